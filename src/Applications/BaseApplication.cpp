@@ -26,6 +26,9 @@
 #include "Applications/Scale4Edge/TestPatternExport/TestPatternsToVcd.hpp"
 #include "Applications/Scale4Edge/TestPatternExport/TestPatternsToStatistics.hpp"
 #include "Applications/Scale4Edge/FaultCompaction/GreedyStaticFaultCompaction.hpp"
+#include "Applications/Scale4Edge/FaultCompaction/GreedyPatternReordering.hpp"
+#include "Applications/Scale4Edge/LowPower/LowPowerPatternProcessing.hpp"
+#include "Applications/Scale4Edge/TestPatternGeneration/EcoRegrading.hpp"
 #include "Applications/Scale4Edge/FaultCompaction/SatStaticFaultCompaction.hpp"
 #include "Applications/Scale4Edge/FaultCoverageExport/FaultCoverageExport.hpp"
 #include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
@@ -128,6 +131,12 @@ unique_ptr<BaseApplication> BaseApplication::Create(std::string application)
 		return std::make_unique<FreiTest::Application::Scale4Edge::GreedyStaticFaultCompaction<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>>();
 	if (application == "SCALE4EDGE_SAT_STATIC_FAULT_COMPACTION_STUCK_AT")
 		return std::make_unique<FreiTest::Application::Scale4Edge::SatStaticFaultCompaction<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>>();
+	if (application == "SCALE4EDGE_GREEDY_PATTERN_REORDERING_STUCK_AT")
+		return std::make_unique<FreiTest::Application::Scale4Edge::GreedyPatternReordering<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>>();
+	if (application == "SCALE4EDGE_LOW_POWER_PATTERN_PROCESSING_STUCK_AT")
+		return std::make_unique<FreiTest::Application::Scale4Edge::LowPowerPatternProcessing<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>>();
+	if (application == "SCALE4EDGE_ECO_REGRADING_STUCK_AT")
+		return std::make_unique<FreiTest::Application::Scale4Edge::EcoRegrading<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>>();
 	if (application == "SCALE4EDGE_FAULT_COVERAGE_EXPORT_STUCK_AT")
 		return std::make_unique<FreiTest::Application::Scale4Edge::FaultCoverageExport<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>>();
 
@@ -153,6 +162,12 @@ unique_ptr<BaseApplication> BaseApplication::Create(std::string application)
 		return std::make_unique<FreiTest::Application::Scale4Edge::GreedyStaticFaultCompaction<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>>();
 	if (application == "SCALE4EDGE_SAT_STATIC_FAULT_COMPACTION_TRANSITION")
 		return std::make_unique<FreiTest::Application::Scale4Edge::SatStaticFaultCompaction<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>>();
+	if (application == "SCALE4EDGE_GREEDY_PATTERN_REORDERING_TRANSITION")
+		return std::make_unique<FreiTest::Application::Scale4Edge::GreedyPatternReordering<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>>();
+	if (application == "SCALE4EDGE_LOW_POWER_PATTERN_PROCESSING_TRANSITION")
+		return std::make_unique<FreiTest::Application::Scale4Edge::LowPowerPatternProcessing<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>>();
+	if (application == "SCALE4EDGE_ECO_REGRADING_TRANSITION")
+		return std::make_unique<FreiTest::Application::Scale4Edge::EcoRegrading<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>>();
 	if (application == "SCALE4EDGE_FAULT_COVERAGE_EXPORT_TRANSITION")
 		return std::make_unique<FreiTest::Application::Scale4Edge::FaultCoverageExport<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>>();
 
@@ -178,6 +193,12 @@ unique_ptr<BaseApplication> BaseApplication::Create(std::string application)
 		return std::make_unique<FreiTest::Application::Scale4Edge::GreedyStaticFaultCompaction<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>>();
 	if (application == "SCALE4EDGE_SAT_STATIC_FAULT_COMPACTION_CELL_AWARE")
 		return std::make_unique<FreiTest::Application::Scale4Edge::SatStaticFaultCompaction<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>>();
+	if (application == "SCALE4EDGE_GREEDY_PATTERN_REORDERING_CELL_AWARE")
+		return std::make_unique<FreiTest::Application::Scale4Edge::GreedyPatternReordering<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>>();
+	if (application == "SCALE4EDGE_LOW_POWER_PATTERN_PROCESSING_CELL_AWARE")
+		return std::make_unique<FreiTest::Application::Scale4Edge::LowPowerPatternProcessing<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>>();
+	if (application == "SCALE4EDGE_ECO_REGRADING_CELL_AWARE")
+		return std::make_unique<FreiTest::Application::Scale4Edge::EcoRegrading<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>>();
 	if (application == "SCALE4EDGE_FAULT_COVERAGE_EXPORT_CELL_AWARE")
 		return std::make_unique<FreiTest::Application::Scale4Edge::FaultCoverageExport<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>>();
 
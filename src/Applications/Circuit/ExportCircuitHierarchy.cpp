@@ -46,7 +46,7 @@ bool ExportCircuitHierarchy::SetSetting(std::string key, std::string value)
 void ExportCircuitHierarchy::Run(void)
 {
 	FileHandle handle("[DataExportDirectory]/hierarchy.txt", false);
-	std::ofstream& output = handle.GetOutStream();
+	std::ostream& output = handle.GetOutStream();
 
 	auto metaData = this->circuit->GetMetaData();
 	ExportHierarchy(0u, metaData.GetRoot(), output);
@@ -148,7 +148,7 @@ void ExportCircuitHierarchy::ExportHierarchy(size_t level, const Circuit::GroupM
 			out << std::string(level + 3u, '\t') << "ID: " << unmappedNode->GetInputPinData(input)->PinSort << std::endl;
 			out << std::string(level + 3u, '\t') << "Signal: "
 				<< ((unmappedNode->GetInputPinData(input)->PinWireId != Circuit::MappedCircuit::NO_CONNECTION)
-					? unmappedNode->GetInputPinData(input)->PinWireName : "None")
+					? unmappedNode->GetInputPinData(input)->PinWireName.Get() : "None")
 				<< std::endl;
 			out << std::string(level + 3u, '\t') << "Connection: "
 				<< ((unmappedNode->GetInputPinData(input)->PinWireId != Circuit::MappedCircuit::NO_CONNECTION)
@@ -162,7 +162,7 @@ void ExportCircuitHierarchy::ExportHierarchy(size_t level, const Circuit::GroupM
 			out << std::string(level + 3u, '\t') << "ID: " << unmappedNode->GetOutputPinData(output)->PinSort << std::endl;
 			out << std::string(level + 3u, '\t') << "Signal: "
 				<< ((unmappedNode->GetOutputPinData(output)->PinWireId != Circuit::UnmappedCircuit::NO_CONNECTION)
-					? unmappedNode->GetOutputPinData(output)->PinWireName : "None")
+					? unmappedNode->GetOutputPinData(output)->PinWireName.Get() : "None")
 				<< std::endl;
 			out << std::string(level + 3u, '\t') << "Connection: "
 				<< ((unmappedNode->GetOutputPinData(output)->PinWireId != Circuit::UnmappedCircuit::NO_CONNECTION)
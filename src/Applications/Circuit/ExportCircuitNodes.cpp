@@ -224,7 +224,7 @@ void ExportCircuitNodes::Run(void)
 	// ------------------------------------------------------------------------
 
 	FileHandle handle("[DataExportDirectory]/nodes.txt", false);
-	std::ofstream& output = handle.GetOutStream();
+	std::ostream& output = handle.GetOutStream();
 
 	// Print header
 	for (size_t column = 0u; column < columnHeaders.size(); ++column)
@@ -49,7 +49,7 @@ void ExportCircuitPorts::Run(void)
 	// ------------------------------------------------------------------------
 
 	FileHandle handleTxt("[DataExportDirectory]/ports.txt", false);
-	std::ofstream& outputTxt = handleTxt.GetOutStream();
+	std::ostream& outputTxt = handleTxt.GetOutStream();
 
 	outputTxt << "Name: " << this->circuit->GetName() << std::endl;
 	outputTxt << std::endl;
@@ -88,7 +88,7 @@ void ExportCircuitPorts::Run(void)
 
 	{
 		FileHandle handleTxt("[DataExportDirectory]/primary-inputs.txt", false);
-		std::ofstream& primaryInputs = handleTxt.GetOutStream();
+		std::ostream& primaryInputs = handleTxt.GetOutStream();
 		for (auto [inputIndex, inputNode] : mappedCircuit.EnumeratePrimaryInputs())
 		{
 			auto name { metaData.GetFriendlyName({ inputNode, { Circuit::PortType::Output, 0u } }) };
@@ -99,7 +99,7 @@ void ExportCircuitPorts::Run(void)
 
 	{
 		FileHandle handleTxt("[DataExportDirectory]/primary-outputs.txt", false);
-		std::ofstream& primaryOutputs = handleTxt.GetOutStream();
+		std::ostream& primaryOutputs = handleTxt.GetOutStream();
 		for (auto [outputIndex, outputNode] : mappedCircuit.EnumeratePrimaryOutputs())
 		{
 			auto name { metaData.GetFriendlyName({ outputNode, { Circuit::PortType::Input, 0u } }) };
@@ -110,7 +110,7 @@ void ExportCircuitPorts::Run(void)
 
 	{
 		FileHandle handleTxt("[DataExportDirectory]/secondary-inputs.txt", false);
-		std::ofstream& secondaryInputs = handleTxt.GetOutStream();
+		std::ostream& secondaryInputs = handleTxt.GetOutStream();
 		for (auto [inputIndex, inputNode] : mappedCircuit.EnumerateSecondaryInputs())
 		{
 			auto name { metaData.GetFriendlyName({ inputNode->GetSuccessor(0u), { Circuit::PortType::Output, 0u } }) };
@@ -121,7 +121,7 @@ void ExportCircuitPorts::Run(void)
 
 	{
 		FileHandle handleTxt("[DataExportDirectory]/secondary-outputs.txt", false);
-		std::ofstream& secondaryOutputs = handleTxt.GetOutStream();
+		std::ostream& secondaryOutputs = handleTxt.GetOutStream();
 		for (auto [outputIndex, outputNode] : mappedCircuit.EnumerateSecondaryOutputs())
 		{
 			auto name { metaData.GetFriendlyName({ outputNode, { Circuit::PortType::Input, 0u } }) };
@@ -135,7 +135,7 @@ void ExportCircuitPorts::Run(void)
 	// ------------------------------------------------------------------------
 
 	FileHandle handleJson("[DataExportDirectory]/ports.json", false);
-	std::ofstream& outputJson = handleJson.GetOutStream();
+	std::ostream& outputJson = handleJson.GetOutStream();
 
 	try
 	{
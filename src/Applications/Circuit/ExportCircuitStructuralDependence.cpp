@@ -47,10 +47,10 @@ void ExportCircuitStructuralDependence::Run(void)
 	auto const& mappedCircuit { this->circuit->GetMappedCircuit() };
 
 	FileHandle in2outHandle("[DataExportDirectory]/inputs2outputs.txt", false);
-	std::ofstream& inputs2outputs = in2outHandle.GetOutStream();
+	std::ostream& inputs2outputs = in2outHandle.GetOutStream();
 
 	FileHandle out2inHandle("[DataExportDirectory]/outputs2inputs.txt", false);
-	std::ofstream& outputs2inputs = out2inHandle.GetOutStream();
+	std::ostream& outputs2inputs = out2inHandle.GetOutStream();
 
 	std::shared_ptr<SolverProxy::ISolverProxy> nullProxy;
 	Tpg::GeneratorContext<Tpg::PinDataG<Tpg::LogicContainer01>> context { nullProxy, this->circuit };
@@ -40,7 +40,7 @@ bool ExportCircuitVerilog::SetSetting(std::string key, std::string value)
 void ExportCircuitVerilog::Run(void)
 {
 	FileHandle handleVerilog("[DataExportDirectory]/circuit.v", false);
-	std::ofstream& outputVerilog = handleVerilog.GetOutStream();
+	std::ostream& outputVerilog = handleVerilog.GetOutStream();
 
 	Io::CircuitVerilogExporter exporter;
 	exporter.ExportCircuit(*this->circuit, outputVerilog);
@@ -1,5 +1,6 @@
 #include "Applications/Mixins/Statistics/FaultStatisticsMixin.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <string>
 #include <type_traits>
@@ -110,8 +111,35 @@ void FaultStatisticsMixin<FaultList>::SetFaultStatus(FaultList& faultList, size_
 {
 	auto [fault, metaData] = faultList[faultIndex];
 
-	// Undo old status
-	switch (metaData->faultStatus)
+	const auto oldStatus = metaData->ExchangeStatus(status, targetedStatus);
+	RemoveFaultStatusCount(oldStatus.status, oldStatus.targetedStatus);
+	AddFaultStatusCount(status, targetedStatus);
+}
+
+template<typename FaultList>
+bool FaultStatisticsMixin<FaultList>::TrySetFaultStatus(FaultList& faultList, size_t faultIndex, Fault::FaultStatus expectedStatus, Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus)
+{
+	auto [fault, metaData] = faultList[faultIndex];
+
+	// Only the thread that wins the compare-and-swap applies the transition.
+	// Both status values are swapped together, which keeps them consistent
+	// when a transition that keeps the fault status (e.g. an aborted fault)
+	// races with a transition to another fault status (e.g. a detection).
+	const auto oldStatus = metaData->CompareExchangeStatus(expectedStatus, status, targetedStatus);
+	if (!oldStatus)
+	{
+		return false;
+	}
+
+	RemoveFaultStatusCount(oldStatus->status, oldStatus->targetedStatus);
+	AddFaultStatusCount(status, targetedStatus);
+	return true;
+}
+
+template<typename FaultList>
+void FaultStatisticsMixin<FaultList>::RemoveFaultStatusCount(Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus)
+{
+	switch (status)
 	{
 		case Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED:
 			faultsUnclassified--;
@@ -127,7 +155,7 @@ void FaultStatisticsMixin<FaultList>::SetFaultStatus(FaultList& faultList, size_
 		default:
 			Logging::Panic();
 	}
-	switch (metaData->targetedFaultStatus)
+	switch (targetedStatus)
 	{
 		case Fault::TargetedFaultStatus::FAULT_STATUS_UNCLASSIFIED:
 		case Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE:
@@ -162,8 +190,11 @@ void FaultStatisticsMixin<FaultList>::SetFaultStatus(FaultList& faultList, size_
 			faultsAborted--;
 			break;
 	}
+}
 
-	// Do new status
+template<typename FaultList>
+void FaultStatisticsMixin<FaultList>::AddFaultStatusCount(Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus)
+{
 	switch (status)
 	{
 		case Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED:
@@ -217,10 +248,6 @@ void FaultStatisticsMixin<FaultList>::SetFaultStatus(FaultList& faultList, size_
 		default:
 			Logging::Panic();
 	}
-
-	// Apply new status
-	metaData->faultStatus = status;
-	metaData->targetedFaultStatus = targetedStatus;
 }
 
 template<typename FaultList>
@@ -243,7 +270,7 @@ void FaultStatisticsMixin<FaultList>::ExportStatistics(const FaultList& faultLis
 	size_t faultIndex = 0u;
 	for (const auto [fault, metaData] : faultList)
 	{
-		switch (metaData->faultStatus)
+		switch (metaData->GetFaultStatus())
 		{
 			case Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED:
 			case Fault::FaultStatus::FAULT_STATUS_EXTENDED:
@@ -258,7 +285,8 @@ void FaultStatisticsMixin<FaultList>::ExportStatistics(const FaultList& faultLis
 				faultsDetected++;
 				if (printStatisticResults == PrintFaultStatisticReport::PrintDetail)
 				{
-					LOG(INFO) << "Fault " << faultIndex << " (" << to_string(*fault) << ") is detected by test pattern " << metaData->detectingPatternId
+					const size_t detectingPatternId { metaData->detectingPatternId.load(std::memory_order_acquire) };
+					LOG(INFO) << "Fault " << faultIndex << " (" << to_string(*fault) << ") is detected by test pattern " << detectingPatternId
 						<< " at port " << metaData->detectingNode.node->GetName() << " in timeframe " << metaData->detectingTimeframe
 						<< " with good / bad difference of " << metaData->detectingOutputGood << "/" << metaData->detectingOutputBad << "!";
 				}
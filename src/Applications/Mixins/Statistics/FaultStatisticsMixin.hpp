@@ -35,9 +35,13 @@ public:
 	void SnapshotStatisticsForIteration(void);
 	void PrintStatistics(std::string additionalInfo);
 	void SetFaultStatus(FaultList& faultList, size_t faultIndex, Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus);
+	bool TrySetFaultStatus(FaultList& faultList, size_t faultIndex, Fault::FaultStatus expectedStatus, Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus);
 	void ExportStatistics(const FaultList& faultList);
 
 private:
+	void RemoveFaultStatusCount(Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus);
+	void AddFaultStatusCount(Fault::FaultStatus status, Fault::TargetedFaultStatus targetedStatus);
+
 	Statistic::AverageStatistic statFaultsUnclassified;
 	Statistic::AverageStatistic statFaultsDetected;
 	Statistic::AverageStatistic statFaultsTimeout;
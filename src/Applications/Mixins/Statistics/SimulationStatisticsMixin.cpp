@@ -21,6 +21,16 @@ SimulationStatisticsMixin::SimulationStatisticsMixin(std::string configPrefix):
 	eventDrivenSimulationTime(),
 	eventDrivenSimulationIncrementalTime(),
 	faultsCoveredBySimulationStat()
+#endif
+	,
+	totalSimulationTimeLocal(totalSimulationTime)
+#ifndef NDEBUG
+	,
+	simulateForFaultTimeLocal(simulateForFaultTime),
+	initialFaultFreeSimulationTimeLocal(initialFaultFreeSimulationTime),
+	eventDrivenSimulationTimeLocal(eventDrivenSimulationTime),
+	eventDrivenSimulationIncrementalTimeLocal(eventDrivenSimulationIncrementalTime),
+	faultsCoveredBySimulationStatLocal(faultsCoveredBySimulationStat)
 #endif
 {
 	totalSimulationTime.SetCollectValues(true);
@@ -36,8 +46,23 @@ SimulationStatisticsMixin::SimulationStatisticsMixin(std::string configPrefix):
 
 SimulationStatisticsMixin::~SimulationStatisticsMixin(void) = default;
 
+void SimulationStatisticsMixin::MergeStatistics(void)
+{
+	totalSimulationTimeLocal.Merge();
+
+#ifndef NDEBUG
+	simulateForFaultTimeLocal.Merge();
+	initialFaultFreeSimulationTimeLocal.Merge();
+	eventDrivenSimulationTimeLocal.Merge();
+	eventDrivenSimulationIncrementalTimeLocal.Merge();
+	faultsCoveredBySimulationStatLocal.Merge();
+#endif
+}
+
 void SimulationStatisticsMixin::ExportStatistics(void)
 {
+	MergeStatistics();
+
 #ifndef NDEBUG
 	statistics.Add("Atpg.Simulation.Total.Runs", totalSimulationTime.GetCount(), "Time(s)", "The number of calls to RunFaultSimulation() for test pattern");
 	statistics.Add("Atpg.Simulation.Total.Time.Sum", totalSimulationTime.GetSum(), "Second(s)", "The total runtime of the RunFaultSimulation() call");
@@ -6,6 +6,7 @@
 
 #include "Applications/Mixins/Statistics/StatisticsMixin.hpp"
 #include "Basic/Statistic/AverageStatistic.hpp"
+#include "Basic/Statistic/ThreadLocalStatistic.hpp"
 
 namespace FreiTest
 {
@@ -21,6 +22,7 @@ public:
 	SimulationStatisticsMixin(std::string configPrefix);
 	virtual ~SimulationStatisticsMixin(void);
 
+	void MergeStatistics(void);
 	void ExportStatistics(void);
 
 protected:
@@ -34,6 +36,20 @@ protected:
 
 	Statistic::AverageStatistic faultsCoveredBySimulationStat;
 #endif
+
+	// Per-thread accumulators for the statistics above which are filled
+	// inside of the parallel fault simulation without locking.
+	// They are merged by MergeStatistics.
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> totalSimulationTimeLocal;
+
+#ifndef NDEBUG
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> simulateForFaultTimeLocal;
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> initialFaultFreeSimulationTimeLocal;
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> eventDrivenSimulationTimeLocal;
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> eventDrivenSimulationIncrementalTimeLocal;
+
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> faultsCoveredBySimulationStatLocal;
+#endif
 };
 
 };
@@ -13,7 +13,10 @@ SolverStatisticsMixin::SolverStatisticsMixin(std::string configPrefix):
 	StatisticsMixin(configPrefix),
 	timeTseitin(),
 	timeSolver(),
-	tseitinClauses()
+	tseitinClauses(),
+	timeTseitinLocal(timeTseitin),
+	timeSolverLocal(timeSolver),
+	tseitinClausesLocal(tseitinClauses)
 {
 	timeTseitin.SetCollectValues(true);
 	timeSolver.SetCollectValues(true);
@@ -22,8 +25,17 @@ SolverStatisticsMixin::SolverStatisticsMixin(std::string configPrefix):
 
 SolverStatisticsMixin::~SolverStatisticsMixin(void) = default;
 
+void SolverStatisticsMixin::MergeStatistics(void)
+{
+	timeTseitinLocal.Merge();
+	timeSolverLocal.Merge();
+	tseitinClausesLocal.Merge();
+}
+
 void SolverStatisticsMixin::ExportStatistics(void)
 {
+	MergeStatistics();
+
 	statistics.Add("Atpg.Tseitin.Runs", timeTseitin.GetCount(), "Time(s)", "The number of calls to GenerateCircuitLogic() on the Logic Generator");
 	statistics.Add("Atpg.Tseitin.Time.Sum", timeTseitin.GetSum(), "Second(s)", "The total runtime of the Logic Generator");
 	statistics.Add("Atpg.Tseitin.Time.Average", timeTseitin.GetAverageValue(), "Second(s)", "The average runtime of the Logic Generator");
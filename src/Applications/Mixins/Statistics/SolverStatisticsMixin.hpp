@@ -2,6 +2,7 @@
 
 #include "Applications/Mixins/Statistics/StatisticsMixin.hpp"
 #include "Basic/Statistic/AverageStatistic.hpp"
+#include "Basic/Statistic/ThreadLocalStatistic.hpp"
 
 namespace FreiTest
 {
@@ -18,12 +19,20 @@ public:
 	virtual ~SolverStatisticsMixin(void);
 
 protected:
+	void MergeStatistics(void);
 	void ExportStatistics(void);
 
 	Statistic::AverageStatistic timeTseitin;
 	Statistic::AverageStatistic timeSolver;
 	Statistic::AverageStatistic tseitinClauses;
 
+	// Per-thread accumulators for the statistics above which are filled
+	// inside of the parallel pattern generation without locking.
+	// They are merged by MergeStatistics.
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> timeTseitinLocal;
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> timeSolverLocal;
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> tseitinClausesLocal;
+
 };
 
 };
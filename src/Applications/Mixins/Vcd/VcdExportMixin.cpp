@@ -32,7 +32,7 @@ namespace Mixin
 template<typename FaultList>
 VcdExportMixin<FaultList>::VcdExportMixin(std::string configPrefix):
 	exportId(0u),
-	vcdModelBuilder(),
+	vcdWriter(),
 	vcdExport(VcdExport::Disabled),
 	vcdExportDirectory("[DataExportDirectory]/vcds"),
 	vcdExportSamples(0u),
@@ -47,7 +47,7 @@ VcdExportMixin<FaultList>::~VcdExportMixin(void) = default;
 template<typename FaultList>
 void VcdExportMixin<FaultList>::Init(void)
 {
-	vcdModelBuilder.Initialize(*this->circuit);
+	vcdWriter.Initialize(*this->circuit);
 }
 
 template<typename FaultList>
@@ -74,7 +74,7 @@ void VcdExportMixin<FaultList>::PostRunVcd(const FaultList& faultList)
 	for (size_t index = 0u; index < faultList.size(); ++index)
 	{
 		auto [fault, metaData] = faultList[index];
-		faultCoverage[index] = (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED);
+		faultCoverage[index] = (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED);
 	}
 	ExportVcdForFaultCoverage(faultList, faultCoverage);
 }
@@ -122,7 +122,7 @@ void VcdExportMixin<FaultList>::ExportCircuitForVisualisation(void) const
 
 	// Copy settings and modify for VCM
 	FileHandle handle(vcdExportCircuitPath, false);
-	std::ofstream& verilogCircuitStream = handle.GetOutStream();
+	std::ostream& verilogCircuitStream = handle.GetOutStream();
 
 	Io::CircuitVerilogExporter exporter;
 	exporter.ExportCircuit(*this->circuit, verilogCircuitStream);
@@ -137,8 +137,7 @@ void VcdExportMixin<FaultList>::ExportVcdForGoodSimulation(const PatternInfo& pa
 	}
 
 	VcdInfo info { GetGoodSimulationVcdInfo(*this->circuit, pattern) };
-	auto modelGood { vcdModelBuilder.BuildVcdModel(goodResult, *this->circuit, info.header) };
-	Io::Vcd::ExportVcd(modelGood, vcdExportDirectory + "/" + info.fileName);
+	vcdWriter.ExportVcd(goodResult, vcdExportDirectory + "/" + info.fileName, info.header);
 }
 
 template<typename FaultList>
@@ -154,8 +153,7 @@ void VcdExportMixin<FaultList>::ExportVcdForBadSimulation(const FaultList& fault
 	}
 
 	VcdInfo info { GetBadSimulationVcdInfo(*this->circuit, pattern, faultInfo) };
-	auto modelBad { vcdModelBuilder.BuildVcdModel(badResult, *this->circuit, info.header) };
-	Io::Vcd::ExportVcd(modelBad, vcdExportDirectory + "/" + info.fileName);
+	vcdWriter.ExportVcd(badResult, vcdExportDirectory + "/" + info.fileName, info.header);
 }
 
 template<typename FaultList>
@@ -202,8 +200,7 @@ void VcdExportMixin<FaultList>::ExportVcdForFaultCoverage(const FaultList& fault
 	}
 
 	VcdInfo info { GetFaultCoverageVcdInfo(*this->circuit) };
-	auto modelCoverage { vcdModelBuilder.BuildVcdModel(faultCoverage, *this->circuit, info.header) };
-	Io::Vcd::ExportVcd(modelCoverage, vcdExportDirectory + "/" + info.fileName);
+	vcdWriter.ExportVcd(faultCoverage, vcdExportDirectory + "/" + info.fileName, info.header);
 }
 
 template<typename FaultList>
@@ -249,8 +246,7 @@ void VcdExportMixin<FaultList>::ExportVcdForPatternFaultCoverage(const FaultList
 	}
 
 	VcdInfo info { GetPatternFaultCoverageVcdInfo(*this->circuit, pattern) };
-	auto modelCoverage { vcdModelBuilder.BuildVcdModel(faultCoverage, *this->circuit, info.header) };
-	Io::Vcd::ExportVcd(modelCoverage, vcdExportDirectory + "/" + info.fileName);
+	vcdWriter.ExportVcd(faultCoverage, vcdExportDirectory + "/" + info.fileName, info.header);
 }
 
 template<typename FaultList>
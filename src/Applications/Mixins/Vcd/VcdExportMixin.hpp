@@ -4,7 +4,7 @@
 #include "Basic/Pattern/TestPattern.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Io/VcdExporter/VcdExporter.hpp"
-#include "Io/VcdExporter/VcdModelBuilder.hpp"
+#include "Io/VcdExporter/VcdStreamWriter.hpp"
 
 #include <atomic>
 #include <string>
@@ -65,7 +65,7 @@ protected:
 	VcdInfo GetBadSimulationVcdInfo(const Circuit::CircuitEnvironment& circuitEnvironment, const PatternInfo& pattern, const FaultInfo& faultInfo) const;
 
 	mutable std::atomic<size_t> exportId;
-	Io::Vcd::VcdModelBuilder vcdModelBuilder;
+	Io::Vcd::VcdStreamWriter vcdWriter;
 
 	VcdExport vcdExport;
 	std::string vcdExportDirectory;
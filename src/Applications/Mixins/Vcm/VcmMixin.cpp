@@ -280,6 +280,8 @@ void Mixin::VcmMixin::LoadVcmCircuit(void)
 	vcmSettings->VerilogExportPreprocessedFilename = vcmExportPreprocessedFilename;
 	vcmSettings->VerilogExportProcessedFilename = vcmExportProcessedFilename;
 	vcmSettings->TopLevelModuleName = vcmTopLevelModuleName;
+	// The snapshot of the main circuit must not be used for the VCM
+	vcmSettings->CircuitSnapshotFilename = "";
 
 	Io::Verilog::VerilogConverter verilogConverter;
 	vcmCircuit = verilogConverter.LoadCircuit(vcmSettings);
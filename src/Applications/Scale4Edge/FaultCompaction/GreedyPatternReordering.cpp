@@ -0,0 +1,371 @@
+#include "Applications/Scale4Edge/FaultCompaction/GreedyPatternReordering.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Pattern/Capture.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Circuit/MappedCircuit.hpp"
+#include "Helper/FileHandle.hpp"
+#include "Io/FaultListParser/FaultListParser.hpp"
+#include "Io/TestPatternParser/TestPatternParser.hpp"
+#include "Io/UserDefinedFaultModel/UdfmModel.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/FaultSimulator.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+PatternReorderingData<Fault::SingleStuckAtFaultModel>::PatternReorderingData(std::string configPrefix)
+{
+}
+PatternReorderingData<Fault::SingleStuckAtFaultModel>::~PatternReorderingData(void) = default;
+
+bool PatternReorderingData<Fault::SingleStuckAtFaultModel>::SetSetting(std::string key, std::string value)
+{
+	return false;
+}
+
+void PatternReorderingData<Fault::SingleStuckAtFaultModel>::Init(void)
+{
+}
+
+void PatternReorderingData<Fault::SingleStuckAtFaultModel>::Run(void)
+{
+}
+
+PatternReorderingData<Fault::SingleTransitionDelayFaultModel>::PatternReorderingData(std::string configPrefix)
+{
+}
+PatternReorderingData<Fault::SingleTransitionDelayFaultModel>::~PatternReorderingData(void) = default;
+
+bool PatternReorderingData<Fault::SingleTransitionDelayFaultModel>::SetSetting(std::string key, std::string value)
+{
+	return false;
+}
+
+void PatternReorderingData<Fault::SingleTransitionDelayFaultModel>::Init(void)
+{
+}
+
+void PatternReorderingData<Fault::SingleTransitionDelayFaultModel>::Run(void)
+{
+}
+
+PatternReorderingData<Fault::CellAwareFaultModel>::PatternReorderingData(std::string configPrefix):
+	Mixin::UdfmMixin(configPrefix)
+{
+}
+PatternReorderingData<Fault::CellAwareFaultModel>::~PatternReorderingData(void) = default;
+
+bool PatternReorderingData<Fault::CellAwareFaultModel>::SetSetting(std::string key, std::string value)
+{
+	return UdfmMixin::SetSetting(key, value);
+}
+
+void PatternReorderingData<Fault::CellAwareFaultModel>::Init(void)
+{
+	UdfmMixin::Init();
+}
+
+void PatternReorderingData<Fault::CellAwareFaultModel>::Run(void)
+{
+	UdfmMixin::Run();
+}
+
+template <typename FaultModel, typename FaultList>
+GreedyPatternReordering<FaultModel, FaultList>::GreedyPatternReordering(void):
+	BaseApplication(),
+	PatternReorderingData<FaultModel>("Scale4Edge/PatternReordering"),
+	_categoryWeightFile(),
+	_coverageCurveFile("[DataExportDirectory]/coverage_curve.csv")
+{
+}
+
+template <typename FaultModel, typename FaultList>
+GreedyPatternReordering<FaultModel, FaultList>::~GreedyPatternReordering(void) = default;
+
+template <typename FaultModel, typename FaultList>
+bool GreedyPatternReordering<FaultModel, FaultList>::SetSetting(std::string key, std::string value)
+{
+	if (key == "Scale4Edge/PatternReordering/CategoryWeightFile")
+	{
+		_categoryWeightFile = value;
+		return true;
+	}
+	if (key == "Scale4Edge/PatternReordering/CoverageCurveFile")
+	{
+		_coverageCurveFile = value;
+		return true;
+	}
+
+	return PatternReorderingData<FaultModel>::SetSetting(key, value);
+}
+
+template <typename FaultModel, typename FaultList>
+void GreedyPatternReordering<FaultModel, FaultList>::Init(void)
+{
+	PatternReorderingData<FaultModel>::Init();
+}
+
+template <typename FaultModel, typename FaultList>
+void GreedyPatternReordering<FaultModel, FaultList>::Run(void)
+{
+	PatternReorderingData<FaultModel>::Run();
+
+	FileHandle importPatternHandle("[DataImportDirectory]/patterns.[DataExchangeExtension]", true);
+	auto patternResult = Io::ImportPatterns(importPatternHandle.GetStream(), *this->circuit);
+	if (!patternResult) LOG(FATAL) << "Test patterns could not be read";
+
+	FileHandle importMetaDataHandle("[DataImportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), true);
+	auto faultResult = [&]() -> std::optional<Io::FaultListExchangeFormat<FaultList>> {
+		if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>
+			|| std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
+		{
+			return Io::ImportFaults<FaultList>(importMetaDataHandle.GetStream(), *this->circuit);
+		}
+		else if constexpr (std::is_same_v<FaultModel, Fault::CellAwareFaultModel>)
+		{
+			ASSERT(this->GetUdfm()) << "No User-Defined Fault Model (UDFM) was loaded";
+			return Io::ImportFaults<FaultList>(importMetaDataHandle.GetStream(), *this->circuit, *this->GetUdfm());
+		}
+		else
+		{
+			Logging::Panic("Unknown fault model");
+		}
+	}();
+	if (!faultResult) LOG(FATAL) << "Fault data could not be read";
+
+	const Circuit::MappedCircuit& circuit { this->circuit->GetMappedCircuit() };
+	const auto& importedPatterns { patternResult->GetTestPatterns() };
+	const auto& faultList { faultResult->GetFaults() };
+	const Pattern::OutputCapture outputCapture { Pattern::GetOutputCapture(patternResult->GetInputCapture()) };
+	const Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
+	LOG(INFO) << "Imported " << importedPatterns.size() << " patterns and " << faultList.size() << " faults";
+
+	// Only faults that are detected by the imported patterns contribute to the coverage.
+	std::vector<bool> simulatedFaults(faultList.size(), false);
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = faultList[faultIndex];
+		simulatedFaults[faultIndex] = (metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED);
+	}
+
+	// The complete detections of each pattern are required as the marginal coverage
+	// depends on the patterns that have been selected before.
+	std::vector<std::vector<Fault::FaultCoverageMatrix::index_type>> patternDetections(importedPatterns.size());
+	Parallel::ExecuteParallel(0u, importedPatterns.size(), Parallel::Arena::FaultSimulation, Parallel::Order::Parallel, [&](size_t patternIndex) {
+		const auto detections { Simulation::SimulateFaults<FaultModel>(circuit, *importedPatterns[patternIndex], faultList, outputCapture, simConfig,
+			[&](size_t faultIndex) { return simulatedFaults[faultIndex]; }) };
+		patternDetections[patternIndex].assign(detections.begin(), detections.end());
+	});
+	const Fault::FaultCoverageMatrix coverage { faultList.size(), std::move(patternDetections) };
+	LOG(INFO) << "The coverage matrix contains " << coverage.GetNumberOfDetections() << " detections";
+
+	const auto faultWeights { GetFaultWeights(faultList) };
+	const auto order { Fault::OrderByMarginalCoverage(coverage, faultWeights) };
+
+	// The detecting pattern of each fault is the first pattern in the new order that detects it
+	std::vector<size_t> position(order.size());
+	for (size_t index { 0u }; index < order.size(); ++index)
+	{
+		position[order[index]] = index;
+	}
+	size_t undetectedFaults { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = faultList[faultIndex];
+		if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		{
+			continue;
+		}
+
+		size_t detectingPattern { std::numeric_limits<size_t>::max() };
+		for (const auto patternIndex : coverage.GetDetectingPatterns(faultIndex))
+		{
+			detectingPattern = std::min<size_t>(detectingPattern, position[patternIndex]);
+		}
+		undetectedFaults += (detectingPattern == std::numeric_limits<size_t>::max()) ? 1u : 0u;
+		metadata->detectingPatternId = detectingPattern;
+	}
+	LOG_IF(undetectedFaults > 0u, WARNING) << undetectedFaults << " faults are marked as detected, but are not detected by a test pattern";
+
+	Pattern::TestPatternList exportedPatterns;
+	for (const auto patternIndex : order)
+	{
+		exportedPatterns.emplace_back(*importedPatterns[patternIndex]);
+	}
+
+	ExportCoverageCurve(coverage, order, faultWeights);
+
+	FileHandle exportPatternHandle("[DataExportDirectory]/patterns.[DataExchangeExtension]", false);
+	Io::ExportPatterns(exportPatternHandle.GetOutStream(), { *this->circuit, exportedPatterns, patternResult->GetInputCapture() }, Settings::GetInstance()->DataExchangeFormat);
+
+	FileHandle exportMetaDataHandle("[DataExportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), false);
+	Io::FaultListExchangeFormat<FaultList> faultData { *this->circuit, faultList };
+	Io::ExportFaults(exportMetaDataHandle.GetOutStream(), faultData, Settings::GetInstance()->DataExchangeFormat);
+}
+
+template <typename FaultModel, typename FaultList>
+std::vector<double> GreedyPatternReordering<FaultModel, FaultList>::GetFaultWeights(const FaultList& faultList) const
+{
+	if (_categoryWeightFile.empty())
+	{
+		return { };
+	}
+
+	if constexpr (!std::is_same_v<FaultModel, Fault::CellAwareFaultModel>)
+	{
+		LOG(WARNING) << "Fault category weights are only supported for the cell-aware fault model and are ignored";
+		return { };
+	}
+	else
+	{
+		// Each line of the file has the format "category = weight"
+		std::map<std::string, double> categoryWeights;
+		FileHandle weightFile { _categoryWeightFile, true };
+		auto& weightStream { weightFile.GetStream() };
+		ASSERT(weightStream.good()) << "Could not open the fault category weight file " << _categoryWeightFile;
+
+		std::string line;
+		while (std::getline(weightStream, line))
+		{
+			boost::trim(line);
+			if (line.empty() || line[0u] == '#')
+			{
+				continue;
+			}
+
+			std::vector<std::string> tokenizedLine;
+			boost::split(tokenizedLine, line, boost::is_any_of("="));
+			ASSERT(tokenizedLine.size() == 2u) << "Something is wrong in the format of the file. Should be \"category = weight\"";
+
+			auto category { tokenizedLine[0u] };
+			auto weight { tokenizedLine[1u] };
+			boost::trim(category);
+			boost::trim(weight);
+			try
+			{
+				categoryWeights[category] = std::stod(weight);
+			}
+			catch (const std::exception& exception)
+			{
+				LOG(FATAL) << "The weight \"" << weight << "\" of the fault category " << category << " is not a number";
+			}
+		}
+
+		// Faults of categories that are not listed keep the weight 1
+		std::vector<double> faultWeights(faultList.size(), 1.0);
+		for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+		{
+			auto [fault, metadata] = faultList[faultIndex];
+			const auto& category { fault->GetUserDefinedFault()->GetFaultCategory() };
+			if (auto it = categoryWeights.find(category); it != categoryWeights.end())
+			{
+				faultWeights[faultIndex] = it->second;
+			}
+		}
+
+		LOG(INFO) << "Loaded " << categoryWeights.size() << " fault category weights";
+		return faultWeights;
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+void GreedyPatternReordering<FaultModel, FaultList>::ExportCoverageCurve(const Fault::FaultCoverageMatrix& coverage, const std::vector<size_t>& order, const std::vector<double>& faultWeights) const
+{
+	const auto get_weight = [&](size_t faultIndex) {
+		return faultWeights.empty() ? 1.0 : faultWeights[faultIndex];
+	};
+
+	double totalWeight { 0.0 };
+	for (size_t faultIndex { 0u }; faultIndex < coverage.GetNumberOfFaults(); ++faultIndex)
+	{
+		totalWeight += get_weight(faultIndex);
+	}
+
+	// The average number of applied patterns until a (weighted) fault is detected.
+	// This is the expected test time of a test program that aborts on the first failing pattern.
+	const auto get_average_length = [&](const std::vector<size_t>& patterns) {
+		std::vector<bool> detected(coverage.GetNumberOfFaults(), false);
+		double length { 0.0 };
+		double weight { 0.0 };
+		for (size_t index { 0u }; index < patterns.size(); ++index)
+		{
+			for (const auto faultIndex : coverage.GetDetectedFaults(patterns[index]))
+			{
+				if (!detected[faultIndex])
+				{
+					detected[faultIndex] = true;
+					length += get_weight(faultIndex) * static_cast<double>(index + 1u);
+					weight += get_weight(faultIndex);
+				}
+			}
+		}
+		return (weight > 0.0) ? (length / weight) : 0.0;
+	};
+
+	std::vector<size_t> originalOrder(order.size());
+	std::iota(originalOrder.begin(), originalOrder.end(), 0u);
+	LOG(INFO) << "Average number of patterns until detection: " << get_average_length(originalOrder)
+		<< " (original order), " << get_average_length(order) << " (reordered)";
+
+	FileHandle curveHandle(_coverageCurveFile, false);
+	auto& out { curveHandle.GetOutStream() };
+	if (!out.good())
+	{
+		LOG(ERROR) << "Could not write the coverage curve to " << _coverageCurveFile;
+		return;
+	}
+
+	out << "Pattern;OriginalPattern;NewDetections;Detections;Coverage\n";
+	std::vector<bool> detected(coverage.GetNumberOfFaults(), false);
+	size_t detections { 0u };
+	double detectedWeight { 0.0 };
+	for (size_t index { 0u }; index < order.size(); ++index)
+	{
+		size_t newDetections { 0u };
+		for (const auto faultIndex : coverage.GetDetectedFaults(order[index]))
+		{
+			if (!detected[faultIndex])
+			{
+				detected[faultIndex] = true;
+				detectedWeight += get_weight(faultIndex);
+				newDetections++;
+			}
+		}
+		detections += newDetections;
+
+		const double percentage { (totalWeight > 0.0) ? (100.0 * detectedWeight / totalWeight) : 0.0 };
+		out << index << ";" << order[index] << ";" << newDetections << ";" << detections << ";" << percentage << "\n";
+	}
+}
+
+template class GreedyPatternReordering<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
+template class GreedyPatternReordering<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>;
+template class GreedyPatternReordering<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>;
+
+};
+};
+};
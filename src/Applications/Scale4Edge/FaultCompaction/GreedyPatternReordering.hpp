@@ -0,0 +1,101 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Applications/BaseApplication.hpp"
+#include "Applications/Mixins/Udfm/UdfmMixin.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Basic/Fault/Models/SingleTransitionDelayFaultModel.hpp"
+#include "Basic/Fault/Models/CellAwareFaultModel.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/FaultCoverageMatrix.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+template <typename FaultModel>
+class PatternReorderingData
+{
+};
+
+template<>
+class PatternReorderingData<Fault::SingleStuckAtFaultModel> {
+public:
+	PatternReorderingData(std::string configPrefix);
+	virtual ~PatternReorderingData(void);
+
+	bool SetSetting(std::string key, std::string value);
+	void Init(void);
+	void Run(void);
+
+};
+
+template<>
+class PatternReorderingData<Fault::SingleTransitionDelayFaultModel> {
+public:
+	PatternReorderingData(std::string configPrefix);
+	virtual ~PatternReorderingData(void);
+
+	bool SetSetting(std::string key, std::string value);
+	void Init(void);
+	void Run(void);
+
+};
+
+template<>
+class PatternReorderingData<Fault::CellAwareFaultModel>:
+	public Mixin::UdfmMixin
+{
+public:
+	PatternReorderingData(std::string configPrefix);
+	virtual ~PatternReorderingData(void);
+
+	bool SetSetting(std::string key, std::string value);
+	void Init(void);
+	void Run(void);
+
+};
+
+/**
+ * @brief Reorders test patterns to reach the final fault coverage as early as possible.
+ *
+ * Test programs that abort on the first failing pattern benefit from patterns
+ * that detect many faults being applied first. The patterns are ordered greedily
+ * by the number of faults that they detect additionally to the already selected
+ * patterns. For the cell-aware fault model the faults can be weighted by the
+ * category of the user-defined fault.
+ *
+ * The reordered patterns, the fault list with updated detecting patterns and the
+ * cumulative coverage curve are exported.
+ */
+template<typename FaultModel, typename FaultList>
+class GreedyPatternReordering:
+	public virtual BaseApplication,
+	public PatternReorderingData<FaultModel>
+{
+public:
+	GreedyPatternReordering(void);
+	virtual ~GreedyPatternReordering(void);
+
+	void Init(void) override;
+	void Run(void) override;
+	bool SetSetting(std::string key, std::string value) override;
+
+private:
+	std::vector<double> GetFaultWeights(const FaultList& faultList) const;
+	void ExportCoverageCurve(const Fault::FaultCoverageMatrix& coverage, const std::vector<size_t>& order, const std::vector<double>& faultWeights) const;
+
+	std::string _categoryWeightFile;
+	std::string _coverageCurveFile;
+
+};
+
+};
+};
+};
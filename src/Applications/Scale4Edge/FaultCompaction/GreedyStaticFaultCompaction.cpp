@@ -2,11 +2,14 @@
 
 #include <boost/format.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <vector>
 
 #include "Basic/ApplicationStatistics.hpp"
@@ -22,9 +25,12 @@
 #include "Basic/Fault/Models/CellAwareFaultModel.hpp"
 #include "Basic/Settings.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
+#include "Circuit/MappedCircuit.hpp"
 #include "Helper/FileHandle.hpp"
 #include "Io/FaultListParser/FaultListParser.hpp"
 #include "Io/TestPatternParser/TestPatternParser.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/FaultSimulator.hpp"
 
 namespace FreiTest
 {
@@ -33,6 +39,149 @@ namespace Application
 namespace Scale4Edge
 {
 
+namespace
+{
+
+// Number of positions that are compared before the complete care bits
+constexpr size_t KEY_POSITIONS { 64u };
+// Number of key positions that form the signature of a bucket of merged patterns
+constexpr size_t SIGNATURE_POSITIONS { 16u };
+
+// The specified (0 / 1) inputs of a test pattern as bit vectors.
+// The position of an input is timeframe * (primary + secondary inputs) + input.
+struct CareBits
+{
+	std::vector<uint64_t> ones;
+	std::vector<uint64_t> zeros;
+	uint64_t keyOnes;
+	uint64_t keyZeros;
+};
+
+template<typename Func>
+void ForEachCareBit(const Pattern::TestPattern& pattern, Func function)
+{
+	const size_t primaryInputs { pattern.GetNumberOfPrimaryInputs() };
+	const size_t inputs { primaryInputs + pattern.GetNumberOfSecondaryInputs() };
+	for (size_t timeframe { 0u }; timeframe < pattern.GetNumberOfTimeframes(); ++timeframe)
+	{
+		for (size_t input { 0u }; input < inputs; ++input)
+		{
+			const auto value { (input < primaryInputs)
+				? pattern.GetPrimaryInput(timeframe, input)
+				: pattern.GetSecondaryInput(timeframe, input - primaryInputs) };
+			if (value == Basic::Logic::LOGIC_ZERO || value == Basic::Logic::LOGIC_ONE)
+			{
+				function(timeframe * inputs + input, value == Basic::Logic::LOGIC_ONE);
+			}
+		}
+	}
+}
+
+CareBits GetCareBits(const Pattern::TestPattern& pattern, size_t positions, const std::vector<int>& keyIndices)
+{
+	CareBits careBits { std::vector<uint64_t>((positions + 63u) / 64u, 0u), std::vector<uint64_t>((positions + 63u) / 64u, 0u), 0u, 0u };
+	ForEachCareBit(pattern, [&](size_t position, bool one) {
+		auto& words { one ? careBits.ones : careBits.zeros };
+		words[position / 64u] |= (uint64_t { 1u } << (position % 64u));
+		if (keyIndices[position] >= 0)
+		{
+			(one ? careBits.keyOnes : careBits.keyZeros) |= (uint64_t { 1u } << keyIndices[position]);
+		}
+	});
+	return careBits;
+}
+
+bool AreCareBitsCompatible(const CareBits& lhs, const CareBits& rhs)
+{
+	if ((lhs.keyOnes & rhs.keyZeros) | (lhs.keyZeros & rhs.keyOnes))
+	{
+		return false;
+	}
+
+	for (size_t word { 0u }; word < lhs.ones.size(); ++word)
+	{
+		if ((lhs.ones[word] & rhs.zeros[word]) | (lhs.zeros[word] & rhs.ones[word]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Groups the merged patterns into buckets by the care bits of their most often
+// specified positions. All patterns of a bucket whose signature conflicts with
+// the searched pattern are skipped without comparing their care bits.
+class CareBitIndex
+{
+public:
+	void Insert(size_t index, const CareBits& careBits)
+	{
+		auto& bucket { buckets[GetSignature(careBits)] };
+		bucket.insert(std::lower_bound(bucket.begin(), bucket.end(), index), index);
+	}
+
+	void Remove(size_t index, const CareBits& careBits)
+	{
+		auto it { buckets.find(GetSignature(careBits)) };
+		ASSERT(it != buckets.end()) << "The merged pattern " << index << " is not indexed";
+		auto& bucket { it->second };
+		bucket.erase(std::lower_bound(bucket.begin(), bucket.end(), index));
+		if (bucket.empty())
+		{
+			buckets.erase(it);
+		}
+	}
+
+	// Returns the lowest index of the compatible patterns to keep the first-fit order.
+	std::optional<size_t> FindFirstCompatible(const CareBits& careBits, const std::vector<CareBits>& patterns) const
+	{
+		const uint64_t signature { GetSignature(careBits) };
+		const uint64_t ones { signature >> 32u };
+		const uint64_t zeros { signature & 0xFFFFFFFFu };
+
+		size_t first { std::numeric_limits<size_t>::max() };
+		for (auto const& [bucketSignature, bucket] : buckets)
+		{
+			if (((bucketSignature >> 32u) & zeros) | ((bucketSignature & 0xFFFFFFFFu) & ones))
+			{
+				continue;
+			}
+
+			// The indices of a bucket are sorted in ascending order
+			for (auto const index : bucket)
+			{
+				if (index >= first)
+				{
+					break;
+				}
+				if (AreCareBitsCompatible(careBits, patterns[index]))
+				{
+					first = index;
+					break;
+				}
+			}
+		}
+
+		if (first == std::numeric_limits<size_t>::max())
+		{
+			return std::nullopt;
+		}
+		return first;
+	}
+
+private:
+	static uint64_t GetSignature(const CareBits& careBits)
+	{
+		constexpr uint64_t mask { (uint64_t { 1u } << SIGNATURE_POSITIONS) - 1u };
+		return ((careBits.keyOnes & mask) << 32u) | (careBits.keyZeros & mask);
+	}
+
+	std::map<uint64_t, std::vector<size_t>> buckets;
+
+};
+
+};
+
 GreedyCompactionData<Fault::SingleStuckAtFaultModel>::GreedyCompactionData(std::string configPrefix)
 {
 }
@@ -94,7 +243,9 @@ template <typename FaultModel, typename FaultList>
 GreedyStaticFaultCompaction<FaultModel, FaultList>::GreedyStaticFaultCompaction(void):
 	BaseApplication(),
 	GreedyCompactionData<FaultModel>("Scale4Edge/FaultCompaction"),
-	_compactionOrder(CompactionOrder::CompactAscendingId)
+	_compactionOrder(CompactionOrder::CompactAscendingId),
+	_compactionMethod(CompactionMethod::Merge),
+	_detectionLimit(1u)
 {
 }
 
@@ -111,6 +262,18 @@ bool GreedyStaticFaultCompaction<FaultModel, FaultList>::SetSetting(std::string
 			{ "Descending", CompactionOrder::CompactDescendingId },
 		});
 	}
+	if (key == "Scale4Edge/FaultCompaction/CompactionMethod")
+	{
+		return Settings::ParseEnum(value, _compactionMethod, {
+			{ "Merge", CompactionMethod::Merge },
+			{ "Simulation", CompactionMethod::Simulation },
+			{ "MergeAndSimulation", CompactionMethod::MergeAndSimulation },
+		});
+	}
+	if (key == "Scale4Edge/FaultCompaction/DetectionLimit")
+	{
+		return Settings::ParseSizet(value, _detectionLimit) && _detectionLimit > 0u;
+	}
 
 	return false;
 }
@@ -148,11 +311,11 @@ void GreedyStaticFaultCompaction<FaultModel, FaultList>::Run(void)
 		}
 	};
 
-	FileHandle importPatternHandle("[DataImportDirectory]/patterns.json", true);
+	FileHandle importPatternHandle("[DataImportDirectory]/patterns.[DataExchangeExtension]", true);
 	auto patternResult = Io::ImportPatterns(importPatternHandle.GetStream(), *this->circuit);
 	if (!patternResult) LOG(FATAL) << "Test patterns could not be read";
 
-	FileHandle importMetaDataHandle("[DataImportDirectory]/faults.json", true);
+	FileHandle importMetaDataHandle("[DataImportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), true);
 	auto faultResult = [&]() -> std::optional<Io::FaultListExchangeFormat<FaultList>> {
 		if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>
 			|| std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
@@ -183,7 +346,14 @@ void GreedyStaticFaultCompaction<FaultModel, FaultList>::Run(void)
 	auto const& faultList { faultResult->GetFaults() };
 	std::vector<std::shared_ptr<Pattern::TestPattern>> patternList;
 	copy_pattern_list(importedPatterns, patternList, faultList);
-	CompactPatternList(patternList, faultList);
+	if (_compactionMethod == CompactionMethod::Merge || _compactionMethod == CompactionMethod::MergeAndSimulation)
+	{
+		MergePatternList(patternList, faultList);
+	}
+	if (_compactionMethod == CompactionMethod::Simulation || _compactionMethod == CompactionMethod::MergeAndSimulation)
+	{
+		SimulatePatternList(patternList, faultList, inputCapture);
+	}
 
 	Pattern::TestPatternList exportedPatterns;
 	copy_pattern_list(patternList, exportedPatterns, faultList);
@@ -194,45 +364,177 @@ void GreedyStaticFaultCompaction<FaultModel, FaultList>::Run(void)
 		LOG(INFO) << "Exporting Pattern " << patternIndex << ": " << to_string(*exportedPatterns[patternIndex]);
 	}
 
-	FileHandle exportPatternHandle("[DataExportDirectory]/patterns.json", false);
-	Io::ExportPatterns(exportPatternHandle.GetOutStream(), { *this->circuit, exportedPatterns, inputCapture });
+	FileHandle exportPatternHandle("[DataExportDirectory]/patterns.[DataExchangeExtension]", false);
+	Io::ExportPatterns(exportPatternHandle.GetOutStream(), { *this->circuit, exportedPatterns, inputCapture }, Settings::GetInstance()->DataExchangeFormat);
 
-	FileHandle exportMetaDataHandle("[DataExportDirectory]/faults.json", false);
+	FileHandle exportMetaDataHandle("[DataExportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), false);
 	Io::FaultListExchangeFormat<FaultList> faultData { *this->circuit, faultList };
-	Io::ExportFaults(exportMetaDataHandle.GetOutStream(), faultData);
+	Io::ExportFaults(exportMetaDataHandle.GetOutStream(), faultData, Settings::GetInstance()->DataExchangeFormat);
 }
 
 template <typename FaultModel, typename FaultList>
-void GreedyStaticFaultCompaction<FaultModel, FaultList>::CompactPatternList(std::vector<std::shared_ptr<Pattern::TestPattern>>& patternList, const FaultList& faultList)
+void GreedyStaticFaultCompaction<FaultModel, FaultList>::MergePatternList(std::vector<std::shared_ptr<Pattern::TestPattern>>& patternList, const FaultList& faultList)
 {
-	for (size_t i = 0; i < patternList.size()-1; i++)
+	if (patternList.empty())
+	{
+		return;
+	}
+
+	const size_t inputs { patternList[0u]->GetNumberOfPrimaryInputs() + patternList[0u]->GetNumberOfSecondaryInputs() };
+	size_t timeframes { 0u };
+	for (auto const& pattern : patternList)
+	{
+		timeframes = std::max(timeframes, pattern->GetNumberOfTimeframes());
+	}
+
+	// The positions that are most often specified are used for a quick
+	// pre-check before the care bits of two patterns are compared completely.
+	std::vector<size_t> careCounts(timeframes * inputs, 0u);
+	for (auto const& pattern : patternList)
+	{
+		ForEachCareBit(*pattern, [&](size_t position, bool) { careCounts[position]++; });
+	}
+	std::vector<size_t> keyPositions(careCounts.size());
+	std::iota(keyPositions.begin(), keyPositions.end(), 0u);
+	const size_t keys { std::min<size_t>(KEY_POSITIONS, keyPositions.size()) };
+	std::partial_sort(keyPositions.begin(), keyPositions.begin() + keys, keyPositions.end(), [&](size_t lhs, size_t rhs) {
+		return careCounts[lhs] > careCounts[rhs];
+	});
+	std::vector<int> keyIndices(careCounts.size(), -1);
+	for (size_t key { 0u }; key < keys; ++key)
+	{
+		keyIndices[keyPositions[key]] = static_cast<int>(key);
+	}
+
+	// Each pattern is merged into the first compatible pattern of the compacted list.
+	std::vector<std::shared_ptr<Pattern::TestPattern>> mergedPatterns;
+	std::vector<CareBits> mergedCareBits;
+	CareBitIndex mergedIndex;
+	std::vector<size_t> mapping(patternList.size());
+	for (size_t patternIndex { 0u }; patternIndex < patternList.size(); ++patternIndex)
 	{
-		for (size_t j = i+1; j < patternList.size(); j++)
+		auto const& pattern { patternList[patternIndex] };
+		auto careBits { GetCareBits(*pattern, timeframes * inputs, keyIndices) };
+
+		const auto compatible { mergedIndex.FindFirstCompatible(careBits, mergedCareBits) };
+		if (!compatible)
 		{
-			if (patternList[i]->IsCompatible(*patternList[j]) || patternList[j]->IsCompatible(*patternList[i]))
-			{
-				if (patternList[i]->GetNumberOfTimeframes() < patternList[j]->GetNumberOfTimeframes())
-				{
-					VLOG(3) << "Merged " << i << " into " << j << " (storing to id " <<  i << ")";
-					patternList[j]->Compact(*patternList[i]);
-					patternList[i] = patternList[j];
-				}
-				else
-				{
-					VLOG(3) << "Merged " << j << " into " << i << " (storing to id " <<  i << ")";
-					patternList[i]->Compact(*patternList[j]);
-				}
+			mapping[patternIndex] = mergedPatterns.size();
+			mergedIndex.Insert(mergedPatterns.size(), careBits);
+			mergedPatterns.push_back(std::make_shared<Pattern::TestPattern>(*pattern));
+			mergedCareBits.push_back(std::move(careBits));
+			continue;
+		}
 
-				for (auto [fault, metadata] : faultList)
-				{
-					if (metadata->detectingPatternId == j) metadata->detectingPatternId = i;
-					if (metadata->detectingPatternId > j && metadata->detectingPatternId != std::numeric_limits<size_t>::max()) metadata->detectingPatternId -= 1;
-				}
+		const size_t target { *compatible };
+		VLOG(3) << "Merged " << patternIndex << " into " << target;
+		if (mergedPatterns[target]->GetNumberOfTimeframes() < pattern->GetNumberOfTimeframes())
+		{
+			auto merged { std::make_shared<Pattern::TestPattern>(*pattern) };
+			ASSERT(merged->Compact(*mergedPatterns[target])) << "The test patterns " << patternIndex << " and " << target << " can not be merged";
+			mergedPatterns[target] = merged;
+		}
+		else
+		{
+			ASSERT(mergedPatterns[target]->Compact(*pattern)) << "The test patterns " << patternIndex << " and " << target << " can not be merged";
+		}
+		mapping[patternIndex] = target;
+		mergedIndex.Remove(target, mergedCareBits[target]);
+		mergedCareBits[target] = GetCareBits(*mergedPatterns[target], timeframes * inputs, keyIndices);
+		mergedIndex.Insert(target, mergedCareBits[target]);
+	}
 
-				patternList.erase(patternList.begin() + j);
+	for (auto [fault, metadata] : faultList)
+	{
+		if (metadata->detectingPatternId != std::numeric_limits<size_t>::max())
+		{
+			metadata->detectingPatternId = mapping[metadata->detectingPatternId];
+		}
+	}
+
+	LOG(INFO) << "Merged " << patternList.size() << " into " << mergedPatterns.size() << " patterns";
+	patternList = std::move(mergedPatterns);
+}
+
+template <typename FaultModel, typename FaultList>
+void GreedyStaticFaultCompaction<FaultModel, FaultList>::SimulatePatternList(std::vector<std::shared_ptr<Pattern::TestPattern>>& patternList, const FaultList& faultList, Pattern::InputCapture capture)
+{
+	const Circuit::MappedCircuit& circuit { this->circuit->GetMappedCircuit() };
+	const Pattern::OutputCapture outputCapture { Pattern::GetOutputCapture(capture) };
+	const Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
+
+	// Faults are dropped as soon as they reach the detection limit.
+	// Faults that are not detected by the imported patterns are not simulated at all.
+	std::vector<size_t> detections(faultList.size(), _detectionLimit);
+	std::vector<size_t> detectingPatterns(faultList.size(), std::numeric_limits<size_t>::max());
+	size_t remainingFaults { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = faultList[faultIndex];
+		if (metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		{
+			detections[faultIndex] = 0u;
+			remainingFaults++;
+		}
+	}
+
+	// The patterns are simulated in reverse order as the last patterns
+	// of a test set usually target the hard-to-detect faults which
+	// are detected by few patterns only.
+	std::vector<bool> requiredPatterns(patternList.size(), false);
+	for (size_t patternIndex { patternList.size() }; patternIndex-- > 0u && remainingFaults > 0u; )
+	{
+		const auto detectedFaults { Simulation::SimulateFaults<FaultModel>(circuit, *patternList[patternIndex], faultList, outputCapture, simConfig,
+			[&](size_t faultIndex) { return detections[faultIndex] < _detectionLimit; }) };
+		VLOG(3) << "Test pattern " << patternIndex << " detects " << detectedFaults.size() << " remaining faults";
+
+		requiredPatterns[patternIndex] = !detectedFaults.empty();
+		for (const auto faultIndex : detectedFaults)
+		{
+			if (detections[faultIndex] == 0u)
+			{
+				detectingPatterns[faultIndex] = patternIndex;
 			}
+			if (++detections[faultIndex] == _detectionLimit)
+			{
+				remainingFaults--;
+			}
+		}
+	}
+
+	std::vector<std::shared_ptr<Pattern::TestPattern>> requiredPatternList;
+	std::vector<size_t> mapping(patternList.size(), std::numeric_limits<size_t>::max());
+	for (size_t patternIndex { 0u }; patternIndex < patternList.size(); ++patternIndex)
+	{
+		if (requiredPatterns[patternIndex])
+		{
+			mapping[patternIndex] = requiredPatternList.size();
+			requiredPatternList.push_back(patternList[patternIndex]);
+		}
+	}
+
+	size_t undetectedFaults { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = faultList[faultIndex];
+		if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		{
+			continue;
 		}
+
+		if (detectingPatterns[faultIndex] == std::numeric_limits<size_t>::max())
+		{
+			undetectedFaults++;
+			metadata->detectingPatternId = std::numeric_limits<size_t>::max();
+			continue;
+		}
+		metadata->detectingPatternId = mapping[detectingPatterns[faultIndex]];
 	}
+
+	LOG_IF(undetectedFaults > 0u, WARNING) << undetectedFaults << " faults are marked as detected, but are not detected by a test pattern";
+	LOG_IF(_detectionLimit > 1u, INFO) << remainingFaults << " faults are detected less than " << _detectionLimit << " times";
+	LOG(INFO) << "Removed " << (patternList.size() - requiredPatternList.size()) << " of " << patternList.size() << " patterns by fault simulation";
+	patternList = std::move(requiredPatternList);
 }
 
 template class GreedyStaticFaultCompaction<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
@@ -11,6 +11,7 @@
 #include "Basic/Fault/Models/CellAwareFaultModel.hpp"
 #include "Basic/ApplicationStatistics.hpp"
 #include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Pattern/Capture.hpp"
 #include "Basic/Pattern/TestPattern.hpp"
 
 namespace FreiTest
@@ -78,11 +79,15 @@ public:
 
 protected:
 	enum class CompactionOrder { CompactAscendingId, CompactDescendingId };
+	enum class CompactionMethod { Merge, Simulation, MergeAndSimulation };
 
-private:
-	void CompactPatternList(std::vector<std::shared_ptr<Pattern::TestPattern>>& patternList, const FaultList& faultList);
+	void MergePatternList(std::vector<std::shared_ptr<Pattern::TestPattern>>& patternList, const FaultList& faultList);
+	void SimulatePatternList(std::vector<std::shared_ptr<Pattern::TestPattern>>& patternList, const FaultList& faultList, Pattern::InputCapture capture);
 
+private:
 	CompactionOrder _compactionOrder;
+	CompactionMethod _compactionMethod;
+	size_t _detectionLimit;
 
 };
 
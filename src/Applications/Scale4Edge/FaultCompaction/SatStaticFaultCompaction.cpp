@@ -13,6 +13,7 @@
 #include "Basic/Logging.hpp"
 #include "Basic/Parallel.hpp"
 #include "Basic/Pattern/Capture.hpp"
+#include "Basic/Fault/FaultCoverageMatrix.hpp"
 #include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
 #include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
 #include "Basic/Fault/Lists/CellAwareFaultList.hpp"
@@ -25,6 +26,7 @@
 #include "Io/FaultListParser/FaultListParser.hpp"
 #include "Io/TestPatternParser/TestPatternParser.hpp"
 #include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/FaultSimulator.hpp"
 #include "SolverProxy/MaxSat/MaxSatSolverProxy.hpp"
 #include "Tpg/Encoder/LogicEncoder.hpp"
 #include "Tpg/LogicGenerator/TestPatternExtractor.hpp"
@@ -115,11 +117,11 @@ void SatStaticFaultCompaction<FaultModel, FaultList>::Run(void)
 {
 	LOG(INFO) << "Importing test patterns";
 
-	FileHandle patternFileHandle("[DataImportDirectory]/patterns.json", true);
+	FileHandle patternFileHandle("[DataImportDirectory]/patterns.[DataExchangeExtension]", true);
 	auto patternResult = Io::ImportPatterns(patternFileHandle.GetStream(), *this->circuit);
 	if (!patternResult) LOG(FATAL) << "Test patterns could not be read";
 
-	FileHandle importMetaDataHandle("[DataImportDirectory]/faults.json", true);
+	FileHandle importMetaDataHandle("[DataImportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), true);
 	auto faultResult = [&]() -> std::optional<Io::FaultListExchangeFormat<FaultList>> {
 		if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>
 			|| std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
@@ -174,164 +176,126 @@ void SatStaticFaultCompaction<FaultModel, FaultList>::Run(void)
 	}
 
 	LOG(INFO) << "Exporting test patterns";
-	FileHandle exportPatternHandle("[DataExportDirectory]/patterns.json", false);
-	Io::ExportPatterns(exportPatternHandle.GetOutStream(), { *this->circuit, exportedPatterns, capture });
+	FileHandle exportPatternHandle("[DataExportDirectory]/patterns.[DataExchangeExtension]", false);
+	Io::ExportPatterns(exportPatternHandle.GetOutStream(), { *this->circuit, exportedPatterns, capture }, Settings::GetInstance()->DataExchangeFormat);
 
-	FileHandle exportMetaDataHandle("[DataExportDirectory]/faults.json", false);
+	FileHandle exportMetaDataHandle("[DataExportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), false);
 	Io::FaultListExchangeFormat<FaultList> faultData { *this->circuit, faultResult->GetFaults() };
-	Io::ExportFaults(exportMetaDataHandle.GetOutStream(), faultData);
+	Io::ExportFaults(exportMetaDataHandle.GetOutStream(), faultData, Settings::GetInstance()->DataExchangeFormat);
 }
 
 template <typename FaultModel, typename FaultList>
 Pattern::TestPatternList SatStaticFaultCompaction<FaultModel, FaultList>::CompactPatternList(Pattern::TestPatternList &patternList, const FaultList &faultList, Pattern::InputCapture capture)
 {
-	std::shared_ptr<Sat::MaxSatSolverProxy> solver = Sat::MaxSatSolverProxy::CreateMaxSatSolver(Sat::SatSolver::PROD_MAX_SAT_PACOSE);
-	Tpg::LogicEncoder encoder { solver };
-
-	LOG(INFO) << "Generating the pattern literals";
-	std::vector<Tpg::LogicContainer01> patternLiterals;
-	std::vector<std::vector<bool>> patternFaultCoverage;
-	for (auto const& pattern : patternList)
-	{
-		patternLiterals.push_back(encoder.NewLogicContainer<Tpg::LogicContainer01>());
-		patternFaultCoverage.emplace_back(faultList.size(), false);
-	}
-
-	const Pattern::OutputCapture outputCapture = [&](){
-		switch (capture)
-		{
-			case Pattern::InputCapture::PrimaryInputsOnly:
-			case Pattern::InputCapture::PrimaryAndInitialSecondaryInputs:
-				return Pattern::OutputCapture::PrimaryOutputsOnly;
-			case Pattern::InputCapture::SecondaryInputsOnly:
-				return Pattern::OutputCapture::SecondaryOutputsOnly;
-			case Pattern::InputCapture::PrimaryAndSecondaryInputs:
-				return Pattern::OutputCapture::PrimaryAndSecondaryOutputs;
-			default:
-				Logging::Panic("Unsupported capture operation mode");
-		}
-	}();
+	const Circuit::MappedCircuit& circuit { this->circuit->GetMappedCircuit() };
+	const Pattern::OutputCapture outputCapture { Pattern::GetOutputCapture(capture) };
+	const Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
 
 	LOG(INFO) << "Computing coverage matrix";
-	// Create the fault coverage matrix
-	Parallel::ExecuteParallel(0, patternList.size(), Parallel::Arena::FaultSimulation, Parallel::Order::Parallel, [&](size_t index) {
-		RunFaultSimulation(patternList[index], faultList, patternFaultCoverage[index], outputCapture);
+	// Only the detections are stored (sparse) as a dense pattern x fault matrix
+	// does not fit into memory for large pattern sets and fault lists.
+	std::vector<std::vector<Fault::FaultCoverageMatrix::index_type>> patternDetections(patternList.size());
+	Parallel::ExecuteParallel(0u, patternList.size(), Parallel::Arena::FaultSimulation, Parallel::Order::Parallel, [&](size_t index) {
+		const auto detections { Simulation::SimulateFaults<FaultModel>(circuit, *patternList[index], faultList, outputCapture, simConfig) };
+		patternDetections[index].assign(detections.begin(), detections.end());
 	});
+	const Fault::FaultCoverageMatrix coverage { faultList.size(), std::move(patternDetections) };
+	LOG(INFO) << "The coverage matrix contains " << coverage.GetNumberOfDetections() << " detections";
 
-	LOG(INFO) << "Encoding coverage matrix";
-	// Convert the coverage matrix into a SAT problem where
-	// all testable faults are required to be detected.
 	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
 	{
 		auto [fault, metadata] = faultList[faultIndex];
-
-		std::vector<Tpg::LogicContainer01> detectingPatterns;
-		for (size_t patternIndex { 0u }; patternIndex < patternList.size(); ++patternIndex)
-		{
-			if (patternFaultCoverage[patternIndex][faultIndex])
-			{
-				detectingPatterns.push_back(patternLiterals[patternIndex]);
-			}
-		}
-
-		if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		const size_t detectingPatterns { coverage.GetDetectingPatterns(faultIndex).size() };
+		if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
 		{
-			ASSERT(detectingPatterns.size() == 0u) << "The fault " << faultIndex << " was marked undetectable, but is detected by a test pattern.";
-			continue;
+			ASSERT(detectingPatterns == 0u) << "The fault " << faultIndex << " was marked undetectable, but is detected by a test pattern.";
 		}
-
-		ASSERT(detectingPatterns.size() > 0u) << "The fault " << faultIndex << " was marked testable, but was not detected by a test pattern.";
-		if (detectingPatterns.size() == 0u)
+		else
 		{
-			continue;
+			ASSERT(detectingPatterns > 0u) << "The fault " << faultIndex << " was marked testable, but was not detected by a test pattern.";
 		}
-
-		// Require the fault to be detected by at least one pattern.
-		auto detectionLiteral = encoder.EncodeOr(detectingPatterns);
-		encoder.EncodeLogicValue(detectionLiteral, Basic::Logic::LOGIC_ONE);
 	}
 
-	LOG(INFO) << "Encoding maximization literals";
-	// Now add all pattern literals as maximization literal to
-	// maximize the number of patterns that are not required.
-	for (auto& patternLiteral : patternLiterals)
+	LOG(INFO) << "Reducing coverage matrix";
+	// Essential patterns and dominated faults / patterns are removed
+	// before the remaining core of the problem is given to the solver.
+	const auto reduction { Fault::ReduceSetCover(coverage) };
+	LOG(INFO) << "Found " << reduction.essentialPatterns.size() << " essential patterns, "
+		<< reduction.dominatedPatterns << " dominated patterns and " << reduction.dominatedFaults << " dominated faults";
+	LOG(INFO) << "The remaining core has " << reduction.corePatterns.size() << " patterns and " << reduction.coreFaults.size() << " faults";
+
+	std::vector<bool> requiredPatterns(patternList.size(), false);
+	for (const auto patternIndex : reduction.essentialPatterns)
 	{
-		auto zeroDetector { encoder.EncodeLogicValueDetector(patternLiteral, Basic::Logic::LOGIC_ZERO) };
-		solver->CommitSoftClause(zeroDetector.l0);
+		requiredPatterns[patternIndex] = true;
 	}
 
-	LOG(INFO) << "Solving problem instance";
-	auto solverResult = solver->MaxSolve();
-	ASSERT(solverResult == Sat::SatResult::SAT) << "The solver returned an invalid result (" << solverResult << ")!";
-
-	Pattern::TestPatternList resultList;
-	for (size_t patternIndex = 0u; patternIndex < patternList.size(); ++patternIndex)
+	if (!reduction.coreFaults.empty())
 	{
-		auto value = encoder.GetSolvedLogicValue(patternLiterals[patternIndex]);
-		ASSERT (value == Basic::Logic::LOGIC_ZERO || value == Basic::Logic::LOGIC_ONE) << "Solver returned invalid result for pattern " << patternIndex;
+		std::shared_ptr<Sat::MaxSatSolverProxy> solver = Sat::MaxSatSolverProxy::CreateMaxSatSolver(Sat::SatSolver::PROD_MAX_SAT_PACOSE);
+		Tpg::LogicEncoder encoder { solver };
 
-		LOG(INFO) << "Test pattern " << patternIndex << " is " << ((value == Basic::Logic::LOGIC_ZERO) ? "not " : "") << "required";
-		if (value == Basic::Logic::LOGIC_ONE)
+		LOG(INFO) << "Generating the pattern literals";
+		std::vector<size_t> coreIndices(patternList.size(), std::numeric_limits<size_t>::max());
+		std::vector<Tpg::LogicContainer01> patternLiterals;
+		for (const auto patternIndex : reduction.corePatterns)
 		{
-			resultList.push_back(patternList[patternIndex]);
+			coreIndices[patternIndex] = patternLiterals.size();
+			patternLiterals.push_back(encoder.NewLogicContainer<Tpg::LogicContainer01>());
 		}
-	}
-
-	return resultList;
-}
-
-template <typename FaultModel, typename FaultList>
-void SatStaticFaultCompaction<FaultModel, FaultList>::RunFaultSimulation(std::shared_ptr<Pattern::TestPattern> pattern, const FaultList &faultList, std::vector<bool>& faultCoverage, Pattern::OutputCapture capture)
-{
-	const Circuit::MappedCircuit& circuit { this->circuit->GetMappedCircuit() };
-
-	Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
-	Simulation::SimulationResult goodResult { pattern->GetNumberOfTimeframes(), circuit.GetNumberOfNodes() };
-	Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(circuit, *pattern, { }, goodResult, simConfig);
-
-	Simulation::SimulationResult badResult { pattern->GetNumberOfTimeframes(), circuit.GetNumberOfNodes() };
-	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
-	{
-		auto [fault, metadata] = faultList[faultIndex];
 
-		badResult.ReplaceWith(goodResult);
-		Simulation::SimulateTestPatternEventDrivenIncremental<FaultModel>(circuit, *pattern, { fault }, std::as_const(goodResult), badResult, simConfig);
-
-		const auto [testPrimaryOutputs, testSecondaryOutputs ] = Pattern::GetCaptureOutputs(capture);
-		for (size_t timeframe = 0u; timeframe < pattern->GetNumberOfTimeframes(); ++timeframe)
+		LOG(INFO) << "Encoding coverage matrix";
+		// Convert the reduced coverage matrix into a SAT problem where
+		// all remaining faults are required to be detected.
+		for (const auto faultIndex : reduction.coreFaults)
 		{
-			for (size_t index = 0u; testPrimaryOutputs && index < circuit.GetNumberOfPrimaryOutputs(); ++index)
+			std::vector<Tpg::LogicContainer01> detectingPatterns;
+			for (const auto patternIndex : coverage.GetDetectingPatterns(faultIndex))
 			{
-				const auto* primaryOutput = circuit.GetPrimaryOutput(index);
-				const auto good = goodResult.GetOutputLogic(primaryOutput, timeframe);
-				const auto bad = badResult.GetOutputLogic(primaryOutput, timeframe);
-				const bool difference = IsValidLogic01(good) && IsValidLogic01(bad) && (bad != good);
-
-				if (__builtin_expect(difference, false))
+				if (coreIndices[patternIndex] != std::numeric_limits<size_t>::max())
 				{
-					faultCoverage[faultIndex] = true;
-					goto nextFault;
+					detectingPatterns.push_back(patternLiterals[coreIndices[patternIndex]]);
 				}
 			}
+			ASSERT(detectingPatterns.size() > 0u) << "The fault " << faultIndex << " is not detected by a remaining test pattern.";
 
-			for (size_t index = 0; testSecondaryOutputs && index < circuit.GetNumberOfSecondaryOutputs(); ++index)
-			{
-				const auto* secondaryOutput = circuit.GetSecondaryOutput(index);
-				const auto good = goodResult.GetOutputLogic(secondaryOutput, timeframe);
-				const auto bad = badResult.GetOutputLogic(secondaryOutput, timeframe);
-				const bool difference = IsValidLogic01(good) && IsValidLogic01(bad) && bad != good;
+			// Require the fault to be detected by at least one pattern.
+			auto detectionLiteral = encoder.EncodeOr(detectingPatterns);
+			encoder.EncodeLogicValue(detectionLiteral, Basic::Logic::LOGIC_ONE);
+		}
 
-				if (__builtin_expect(difference, false))
-				{
-					faultCoverage[faultIndex] = true;
-					goto nextFault;
-				}
-			}
+		LOG(INFO) << "Encoding maximization literals";
+		// Now add all pattern literals as maximization literal to
+		// maximize the number of patterns that are not required.
+		for (auto& patternLiteral : patternLiterals)
+		{
+			auto zeroDetector { encoder.EncodeLogicValueDetector(patternLiteral, Basic::Logic::LOGIC_ZERO) };
+			solver->CommitSoftClause(zeroDetector.l0);
 		}
 
-	nextFault:
-		;
+		LOG(INFO) << "Solving problem instance";
+		auto solverResult = solver->MaxSolve();
+		ASSERT(solverResult == Sat::SatResult::SAT) << "The solver returned an invalid result (" << solverResult << ")!";
+
+		for (const auto patternIndex : reduction.corePatterns)
+		{
+			auto value = encoder.GetSolvedLogicValue(patternLiterals[coreIndices[patternIndex]]);
+			ASSERT (value == Basic::Logic::LOGIC_ZERO || value == Basic::Logic::LOGIC_ONE) << "Solver returned invalid result for pattern " << patternIndex;
+			requiredPatterns[patternIndex] = (value == Basic::Logic::LOGIC_ONE);
+		}
+	}
+
+	Pattern::TestPatternList resultList;
+	for (size_t patternIndex = 0u; patternIndex < patternList.size(); ++patternIndex)
+	{
+		LOG(INFO) << "Test pattern " << patternIndex << " is " << (requiredPatterns[patternIndex] ? "" : "not ") << "required";
+		if (requiredPatterns[patternIndex])
+		{
+			resultList.push_back(patternList[patternIndex]);
+		}
 	}
+
+	return resultList;
 }
 
 template class SatStaticFaultCompaction<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
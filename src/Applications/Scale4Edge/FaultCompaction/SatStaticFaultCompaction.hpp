@@ -77,7 +77,6 @@ protected:
 
 private:
 	Pattern::TestPatternList CompactPatternList(Pattern::TestPatternList& patternList, const FaultList& faultList, Pattern::InputCapture capture);
-	void RunFaultSimulation(std::shared_ptr<Pattern::TestPattern> pattern, const FaultList& faultList, std::vector<bool>& faultCoverage, Pattern::OutputCapture capture);
 
 };
 
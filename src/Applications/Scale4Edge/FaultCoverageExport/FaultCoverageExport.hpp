@@ -37,11 +37,7 @@ private:
 	size_t simulationThreadLimit;
 	Basic::ApplicationStatistics statistics;
 
-	std::mutex parallelMutex;
-
 	void GenerateFaultList(void);
-	std::vector<bool> Simulate(const Pattern::TestPattern& pattern, Pattern::InputCapture capture, const FaultList& faultList);
-	Io::FaultCoverage::FaultInformation GetFaultInformation(const FaultModel& fault);
 
 };
 
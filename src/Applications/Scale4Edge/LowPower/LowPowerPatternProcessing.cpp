@@ -0,0 +1,419 @@
+#include "Applications/Scale4Edge/LowPower/LowPowerPatternProcessing.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/FaultCoverageMatrix.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Basic/Pattern/Capture.hpp"
+#include "Basic/Pattern/PatternFill.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Circuit/MappedCircuit.hpp"
+#include "Helper/FileHandle.hpp"
+#include "Io/FaultListParser/FaultListParser.hpp"
+#include "Io/TestPatternParser/TestPatternParser.hpp"
+#include "Io/UserDefinedFaultModel/UdfmModel.hpp"
+#include "Simulation/FaultSimulator.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+LowPowerPatternData<Fault::SingleStuckAtFaultModel>::LowPowerPatternData(std::string configPrefix)
+{
+}
+LowPowerPatternData<Fault::SingleStuckAtFaultModel>::~LowPowerPatternData(void) = default;
+
+bool LowPowerPatternData<Fault::SingleStuckAtFaultModel>::SetSetting(std::string key, std::string value)
+{
+	return false;
+}
+
+void LowPowerPatternData<Fault::SingleStuckAtFaultModel>::Init(void)
+{
+}
+
+void LowPowerPatternData<Fault::SingleStuckAtFaultModel>::Run(void)
+{
+}
+
+LowPowerPatternData<Fault::SingleTransitionDelayFaultModel>::LowPowerPatternData(std::string configPrefix)
+{
+}
+LowPowerPatternData<Fault::SingleTransitionDelayFaultModel>::~LowPowerPatternData(void) = default;
+
+bool LowPowerPatternData<Fault::SingleTransitionDelayFaultModel>::SetSetting(std::string key, std::string value)
+{
+	return false;
+}
+
+void LowPowerPatternData<Fault::SingleTransitionDelayFaultModel>::Init(void)
+{
+}
+
+void LowPowerPatternData<Fault::SingleTransitionDelayFaultModel>::Run(void)
+{
+}
+
+LowPowerPatternData<Fault::CellAwareFaultModel>::LowPowerPatternData(std::string configPrefix):
+	Mixin::UdfmMixin(configPrefix)
+{
+}
+LowPowerPatternData<Fault::CellAwareFaultModel>::~LowPowerPatternData(void) = default;
+
+bool LowPowerPatternData<Fault::CellAwareFaultModel>::SetSetting(std::string key, std::string value)
+{
+	return UdfmMixin::SetSetting(key, value);
+}
+
+void LowPowerPatternData<Fault::CellAwareFaultModel>::Init(void)
+{
+	UdfmMixin::Init();
+}
+
+void LowPowerPatternData<Fault::CellAwareFaultModel>::Run(void)
+{
+	UdfmMixin::Run();
+}
+
+// Orders the patterns of a group by the number of faults that they detect additionally.
+// Faults that are already detected by a previous group don't contribute to the order.
+static std::vector<size_t> OrderGroupByMarginalCoverage(const Fault::FaultCoverageMatrix& coverage, const std::vector<size_t>& patterns, std::vector<bool>& detected)
+{
+	std::vector<std::vector<Fault::FaultCoverageMatrix::index_type>> detections(patterns.size());
+	for (size_t index { 0u }; index < patterns.size(); ++index)
+	{
+		for (const auto faultIndex : coverage.GetDetectedFaults(patterns[index]))
+		{
+			if (!detected[faultIndex]) detections[index].push_back(faultIndex);
+		}
+	}
+
+	const Fault::FaultCoverageMatrix groupCoverage { coverage.GetNumberOfFaults(), std::move(detections) };
+	std::vector<size_t> order;
+	for (const auto index : Fault::OrderByMarginalCoverage(groupCoverage, { }))
+	{
+		order.push_back(patterns[index]);
+		for (const auto faultIndex : groupCoverage.GetDetectedFaults(index))
+		{
+			detected[faultIndex] = true;
+		}
+	}
+	return order;
+}
+
+template <typename FaultModel, typename FaultList>
+LowPowerPatternProcessing<FaultModel, FaultList>::LowPowerPatternProcessing(void):
+	BaseApplication(),
+	LowPowerPatternData<FaultModel>("Scale4Edge/LowPowerPatterns"),
+	_fillStrategy(FillStrategy::Adjacent),
+	_reordering(Reordering::Enabled),
+	_shiftBudget(0u),
+	_captureBudget(0u),
+	_activityFile("[DataExportDirectory]/switching_activity.csv")
+{
+}
+
+template <typename FaultModel, typename FaultList>
+LowPowerPatternProcessing<FaultModel, FaultList>::~LowPowerPatternProcessing(void) = default;
+
+template <typename FaultModel, typename FaultList>
+bool LowPowerPatternProcessing<FaultModel, FaultList>::SetSetting(std::string key, std::string value)
+{
+	if (key == "Scale4Edge/LowPowerPatterns/Fill")
+	{
+		return Settings::ParseEnum(value, _fillStrategy, {
+			{ "None", FillStrategy::None },
+			{ "Zero", FillStrategy::Zero },
+			{ "One", FillStrategy::One },
+			{ "Adjacent", FillStrategy::Adjacent },
+			{ "MinimumActivity", FillStrategy::MinimumActivity }
+		});
+	}
+	if (key == "Scale4Edge/LowPowerPatterns/Reordering")
+	{
+		return Settings::ParseEnum(value, _reordering, {
+			{ "Disabled", Reordering::Disabled },
+			{ "Enabled", Reordering::Enabled }
+		});
+	}
+	if (key == "Scale4Edge/LowPowerPatterns/ShiftBudget")
+	{
+		return Settings::ParseSizet(value, _shiftBudget);
+	}
+	if (key == "Scale4Edge/LowPowerPatterns/CaptureBudget")
+	{
+		return Settings::ParseSizet(value, _captureBudget);
+	}
+	if (key == "Scale4Edge/LowPowerPatterns/ActivityFile")
+	{
+		_activityFile = value;
+		return true;
+	}
+
+	return LowPowerPatternData<FaultModel>::SetSetting(key, value);
+}
+
+template <typename FaultModel, typename FaultList>
+void LowPowerPatternProcessing<FaultModel, FaultList>::Init(void)
+{
+	LowPowerPatternData<FaultModel>::Init();
+}
+
+template <typename FaultModel, typename FaultList>
+void LowPowerPatternProcessing<FaultModel, FaultList>::Run(void)
+{
+	LowPowerPatternData<FaultModel>::Run();
+
+	FileHandle importPatternHandle("[DataImportDirectory]/patterns.[DataExchangeExtension]", true);
+	auto patternResult = Io::ImportPatterns(importPatternHandle.GetStream(), *this->circuit);
+	if (!patternResult) LOG(FATAL) << "Test patterns could not be read";
+
+	FileHandle importMetaDataHandle("[DataImportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), true);
+	auto faultResult = [&]() -> std::optional<Io::FaultListExchangeFormat<FaultList>> {
+		if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>
+			|| std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
+		{
+			return Io::ImportFaults<FaultList>(importMetaDataHandle.GetStream(), *this->circuit);
+		}
+		else if constexpr (std::is_same_v<FaultModel, Fault::CellAwareFaultModel>)
+		{
+			ASSERT(this->GetUdfm()) << "No User-Defined Fault Model (UDFM) was loaded";
+			return Io::ImportFaults<FaultList>(importMetaDataHandle.GetStream(), *this->circuit, *this->GetUdfm());
+		}
+		else
+		{
+			Logging::Panic("Unknown fault model");
+		}
+	}();
+	if (!faultResult) LOG(FATAL) << "Fault data could not be read";
+
+	const Circuit::MappedCircuit& circuit { this->circuit->GetMappedCircuit() };
+	const auto& importedPatterns { patternResult->GetTestPatterns() };
+	const auto& faultList { faultResult->GetFaults() };
+	const Pattern::InputCapture inputCapture { patternResult->GetInputCapture() };
+	const Pattern::OutputCapture outputCapture { Pattern::GetOutputCapture(inputCapture) };
+	LOG(INFO) << "Imported " << importedPatterns.size() << " patterns and " << faultList.size() << " faults";
+
+	Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
+	simConfig.sequentialMode = (inputCapture == Pattern::InputCapture::PrimaryAndSecondaryInputs || inputCapture == Pattern::InputCapture::SecondaryInputsOnly)
+		? Simulation::SequentialMode::FullScan
+		: Simulation::SequentialMode::Functional;
+	LOG_IF(simConfig.sequentialMode == Simulation::SequentialMode::Functional, WARNING) << "The patterns are not applied through scan chains, only the capture activity is estimated";
+
+	std::vector<Pattern::TestPattern> patterns(importedPatterns.size());
+	std::vector<Simulation::SwitchingActivity> originalActivity(importedPatterns.size());
+	std::vector<Simulation::SwitchingActivity> activity(importedPatterns.size());
+	Parallel::ExecuteParallel(0u, importedPatterns.size(), Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t patternIndex) {
+		originalActivity[patternIndex] = Simulation::GetSwitchingActivity(circuit, *importedPatterns[patternIndex], simConfig);
+		patterns[patternIndex] = FillPattern(*importedPatterns[patternIndex], simConfig);
+		activity[patternIndex] = Simulation::GetSwitchingActivity(circuit, patterns[patternIndex], simConfig);
+	});
+
+	// The filled patterns can detect additional faults, but no fault that has been detected before
+	// is lost as the values of the specified inputs are not changed.
+	std::vector<bool> simulatedFaults(faultList.size(), false);
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = faultList[faultIndex];
+		simulatedFaults[faultIndex] = (metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED
+			|| metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED);
+	}
+
+	std::vector<std::vector<Fault::FaultCoverageMatrix::index_type>> patternDetections(patterns.size());
+	Parallel::ExecuteParallel(0u, patterns.size(), Parallel::Arena::FaultSimulation, Parallel::Order::Parallel, [&](size_t patternIndex) {
+		const auto detections { Simulation::SimulateFaults<FaultModel>(circuit, patterns[patternIndex], faultList, outputCapture, simConfig,
+			[&](size_t faultIndex) { return simulatedFaults[faultIndex]; }) };
+		patternDetections[patternIndex].assign(detections.begin(), detections.end());
+	});
+	const Fault::FaultCoverageMatrix coverage { faultList.size(), std::move(patternDetections) };
+
+	// The patterns within the budget are applied first at the full scan frequency
+	std::vector<size_t> order(patterns.size());
+	std::iota(order.begin(), order.end(), 0u);
+	if (_reordering == Reordering::Enabled)
+	{
+		std::vector<size_t> withinBudget;
+		std::vector<size_t> exceedingBudget;
+		for (size_t patternIndex { 0u }; patternIndex < patterns.size(); ++patternIndex)
+		{
+			(IsWithinBudget(activity[patternIndex]) ? withinBudget : exceedingBudget).push_back(patternIndex);
+		}
+
+		// The patterns exceeding the budget are ordered by their activity
+		// to allow the tester to reduce the frequency step by step.
+		std::vector<bool> detected(faultList.size(), false);
+		order = OrderGroupByMarginalCoverage(coverage, withinBudget, detected);
+		std::stable_sort(exceedingBudget.begin(), exceedingBudget.end(), [&](size_t lhs, size_t rhs) {
+			return GetBudgetRatio(activity[lhs]) < GetBudgetRatio(activity[rhs]);
+		});
+		order.insert(order.end(), exceedingBudget.begin(), exceedingBudget.end());
+	}
+
+	std::vector<size_t> position(order.size());
+	for (size_t index { 0u }; index < order.size(); ++index)
+	{
+		position[order[index]] = index;
+	}
+	size_t lostFaults { 0u };
+	size_t additionalFaults { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		if (!simulatedFaults[faultIndex])
+		{
+			continue;
+		}
+
+		auto [fault, metadata] = faultList[faultIndex];
+		size_t detectingPattern { std::numeric_limits<size_t>::max() };
+		for (const auto patternIndex : coverage.GetDetectingPatterns(faultIndex))
+		{
+			detectingPattern = std::min<size_t>(detectingPattern, position[patternIndex]);
+		}
+
+		if (detectingPattern == std::numeric_limits<size_t>::max())
+		{
+			lostFaults += (metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED) ? 1u : 0u;
+			continue;
+		}
+		if (metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+		{
+			metadata->SetFaultStatus(Fault::FaultStatus::FAULT_STATUS_DETECTED);
+			additionalFaults++;
+		}
+		metadata->detectingPatternId = detectingPattern;
+	}
+	LOG_IF(lostFaults > 0u, WARNING) << lostFaults << " faults are marked as detected, but are not detected by a test pattern";
+	LOG_IF(additionalFaults > 0u, INFO) << additionalFaults << " additional faults are detected by the filled test patterns";
+
+	const auto get_peak_shift = [](const Simulation::SwitchingActivity& entry) { return entry.GetPeakShift(); };
+	const auto get_capture = [](const Simulation::SwitchingActivity& entry) { return entry.capture; };
+	const auto get_maximum = [](const std::vector<Simulation::SwitchingActivity>& activities, auto function) {
+		size_t maximum { 0u };
+		for (const auto& entry : activities) maximum = std::max(maximum, function(entry));
+		return maximum;
+	};
+	LOG(INFO) << "Peak shift activity: " << get_maximum(originalActivity, get_peak_shift) << " (original), " << get_maximum(activity, get_peak_shift) << " (processed)";
+	LOG(INFO) << "Peak capture activity: " << get_maximum(originalActivity, get_capture) << " (original), " << get_maximum(activity, get_capture) << " (processed)";
+	LOG(INFO) << std::count_if(activity.begin(), activity.end(), [&](const auto& entry) { return IsWithinBudget(entry); })
+		<< " of " << activity.size() << " patterns are within the budget";
+
+	ExportActivity(order, originalActivity, activity);
+
+	Pattern::TestPatternList exportedPatterns;
+	for (const auto patternIndex : order)
+	{
+		exportedPatterns.emplace_back(patterns[patternIndex]);
+	}
+
+	FileHandle exportPatternHandle("[DataExportDirectory]/patterns.[DataExchangeExtension]", false);
+	Io::ExportPatterns(exportPatternHandle.GetOutStream(), { *this->circuit, exportedPatterns, inputCapture }, Settings::GetInstance()->DataExchangeFormat);
+
+	FileHandle exportMetaDataHandle("[DataExportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), false);
+	Io::FaultListExchangeFormat<FaultList> faultData { *this->circuit, faultList };
+	Io::ExportFaults(exportMetaDataHandle.GetOutStream(), faultData, Settings::GetInstance()->DataExchangeFormat);
+}
+
+template <typename FaultModel, typename FaultList>
+Pattern::TestPattern LowPowerPatternProcessing<FaultModel, FaultList>::FillPattern(const Pattern::TestPattern& pattern, const Simulation::SimulationConfig& config) const
+{
+	const auto fill = [&](Pattern::FillMode mode) {
+		Pattern::TestPattern filled { pattern };
+		Pattern::FillDontCareValues(filled, mode);
+		return filled;
+	};
+
+	switch (_fillStrategy)
+	{
+		case FillStrategy::None: return pattern;
+		case FillStrategy::Zero: return fill(Pattern::FillMode::Zero);
+		case FillStrategy::One: return fill(Pattern::FillMode::One);
+		case FillStrategy::Adjacent: return fill(Pattern::FillMode::Adjacent);
+		case FillStrategy::MinimumActivity:
+		{
+			// The adjacent fill minimizes the shift activity, but a constant fill
+			// can result in a lower capture activity.
+			const Circuit::MappedCircuit& circuit { this->circuit->GetMappedCircuit() };
+			std::optional<Pattern::TestPattern> best;
+			double bestRatio { std::numeric_limits<double>::max() };
+			for (const auto mode : { Pattern::FillMode::Adjacent, Pattern::FillMode::Zero, Pattern::FillMode::One })
+			{
+				auto candidate { fill(mode) };
+				const double ratio { GetBudgetRatio(Simulation::GetSwitchingActivity(circuit, candidate, config)) };
+				if (ratio < bestRatio)
+				{
+					best = std::move(candidate);
+					bestRatio = ratio;
+				}
+			}
+			return *best;
+		}
+		default:
+			Logging::Panic("The fill strategy is not supported");
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+double LowPowerPatternProcessing<FaultModel, FaultList>::GetBudgetRatio(const Simulation::SwitchingActivity& activity) const
+{
+	// Without a budget the absolute activity is used
+	const auto get_ratio = [](size_t value, size_t budget) {
+		return static_cast<double>(value) / static_cast<double>((budget != 0u) ? budget : 1u);
+	};
+	return std::max(get_ratio(activity.GetPeakShift(), _shiftBudget), get_ratio(activity.capture, _captureBudget));
+}
+
+template <typename FaultModel, typename FaultList>
+bool LowPowerPatternProcessing<FaultModel, FaultList>::IsWithinBudget(const Simulation::SwitchingActivity& activity) const
+{
+	return (_shiftBudget == 0u || activity.GetPeakShift() <= _shiftBudget)
+		&& (_captureBudget == 0u || activity.capture <= _captureBudget);
+}
+
+template <typename FaultModel, typename FaultList>
+void LowPowerPatternProcessing<FaultModel, FaultList>::ExportActivity(const std::vector<size_t>& order, const std::vector<Simulation::SwitchingActivity>& originalActivity,
+	const std::vector<Simulation::SwitchingActivity>& activity) const
+{
+	FileHandle activityHandle(_activityFile, false);
+	auto& out { activityHandle.GetOutStream() };
+	if (!out.good())
+	{
+		LOG(ERROR) << "Could not write the switching activity to " << _activityFile;
+		return;
+	}
+
+	out << "Pattern;OriginalPattern;ShiftIn;ShiftOut;Capture;OriginalShiftIn;OriginalShiftOut;OriginalCapture;WithinBudget\n";
+	for (size_t index { 0u }; index < order.size(); ++index)
+	{
+		const auto& original { originalActivity[order[index]] };
+		const auto& processed { activity[order[index]] };
+		out << index << ";" << order[index] << ";"
+			<< processed.shiftIn << ";" << processed.shiftOut << ";" << processed.capture << ";"
+			<< original.shiftIn << ";" << original.shiftOut << ";" << original.capture << ";"
+			<< (IsWithinBudget(processed) ? 1 : 0) << "\n";
+	}
+}
+
+template class LowPowerPatternProcessing<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
+template class LowPowerPatternProcessing<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>;
+template class LowPowerPatternProcessing<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>;
+
+};
+};
+};
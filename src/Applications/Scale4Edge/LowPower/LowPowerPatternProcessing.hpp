@@ -0,0 +1,111 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Applications/BaseApplication.hpp"
+#include "Applications/Mixins/Udfm/UdfmMixin.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Basic/Fault/Models/SingleTransitionDelayFaultModel.hpp"
+#include "Basic/Fault/Models/CellAwareFaultModel.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/SwitchingActivity.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+template <typename FaultModel>
+class LowPowerPatternData
+{
+};
+
+template<>
+class LowPowerPatternData<Fault::SingleStuckAtFaultModel> {
+public:
+	LowPowerPatternData(std::string configPrefix);
+	virtual ~LowPowerPatternData(void);
+
+	bool SetSetting(std::string key, std::string value);
+	void Init(void);
+	void Run(void);
+
+};
+
+template<>
+class LowPowerPatternData<Fault::SingleTransitionDelayFaultModel> {
+public:
+	LowPowerPatternData(std::string configPrefix);
+	virtual ~LowPowerPatternData(void);
+
+	bool SetSetting(std::string key, std::string value);
+	void Init(void);
+	void Run(void);
+
+};
+
+template<>
+class LowPowerPatternData<Fault::CellAwareFaultModel>:
+	public Mixin::UdfmMixin
+{
+public:
+	LowPowerPatternData(std::string configPrefix);
+	virtual ~LowPowerPatternData(void);
+
+	bool SetSetting(std::string key, std::string value);
+	void Init(void);
+	void Run(void);
+
+};
+
+/**
+ * @brief Analyzes and reduces the switching activity of test patterns.
+ *
+ * The shift and capture activity of each pattern is estimated from a fault-free
+ * simulation (see Simulation::GetSwitchingActivity). The don't care values of the
+ * patterns are filled to lower the activity and the patterns are reordered so that
+ * all patterns within the shift and capture budget are applied first. The tester
+ * only has to reduce the scan frequency for the remaining patterns.
+ *
+ * The fault coverage of the processed patterns is recomputed by fault simulation.
+ * The processed patterns, the fault list and the activity of each pattern are exported.
+ */
+template<typename FaultModel, typename FaultList>
+class LowPowerPatternProcessing:
+	public virtual BaseApplication,
+	public LowPowerPatternData<FaultModel>
+{
+public:
+	LowPowerPatternProcessing(void);
+	virtual ~LowPowerPatternProcessing(void);
+
+	void Init(void) override;
+	void Run(void) override;
+	bool SetSetting(std::string key, std::string value) override;
+
+private:
+	enum class FillStrategy { None, Zero, One, Adjacent, MinimumActivity };
+	enum class Reordering { Disabled, Enabled };
+
+	Pattern::TestPattern FillPattern(const Pattern::TestPattern& pattern, const Simulation::SimulationConfig& config) const;
+	double GetBudgetRatio(const Simulation::SwitchingActivity& activity) const;
+	bool IsWithinBudget(const Simulation::SwitchingActivity& activity) const;
+	void ExportActivity(const std::vector<size_t>& order, const std::vector<Simulation::SwitchingActivity>& originalActivity,
+		const std::vector<Simulation::SwitchingActivity>& activity) const;
+
+	FillStrategy _fillStrategy;
+	Reordering _reordering;
+	size_t _shiftBudget;
+	size_t _captureBudget;
+	std::string _activityFile;
+
+};
+
+};
+};
+};
@@ -69,7 +69,7 @@ void TestPatternsToStatistics<FaultModel, FaultList>::Run(void)
 	VLOG(6) << to_debug(this->circuit->GetUnmappedCircuit(), VLOG_VERBOSE(9));
 	VLOG(6) << to_debug(this->circuit->GetMappedCircuit(), VLOG_VERBOSE(9));
 
-	FileHandle patternFileHandle("[DataImportDirectory]/patterns.json", true);
+	FileHandle patternFileHandle("[DataImportDirectory]/patterns.[DataExchangeExtension]", true);
 	auto patternResult = Io::ImportPatterns(patternFileHandle.GetStream(), *this->circuit);
 	if (!patternResult) LOG(FATAL) << "Test patterns could not be read";
 
@@ -6,19 +6,28 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <poll.h>
+
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <execution>
+#include <filesystem>
 #include <iostream>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <random>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "Applications/Scale4Edge/TestPatternGeneration/Base/ShardingCoordinator.hpp"
 #include "Basic/ApplicationStatistics.hpp"
 #include "Basic/CpuClock.hpp"
 #include "Basic/Logic.hpp"
@@ -39,7 +48,11 @@
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Circuit/CircuitMetaData.hpp"
 #include "Circuit/DriverFinder.hpp"
+#include "Circuit/StructuralAnalysis.hpp"
 #include "Helper/FileHandle.hpp"
+#include "Io/AtpgCheckpoint/AtpgCheckpoint.hpp"
+#include "Io/AtpgSharding/ShardingProtocol.hpp"
+#include "Io/FaultCoverage/CoverageDatabase.hpp"
 #include "Io/FaultListParser/FaultListParser.hpp"
 #include "Io/StilExporter/StilExporter.hpp"
 #include "Io/TestPatternParser/TestPatternParser.hpp"
@@ -47,6 +60,7 @@
 #include "Io/VcdExporter/VcdModel.hpp"
 #include "Io/UserDefinedFaultModel/UdfmParser.hpp"
 #include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/FaultSimulator.hpp"
 #include "SolverProxy/Sat/SatSolverProxy.hpp"
 #include "Tpg/LogicGenerator/TestPatternExtractor.hpp"
 #include "Tpg/LogicGenerator/LogicGenerator.hpp"
@@ -121,6 +135,7 @@ bool AtpgData<SingleStuckAtFaultModel>::SetSetting(std::string key, std::string
 		return Settings::ParseEnum(value, faultListReduction, {
 			{ "Original", FaultListReduction::Original },
 			{ "RemoveEquivalent", FaultListReduction::RemoveEquivalent },
+			{ "RemoveDominating", FaultListReduction::RemoveDominating },
 		});
 	}
 
@@ -184,6 +199,96 @@ void AtpgData<CellAwareFaultModel>::Run(void)
 	UdfmMixin::Run();
 }
 
+template <typename FaultModel, typename FaultList>
+struct AtpgBase<FaultModel, FaultList>::FaultSnapshot
+{
+	enum class DetectionCount { Absolute, Increment };
+
+	void Initialize(FaultList& faultList)
+	{
+		for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+		{
+			auto [fault, faultMetaData] = faultList[faultIndex];
+			metaData.push_back(faultMetaData);
+			const auto faultStatus { faultMetaData->GetStatus() };
+			status.push_back(faultStatus.status);
+			targetedStatus.push_back(faultStatus.targetedStatus);
+			detectionCount.push_back(faultMetaData->detectionCount);
+		}
+	}
+
+	// Returns the faults that have changed since the previous call.
+	// The detection count is either the current count or the number of detections since the previous call.
+	std::vector<Io::CheckpointFault> CollectChanges(size_t numberOfPatterns, DetectionCount count)
+	{
+		std::vector<Io::CheckpointFault> faults;
+		for (size_t faultIndex { 0u }; faultIndex < metaData.size(); ++faultIndex)
+		{
+			const auto& faultMetaData { metaData[faultIndex] };
+			const auto [faultStatus, faultTargetedStatus] { faultMetaData->GetStatus() };
+			const size_t faultDetectionCount { faultMetaData->detectionCount };
+			if (faultStatus == status[faultIndex]
+				&& faultTargetedStatus == targetedStatus[faultIndex]
+				&& faultDetectionCount == detectionCount[faultIndex])
+			{
+				continue;
+			}
+
+			// The detecting pattern is assigned by the fault simulation after the status transition.
+			// The fault is returned by a later call when the pattern has not been returned yet.
+			// The pattern id is published after the timeframe and is therefore loaded first.
+			const size_t detectingPatternId { faultMetaData->detectingPatternId.load(std::memory_order_acquire) };
+			const size_t detectingTimeframe { faultMetaData->detectingTimeframe.load(std::memory_order_relaxed) };
+			if (faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED && detectingPatternId >= numberOfPatterns)
+			{
+				continue;
+			}
+
+			faults.push_back({
+				.faultIndex = faultIndex,
+				.status = faultStatus,
+				.targetedStatus = faultTargetedStatus,
+				.detectingPatternId = detectingPatternId,
+				.detectingTimeframe = detectingTimeframe,
+				.detectionCount = (count == DetectionCount::Absolute) ? faultDetectionCount : (faultDetectionCount - detectionCount[faultIndex])
+			});
+			Update(faultIndex, faultStatus, faultTargetedStatus, faultDetectionCount);
+		}
+		return faults;
+	}
+
+	void Update(size_t faultIndex, Fault::FaultStatus faultStatus, Fault::TargetedFaultStatus faultTargetedStatus, size_t faultDetectionCount)
+	{
+		status[faultIndex] = faultStatus;
+		targetedStatus[faultIndex] = faultTargetedStatus;
+		detectionCount[faultIndex] = faultDetectionCount;
+	}
+
+	// The metadata is cached to not lock the fault list while the changes are collected
+	std::vector<std::shared_ptr<FaultMetaData>> metaData;
+	std::vector<Fault::FaultStatus> status;
+	std::vector<Fault::TargetedFaultStatus> targetedStatus;
+	std::vector<size_t> detectionCount;
+};
+
+template <typename FaultModel, typename FaultList>
+struct AtpgBase<FaultModel, FaultList>::CheckpointState
+{
+	CheckpointState(const Circuit::CircuitEnvironment& circuit, std::string filename, size_t numberOfFaults, uint64_t faultListHash):
+		writer(circuit, filename, numberOfFaults, faultListHash)
+	{
+	}
+
+	Io::CheckpointWriter writer;
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool stop { false };
+
+	// The state of the faults that has been written by the previous checkpoint
+	FaultSnapshot snapshot;
+};
+
 template <typename FaultModel, typename FaultList>
 AtpgBase<FaultModel, FaultList>::AtpgBase(std::string configPrefix):
 	Mixin::StatisticsMixin(configPrefix),
@@ -201,10 +306,12 @@ AtpgBase<FaultModel, FaultList>::AtpgBase(std::string configPrefix):
 	faultListFilter(".*"),
 	faultListExclude(""),
 	testPatterns(),
+	patternGrades(),
 	statPatternsGenerated(),
 	printFaultListReport(PrintFaultListReport::PrintSummary),
 	faultSimulation(FaultSimulation::Enabled),
 	testPatternExport(TestPatternExport::Enabled),
+	coverageDatabaseExport(CoverageDatabaseExport::Disabled),
 	printPatternReport(PrintTestPatternReport::PrintSummary),
 	simulateAllFaults(SimulateAllFaults::Disabled),
 	checkSimulation(CheckSimulation::Disabled),
@@ -214,16 +321,28 @@ AtpgBase<FaultModel, FaultList>::AtpgBase(std::string configPrefix):
 	checkAtpgResult(CheckAtpgResult::Disabled),
 	checkMaxIterationCovered(CheckMaxIterationCovered::Disabled),
 	incrementalSimulation(IncrementalSimulation::Enabled),
+	structuralUntestability(StructuralUntestability::Disabled),
+	detectionLimit(1u),
+	checkpointExport(CheckpointExport::Disabled),
+	checkpointFile("[DataExportDirectory]/checkpoint.ftcp"),
+	checkpointInterval(10u * 60u),
+	resumeFromCheckpoint(ResumeFromCheckpoint::Disabled),
+	shardingMode(ShardingMode::Disabled),
+	shardingWorkers(2u),
+	shardingChunkSize(64u),
+	shardingSocket(-1),
 	patternGenerationThreadLimit(0u),
 	solverThreadLimit(1u),
 	solverTimeout(10u * 60u),
 	solverUntestabilityTimeout(3u * 60u),
 	simulationThreadLimit(0u),
+	numaPolicy(Parallel::NumaPolicy::Disabled),
 	faultListBegin(0u),
 	faultListEnd(std::numeric_limits<size_t>::max()),
 	parallelMutex(),
 	vcdDebugExportId(0u),
-	configPrefix(configPrefix)
+	configPrefix(configPrefix),
+	checkpointState()
 {
 	statPatternsGenerated.SetCollectValues(true);
 }
@@ -246,6 +365,8 @@ void AtpgBase<FaultModel, FaultList>::Init(void)
 template <typename FaultModel, typename FaultList>
 void AtpgBase<FaultModel, FaultList>::Run(void)
 {
+	Parallel::SetNumaPolicy(Parallel::Arena::PatternGeneration, numaPolicy);
+	Parallel::SetNumaPolicy(Parallel::Arena::FaultSimulation, numaPolicy);
 	Parallel::SetThreads(Parallel::Arena::General, 0u);
 	Parallel::SetThreads(Parallel::Arena::PatternGeneration, patternGenerationThreadLimit);
 	Parallel::SetThreads(Parallel::Arena::FaultSimulation, simulationThreadLimit);
@@ -310,6 +431,13 @@ bool AtpgBase<FaultModel, FaultList>::SetSetting(std::string key, std::string va
 			{ "Enabled", TestPatternExport::Enabled },
 		});
 	}
+	if (Settings::IsOption(key, "CoverageDatabaseExport", configPrefix))
+	{
+		return Settings::ParseEnum(value, coverageDatabaseExport, {
+			{ "Disabled", CoverageDatabaseExport::Disabled },
+			{ "Enabled", CoverageDatabaseExport::Enabled },
+		});
+	}
 	if (Settings::IsOption(key, "PatternGenerationThreadLimit", configPrefix))
 	{
 		return Settings::ParseSizet(value, patternGenerationThreadLimit);
@@ -330,6 +458,13 @@ bool AtpgBase<FaultModel, FaultList>::SetSetting(std::string key, std::string va
 	{
 		return Settings::ParseSizet(value, simulationThreadLimit);
 	}
+	if (Settings::IsOption(key, "NumaPolicy", configPrefix))
+	{
+		return Settings::ParseEnum(value, numaPolicy, {
+			{ "Disabled", Parallel::NumaPolicy::Disabled },
+			{ "Distributed", Parallel::NumaPolicy::Distributed },
+		});
+	}
 	if (Settings::IsOption(key, "FaultStartIndex", configPrefix))
 	{
 		return Settings::ParseSizet(value, faultListBegin);
@@ -363,6 +498,59 @@ bool AtpgBase<FaultModel, FaultList>::SetSetting(std::string key, std::string va
 			{ "Enabled", SimulateAllFaults::Enabled },
 		});
 	}
+	if (Settings::IsOption(key, "DetectionLimit", configPrefix))
+	{
+		return Settings::ParseSizet(value, detectionLimit) && detectionLimit > 0u;
+	}
+	if (Settings::IsOption(key, "CheckpointExport", configPrefix))
+	{
+		return Settings::ParseEnum(value, checkpointExport, {
+			{ "Disabled", CheckpointExport::Disabled },
+			{ "Enabled", CheckpointExport::Enabled },
+		});
+	}
+	if (Settings::IsOption(key, "CheckpointFile", configPrefix))
+	{
+		checkpointFile = value;
+		return true;
+	}
+	if (Settings::IsOption(key, "CheckpointInterval", configPrefix))
+	{
+		return Settings::ParseSizet(value, checkpointInterval) && checkpointInterval > 0u;
+	}
+	if (Settings::IsOption(key, "ResumeFromCheckpoint", configPrefix))
+	{
+		return Settings::ParseEnum(value, resumeFromCheckpoint, {
+			{ "Disabled", ResumeFromCheckpoint::Disabled },
+			{ "Enabled", ResumeFromCheckpoint::Enabled },
+		});
+	}
+	if (Settings::IsOption(key, "ShardingMode", configPrefix))
+	{
+		return Settings::ParseEnum(value, shardingMode, {
+			{ "Disabled", ShardingMode::Disabled },
+			{ "Coordinator", ShardingMode::Coordinator },
+			{ "Worker", ShardingMode::Worker },
+		});
+	}
+	if (Settings::IsOption(key, "ShardingWorkers", configPrefix))
+	{
+		return Settings::ParseSizet(value, shardingWorkers) && shardingWorkers > 0u;
+	}
+	if (Settings::IsOption(key, "ShardingChunkSize", configPrefix))
+	{
+		return Settings::ParseSizet(value, shardingChunkSize) && shardingChunkSize > 0u;
+	}
+	if (Settings::IsOption(key, "ShardingSocket", configPrefix))
+	{
+		size_t descriptor;
+		if (!Settings::ParseSizet(value, descriptor))
+		{
+			return false;
+		}
+		shardingSocket = static_cast<int>(descriptor);
+		return true;
+	}
 	if (Settings::IsOption(key, "CheckSimulation", configPrefix))
 	{
 		return Settings::ParseEnum(value, checkSimulation, {
@@ -406,6 +594,13 @@ bool AtpgBase<FaultModel, FaultList>::SetSetting(std::string key, std::string va
 			{ "Enabled", CheckMaxIterationCovered::Enabled },
 		});
 	}
+	if (Settings::IsOption(key, "StructuralUntestability", configPrefix))
+	{
+		return Settings::ParseEnum(value, structuralUntestability, {
+			{ "Disabled", StructuralUntestability::Disabled },
+			{ "Enabled", StructuralUntestability::Enabled },
+		});
+	}
 	if (Settings::IsOption(key, "IncrementalSimulation", configPrefix))
 	{
 		return Settings::ParseEnum(value, incrementalSimulation, {
@@ -755,6 +950,11 @@ void AtpgBase<FaultModel, FaultList>::GenerateFaultList(void)
 			{
 				reductions |= Fault::StuckAtFaultReduction::RemoveEquivalent;
 			}
+			if (this->faultListReduction == AtpgData<FaultModel>::FaultListReduction::RemoveDominating)
+			{
+				reductions |= Fault::StuckAtFaultReduction::RemoveEquivalent
+					| Fault::StuckAtFaultReduction::RemoveDominating;
+			}
 
 			generationTimer.SetTimeReference();
 			auto allFaults = Fault::GenerateStuckAtFaultList(*this->circuit);
@@ -944,6 +1144,55 @@ void AtpgBase<FaultModel, FaultList>::GenerateFaultList(void)
 	LOG(INFO) << "Considering faults from " << std::to_string(faultListBegin + 1u) << " to " << std::to_string(faultListEnd);
 	Logging::SetFaultLimits(faultListBegin, faultListEnd);
 	ResetStatistics();
+
+	if (structuralUntestability == StructuralUntestability::Enabled)
+	{
+		ClassifyStructurallyUntestableFaults();
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::ClassifyStructurallyUntestableFaults(void)
+{
+	if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>
+		|| std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
+	{
+		CpuClock analysisTimer;
+		analysisTimer.SetTimeReference();
+
+		const Circuit::StructuralAnalysis analysis { this->circuit->GetMappedCircuit() };
+		std::atomic<size_t> untestableFaults { 0u };
+		Parallel::ExecuteParallelInBlocks(0u, faultList.size(), 4096u, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t faultIndex { begin }; faultIndex < end; ++faultIndex)
+			{
+				const auto fault { faultList.GetFault(faultIndex) };
+
+				bool untestable;
+				if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>)
+				{
+					const StuckAtFaultType type { fault->GetType() };
+					untestable = (type == StuckAtFaultType::STUCK_AT_0 || type == StuckAtFaultType::STUCK_AT_1)
+						&& analysis.IsStuckAtUntestable(fault->GetNodeAndPort(), (type == StuckAtFaultType::STUCK_AT_0) ? Logic::LOGIC_ZERO : Logic::LOGIC_ONE);
+				}
+				else
+				{
+					untestable = analysis.IsTransitionUntestable(fault->GetNodeAndPort());
+				}
+
+				// Faults that are proven untestable don't need a SAT encoding anymore
+				if (untestable && this->TrySetFaultStatus(faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+						Fault::FaultStatus::FAULT_STATUS_UNDETECTED, Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE_STRUCTURAL))
+				{
+					untestableFaults++;
+				}
+			}
+		});
+		analysisTimer.Stop();
+
+		LOG(INFO) << "Classified " << untestableFaults << " faults as structurally untestable";
+		statistics.Add("FaultList.StructurallyUntestableFaults", untestableFaults.load(), "Fault(s)", "The number of faults which were proven untestable by structural analysis");
+		statistics.Add("FaultList.StructuralAnalysisTime", analysisTimer.RunTimeSinceReference(), "Second(s)", "The time for the structural untestability analysis");
+	}
 }
 
 template <typename FaultModel, typename FaultList>
@@ -1001,10 +1250,10 @@ void AtpgBase<FaultModel, FaultList>::ValidateAtpgResult(size_t faultIndex, Patt
 		const auto exportId = vcdDebugExportId.fetch_add(1u, std::memory_order_acq_rel);
 		const auto exportInfo = this->GetBadSimulationVcdInfo(*this->circuit, { .patternId = exportId, .pattern = pattern }, { .faultId = faultIndex, .fault = *fault });
 
-		Io::Vcd::ExportVcd(this->vcdModelBuilder.BuildVcdModel(atpgGoodResult, *this->circuit, exportInfo.header), this->vcdExportDirectory + "/" + std::to_string(exportId) + "-atpg-good.vcd");
-		Io::Vcd::ExportVcd(this->vcdModelBuilder.BuildVcdModel(atpgBadResult, *this->circuit, exportInfo.header), this->vcdExportDirectory + "/" + std::to_string(exportId) + "-atpg-bad.vcd");
-		Io::Vcd::ExportVcd(this->vcdModelBuilder.BuildVcdModel(simGoodResult, *this->circuit, exportInfo.header), this->vcdExportDirectory + "/" + std::to_string(exportId) + "-sim-good.vcd");
-		Io::Vcd::ExportVcd(this->vcdModelBuilder.BuildVcdModel(simBadResult, *this->circuit, exportInfo.header), this->vcdExportDirectory + "/" + std::to_string(exportId) + "-sim-bad.vcd");
+		this->vcdWriter.ExportVcd(atpgGoodResult, this->vcdExportDirectory + "/" + std::to_string(exportId) + "-atpg-good.vcd", exportInfo.header);
+		this->vcdWriter.ExportVcd(atpgBadResult, this->vcdExportDirectory + "/" + std::to_string(exportId) + "-atpg-bad.vcd", exportInfo.header);
+		this->vcdWriter.ExportVcd(simGoodResult, this->vcdExportDirectory + "/" + std::to_string(exportId) + "-sim-good.vcd", exportInfo.header);
+		this->vcdWriter.ExportVcd(simBadResult, this->vcdExportDirectory + "/" + std::to_string(exportId) + "-sim-bad.vcd", exportInfo.header);
 	}
 
 	for (size_t timeframe = 0u; timeframe < atpgGoodResult.GetNumberOfTimeframes(); ++timeframe)
@@ -1043,6 +1292,8 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 
 	CpuClock totalSimulationClock;
 	totalSimulationClock.SetTimeReference();
+	std::atomic<size_t> newDetections { 0u };
+	std::atomic<size_t> detections { 0u };
 #ifndef NDEBUG
 	std::atomic<size_t> faultsCoveredBySimulation { 0u };
 	CpuClock initialFaultFreeSimulationClock;
@@ -1053,10 +1304,7 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 
 #ifndef NDEBUG
 	initialFaultFreeSimulationClock.Stop();
-	{
-		std::scoped_lock lock { parallelMutex };
-		initialFaultFreeSimulationTime.AddValue(initialFaultFreeSimulationClock.TotalRunTime());
-	}
+	initialFaultFreeSimulationTimeLocal.AddValue(initialFaultFreeSimulationClock.TotalRunTime());
 #endif
 
 	Mixin::VcdExportMixin<FaultList>::ExportVcdForGoodSimulation({ patternIndex, *testPattern }, goodResult);
@@ -1071,10 +1319,13 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 
 		for (size_t faultIndex = begin; faultIndex < end; ++faultIndex)
 		{
-			// Check for already detected faults if not SimulateAllFaults option is enabled
+			// Check for already detected faults if not SimulateAllFaults option is enabled.
+			// Detected faults are dropped once they have been detected by enough patterns (n-detect).
 			auto [fault, metaData] = faultList[faultIndex];
 			if (simulateAllFaults != SimulateAllFaults::Enabled
-				&& metaData->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+				&& metaData->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED
+				&& (metaData->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED
+					|| metaData->detectionCount >= detectionLimit))
 			{
 				continue;
 			}
@@ -1108,8 +1359,7 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 
 				#ifndef NDEBUG
 					eventDrivenSimulationClock.Stop();
-					std::scoped_lock lock { parallelMutex };
-					eventDrivenSimulationTime.AddValue(eventDrivenSimulationClock.TotalRunTime());
+					eventDrivenSimulationTimeLocal.AddValue(eventDrivenSimulationClock.TotalRunTime());
 				#endif
 
 					break;
@@ -1127,8 +1377,7 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 
 				#ifndef NDEBUG
 					eventDrivenSimulationIncrementalClock.Stop();
-					std::scoped_lock lock { parallelMutex };
-					eventDrivenSimulationIncrementalTime.AddValue(eventDrivenSimulationIncrementalClock.TotalRunTime());
+					eventDrivenSimulationIncrementalTimeLocal.AddValue(eventDrivenSimulationIncrementalClock.TotalRunTime());
 				#endif
 
 					break;
@@ -1334,36 +1583,43 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 						<< (difference ? " (Difference detected)" : "");
 					if (__builtin_expect(difference, false))
 					{
+						if (checkMaxIterationCovered == CheckMaxIterationCovered::Enabled
+							&& metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED
+							&& metaData->GetTargetedFaultStatus() == Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS)
 						{
-							std::scoped_lock lock { parallelMutex };
-							if (metaData->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-							{
-								if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNDETECTED)
-								{
-									LOG(FATAL) << "Undetectable fault " << faultIndex << " " << to_string(*fault)
-										<< " with status " << to_string(metaData->faultStatus) << "/" << to_string(metaData->targetedFaultStatus)
-										<< " was found by test pattern " << patternIndex << "!";
-								}
-								goto nextFault;
-							}
+							LOG(FATAL) << "Fault " << faultIndex << " " << to_string(*fault)
+								<< " with status " << to_string(metaData->GetFaultStatus()) << "/" << to_string(metaData->GetTargetedFaultStatus())
+								<< " was found by test pattern " << patternIndex << "!";
+						}
 
-							if (checkMaxIterationCovered == CheckMaxIterationCovered::Enabled
-								&& metaData->targetedFaultStatus == Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS)
+						// The thread that wins the status transition exclusively owns the detection data.
+						if (!Mixin::FaultStatisticsMixin<FaultList>::TrySetFaultStatus(faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+							Fault::FaultStatus::FAULT_STATUS_DETECTED, Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE))
+						{
+							if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNDETECTED)
 							{
-								LOG(FATAL) << "Fault " << faultIndex << " " << to_string(*fault)
-									<< " with status " << to_string(metaData->faultStatus) << "/" << to_string(metaData->targetedFaultStatus)
+								LOG(FATAL) << "Undetectable fault " << faultIndex << " " << to_string(*fault)
+									<< " with status " << to_string(metaData->GetFaultStatus()) << "/" << to_string(metaData->GetTargetedFaultStatus())
 									<< " was found by test pattern " << patternIndex << "!";
 							}
+							if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED
+								&& metaData->IncrementDetectionCount(detectionLimit))
+							{
+								detections += 1u;
+							}
+							goto nextFault;
+						}
 
-							Mixin::FaultStatisticsMixin<FaultList>::SetFaultStatus(faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_DETECTED,
-								Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE);
+						metaData->IncrementDetectionCount(detectionLimit);
+						newDetections += 1u;
+						detections += 1u;
 
-							metaData->detectingPatternId = patternIndex;
-							metaData->detectingTimeframe = timeframe;
-							metaData->detectingNode = { primaryOutput, { Circuit::PortType::Input, 0u } };
-							metaData->detectingOutputGood = good;
-							metaData->detectingOutputBad = bad;
-						}
+						// The detection data is published by the release-store of the pattern id
+						metaData->detectingNode = { primaryOutput, { Circuit::PortType::Input, 0u } };
+						metaData->detectingOutputGood = good;
+						metaData->detectingOutputBad = bad;
+						metaData->detectingTimeframe.store(timeframe, std::memory_order_relaxed);
+						metaData->detectingPatternId.store(patternIndex, std::memory_order_release);
 
 					#ifndef NDEBUG
 						if (__builtin_expect(faultIndex != targetFaultIndex, true))
@@ -1388,36 +1644,43 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 						<< (difference ? " (Difference detected)" : "");
 					if (__builtin_expect(difference, false))
 					{
+						if (checkMaxIterationCovered == CheckMaxIterationCovered::Enabled
+							&& metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED
+							&& metaData->GetTargetedFaultStatus() == Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS)
 						{
-							std::scoped_lock lock { parallelMutex };
-							if (metaData->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-							{
-								if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNDETECTED)
-								{
-									LOG(FATAL) << "Undetectable fault " << faultIndex << " " << to_string(*fault)
-										<< " with status " << to_string(metaData->faultStatus) << "/" << to_string(metaData->targetedFaultStatus)
-										<< " was found by test pattern " << patternIndex << "!";
-								}
-								goto nextFault;
-							}
+							LOG(FATAL) << "Fault " << faultIndex << " " << to_string(*fault)
+								<< " with status " << to_string(metaData->GetFaultStatus()) << "/" << to_string(metaData->GetTargetedFaultStatus())
+								<< " was found by test pattern " << patternIndex << "!";
+						}
 
-							if (checkMaxIterationCovered == CheckMaxIterationCovered::Enabled
-								&& metaData->targetedFaultStatus == Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS)
+						// The thread that wins the status transition exclusively owns the detection data.
+						if (!Mixin::FaultStatisticsMixin<FaultList>::TrySetFaultStatus(faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+							Fault::FaultStatus::FAULT_STATUS_DETECTED, Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE))
+						{
+							if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNDETECTED)
 							{
-								LOG(FATAL) << "Fault " << faultIndex << " " << to_string(*fault)
-									<< " with status " << to_string(metaData->faultStatus) << "/" << to_string(metaData->targetedFaultStatus)
+								LOG(FATAL) << "Undetectable fault " << faultIndex << " " << to_string(*fault)
+									<< " with status " << to_string(metaData->GetFaultStatus()) << "/" << to_string(metaData->GetTargetedFaultStatus())
 									<< " was found by test pattern " << patternIndex << "!";
 							}
+							if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED
+								&& metaData->IncrementDetectionCount(detectionLimit))
+							{
+								detections += 1u;
+							}
+							goto nextFault;
+						}
 
-							Mixin::FaultStatisticsMixin<FaultList>::SetFaultStatus(faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_DETECTED,
-								Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE);
+						metaData->IncrementDetectionCount(detectionLimit);
+						newDetections += 1u;
+						detections += 1u;
 
-							metaData->detectingPatternId = patternIndex;
-							metaData->detectingTimeframe = timeframe;
-							metaData->detectingNode = { secondaryOutput, { Circuit::PortType::Input, 0u } };
-							metaData->detectingOutputGood = good;
-							metaData->detectingOutputBad = bad;
-						}
+						// The detection data is published by the release-store of the pattern id
+						metaData->detectingNode = { secondaryOutput, { Circuit::PortType::Input, 0u } };
+						metaData->detectingOutputGood = good;
+						metaData->detectingOutputBad = bad;
+						metaData->detectingTimeframe.store(timeframe, std::memory_order_relaxed);
+						metaData->detectingPatternId.store(patternIndex, std::memory_order_release);
 
 					#ifndef NDEBUG
 						if (__builtin_expect(faultIndex != targetFaultIndex, true))
@@ -1444,8 +1707,7 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 
 	#ifndef NDEBUG
 		simulateForFaultClock.Stop();
-		std::scoped_lock lock { parallelMutex };
-		simulateForFaultTime.AddValue(simulateForFaultClock.TotalRunTime());
+		simulateForFaultTimeLocal.AddValue(simulateForFaultClock.TotalRunTime());
 	#endif
 	};
 
@@ -1459,124 +1721,22 @@ void AtpgBase<FaultModel, FaultList>::RunFaultSimulation(const Tpg::Vcm::VcmCont
 	}
 
 	totalSimulationClock.Stop();
-	std::scoped_lock lock { parallelMutex };
-	totalSimulationTime.AddValue(totalSimulationClock.TotalRunTime());
+	totalSimulationTimeLocal.AddValue(totalSimulationClock.TotalRunTime());
 #ifndef NDEBUG
-	faultsCoveredBySimulationStat.AddValue(faultsCoveredBySimulation);
+	faultsCoveredBySimulationStatLocal.AddValue(faultsCoveredBySimulation);
 #endif
+
+	// Growing the concurrent vector keeps the existing slots in place.
+	// Therefore, the grades of different patterns are written without a lock.
+	patternGrades.grow_to_at_least(patternIndex + 1u, { 0u, 0u });
+	patternGrades[patternIndex].newDetections += newDetections;
+	patternGrades[patternIndex].detections += detections;
 }
 
 template <typename FaultModel, typename FaultList>
 bool AtpgBase<FaultModel, FaultList>::CheckSensitization(const FaultModel& faultModel, const Simulation::SimulationResult& goodResult) const
 {
-	const auto& mappedCircuit { this->circuit->GetMappedCircuit() };
-
-	if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>)
-	{
-		const auto& fault { faultModel.GetFault() };
-		const auto& stuckAt { fault->GetStuckAt() };
-		const size_t nodeId { mappedCircuit.GetDriverForPort(stuckAt)->GetNodeId() };
-		for (size_t timeframeId = 0u; timeframeId < goodResult.GetNumberOfTimeframes(); ++timeframeId)
-		{
-			const Logic& value = goodResult[timeframeId][nodeId];
-			if (__builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_1 && value == Logic::LOGIC_ZERO, false)
-				|| __builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_0 && value == Logic::LOGIC_ONE, false))
-			{
-				return true;
-			}
-		}
-		return false;
-	}
-	else if constexpr (std::is_same_v<FaultModel, Fault::MultiStuckAtFaultModel>)
-	{
-		const auto& fault { faultModel.GetFault() };
-		for (const auto& stuckAt : fault.GetStuckAts())
-		{
-			const size_t nodeId = mappedCircuit.GetDriverForPort(stuckAt)->GetNodeId();
-			for (size_t timeframeId = 0u; timeframeId < goodResult.GetNumberOfTimeframes(); ++timeframeId)
-			{
-				const Logic& value = goodResult[timeframeId][nodeId];
-				if (__builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_1 && value == Logic::LOGIC_ZERO, false)
-					|| __builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_0 && value == Logic::LOGIC_ONE, false))
-				{
-					return true;
-				}
-			}
-		}
-		return false;
-	}
-	else if constexpr (std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
-	{
-		const auto& fault { faultModel.GetFault() };
-		const auto& transitionDelay { fault->GetTransitionDelay() };
-		const size_t nodeId { mappedCircuit.GetDriverForPort(transitionDelay)->GetNodeId() };
-		for (size_t timeframeId = 0u; timeframeId + 1u < goodResult.GetNumberOfTimeframes(); ++timeframeId)
-		{
-			const Logic& initialValue = goodResult[timeframeId][nodeId];
-			const Logic& finalValue = goodResult[timeframeId + 1u][nodeId];
-			if (__builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_RISE && initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE, false)
-				|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_FALL && initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO, false)
-				|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_TRANSITION
-					&& ((initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE)
-						|| (initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO)), false))
-			{
-				return true;
-			}
-		}
-		return false;
-	}
-	else if constexpr (std::is_same_v<FaultModel, Fault::MultiTransitionDelayFaultModel>)
-	{
-		const auto& fault { faultModel.GetFault() };
-		for (const auto& transitionDelay : fault.GetTransitionDelays())
-		{
-			const size_t nodeId = mappedCircuit.GetDriverForPort(transitionDelay)->GetNodeId();
-			for (size_t timeframeId = 0u; timeframeId + 1u < goodResult.GetNumberOfTimeframes(); ++timeframeId)
-			{
-				const Logic& initialValue = goodResult[timeframeId][nodeId];
-				const Logic& finalValue = goodResult[timeframeId + 1u][nodeId];
-				if (__builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_RISE && initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE, false)
-					|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_FALL && initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO, false)
-					|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_TRANSITION
-						&& ((initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE)
-							|| (initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO)), false))
-				{
-					return true;
-				}
-			}
-		}
-		return false;
-	}
-	else if constexpr (std::is_same_v<FaultModel, Fault::CellAwareFaultModel>)
-	{
-		const auto& fault { faultModel.GetFault() };
-		for (const auto& alternative : fault->GetAlternatives())
-		{
-			for (size_t timeframeId { 0u }; timeframeId < goodResult.GetNumberOfTimeframes(); timeframeId++)
-			{
-				// Not enough timeframes left to be able to fulfill conditions
-				bool satisfied { (timeframeId + alternative.conditions[0].logicConstraints.size()) <= goodResult.GetNumberOfTimeframes() };
-				for (const auto& condition : alternative.conditions)
-				{
-					if (!satisfied) { break; }
-					for (size_t index { 0u }; index < alternative.conditions[0].logicConstraints.size(); index++)
-					{
-						if (!satisfied) { break; }
-						auto const targetNodeId { mappedCircuit.GetDriverForPort(condition.nodeAndPort)->GetNodeId() };
-						auto const goodValue { goodResult[timeframeId + index][targetNodeId] };
-						satisfied &= IsConstraintTrueForLogic(goodValue, condition.logicConstraints[index]);
-					}
-				}
-				if (satisfied) { return true; }
-			}
-		}
-		return false;
-	}
-	else
-	{
-		LOG(FATAL) << "Fault model not implemented";
-		__builtin_unreachable();
-	}
+	return Simulation::IsFaultSensitized(this->circuit->GetMappedCircuit(), faultModel, goodResult);
 }
 
 template <typename FaultModel, typename FaultList>
@@ -1904,6 +2064,60 @@ void AtpgBase<FaultModel, FaultList>::ExportStatistics(void)
 			.yAxisMin = 0.0,
 			.yAxisMax = static_cast<double>(testPatterns.size())
 		}, statPatternsGenerated);
+
+	ExportPatternGrades();
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::ExportPatternGrades(void)
+{
+	// The grades are in the order of the test patterns. Patterns that have not been
+	// simulated (fault simulation disabled for other faults) have no detections.
+	Statistic::AverageStatistic statNewDetections;
+	Statistic::AverageStatistic statDetections;
+	statNewDetections.SetCollectValues(true);
+	statDetections.SetCollectValues(true);
+	for (size_t patternIndex { 0u }; patternIndex < testPatterns.size(); ++patternIndex)
+	{
+		const PatternGrade grade { (patternIndex < patternGrades.size()) ? patternGrades[patternIndex] : PatternGrade { 0u, 0u } };
+		statNewDetections.AddValue(grade.newDetections);
+		statDetections.AddValue(grade.detections);
+	}
+
+	size_t faultDetections { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metaData] = faultList[faultIndex];
+		faultDetections += std::min<size_t>(metaData->detectionCount, detectionLimit);
+	}
+	const double nDetectCoverage { (faultList.size() == 0u) ? 0.0
+		: 100.0 * static_cast<double>(faultDetections) / static_cast<double>(faultList.size() * detectionLimit) };
+
+	statistics.Add("Atpg.Faults.DetectionLimit", detectionLimit, "Detection(s)", "The number of detections after which a fault is dropped from the fault simulation");
+	statistics.Add("Atpg.Faults.NDetectCoverage", nDetectCoverage, "Percent", "The percentage of fault detections up to the detection limit that are achieved by the test patterns");
+
+	Mixin::StatisticsMixin::ExportStatistics("plots/PatternCoverage", {
+			{
+				.xAxisLabel = "Pattern",
+				.yAxisLabel = "Faults",
+				.dataIsCumulative = Io::StatisticsExporter::CumulativeStatistics::NotCumulative,
+				.plotCumulative = Io::StatisticsExporter::CumulativeStatistics::Cumulative,
+			},
+			.title = "Detected Faults per Test Pattern",
+			.yAxisMin = 0.0,
+			.yAxisMax = static_cast<double>(faultList.size())
+		}, statNewDetections);
+	Mixin::StatisticsMixin::ExportStatistics("plots/PatternDetections", {
+			{
+				.xAxisLabel = "Pattern",
+				.yAxisLabel = "Detections",
+				.dataIsCumulative = Io::StatisticsExporter::CumulativeStatistics::NotCumulative,
+				.plotCumulative = Io::StatisticsExporter::CumulativeStatistics::Cumulative,
+			},
+			.title = "Fault Detections (N-Detect) per Test Pattern",
+			.yAxisMin = 0.0,
+			.yAxisMax = static_cast<double>(faultList.size() * detectionLimit)
+		}, statDetections);
 }
 
 template <typename FaultModel, typename FaultList>
@@ -1914,10 +2128,10 @@ void AtpgBase<FaultModel, FaultList>::ExportTestPatterns(Pattern::InputCapture c
 		return;
 	}
 
-	FileHandle jsonPatternsHandle("[DataExportDirectory]/patterns.json", false);
+	FileHandle exchangePatternsHandle("[DataExportDirectory]/patterns.[DataExchangeExtension]", false);
 	FileHandle stilPatternsHandle("[DataExportDirectory]/patterns.stil", false);
 	Io::TestPatternExchangeFormat testPatternExport(*this->circuit, testPatterns, capture);
-	Io::ExportPatterns(jsonPatternsHandle.GetOutStream(), testPatternExport);
+	Io::ExportPatterns(exchangePatternsHandle.GetOutStream(), testPatternExport, Settings::GetInstance()->DataExchangeFormat);
 	Io::ExportStilPatterns(*this->circuit, testPatterns,
 		(capture == Pattern::InputCapture::PrimaryAndSecondaryInputs)
 			? Io::StilPatternType::FullScan : Io::StilPatternType::Sequential,
@@ -1937,12 +2151,437 @@ void AtpgBase<FaultModel, FaultList>::ExportFaultList(void) const
 		}
 	}
 
-	FileHandle faultListHandle("[DataExportDirectory]/faults.json", false);
-	FileHandle faultListWithEquivalentHandle("[DataExportDirectory]/faults.all.json", false);
+	FileHandle faultListHandle("[DataExportDirectory]/faults." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), false);
+	FileHandle faultListWithEquivalentHandle("[DataExportDirectory]/faults.all." + Io::GetFaultListExchangeExtension<FaultList>(Settings::GetInstance()->DataExchangeFormat), false);
 	Io::FaultListExchangeFormat<FaultList> faultListExport { *this->circuit, faultList };
 	Io::FaultListExchangeFormat<FaultList> faultListWithEquivalentExport { *this->circuit, faultListWithEquivalent };
-	Io::ExportFaults(faultListHandle.GetOutStream(), faultListExport);
-	Io::ExportFaults(faultListWithEquivalentHandle.GetOutStream(), faultListWithEquivalentExport);
+	Io::ExportFaults(faultListHandle.GetOutStream(), faultListExport, Settings::GetInstance()->DataExchangeFormat);
+	Io::ExportFaults(faultListWithEquivalentHandle.GetOutStream(), faultListWithEquivalentExport, Settings::GetInstance()->DataExchangeFormat);
+
+	if (coverageDatabaseExport == CoverageDatabaseExport::Enabled)
+	{
+		FileHandle coverageDatabaseHandle("[DataExportDirectory]/coverage.fcdb", false);
+		Io::FaultCoverage::ExportCoverageDatabase(coverageDatabaseHandle.GetOutStream(),
+			Io::FaultCoverage::CreateCoverageDatabase<FaultModel>(*this->circuit, faultList, testPatterns.size()));
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::StartCheckpoints(void)
+{
+	// The checkpoint is only resumed for the same circuit and fault list
+	const uint64_t faultListHash { Io::GetCheckpointFaultListHash(faultList) };
+	std::optional<Io::Checkpoint> checkpoint;
+	if (resumeFromCheckpoint == ResumeFromCheckpoint::Enabled)
+	{
+		const std::string filename { Settings::GetInstance()->MapFileName(checkpointFile, false) };
+		if (!std::filesystem::exists(filename))
+		{
+			LOG(WARNING) << "The checkpoint file " << filename << " does not exist. The test pattern generation starts from the beginning.";
+		}
+		else
+		{
+			std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+			checkpoint = Io::ImportCheckpoint(input, *this->circuit, faultList.size(), faultListHash);
+			if (!checkpoint)
+			{
+				LOG(FATAL) << "The checkpoint file " << filename << " could not be imported";
+			}
+
+			// Aborted faults are still unclassified and are targeted again
+			for (const auto& record : checkpoint->faults)
+			{
+				auto [fault, metaData] = faultList[record.faultIndex];
+				Mixin::FaultStatisticsMixin<FaultList>::SetFaultStatus(faultList, record.faultIndex, record.status, record.targetedStatus);
+				metaData->detectingTimeframe.store(record.detectingTimeframe, std::memory_order_relaxed);
+				metaData->detectingPatternId.store(record.detectingPatternId, std::memory_order_release);
+				metaData->detectionCount = record.detectionCount;
+			}
+			for (const auto& pattern : checkpoint->patterns)
+			{
+				testPatterns.emplace_back(pattern);
+			}
+
+			LOG(INFO) << "Resumed " << checkpoint->patterns.size() << " test patterns and "
+				<< checkpoint->faults.size() << " fault records from the checkpoint " << filename;
+		}
+	}
+
+	if (checkpointExport == CheckpointExport::Disabled)
+	{
+		return;
+	}
+
+	checkpointState = std::make_unique<CheckpointState>(*this->circuit, checkpointFile, faultList.size(), faultListHash);
+	auto& state { *checkpointState };
+	if (!(checkpoint ? state.writer.Continue(*checkpoint) : state.writer.Create()))
+	{
+		LOG(FATAL) << "The checkpoint file " << checkpointFile << " could not be opened";
+	}
+
+	state.snapshot.Initialize(faultList);
+
+	state.thread = std::thread([this, &state]() {
+		std::unique_lock lock { state.mutex };
+		while (!state.condition.wait_for(lock, std::chrono::seconds(checkpointInterval), [&state]() { return state.stop; }))
+		{
+			WriteCheckpoint(state);
+		}
+	});
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::StopCheckpoints(void)
+{
+	if (!checkpointState)
+	{
+		return;
+	}
+
+	{
+		std::scoped_lock lock { checkpointState->mutex };
+		checkpointState->stop = true;
+	}
+	checkpointState->condition.notify_all();
+	checkpointState->thread.join();
+
+	WriteCheckpoint(*checkpointState);
+	checkpointState.reset();
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::WriteCheckpoint(CheckpointState& state)
+{
+	// The patterns are never modified after they have been added to the list.
+	// Therefore, only the new patterns are appended. The workers keep adding
+	// patterns, so the pointers are copied while the list is locked.
+	const auto newPatterns { testPatterns.copy_range(state.writer.GetNumberOfPatterns(), std::numeric_limits<size_t>::max()) };
+	for (const auto& pattern : newPatterns)
+	{
+		state.writer.WritePattern(*pattern);
+	}
+	const size_t numberOfPatterns { state.writer.GetNumberOfPatterns() };
+
+	const auto faults { state.snapshot.CollectChanges(numberOfPatterns, FaultSnapshot::DetectionCount::Absolute) };
+	state.writer.WriteFaults(faults);
+	if (!state.writer.Commit())
+	{
+		LOG(FATAL) << "The checkpoint could not be written";
+	}
+	LOG(INFO) << "Checkpoint written with " << numberOfPatterns << " test patterns and " << faults.size() << " changed faults";
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::RunPatternGeneration(const std::function<void(size_t, size_t)>& generate)
+{
+	switch (shardingMode)
+	{
+		case ShardingMode::Disabled:
+			generate(faultListBegin, faultListEnd);
+			break;
+
+		case ShardingMode::Coordinator:
+			RunShardingCoordinator();
+			break;
+
+		case ShardingMode::Worker:
+			RunShardingWorker(generate);
+			break;
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::RunShardingCoordinator(void)
+{
+	using namespace Io::Sharding;
+
+	enum class WorkerState { Starting, Idle, Busy, Finished };
+	struct Worker
+	{
+		WorkerProcess process;
+		WorkerState state;
+	};
+
+	ShardingCoordinator<FaultList> coordinator(*this, faultList, testPatterns, detectionLimit,
+		shardingWorkers, faultListBegin, faultListEnd, shardingChunkSize);
+	const size_t numberOfChunks { coordinator.GetNumberOfChunks() };
+
+	// The workers load the same circuit and generate the same fault list from the command line of this process.
+	// Each worker exports its files into a separate directory below the export directory.
+	const size_t workerThreads { (patternGenerationThreadLimit != 0u) ? patternGenerationThreadLimit
+		: std::max<size_t>(1u, std::thread::hardware_concurrency() / shardingWorkers) };
+	const std::string exportDirectory { Settings::GetInstance()->MapFileName("[DataExportDirectory]", false) };
+	std::vector<Worker> workers;
+	for (size_t workerIndex { 0u }; workerIndex < shardingWorkers; ++workerIndex)
+	{
+		std::vector<std::string> arguments {
+			"--DataExportDirectory", exportDirectory + "/shard-" + std::to_string(workerIndex),
+			"--" + configPrefix + "/ShardingMode", "Worker",
+			"--" + configPrefix + "/PatternGenerationThreadLimit", std::to_string(workerThreads),
+			"--" + configPrefix + "/CheckpointExport", "Disabled",
+			"--" + configPrefix + "/ResumeFromCheckpoint", "Disabled",
+		};
+		if (!Settings::GetInstance()->StatisticsExportFilename.empty())
+		{
+			arguments.insert(arguments.end(), { "--StatisticsExportFilename", "[DataExportDirectory]/statistics.json" });
+		}
+
+		auto process { SpawnWorker(arguments, configPrefix + "/ShardingSocket") };
+		if (!process)
+		{
+			LOG(FATAL) << "Could not start the sharding worker " << workerIndex;
+		}
+		workers.push_back({ std::move(*process), WorkerState::Starting });
+	}
+	LOG(INFO) << "Started " << workers.size() << " sharding workers with " << workerThreads << " threads for " << numberOfChunks << " chunks";
+
+	// The chunk of a terminated worker is handed out to the next idle worker
+	auto fail_worker = [&](size_t workerIndex) {
+		auto& worker { workers[workerIndex] };
+		LOG(ERROR) << "The sharding worker " << workerIndex << " has terminated unexpectedly";
+		coordinator.FailWorker(workerIndex);
+		worker.state = WorkerState::Finished;
+		worker.process.channel.reset();
+	};
+	auto send_faults = [&](size_t workerIndex, const std::vector<Io::CheckpointFault>& faults) {
+		if (!workers[workerIndex].process.channel->Send(MessageType::Drop, EncodeFaults(faults)))
+		{
+			fail_worker(workerIndex);
+		}
+	};
+
+	size_t droppedFaults { 0u };
+	auto is_running = [](const Worker& worker) {
+		return worker.state == WorkerState::Starting || worker.state == WorkerState::Busy;
+	};
+	while (std::any_of(workers.begin(), workers.end(), is_running))
+	{
+		std::vector<pollfd> descriptors;
+		std::vector<size_t> workerIndices;
+		for (size_t workerIndex { 0u }; workerIndex < workers.size(); ++workerIndex)
+		{
+			if (is_running(workers[workerIndex]))
+			{
+				descriptors.push_back({ workers[workerIndex].process.channel->GetDescriptor(), POLLIN, 0 });
+				workerIndices.push_back(workerIndex);
+			}
+		}
+		if (poll(descriptors.data(), descriptors.size(), -1) < 0)
+		{
+			LOG_IF(errno != EINTR, FATAL) << "Could not wait for the sharding workers: " << std::strerror(errno);
+			continue;
+		}
+
+		for (size_t index { 0u }; index < descriptors.size(); ++index)
+		{
+			const size_t workerIndex { workerIndices[index] };
+			auto& worker { workers[workerIndex] };
+			if (descriptors[index].revents == 0 || !is_running(worker))
+			{
+				continue;
+			}
+
+			auto message { worker.process.channel->Receive() };
+			if (!message)
+			{
+				fail_worker(workerIndex);
+			}
+			else if (worker.state == WorkerState::Starting && message->type == MessageType::Hello)
+			{
+				if (!ValidateHello(message->payload, *this->circuit, faultList.size()))
+				{
+					LOG(ERROR) << "The sharding worker " << workerIndex << " uses a different circuit or fault list";
+					fail_worker(workerIndex);
+					continue;
+				}
+
+				// The faults that have been classified before (e.g. by a checkpoint) are not targeted by the worker
+				worker.state = WorkerState::Idle;
+				send_faults(workerIndex, coordinator.GetClassifiedFaults());
+			}
+			else if (worker.state == WorkerState::Busy && message->type == MessageType::Result)
+			{
+				auto result { DecodeResult(message->payload, this->circuit->GetMappedCircuit(), faultList.size()) };
+				if (!result)
+				{
+					LOG(ERROR) << "Received an invalid result from the sharding worker " << workerIndex;
+					fail_worker(workerIndex);
+					continue;
+				}
+
+				const auto dropped { coordinator.MergeResult(workerIndex, *result) };
+				worker.state = WorkerState::Idle;
+				droppedFaults += dropped.size();
+				VLOG(3) << "Merged " << result->patterns.size() << " test patterns and " << result->faults.size()
+					<< " faults of the sharding worker " << workerIndex;
+
+				// The other workers drop the faults from the fault simulation and the pattern generation
+				for (size_t otherIndex { 0u }; otherIndex < workers.size() && !dropped.empty(); ++otherIndex)
+				{
+					if (otherIndex != workerIndex && (workers[otherIndex].state == WorkerState::Idle || workers[otherIndex].state == WorkerState::Busy))
+					{
+						send_faults(otherIndex, dropped);
+					}
+				}
+			}
+			else
+			{
+				LOG(ERROR) << "Received an unexpected message from the sharding worker " << workerIndex;
+				fail_worker(workerIndex);
+			}
+		}
+
+		for (size_t workerIndex { 0u }; workerIndex < workers.size() && coordinator.HasChunks(); ++workerIndex)
+		{
+			auto& worker { workers[workerIndex] };
+			if (worker.state != WorkerState::Idle)
+			{
+				continue;
+			}
+
+			const auto chunk { *coordinator.AssignChunk(workerIndex) };
+			worker.state = WorkerState::Busy;
+			if (!worker.process.channel->Send(MessageType::Chunk, EncodeChunk(chunk.first, chunk.second)))
+			{
+				fail_worker(workerIndex);
+			}
+		}
+	}
+
+	if (coordinator.HasChunks())
+	{
+		LOG(FATAL) << "All sharding workers have terminated before the test pattern generation has been finished";
+	}
+
+	size_t failedWorkers { 0u };
+	for (size_t workerIndex { 0u }; workerIndex < workers.size(); ++workerIndex)
+	{
+		auto& worker { workers[workerIndex] };
+		if (worker.process.channel)
+		{
+			worker.process.channel->Send(MessageType::Finish, "");
+			worker.process.channel.reset();
+		}
+	}
+	for (size_t workerIndex { 0u }; workerIndex < workers.size(); ++workerIndex)
+	{
+		if (!WaitForWorker(workers[workerIndex].process.pid))
+		{
+			LOG(WARNING) << "The sharding worker " << workerIndex << " has not exited successfully";
+			failedWorkers++;
+		}
+	}
+
+	this->statistics.Add("Atpg.Sharding.Workers", workers.size(), "Worker(s)", "The number of worker processes of the sharded test pattern generation");
+	this->statistics.Add("Atpg.Sharding.FailedWorkers", failedWorkers, "Worker(s)", "The number of worker processes that have not exited successfully");
+	this->statistics.Add("Atpg.Sharding.Chunks", numberOfChunks, "Chunk(s)", "The number of fault chunks that have been handed out to the workers");
+	this->statistics.Add("Atpg.Sharding.DroppedFaults", droppedFaults, "Fault(s)", "The number of faults that have been dropped by the workers after the detection by another worker");
+}
+
+template <typename FaultModel, typename FaultList>
+void AtpgBase<FaultModel, FaultList>::RunShardingWorker(const std::function<void(size_t, size_t)>& generate)
+{
+	using namespace Io::Sharding;
+
+	Channel channel { shardingSocket };
+	if (!channel.Send(MessageType::Hello, EncodeHello(*this->circuit, faultList.size())))
+	{
+		LOG(FATAL) << "Could not connect to the sharding coordinator";
+	}
+
+	// The snapshot is shared with the receiver thread, which updates it for the dropped faults.
+	// This prevents that the dropped faults are reported back to the coordinator.
+	FaultSnapshot snapshot;
+	std::mutex snapshotMutex;
+	snapshot.Initialize(faultList);
+
+	// An empty chunk finishes the worker
+	std::deque<std::optional<std::pair<size_t, size_t>>> chunks;
+	std::mutex chunkMutex;
+	std::condition_variable chunkCondition;
+	auto push_chunk = [&](std::optional<std::pair<size_t, size_t>> chunk) {
+		{
+			std::scoped_lock lock { chunkMutex };
+			chunks.push_back(chunk);
+		}
+		chunkCondition.notify_one();
+	};
+
+	// The faults are dropped while the pattern generation is running
+	std::thread receiver([&]() {
+		while (true)
+		{
+			auto message { channel.Receive() };
+			if (!message || message->type == MessageType::Finish)
+			{
+				LOG_IF(!message, ERROR) << "The connection to the sharding coordinator has been lost";
+				push_chunk(std::nullopt);
+				return;
+			}
+
+			if (message->type == MessageType::Chunk)
+			{
+				auto chunk { DecodeChunk(message->payload) };
+				LOG_IF(!chunk || chunk->second > faultList.size(), FATAL) << "Received an invalid chunk from the sharding coordinator";
+				push_chunk(chunk);
+			}
+			else if (message->type == MessageType::Drop)
+			{
+				auto faults { DecodeFaults(message->payload, faultList.size()) };
+				LOG_IF(!faults, FATAL) << "Received invalid faults from the sharding coordinator";
+
+				std::scoped_lock lock { snapshotMutex };
+				for (const auto& record : *faults)
+				{
+					// Faults that have been detected by this worker in the meantime are reported as usual
+					if (Mixin::FaultStatisticsMixin<FaultList>::TrySetFaultStatus(faultList, record.faultIndex,
+						Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, record.status, record.targetedStatus))
+					{
+						snapshot.metaData[record.faultIndex]->detectionCount = record.detectionCount;
+						snapshot.Update(record.faultIndex, record.status, record.targetedStatus, record.detectionCount);
+					}
+				}
+			}
+			else
+			{
+				LOG(FATAL) << "Received an unexpected message from the sharding coordinator";
+			}
+		}
+	});
+
+	size_t reportedPatterns { 0u };
+	while (true)
+	{
+		std::optional<std::pair<size_t, size_t>> chunk;
+		{
+			std::unique_lock lock { chunkMutex };
+			chunkCondition.wait(lock, [&]() { return !chunks.empty(); });
+			chunk = chunks.front();
+			chunks.pop_front();
+		}
+		if (!chunk)
+		{
+			break;
+		}
+
+		VLOG(3) << "Generating test patterns for the faults " << chunk->first << " to " << chunk->second;
+		generate(chunk->first, chunk->second);
+
+		const size_t numberOfPatterns { testPatterns.size() };
+		std::vector<Io::CheckpointFault> faults;
+		{
+			std::scoped_lock lock { snapshotMutex };
+			faults = snapshot.CollectChanges(numberOfPatterns, FaultSnapshot::DetectionCount::Increment);
+		}
+		if (!channel.Send(MessageType::Result, EncodeResult(testPatterns, reportedPatterns, numberOfPatterns, faults)))
+		{
+			LOG(ERROR) << "The connection to the sharding coordinator has been lost";
+			break;
+		}
+		reportedPatterns = numberOfPatterns;
+	}
+
+	receiver.join();
 }
 
 template <typename FaultModel, typename FaultList>
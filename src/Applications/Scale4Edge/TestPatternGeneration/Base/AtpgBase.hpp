@@ -1,6 +1,10 @@
 #pragma once
 
+#include <tbb/concurrent_vector.h>
+
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <mutex>
 
@@ -13,6 +17,7 @@
 #include "Applications/Mixins/Udfm/UdfmMixin.hpp"
 #include "Basic/ApplicationStatistics.hpp"
 #include "Basic/Logic.hpp"
+#include "Basic/Parallel.hpp"
 #include "Basic/Fault/Lists/CellAwareFaultList.hpp"
 #include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
 #include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
@@ -51,7 +56,7 @@ public:
 	void Run(void);
 
 protected:
-	enum class FaultListReduction { Original, RemoveEquivalent };
+	enum class FaultListReduction { Original, RemoveEquivalent, RemoveDominating };
 
 	FaultListReduction faultListReduction;
 
@@ -131,6 +136,10 @@ protected:
 	enum class PrintFaultListReport { PrintDetail, PrintSummary, PrintNothing };
 	enum class FaultSimulation { Disabled, Enabled };
 	enum class TestPatternExport { Disabled, Enabled };
+	enum class CoverageDatabaseExport { Disabled, Enabled };
+	enum class CheckpointExport { Disabled, Enabled };
+	enum class ResumeFromCheckpoint { Disabled, Enabled };
+	enum class ShardingMode { Disabled, Coordinator, Worker };
 	enum class PrintTestPatternReport { PrintDetail, PrintSummary, PrintNothing };
 	enum class SimulateAllFaults { Disabled, Enabled };
 	enum class CheckSimulation { Disabled, Enabled };
@@ -140,8 +149,22 @@ protected:
 	enum class CheckAtpgResult { Disabled, CheckEqual, CheckInitial };
 	enum class CheckMaxIterationCovered { Disabled, Enabled };
 	enum class IncrementalSimulation { Disabled, Enabled };
+	enum class StructuralUntestability { Disabled, Enabled };
+
+	/**
+	 * @brief The detections that have been recorded by the fault simulation of one test pattern.
+	 *
+	 * - newDetections: Faults that have been detected by this pattern for the first time.
+	 * - detections: Faults whose detection count has been incremented by this pattern (n-detect).
+	 */
+	struct PatternGrade
+	{
+		size_t newDetections;
+		size_t detections;
+	};
 
 	void GenerateFaultList(void);
+	void ClassifyStructurallyUntestableFaults(void);
 	template<typename PinData>
 	void ValidateAtpgResult(size_t faultIndex, Pattern::TestPattern& pattern, Pattern::OutputCapture capture, Tpg::LogicGenerator<PinData>& logicGenerator, const Simulation::SimulationConfig& simConfig) const;
 
@@ -150,12 +173,35 @@ protected:
 	void ExportTestPatterns(Pattern::InputCapture capture) const;
 	void ExportFaultList(void) const;
 
+	/**
+	 * @brief Resumes from the checkpoint file and starts the periodic checkpoints.
+	 *
+	 * Has to be called after the fault list has been generated and before the test pattern generation starts.
+	 * The checkpoints are written by a background thread which only reads the atomic fault metadata
+	 * and the test patterns. The test pattern generation is never blocked by a checkpoint.
+	 */
+	void StartCheckpoints(void);
+	/**
+	 * @brief Stops the background thread and writes the final checkpoint.
+	 */
+	void StopCheckpoints(void);
+	/**
+	 * @brief Runs the test pattern generation for the faults between faultListBegin and faultListEnd.
+	 *
+	 * The generate function is called with a range of faults. Without sharding, it is called once with the whole range.
+	 * As coordinator, the range is split into chunks that are handed out to worker processes on the same host.
+	 * The patterns and detections of the workers are merged into the fault list and the test patterns of the coordinator.
+	 * As worker, the function is called for each chunk that has been received from the coordinator.
+	 */
+	void RunPatternGeneration(const std::function<void(size_t, size_t)>& generate);
+
 	std::vector<Fault::FaultStatus> CheckCombinationalUntestability(const FaultList& faultList, const std::vector<bool>& faultMask);
 
 	void ResetStatistics(void);
 	void SnapshotStatisticsForIteration(void);
 	void PrintStatistics(void);
 	void ExportStatistics(void);
+	void ExportPatternGrades(void);
 	std::string DebugFaultLocation(const Simulation::SimulationResult& atpgGoodResult, const Simulation::SimulationResult& atpgBadResult, const Simulation::SimulationResult& simGoodResult, const Simulation::SimulationResult& simBadResult, size_t faultIndex) const;
 
 	FaultListSource faultListSource;
@@ -167,12 +213,15 @@ protected:
 	std::string faultListExclude;
 
 	Pattern::TestPatternList testPatterns;
+	// Each test pattern has its own slot, which is written by the thread that simulates the pattern
+	tbb::concurrent_vector<PatternGrade> patternGrades;
 
 	Statistic::AverageStatistic statPatternsGenerated;
 
 	PrintFaultListReport printFaultListReport;
 	FaultSimulation faultSimulation;
 	TestPatternExport testPatternExport;
+	CoverageDatabaseExport coverageDatabaseExport;
 	PrintTestPatternReport printPatternReport;
 	SimulateAllFaults simulateAllFaults;
 	CheckSimulation checkSimulation;
@@ -182,12 +231,23 @@ protected:
 	CheckAtpgResult checkAtpgResult;
 	CheckMaxIterationCovered checkMaxIterationCovered;
 	IncrementalSimulation incrementalSimulation;
+	StructuralUntestability structuralUntestability;
+	size_t detectionLimit;
+	CheckpointExport checkpointExport;
+	std::string checkpointFile;
+	size_t checkpointInterval;
+	ResumeFromCheckpoint resumeFromCheckpoint;
+	ShardingMode shardingMode;
+	size_t shardingWorkers;
+	size_t shardingChunkSize;
+	int shardingSocket;
 
 	size_t patternGenerationThreadLimit;
 	size_t solverThreadLimit;
 	size_t solverTimeout;
 	size_t solverUntestabilityTimeout;
 	size_t simulationThreadLimit;
+	Parallel::NumaPolicy numaPolicy;
 
 	size_t faultListBegin;
 	size_t faultListEnd;
@@ -196,7 +256,15 @@ protected:
 	mutable std::atomic<size_t> vcdDebugExportId;
 
 private:
+	struct FaultSnapshot;
+	struct CheckpointState;
+
+	void WriteCheckpoint(CheckpointState& state);
+	void RunShardingCoordinator(void);
+	void RunShardingWorker(const std::function<void(size_t, size_t)>& generate);
+
 	std::string configPrefix;
+	std::unique_ptr<CheckpointState> checkpointState;
 
 };
 
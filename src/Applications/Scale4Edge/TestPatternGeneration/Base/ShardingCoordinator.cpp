@@ -0,0 +1,165 @@
+#include "Applications/Scale4Edge/TestPatternGeneration/Base/ShardingCoordinator.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+template<typename FaultList>
+ShardingCoordinator<FaultList>::ShardingCoordinator(Mixin::FaultStatisticsMixin<FaultList>& faultStatistics, FaultList& faultList, Pattern::TestPatternList& testPatterns,
+		size_t detectionLimit, size_t numberOfWorkers, size_t faultListBegin, size_t faultListEnd, size_t chunkSize):
+	faultStatistics(faultStatistics),
+	faultList(faultList),
+	testPatterns(testPatterns),
+	detectionLimit(detectionLimit),
+	numberOfChunks(0u),
+	chunks(),
+	workerChunks(numberOfWorkers),
+	patternMappings(numberOfWorkers)
+{
+	for (size_t begin { faultListBegin }; begin < faultListEnd; begin += chunkSize)
+	{
+		chunks.emplace_back(begin, std::min(faultListEnd, begin + chunkSize));
+	}
+	numberOfChunks = chunks.size();
+}
+
+template<typename FaultList>
+ShardingCoordinator<FaultList>::~ShardingCoordinator(void) = default;
+
+template<typename FaultList>
+std::optional<typename ShardingCoordinator<FaultList>::Chunk> ShardingCoordinator<FaultList>::AssignChunk(size_t workerIndex)
+{
+	if (chunks.empty())
+	{
+		return std::nullopt;
+	}
+
+	workerChunks[workerIndex] = chunks.front();
+	chunks.pop_front();
+	return workerChunks[workerIndex];
+}
+
+template<typename FaultList>
+std::vector<Io::CheckpointFault> ShardingCoordinator<FaultList>::MergeResult(size_t workerIndex, Io::Sharding::Result& result)
+{
+	auto& patternMapping { patternMappings[workerIndex] };
+	for (auto& pattern : result.patterns)
+	{
+		patternMapping.push_back(testPatterns.emplace_back(std::move(pattern)));
+	}
+
+	std::vector<Io::CheckpointFault> dropped;
+	for (const auto& record : result.faults)
+	{
+		auto [fault, metaData] = faultList[record.faultIndex];
+		const bool wasDropped { IsDropped(record.faultIndex) };
+		switch (record.status)
+		{
+			case Fault::FaultStatus::FAULT_STATUS_DETECTED:
+				if (faultStatistics.TrySetFaultStatus(faultList, record.faultIndex,
+					Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_DETECTED, record.targetedStatus))
+				{
+					metaData->detectingTimeframe.store(record.detectingTimeframe, std::memory_order_relaxed);
+					metaData->detectingPatternId.store((record.detectingPatternId < patternMapping.size())
+						? patternMapping[record.detectingPatternId] : std::numeric_limits<size_t>::max(), std::memory_order_release);
+				}
+				if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+				{
+					// The workers report the new detections which are summed up for n-detect
+					metaData->detectionCount = std::min(detectionLimit, metaData->detectionCount + record.detectionCount);
+				}
+				break;
+
+			case Fault::FaultStatus::FAULT_STATUS_UNDETECTED:
+				faultStatistics.TrySetFaultStatus(faultList, record.faultIndex,
+					Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNDETECTED, record.targetedStatus);
+				break;
+
+			default:
+				// Aborted faults keep the unclassified status
+				if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+				{
+					faultStatistics.SetFaultStatus(faultList, record.faultIndex, record.status, record.targetedStatus);
+				}
+				break;
+		}
+
+		if (!wasDropped && IsDropped(record.faultIndex))
+		{
+			dropped.push_back(GetDroppedFault(record.faultIndex));
+		}
+	}
+
+	workerChunks[workerIndex].reset();
+	return dropped;
+}
+
+template<typename FaultList>
+void ShardingCoordinator<FaultList>::FailWorker(size_t workerIndex)
+{
+	if (workerChunks[workerIndex])
+	{
+		chunks.push_front(*workerChunks[workerIndex]);
+		workerChunks[workerIndex].reset();
+	}
+}
+
+template<typename FaultList>
+std::vector<Io::CheckpointFault> ShardingCoordinator<FaultList>::GetClassifiedFaults(void) const
+{
+	std::vector<Io::CheckpointFault> classified;
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		if (IsDropped(faultIndex))
+		{
+			classified.push_back(GetDroppedFault(faultIndex));
+		}
+	}
+	return classified;
+}
+
+template<typename FaultList>
+bool ShardingCoordinator<FaultList>::HasChunks(void) const
+{
+	return !chunks.empty();
+}
+
+template<typename FaultList>
+size_t ShardingCoordinator<FaultList>::GetNumberOfChunks(void) const
+{
+	return numberOfChunks;
+}
+
+template<typename FaultList>
+bool ShardingCoordinator<FaultList>::IsDropped(size_t faultIndex) const
+{
+	auto [fault, metaData] = faultList[faultIndex];
+	return metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNDETECTED
+		|| (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED && metaData->detectionCount >= detectionLimit);
+}
+
+template<typename FaultList>
+Io::CheckpointFault ShardingCoordinator<FaultList>::GetDroppedFault(size_t faultIndex) const
+{
+	auto [fault, metaData] = faultList[faultIndex];
+	const auto status { metaData->GetStatus() };
+	return { faultIndex, status.status, status.targetedStatus, std::numeric_limits<size_t>::max(), 0u, metaData->detectionCount };
+}
+
+template class ShardingCoordinator<Fault::SingleStuckAtFaultList>;
+template class ShardingCoordinator<Fault::SingleTransitionDelayFaultList>;
+template class ShardingCoordinator<Fault::CellAwareFaultList>;
+
+};
+};
+};
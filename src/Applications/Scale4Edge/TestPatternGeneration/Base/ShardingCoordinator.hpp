@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Applications/Mixins/Statistics/FaultStatisticsMixin.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Io/AtpgCheckpoint/AtpgCheckpoint.hpp"
+#include "Io/AtpgSharding/ShardingProtocol.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+/**
+ * @brief Distributes the fault chunks to the sharding workers and merges their results.
+ *
+ * The processes and channels of the workers are managed by the caller.
+ * The coordinator keeps track of the chunk that each worker processes.
+ * The chunk of a failed worker is handed out again before the remaining chunks.
+ */
+template<typename FaultList>
+class ShardingCoordinator
+{
+public:
+	using Chunk = std::pair<size_t, size_t>;
+
+	ShardingCoordinator(Mixin::FaultStatisticsMixin<FaultList>& faultStatistics, FaultList& faultList, Pattern::TestPatternList& testPatterns,
+		size_t detectionLimit, size_t numberOfWorkers, size_t faultListBegin, size_t faultListEnd, size_t chunkSize);
+	virtual ~ShardingCoordinator(void);
+
+	/**
+	 * @brief Assigns the next chunk to an idle worker.
+	 *
+	 * @return The chunk or std::nullopt if no chunk is left
+	 */
+	std::optional<Chunk> AssignChunk(size_t workerIndex);
+	/**
+	 * @brief Merges the result of a worker and finishes its chunk.
+	 *
+	 * The test patterns are appended to the merged test patterns and the detecting patterns
+	 * of the faults are mapped to the merged indices. The detection counts of all workers are summed up.
+	 *
+	 * @return The faults that are no longer targeted and are dropped by the other workers
+	 */
+	std::vector<Io::CheckpointFault> MergeResult(size_t workerIndex, Io::Sharding::Result& result);
+	/**
+	 * @brief Hands out the chunk of a terminated worker to the next idle worker.
+	 */
+	void FailWorker(size_t workerIndex);
+
+	/**
+	 * @brief Returns the faults that have been classified before the workers started (e.g. by a checkpoint).
+	 */
+	std::vector<Io::CheckpointFault> GetClassifiedFaults(void) const;
+	bool HasChunks(void) const;
+	size_t GetNumberOfChunks(void) const;
+
+private:
+	bool IsDropped(size_t faultIndex) const;
+	Io::CheckpointFault GetDroppedFault(size_t faultIndex) const;
+
+	Mixin::FaultStatisticsMixin<FaultList>& faultStatistics;
+	FaultList& faultList;
+	Pattern::TestPatternList& testPatterns;
+	size_t detectionLimit;
+	size_t numberOfChunks;
+
+	std::deque<Chunk> chunks;
+	std::vector<std::optional<Chunk>> workerChunks;
+	// Maps the pattern indices of each worker to the indices of the merged test patterns
+	std::vector<std::vector<size_t>> patternMappings;
+
+};
+
+};
+};
+};
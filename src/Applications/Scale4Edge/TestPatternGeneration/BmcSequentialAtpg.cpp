@@ -176,7 +176,7 @@ void BmcSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 
 	// Check for already detected faults
 	auto [fault, metadata] = this->faultList[faultIndex];
-	if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
 	{
 		return;
 	}
@@ -308,7 +308,7 @@ void BmcSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 			size_t testPatternIndex = this->testPatterns.emplace_back(pattern);
 			AtpgBase<FaultModel, FaultList>::RunFaultSimulation(vcmContext, faultIndex, testPatternIndex, Pattern::OutputCapture::PrimaryOutputsOnly, simConfig);
 
-			if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+			if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
 			{
 				LOG(FATAL) << "Invalid test pattern was generated";
 			}
@@ -320,17 +320,13 @@ void BmcSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 		{
 			LOG(INFO) << "No test pattern can be created (" << bmcSolver->GetLastResult() << ")";
 
-			std::scoped_lock lock { this->parallelMutex };
-			if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-			{
-				AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex,
-					(bmcSolver->GetLastResult() == Bmc::BmcResult::Unreachable)
-						? Fault::FaultStatus::FAULT_STATUS_UNDETECTED
-						: Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-					(bmcSolver->GetLastResult() == Bmc::BmcResult::Unreachable)
-						? Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE
-						: Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS);
-			}
+			AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				(bmcSolver->GetLastResult() == Bmc::BmcResult::Unreachable)
+					? Fault::FaultStatus::FAULT_STATUS_UNDETECTED
+					: Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				(bmcSolver->GetLastResult() == Bmc::BmcResult::Unreachable)
+					? Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE
+					: Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS);
 			goto nextFault;
 		}
 
@@ -340,13 +336,9 @@ void BmcSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 			LOG(WARNING) << "No conclusion about testability could be found ("
 				<< bmcSolver->GetLastResult() << ")";
 
-			std::scoped_lock lock { this->parallelMutex };
-			if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-			{
-				AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex,
-					Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-					Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
-			}
+			AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
 			goto nextFault;
 		}
 	}
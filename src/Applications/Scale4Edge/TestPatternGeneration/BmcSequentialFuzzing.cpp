@@ -118,6 +118,8 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::Init(void)
 template <typename FaultModel, typename FaultList>
 void BmcSequentialFuzzing<FaultModel, FaultList>::Run(void)
 {
+	Parallel::SetNumaPolicy(Parallel::Arena::PatternGeneration, this->numaPolicy);
+	Parallel::SetNumaPolicy(Parallel::Arena::FaultSimulation, this->numaPolicy);
 	Parallel::SetThreads(Parallel::Arena::General, 0u);
 	Parallel::SetThreads(Parallel::Arena::PatternGeneration, this->patternGenerationThreadLimit);
 	Parallel::SetThreads(Parallel::Arena::FaultSimulation, this->simulationThreadLimit);
@@ -133,6 +135,7 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::Run(void)
 		VLOG(6) << to_debug(this->circuit->GetMappedCircuit(), VLOG_VERBOSE(9));
 
 		this->testPatterns.clear();
+		this->patternGrades.clear();
 		Parallel::ExecuteParallel(this->faultListBegin, this->faultListEnd, Parallel::Arena::PatternGeneration, Parallel::Order::Parallel, [&](size_t index) {
 			GeneratePatternForFault(seed, index);
 		});
@@ -151,7 +154,7 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::GeneratePatternForFault(size_t
 
 	// Check for already detected faults
 	auto [fault, metadata] = this->faultList[faultIndex];
-	if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
 	{
 		return;
 	}
@@ -218,12 +221,8 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::GeneratePatternForFault(size_t
 	logicGenerator->GetContext().SetNumberOfTimeframes(this->settingsMaximumTimeframes + 1u);
 	if (!logicGenerator->GenerateCircuitLogic())
 	{
-		std::scoped_lock lock { this->parallelMutex };
-		if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-		{
-			AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
-				Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
-		}
+		AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
+			Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
 		goto validate_untestable;
 	}
 
@@ -268,7 +267,7 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::GeneratePatternForFault(size_t
 
 		size_t testPatternIndex = this->testPatterns.emplace_back(pattern);
 		AtpgBase<FaultModel, FaultList>::RunFaultSimulation(vcmContext, faultIndex, testPatternIndex, Pattern::OutputCapture::PrimaryOutputsOnly, simConfig);
-		if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
 		{
 			LOG(FATAL) << "Invalid test pattern was generated";
 		}
@@ -278,12 +277,8 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::GeneratePatternForFault(size_t
 	case Bmc::BmcResult::Unreachable:
 	case Bmc::BmcResult::MaxIterationsReached:
 	{
-		std::scoped_lock lock { this->parallelMutex };
-		if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-		{
-			AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
-				Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
-		}
+		AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
+			Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
 		goto validate_untestable;
 	}
 
@@ -291,12 +286,8 @@ void BmcSequentialFuzzing<FaultModel, FaultList>::GeneratePatternForFault(size_t
 	case Bmc::BmcResult::Timeout:
 	{
 		LOG(WARNING) << "No conclusion about testability could be found (UNKNOWN)";
-		std::scoped_lock lock { this->parallelMutex };
-		if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-		{
-			AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-				Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
-		}
+		AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+			Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
 		return;
 	}
 	} // end case
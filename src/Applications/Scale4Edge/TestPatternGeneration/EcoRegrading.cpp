@@ -0,0 +1,256 @@
+#include "Applications/Scale4Edge/TestPatternGeneration/EcoRegrading.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Models/SingleTransitionDelayFaultModel.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Models/CellAwareFaultModel.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Basic/Pattern/Capture.hpp"
+#include "Circuit/CircuitBuilder.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Helper/FileHandle.hpp"
+#include "Io/CircuitSnapshot/CircuitSnapshot.hpp"
+#include "Io/TestPatternParser/TestPatternParser.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/FaultSimulator.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Application::Mixin;
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+template <typename FaultModel, typename FaultList>
+EcoRegrading<FaultModel, FaultList>::EcoRegrading(void):
+	StatisticsMixin(SCALE4EDGE_ATPG_CONFIG),
+	FaultStatisticsMixin<FaultList>(SCALE4EDGE_ATPG_CONFIG),
+	SimulationStatisticsMixin(SCALE4EDGE_ATPG_CONFIG),
+	SolverStatisticsMixin(SCALE4EDGE_ATPG_CONFIG),
+	VcdExportMixin<FaultList>(SCALE4EDGE_ATPG_CONFIG),
+	VcmMixin(SCALE4EDGE_ATPG_CONFIG),
+	SatFullScanAtpg<FaultModel, FaultList>(),
+	previousCircuitSnapshot(""),
+	coverageDatabaseFile("[DataImportDirectory]/coverage.fcdb"),
+	testPatternGeneration(TestPatternGeneration::Enabled)
+{
+	// The updated database is the input of the next regrading
+	this->coverageDatabaseExport = AtpgBase<FaultModel, FaultList>::CoverageDatabaseExport::Enabled;
+}
+
+template <typename FaultModel, typename FaultList>
+EcoRegrading<FaultModel, FaultList>::~EcoRegrading(void) = default;
+
+template <typename FaultModel, typename FaultList>
+void EcoRegrading<FaultModel, FaultList>::Init(void)
+{
+	SatFullScanAtpg<FaultModel, FaultList>::Init();
+}
+
+template <typename FaultModel, typename FaultList>
+bool EcoRegrading<FaultModel, FaultList>::SetSetting(std::string key, std::string value)
+{
+	if (key == "Scale4Edge/EcoRegrading/PreviousCircuitSnapshot")
+	{
+		previousCircuitSnapshot = value;
+		return true;
+	}
+	if (key == "Scale4Edge/EcoRegrading/CoverageDatabaseFile")
+	{
+		coverageDatabaseFile = value;
+		return true;
+	}
+	if (key == "Scale4Edge/EcoRegrading/TestPatternGeneration")
+	{
+		return Settings::ParseEnum(value, testPatternGeneration, {
+			{ "Disabled", TestPatternGeneration::Disabled },
+			{ "Enabled", TestPatternGeneration::Enabled }
+		});
+	}
+
+	return SatFullScanAtpg<FaultModel, FaultList>::SetSetting(key, value);
+}
+
+template <typename FaultModel, typename FaultList>
+void EcoRegrading<FaultModel, FaultList>::Run(void)
+{
+	AtpgBase<FaultModel, FaultList>::Run();
+	AtpgBase<FaultModel, FaultList>::GenerateFaultList();
+
+	LOG(INFO) << "Loading the previous circuit from " << previousCircuitSnapshot;
+	auto previousBuilder = Io::ImportCircuitSnapshot(Settings::GetInstance()->MapFileName(previousCircuitSnapshot, false), "");
+	if (!previousBuilder) LOG(FATAL) << "Failed to load the previous circuit snapshot " << previousCircuitSnapshot;
+	auto previousCircuit = previousBuilder->BuildCircuitEnvironment(Circuit::Builder::BuildConfiguration { });
+	if (!previousCircuit) LOG(FATAL) << "Failed to build the previous circuit";
+
+	FileHandle databaseHandle(coverageDatabaseFile, true);
+	auto database = Io::FaultCoverage::ImportCoverageDatabase(databaseHandle.GetStream());
+	if (!database) LOG(FATAL) << "The coverage database could not be read";
+
+	// The patterns have to be applicable to the unchanged interface of the circuit
+	FileHandle patternHandle("[DataImportDirectory]/patterns.[DataExchangeExtension]", true);
+	auto patternResult = Io::ImportPatterns(patternHandle.GetStream(), *this->circuit);
+	if (!patternResult) LOG(FATAL) << "Test patterns could not be read";
+	if (patternResult->GetInputCapture() != Pattern::InputCapture::PrimaryAndSecondaryInputs) LOG(FATAL) << "The ECO regrading requires full-scan test patterns";
+
+	// Patterns with multiple timeframes (e.g. transition delay or cell-aware faults) propagate
+	// the differences through the flip-flops into the next timeframe
+	size_t timeframes { 1u };
+	for (const auto& pattern : patternResult->GetTestPatterns())
+	{
+		this->testPatterns.emplace_back(*pattern);
+		timeframes = std::max(timeframes, pattern->GetNumberOfTimeframes());
+	}
+	patternResult.reset();
+
+	const Circuit::CircuitDifference difference { previousCircuit->GetMappedCircuit(), this->circuit->GetMappedCircuit(), timeframes };
+	LOG(INFO) << "The ECO changed " << difference.GetNumberOfChangedNodes() << " nodes, removed " << difference.GetNumberOfRemovedNodes()
+		<< " nodes and affects " << difference.GetNumberOfAffectedNodes() << " of " << this->circuit->GetMappedCircuit().GetNumberOfNodes()
+		<< " nodes for " << timeframes << " timeframe(s)";
+	previousCircuit.reset();
+	previousBuilder.reset();
+
+	const auto regradedFaults { RegradeFaults(*database, difference) };
+	std::vector<size_t> undetectedFaults;
+	std::copy_if(regradedFaults.begin(), regradedFaults.end(), std::back_inserter(undetectedFaults), [&](size_t faultIndex) {
+		auto [fault, metadata] = this->faultList[faultIndex];
+		return metadata->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED;
+	});
+	LOG(INFO) << undetectedFaults.size() << " of " << regradedFaults.size() << " regraded faults are not detected by the existing test patterns";
+
+	const size_t existingPatterns { this->testPatterns.size() };
+	if (testPatternGeneration == TestPatternGeneration::Enabled)
+	{
+		LOG(INFO) << "Generating test patterns for " << undetectedFaults.size() << " faults";
+		Parallel::ExecuteParallel(0u, undetectedFaults.size(), Parallel::Arena::PatternGeneration, Parallel::Order::Parallel, [&](size_t index) {
+			this->GeneratePatternForFault(undetectedFaults[index]);
+		});
+		Logging::ClearCurrentFault();
+	}
+
+	this->statistics.Add("Eco.Nodes.Changed", difference.GetNumberOfChangedNodes(), "Node(s)", "The number of nodes that are new or have been modified by the ECO");
+	this->statistics.Add("Eco.Nodes.Removed", difference.GetNumberOfRemovedNodes(), "Node(s)", "The number of nodes that have been removed by the ECO");
+	this->statistics.Add("Eco.Nodes.Affected", difference.GetNumberOfAffectedNodes(), "Node(s)", "The number of nodes in the fan-in of a node with a modified value");
+	this->statistics.Add("Eco.Faults.Reused", this->faultList.size() - regradedFaults.size(), "Fault(s)", "The number of faults whose detection data has been reused");
+	this->statistics.Add("Eco.Faults.Regraded", regradedFaults.size(), "Fault(s)", "The number of faults that have been simulated with the existing test patterns");
+	this->statistics.Add("Eco.Faults.Undetected", undetectedFaults.size(), "Fault(s)", "The number of regraded faults that are not detected by the existing test patterns");
+	this->statistics.Add("Eco.Patterns.Existing", existingPatterns, "Pattern(s)", "The number of imported test patterns");
+	this->statistics.Add("Eco.Patterns.Generated", this->testPatterns.size() - existingPatterns, "Pattern(s)", "The number of test patterns that have been generated for the undetected faults");
+	AtpgBase<FaultModel, FaultList>::ExportStatistics();
+	AtpgBase<FaultModel, FaultList>::ExportTestPatterns(Pattern::InputCapture::PrimaryAndSecondaryInputs);
+	AtpgBase<FaultModel, FaultList>::ExportFaultList();
+}
+
+template <typename FaultModel, typename FaultList>
+bool EcoRegrading<FaultModel, FaultList>::IsFaultAffected(const typename FaultList::fault_type& fault, const Circuit::CircuitDifference& difference) const
+{
+	if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>
+		|| std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
+	{
+		return difference.IsAffected(fault.GetNode());
+	}
+	else if constexpr (std::is_same_v<FaultModel, Fault::CellAwareFaultModel>)
+	{
+		const auto is_affected = [&](const Circuit::MappedCircuit::NodeAndPort& nodeAndPort) {
+			return difference.IsAffected(nodeAndPort.node);
+		};
+		return std::any_of(fault.GetConditionNodesAndPorts().begin(), fault.GetConditionNodesAndPorts().end(), is_affected)
+			|| std::any_of(fault.GetEffectNodesAndPorts().begin(), fault.GetEffectNodesAndPorts().end(), is_affected);
+	}
+	else
+	{
+		Logging::Panic("Unknown fault model");
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+std::vector<size_t> EcoRegrading<FaultModel, FaultList>::RegradeFaults(const Io::FaultCoverage::CoverageDatabase& database, const Circuit::CircuitDifference& difference)
+{
+	const auto& circuit { this->circuit->GetMappedCircuit() };
+	const size_t numberOfPatterns { this->testPatterns.size() };
+	LOG_IF(database.GetNumberOfPatterns() != numberOfPatterns, WARNING) << "The coverage database has been created for "
+		<< database.GetNumberOfPatterns() << " test patterns while " << numberOfPatterns << " have been imported. All faults are regraded.";
+
+	// The faults that have been classified by the fault list generation (e.g. structurally untestable) are kept.
+	// Faults without an entry in the database are new or have been renamed and are regraded.
+	std::vector<bool> regraded(this->faultList.size(), false);
+	for (size_t faultIndex { 0u }; faultIndex < this->faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = this->faultList[faultIndex];
+		if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+		{
+			continue;
+		}
+
+		const auto record { database.GetFault(Io::FaultCoverage::GetFaultInformation<FaultModel>(*this->circuit, { fault })) };
+		if (!record || database.GetNumberOfPatterns() != numberOfPatterns || IsFaultAffected(*fault, difference))
+		{
+			regraded[faultIndex] = true;
+			continue;
+		}
+
+		const Fault::TargetedFaultStatus targetedStatus {
+			(record->status == Fault::FaultStatus::FAULT_STATUS_DETECTED) ? Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE
+			: (record->status == Fault::FaultStatus::FAULT_STATUS_UNDETECTED) ? Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE
+			: metadata->GetTargetedFaultStatus()
+		};
+		FaultStatisticsMixin<FaultList>::SetFaultStatus(this->faultList, faultIndex, record->status, targetedStatus);
+		metadata->detectingPatternId = record->detectingPatternId;
+		metadata->detectionCount = std::min(record->detectionCount, this->detectionLimit);
+	}
+
+	std::vector<size_t> regradedFaults;
+	for (size_t faultIndex { 0u }; faultIndex < regraded.size(); ++faultIndex)
+	{
+		if (regraded[faultIndex])
+		{
+			regradedFaults.push_back(faultIndex);
+		}
+	}
+	LOG(INFO) << "Regrading " << regradedFaults.size() << " of " << this->faultList.size() << " faults with " << numberOfPatterns << " test patterns";
+
+	Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
+	std::vector<std::vector<size_t>> patternDetections(numberOfPatterns);
+	Parallel::ExecuteParallel(0u, numberOfPatterns, Parallel::Arena::FaultSimulation, Parallel::Order::Parallel, [&](size_t patternIndex) {
+		patternDetections[patternIndex] = Simulation::SimulateFaults<FaultModel>(circuit, *this->testPatterns[patternIndex], this->faultList,
+			Pattern::OutputCapture::PrimaryAndSecondaryOutputs, simConfig, [&](size_t faultIndex) { return regraded[faultIndex]; });
+	});
+
+	// The patterns are processed in order to record the first detecting pattern of each fault
+	for (size_t patternIndex { 0u }; patternIndex < numberOfPatterns; ++patternIndex)
+	{
+		for (const size_t faultIndex : patternDetections[patternIndex])
+		{
+			auto [fault, metadata] = this->faultList[faultIndex];
+			if (FaultStatisticsMixin<FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				Fault::FaultStatus::FAULT_STATUS_DETECTED, Fault::TargetedFaultStatus::FAULT_STATUS_TESTABLE))
+			{
+				metadata->detectingPatternId = patternIndex;
+			}
+			metadata->IncrementDetectionCount(this->detectionLimit);
+		}
+	}
+
+	return regradedFaults;
+}
+
+template class EcoRegrading<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
+template class EcoRegrading<Fault::SingleTransitionDelayFaultModel, Fault::SingleTransitionDelayFaultList>;
+template class EcoRegrading<Fault::CellAwareFaultModel, Fault::CellAwareFaultList>;
+
+};
+};
+};
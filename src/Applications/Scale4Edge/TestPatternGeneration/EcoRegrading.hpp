@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Applications/Scale4Edge/TestPatternGeneration/SatFullScanAtpg.hpp"
+#include "Circuit/CircuitDifference.hpp"
+#include "Io/FaultCoverage/CoverageDatabase.hpp"
+
+namespace FreiTest
+{
+namespace Application
+{
+namespace Scale4Edge
+{
+
+/**
+ * @brief Regrades the full-scan test patterns after an engineering change order (ECO).
+ *
+ * The previous circuit is loaded from a snapshot and compared to the current circuit
+ * by the node names (see Circuit::CircuitDifference). The detection data of the faults
+ * outside of the changed cones is reused from the coverage database of the previous run.
+ * Only the affected and new faults are simulated with the existing test patterns.
+ *
+ * Steps:
+ * 1. Fault list generation for the current circuit
+ * 2. Import of the test patterns and the coverage database of the previous circuit
+ * 3. Reuse of the detection data for unaffected faults
+ * 4. Fault simulation of the affected faults with the existing test patterns
+ * 5. SAT-based test pattern generation for the affected faults that are no longer detected
+ * 6. Export of the test patterns (existing patterns followed by the new ones),
+ *    the fault list and the updated coverage database
+ */
+template<typename FaultModel, typename FaultList>
+class EcoRegrading:
+	public SatFullScanAtpg<FaultModel, FaultList>
+{
+public:
+	EcoRegrading(void);
+	virtual ~EcoRegrading(void);
+
+	void Init(void) override;
+	void Run(void) override;
+	bool SetSetting(std::string key, std::string value) override;
+
+private:
+	enum class TestPatternGeneration { Disabled, Enabled };
+
+	bool IsFaultAffected(const typename FaultList::fault_type& fault, const Circuit::CircuitDifference& difference) const;
+	std::vector<size_t> RegradeFaults(const Io::FaultCoverage::CoverageDatabase& database, const Circuit::CircuitDifference& difference);
+
+	std::string previousCircuitSnapshot;
+	std::string coverageDatabaseFile;
+	TestPatternGeneration testPatternGeneration;
+
+};
+
+};
+};
+};
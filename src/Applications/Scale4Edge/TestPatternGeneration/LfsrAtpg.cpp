@@ -188,7 +188,7 @@ void LfsrAtpg<FaultModel, FaultList>::GeneratePattern(size_t lfsrId)
 	size_t faultDetectCount { 0u };
 	for(auto [fault, metaData] : this->faultList)
 	{
-		if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
 		{
 			faultDetectCount++;
 		}
@@ -197,20 +197,30 @@ void LfsrAtpg<FaultModel, FaultList>::GeneratePattern(size_t lfsrId)
 	LOG(INFO) << "LFSR " << lfsrId << " detects " << faultDetectCount << " faults";
 	LOG(INFO) << "LFSR " << lfsrId << " fault coverage is " << (100.0f * faultDetectCount / static_cast<float>(this->faultList.size())) << "%";
 
-	FileHandle faultListFileHandle("[DataExportDirectory]/lfsr_" + std::to_string(lfsrId) + ".faults.jsonc", false);
+	// The JSON files of the LFSR keep their original "jsonc" extension
+	const auto exchangeFormat { Settings::GetInstance()->DataExchangeFormat };
+	const auto get_extension = [](Settings::ExchangeFormat format) -> std::string {
+		return (format == Settings::ExchangeFormat::Json) ? "jsonc" : Settings::GetExchangeExtension(format);
+	};
+
+	FileHandle faultListFileHandle("[DataExportDirectory]/lfsr_" + std::to_string(lfsrId) + ".faults."
+		+ get_extension(Io::GetFaultListExchangeFormat<FaultList>(exchangeFormat)), false);
 	Io::FaultListExchangeFormat faultListExport { *this->circuit, this->faultList };
-	Io::ExportFaults(faultListFileHandle.GetOutStream(), faultListExport);
+	Io::ExportFaults(faultListFileHandle.GetOutStream(), faultListExport, exchangeFormat);
 
-	FileHandle patternFileHandle("[DataExportDirectory]/lfsr_" + std::to_string(lfsrId) + ".patterns.jsonc", false);
+	FileHandle patternFileHandle("[DataExportDirectory]/lfsr_" + std::to_string(lfsrId) + ".patterns." + get_extension(exchangeFormat), false);
 	Io::TestPatternExchangeFormat patternListExport { *this->circuit, this->testPatterns, Pattern::InputCapture::PrimaryInputsOnly };
-	Io::ExportPatterns(patternFileHandle.GetOutStream(), patternListExport);
+	Io::ExportPatterns(patternFileHandle.GetOutStream(), patternListExport, exchangeFormat);
 	AtpgBase<FaultModel, FaultList>::PrintStatistics();
 
 	for(size_t index { 0u }; index < this->faultList.size(); index++)
 	{
 		AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, index, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::TargetedFaultStatus::FAULT_STATUS_UNCLASSIFIED);
+		auto [fault, metaData] = this->faultList[index];
+		metaData->detectionCount = 0u;
 	}
 	this->testPatterns.clear();
+	this->patternGrades.clear();
 }
 
 template class LfsrAtpg<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
@@ -2,11 +2,14 @@
 
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <execution>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <vector>
 
@@ -22,9 +25,11 @@
 #include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
 #include "Basic/Fault/Models/CellAwareFaultModel.hpp"
 #include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Basic/Pattern/PatternFill.hpp"
 #include "Basic/Pattern/TestPattern.hpp"
 #include "Basic/Iterator/IntegerIterator.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
+#include "Simulation/PatternRelaxation.hpp"
 #include "SolverProxy/Sat/SatSolverProxy.hpp"
 #include "SolverProxy/MaxSat/MaxSatSolverProxy.hpp"
 #include "SolverProxy/Sat/Glucose421ParallelSolverProxy.hpp"
@@ -110,7 +115,19 @@ SatFullScanAtpg<FaultModel, FaultList>::SatFullScanAtpg(void):
 	maximizeDontCarePorts(MaximizeDontCarePorts::Inputs),
 	maximizeDontCareFlipFlops(MaximizeDontCareFlipFlops::Inputs),
 	maximizeDontCarePortWeight(1u),
-	maximizeDontCareFlipFlopWeight(1u)
+	maximizeDontCareFlipFlopWeight(1u),
+	dontCareRelaxation(DontCareRelaxation::Disabled),
+	dontCareFill(Pattern::FillMode::None),
+	dontCareFillSeed(0u),
+	extractedCareBits(0u),
+	relaxedCareBits(0u),
+	relaxationTime(),
+	relaxationTimeLocal(relaxationTime),
+	patternGenerationPipeline(PatternGenerationPipeline::Disabled),
+	pipelineDepth(0u),
+	pipelineEncodingThreadLimit(0u),
+	pipelineSolvingThreadLimit(0u),
+	pipelineExtractionThreadLimit(0u)
 {
 }
 
@@ -134,19 +151,163 @@ void SatFullScanAtpg<FaultModel, FaultList>::Run(void)
 	AtpgBase<FaultModel, FaultList>::GenerateFaultList();
 	VLOG(6) << to_debug(this->faultList, this->circuit->GetMappedCircuit());
 
+	if (this->vcmEnable == VcmMixin::VcmEnable::Enabled
+		&& (dontCareRelaxation == DontCareRelaxation::Enabled || dontCareFill != Pattern::FillMode::None))
+	{
+		vcmFixedInputs = GetVcmFixedInputs();
+	}
+
+	AtpgBase<FaultModel, FaultList>::StartCheckpoints();
 	LOG(INFO) << "Generating test patterns for " << (this->faultListEnd - this->faultListBegin) << " faults";
-	Parallel::ExecuteParallel(this->faultListBegin, this->faultListEnd, Parallel::Arena::PatternGeneration, Parallel::Order::Parallel, [&](size_t index) {
-		GeneratePatternForFault(index);
+	if (patternGenerationPipeline == PatternGenerationPipeline::Enabled)
+	{
+		// The stages without a thread limit share the threads of the pattern generation
+		// that are not assigned to another stage. The SAT-solving gets half of the shared threads
+		// and the encoding and the extraction a quarter each. Every stage gets at least one thread.
+		struct PipelineStageThreads { Parallel::Arena arena; size_t limit; size_t weight; };
+		const std::array<PipelineStageThreads, 3u> stages {{
+			{ Parallel::Arena::Encoding, pipelineEncodingThreadLimit, 1u },
+			{ Parallel::Arena::Extraction, pipelineExtractionThreadLimit, 1u },
+			{ Parallel::Arena::Solving, pipelineSolvingThreadLimit, 2u }
+		}};
+
+		const size_t threads { Parallel::GetThreads(Parallel::Arena::PatternGeneration) };
+		size_t assignedThreads { 0u };
+		size_t sharedWeight { 0u };
+		for (const auto& stage : stages)
+		{
+			assignedThreads += stage.limit;
+			sharedWeight += (stage.limit == 0u) ? stage.weight : 0u;
+		}
+
+		// The last stage with a share gets the threads that are left after rounding down
+		size_t sharedThreads { (threads > assignedThreads) ? (threads - assignedThreads) : 0u };
+		for (const auto& stage : stages)
+		{
+			size_t stageThreads { stage.limit };
+			if (stageThreads == 0u)
+			{
+				stageThreads = std::max<size_t>(1u, (sharedThreads * stage.weight) / sharedWeight);
+				sharedThreads -= std::min(sharedThreads, stageThreads);
+				sharedWeight -= stage.weight;
+			}
+			Parallel::SetThreads(stage.arena, stageThreads);
+		}
+		LOG(INFO) << "Using " << Parallel::GetThreads(Parallel::Arena::Encoding) << " encoding, "
+			<< Parallel::GetThreads(Parallel::Arena::Solving) << " solving and "
+			<< Parallel::GetThreads(Parallel::Arena::Extraction) << " extraction threads for the pipeline";
+	}
+
+	AtpgBase<FaultModel, FaultList>::RunPatternGeneration([&](size_t begin, size_t end) {
+		if (patternGenerationPipeline == PatternGenerationPipeline::Enabled)
+		{
+			// The job of a fault is kept between the stages and released as soon as the fault is finished
+			std::vector<std::unique_ptr<PatternGenerationJob>> jobs(end - begin);
+			auto get_job = [&](size_t index) -> std::unique_ptr<PatternGenerationJob>& {
+				return jobs[index - begin];
+			};
+
+			Parallel::ExecutePipeline(begin, end, pipelineDepth, Parallel::Order::Parallel, {
+				{ Parallel::Arena::Encoding, [&](size_t index) {
+					get_job(index) = EncodePatternForFault(index);
+					return get_job(index) != nullptr;
+				} },
+				{ Parallel::Arena::Solving, [&](size_t index) {
+					if (SolvePatternForFault(index, *get_job(index)))
+					{
+						return true;
+					}
+					get_job(index).reset();
+					return false;
+				} },
+				{ Parallel::Arena::Extraction, [&](size_t index) {
+					ExtractPatternForFault(index, *get_job(index));
+					get_job(index).reset();
+					return false;
+				} }
+			});
+		}
+		else
+		{
+			Parallel::ExecuteParallel(begin, end, Parallel::Arena::PatternGeneration, Parallel::Order::Parallel, [&](size_t index) {
+				GeneratePatternForFault(index);
+			});
+		}
 	});
 	Logging::ClearCurrentFault();
+	AtpgBase<FaultModel, FaultList>::StopCheckpoints();
+
+	// The report of the last faults might have been skipped while another thread was taking it
+	AtpgBase<FaultModel, FaultList>::SnapshotStatisticsForIteration();
 
 	this->statistics.Add("Encoding.PatternGeneration.LogicContainer", std::string("LogicContainer") + get_logic_container_name<LogicContainer>, "Type", "LogicContainer used");
+	if (dontCareRelaxation == DontCareRelaxation::Enabled)
+	{
+		relaxationTimeLocal.Merge();
+		this->statistics.Add("Atpg.Patterns.CareBits.Extracted", extractedCareBits.load(), "Bit(s)", "The number of specified inputs of the test patterns returned by the SAT-solver");
+		this->statistics.Add("Atpg.Patterns.CareBits.Relaxed", relaxedCareBits.load(), "Bit(s)", "The number of specified inputs that have been relaxed to DON'T CARE");
+		this->statistics.Add("Atpg.Patterns.Relaxation.Time", relaxationTime.GetSum(), "Second(s)", "The total runtime of the DON'T CARE relaxation");
+	}
 	this->statistics.Add("Encoding.PatternGeneration.PinData", std::string("PinData") + get_pin_data_name_v<PinData>, "Type", "PinData used");
 	AtpgBase<FaultModel, FaultList>::ExportStatistics();
 	AtpgBase<FaultModel, FaultList>::ExportTestPatterns(Pattern::InputCapture::PrimaryAndSecondaryInputs);
 	AtpgBase<FaultModel, FaultList>::ExportFaultList();
 }
 
+template <typename FaultModel, typename FaultList>
+Pattern::FixedInputs SatFullScanAtpg<FaultModel, FaultList>::GetVcmFixedInputs(void) const
+{
+	const auto& mappedCircuit { this->circuit->GetMappedCircuit() };
+	Pattern::FixedInputs fixedInputs {
+		std::vector<bool>(mappedCircuit.GetNumberOfPrimaryInputs(), false),
+		std::vector<bool>(mappedCircuit.GetNumberOfSecondaryInputs(), false)
+	};
+
+	// Every input in the input cone of a node that is observed by the VCM is fixed.
+	// The cone is followed through the flip-flops as the VCM observes the nodes in all timeframes.
+	std::vector<bool> visited(mappedCircuit.GetNumberOfNodes(), false);
+	std::vector<const Circuit::MappedNode*> nodes;
+	const auto visit = [&](const Circuit::MappedNode* node) {
+		if (node != nullptr && !visited[node->GetNodeId()])
+		{
+			visited[node->GetNodeId()] = true;
+			nodes.push_back(node);
+		}
+	};
+
+	for (const auto& vcmInput : this->vcmInputs)
+	{
+		visit(vcmInput.targetNode);
+	}
+	while (!nodes.empty())
+	{
+		const auto* node { nodes.back() };
+		nodes.pop_back();
+
+		if (mappedCircuit.IsPrimaryInput(node))
+		{
+			fixedInputs.primaryInputs[mappedCircuit.GetPrimaryInputNumber(node)] = true;
+		}
+		else if (mappedCircuit.IsSecondaryInput(node))
+		{
+			fixedInputs.secondaryInputs[mappedCircuit.GetSecondaryInputNumber(node)] = true;
+			visit(mappedCircuit.GetSecondaryOutputForSecondaryInput(node));
+		}
+
+		for (const auto* input : node->GetInputs())
+		{
+			visit(input);
+		}
+	}
+
+	const size_t fixedPrimaryInputs = std::count(fixedInputs.primaryInputs.begin(), fixedInputs.primaryInputs.end(), true);
+	const size_t fixedSecondaryInputs = std::count(fixedInputs.secondaryInputs.begin(), fixedInputs.secondaryInputs.end(), true);
+	LOG(INFO) << "The VCM observes " << fixedPrimaryInputs << " primary and " << fixedSecondaryInputs
+		<< " secondary inputs which are excluded from the DON'T CARE relaxation and fill";
+
+	return fixedInputs;
+}
+
 template <typename FaultModel, typename FaultList>
 bool SatFullScanAtpg<FaultModel, FaultList>::SetSetting(std::string key, std::string value)
 {
@@ -183,6 +344,50 @@ bool SatFullScanAtpg<FaultModel, FaultList>::SetSetting(std::string key, std::st
 	{
 		return Settings::ParseSizet(value, maximizeDontCareFlipFlopWeight);
 	}
+	if (key == "Scale4Edge/TestPatternGeneration/DontCareRelaxation")
+	{
+		return Settings::ParseEnum(value, dontCareRelaxation, {
+			{ "Disabled", DontCareRelaxation::Disabled },
+			{ "Enabled", DontCareRelaxation::Enabled }
+		});
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/DontCareFill")
+	{
+		return Settings::ParseEnum(value, dontCareFill, {
+			{ "None", Pattern::FillMode::None },
+			{ "Zero", Pattern::FillMode::Zero },
+			{ "One", Pattern::FillMode::One },
+			{ "Adjacent", Pattern::FillMode::Adjacent },
+			{ "Random", Pattern::FillMode::Random }
+		});
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/DontCareFillSeed")
+	{
+		return Settings::ParseSizet(value, dontCareFillSeed);
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/PatternGenerationPipeline")
+	{
+		return Settings::ParseEnum(value, patternGenerationPipeline, {
+			{ "Disabled", PatternGenerationPipeline::Disabled },
+			{ "Enabled", PatternGenerationPipeline::Enabled }
+		});
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/PipelineDepth")
+	{
+		return Settings::ParseSizet(value, pipelineDepth);
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/PipelineEncodingThreadLimit")
+	{
+		return Settings::ParseSizet(value, pipelineEncodingThreadLimit);
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/PipelineSolvingThreadLimit")
+	{
+		return Settings::ParseSizet(value, pipelineSolvingThreadLimit);
+	}
+	if (key == "Scale4Edge/TestPatternGeneration/PipelineExtractionThreadLimit")
+	{
+		return Settings::ParseSizet(value, pipelineExtractionThreadLimit);
+	}
 
 	return AtpgBase<FaultModel, FaultList>::SetSetting(key, value);
 }
@@ -193,8 +398,40 @@ Basic::ApplicationStatistics SatFullScanAtpg<FaultModel, FaultList>::GetStatisti
 	return AtpgBase<FaultModel, FaultList>::GetStatistics();
 }
 
+template <typename FaultModel, typename FaultList>
+struct SatFullScanAtpg<FaultModel, FaultList>::PatternGenerationJob
+{
+	PatternGenerationJob(void):
+		vcmContext("pattern_generation", "Pattern Generation"),
+		result(Sat::SatResult::UNKNOWN)
+	{
+	}
+
+	std::shared_ptr<Sat::SatSolverProxy> satSolver;
+	std::shared_ptr<Tpg::LogicGenerator<PinData>> logicGenerator;
+	std::shared_ptr<Tpg::LogicGenerator<VcmPinData>> vcmLogicGenerator;
+	Tpg::Vcm::VcmContext vcmContext;
+
+	Sat::SatResult result;
+	CpuClock cnfGenerationTimer;
+	CpuClock satSolverTimer;
+	CpuClock relaxationTimer;
+	size_t extractedCareBits { 0u };
+	size_t relaxedCareBits { 0u };
+};
+
 template <typename FaultModel, typename FaultList>
 void SatFullScanAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t faultIndex)
+{
+	auto job = EncodePatternForFault(faultIndex);
+	if (job && SolvePatternForFault(faultIndex, *job))
+	{
+		ExtractPatternForFault(faultIndex, *job);
+	}
+}
+
+template <typename FaultModel, typename FaultList>
+std::unique_ptr<typename SatFullScanAtpg<FaultModel, FaultList>::PatternGenerationJob> SatFullScanAtpg<FaultModel, FaultList>::EncodePatternForFault(size_t faultIndex)
 {
 	using FaultGenerator = typename AtpgConfig<FaultModel, PinData>::FaultGenerator;
 	using FaultSensitization = typename AtpgConfig<FaultModel, PinData>::FaultSensitization;
@@ -206,9 +443,9 @@ void SatFullScanAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t faul
 
 	// Check for already detected faults
 	auto [fault, metadata] = this->faultList[faultIndex];
-	if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
 	{
-		return;
+		return nullptr;
 	}
 
 	LOG_IF(this->maximizeDontCareValues == MaximizeDontCareValues::Enabled, WARNING) << "Maximization of DON'T CARE values enabled. Forcing Pacose Max-SAT solver.";
@@ -218,7 +455,7 @@ void SatFullScanAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t faul
 	if (!satSolver)
 	{
 		LOG(FATAL) << "Could not initialize SAT-Solver!";
-		return;
+		return nullptr;
 	}
 
 	satSolver->SetSolverTimeout(this->solverTimeout);
@@ -270,7 +507,12 @@ void SatFullScanAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t faul
 	// For the cell-aware model the propagation constraint "Any" is required due to different lengths of the patterns.
 	logicGenerator->template EmplaceModule<Tpg::FaultPropagationConstraintEncoder<PinData>>(Tpg::FaultPropagationTarget::PrimaryAndSecondaryOutputs, Tpg::FaultPropagationTimeframe::Any);
 
-	Tpg::Vcm::VcmContext vcmContext { "pattern_generation", "Pattern Generation" };
+	auto job = std::make_unique<PatternGenerationJob>();
+	job->satSolver = satSolver;
+	job->logicGenerator = logicGenerator;
+	job->vcmLogicGenerator = vcmLogicGenerator;
+
+	Tpg::Vcm::VcmContext& vcmContext { job->vcmContext };
 	vcmContext.SetTargetStartState(std::vector<Basic::Logic>(this->circuit->GetMappedCircuit().GetNumberOfSecondaryInputs(), Basic::Logic::LOGIC_DONT_CARE));
 	vcmContext.AddTags(this->vcmTags);
 	vcmContext.AddVcmParameters(this->vcmParameters);
@@ -322,9 +564,7 @@ void SatFullScanAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t faul
 
 	LOG(INFO) << "Generating test pattern for fault " << to_string(*fault);
 
-	Sat::SatResult result;
-	CpuClock cnfGenerationTimer;
-	CpuClock satSolverTimer;
+	CpuClock& cnfGenerationTimer { job->cnfGenerationTimer };
 
 	cnfGenerationTimer.SetTimeReference();
 	logicGenerator->GetContext().SetNumberOfTimeframes(timeframes);
@@ -335,84 +575,131 @@ void SatFullScanAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t faul
 		cnfGenerationTimer.Stop();
 		LOG(INFO) << "Fault is untestable as no circuit output can be reached";
 
-		std::scoped_lock lock { this->parallelMutex };
-		if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-		{
-			AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
-				Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
-		}
-		goto nextFault;
+		AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
+			Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
+		FinishPatternForFault(*job);
+		return nullptr;
 	}
 	cnfGenerationTimer.Stop();
 
+	return job;
+}
+
+template <typename FaultModel, typename FaultList>
+bool SatFullScanAtpg<FaultModel, FaultList>::SolvePatternForFault(size_t faultIndex, PatternGenerationJob& job)
+{
+	Logging::SetCurrentFault(faultIndex);
+
+	// The fault might have been detected by the pattern of another fault since the encoding
+	auto [fault, metadata] = this->faultList[faultIndex];
+	if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	{
+		FinishPatternForFault(job);
+		return false;
+	}
+
 	VLOG(3) << "Invoking SAT-Solver to find solution";
-	satSolverTimer.SetTimeReference();
-	result = (maximizeDontCareValues == MaximizeDontCareValues::Enabled)
-		? std::dynamic_pointer_cast<Sat::MaxSatSolverProxy>(satSolver)->MaxSolve()
-		: satSolver->Solve();
-	satSolverTimer.Stop();
+	job.satSolverTimer.SetTimeReference();
+	job.result = (maximizeDontCareValues == MaximizeDontCareValues::Enabled)
+		? std::dynamic_pointer_cast<Sat::MaxSatSolverProxy>(job.satSolver)->MaxSolve()
+		: job.satSolver->Solve();
+	job.satSolverTimer.Stop();
 
-	switch (result)
+	switch (job.result)
 	{
 	case Sat::SatResult::SAT:
+		return true;
+
+	case Sat::SatResult::UNSAT:
 	{
-		Pattern::TestPattern pattern = Tpg::Extractor::ExtractTestPattern<PinData, GoodTag>(logicGenerator->GetContext(), Pattern::InputCapture::PrimaryAndSecondaryInputs);
-		VLOG(3) << "Generated test pattern: " << to_string(pattern);
+		LOG(INFO) << "There exists no test pattern (" << to_string(job.result) << ")";
 
-		Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
-		simConfig.sequentialMode = Simulation::SequentialMode::FullScan;
+		AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
+			Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
+		break;
+	}
 
-		if (this->checkAtpgResult == AtpgBase<FaultModel, FaultList>::CheckAtpgResult::CheckEqual)
-		{
-			AtpgBase<FaultModel, FaultList>::ValidateAtpgResult(faultIndex, pattern, Pattern::OutputCapture::PrimaryAndSecondaryOutputs, *logicGenerator, simConfig);
-		}
+	default:
+	case Sat::SatResult::UNKNOWN:
+	{
+		LOG(WARNING) << "No conclusion about testability could be found (" << to_string(job.result) << ")";
 
-		size_t testPatternIndex = this->testPatterns.emplace_back(pattern);
-		AtpgBase<FaultModel, FaultList>::RunFaultSimulation(vcmContext, faultIndex, testPatternIndex, Pattern::OutputCapture::PrimaryAndSecondaryOutputs, simConfig);
+		AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+			Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
+		break;
+	}
 
-		if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_DETECTED)
-		{
-			LOG(FATAL) << "Invalid test pattern was generated";
-		}
+	} // end case
 
-		goto nextFault;
-	}
+	FinishPatternForFault(job);
+	return false;
+}
 
-	case Sat::SatResult::UNSAT:
-	{
-		LOG(INFO) << "There exists no test pattern (" << to_string(result) << ")";
+template <typename FaultModel, typename FaultList>
+void SatFullScanAtpg<FaultModel, FaultList>::ExtractPatternForFault(size_t faultIndex, PatternGenerationJob& job)
+{
+	Logging::SetCurrentFault(faultIndex);
+	auto [fault, metadata] = this->faultList[faultIndex];
 
-		std::scoped_lock lock { this->parallelMutex };
-		if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-		{
-			AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNDETECTED,
-				Fault::TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
-		}
-		goto nextFault;
+	Pattern::TestPattern pattern = Tpg::Extractor::ExtractTestPattern<PinData, GoodTag>(job.logicGenerator->GetContext(), Pattern::InputCapture::PrimaryAndSecondaryInputs);
+	VLOG(3) << "Generated test pattern: " << to_string(pattern);
+
+	Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
+	simConfig.sequentialMode = Simulation::SequentialMode::FullScan;
+
+	if (this->checkAtpgResult == AtpgBase<FaultModel, FaultList>::CheckAtpgResult::CheckEqual)
+	{
+		AtpgBase<FaultModel, FaultList>::ValidateAtpgResult(faultIndex, pattern, Pattern::OutputCapture::PrimaryAndSecondaryOutputs, *job.logicGenerator, simConfig);
 	}
 
-	default:
-	case Sat::SatResult::UNKNOWN:
+	// The relaxation only removes care bits and the fill only assigns don't care values.
+	// Both keep the detection of the target fault intact.
+	// The inputs observed by the VCM are kept as the VCM constraints are not simulated here.
+	if (dontCareRelaxation == DontCareRelaxation::Enabled)
 	{
-		LOG(WARNING) << "No conclusion about testability could be found (" << to_string(result) << ")";
+		job.relaxationTimer.SetTimeReference();
+		job.extractedCareBits = Pattern::GetNumberOfCareBits(pattern);
+		job.relaxedCareBits = Simulation::RelaxTestPattern<FaultModel>(this->circuit->GetMappedCircuit(), pattern, FaultModel(fault),
+			Pattern::OutputCapture::PrimaryAndSecondaryOutputs, simConfig, vcmFixedInputs);
+		job.relaxationTimer.Stop();
+		VLOG(3) << "Relaxed " << job.relaxedCareBits << " of " << job.extractedCareBits << " care bits: " << to_string(pattern);
+	}
+	if (dontCareFill != Pattern::FillMode::None)
+	{
+		Pattern::FillDontCareValues(pattern, dontCareFill, dontCareFillSeed + faultIndex, vcmFixedInputs);
+	}
 
-		std::scoped_lock lock { this->parallelMutex };
-		if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-		{
-			AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-				Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
-		}
-		goto nextFault;
+	size_t testPatternIndex = this->testPatterns.emplace_back(pattern);
+	AtpgBase<FaultModel, FaultList>::RunFaultSimulation(job.vcmContext, faultIndex, testPatternIndex, Pattern::OutputCapture::PrimaryAndSecondaryOutputs, simConfig);
+
+	if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+	{
+		LOG(FATAL) << "Invalid test pattern was generated";
 	}
 
-	} // end case
+	FinishPatternForFault(job);
+}
 
-nextFault:
-	std::scoped_lock lock { this->parallelMutex };
-	this->timeTseitin.AddValue(cnfGenerationTimer.TotalRunTime());
-	this->timeSolver.AddValue(satSolverTimer.TotalRunTime());
-	this->tseitinClauses.AddValue(satSolver->GetNumberOfClauses());
-	AtpgBase<FaultModel, FaultList>::SnapshotStatisticsForIteration();
+template <typename FaultModel, typename FaultList>
+void SatFullScanAtpg<FaultModel, FaultList>::FinishPatternForFault(PatternGenerationJob& job)
+{
+	this->timeTseitinLocal.AddValue(job.cnfGenerationTimer.TotalRunTime());
+	this->timeSolverLocal.AddValue(job.satSolverTimer.TotalRunTime());
+	this->tseitinClausesLocal.AddValue(job.satSolver->GetNumberOfClauses());
+	extractedCareBits += job.extractedCareBits;
+	relaxedCareBits += job.relaxedCareBits;
+	if (dontCareRelaxation == DontCareRelaxation::Enabled)
+	{
+		relaxationTimeLocal.AddValue(job.relaxationTimer.TotalRunTime());
+	}
+
+	// The statistics of the iteration only report the progress.
+	// A fault skips the report while another thread is taking it, which doesn't block the extraction.
+	std::unique_lock lock { this->parallelMutex, std::try_to_lock };
+	if (lock.owns_lock())
+	{
+		AtpgBase<FaultModel, FaultList>::SnapshotStatisticsForIteration();
+	}
 }
 
 template class SatFullScanAtpg<Fault::SingleStuckAtFaultModel, Fault::SingleStuckAtFaultList>;
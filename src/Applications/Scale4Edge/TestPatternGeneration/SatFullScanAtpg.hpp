@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 
 #include "Applications/Scale4Edge/TestPatternGeneration/Base/AtpgBase.hpp"
+#include "Basic/Pattern/PatternFill.hpp"
+#include "Basic/Statistic/AverageStatistic.hpp"
+#include "Basic/Statistic/ThreadLocalStatistic.hpp"
 
 namespace FreiTest
 {
@@ -72,15 +77,57 @@ protected:
 		Outputs,
 		InputAndOutputs
 	};
+	enum class DontCareRelaxation {
+		Disabled,
+		Enabled
+	};
+	enum class PatternGenerationPipeline {
+		Disabled,
+		Enabled
+	};
+
+	/**
+	 * @brief The state of the pattern generation for one fault
+	 * that is handed over between the stages of the pipeline.
+	 */
+	struct PatternGenerationJob;
 
 	void GeneratePatternForFault(size_t faultIndex);
 
+	// Stages of the pattern generation for one fault:
+	// 1. Encode the fault into a new CNF (nullptr if the fault is skipped or untestable)
+	// 2. Solve the CNF (true if a test pattern has been found)
+	// 3. Extract the test pattern and run the fault simulation
+	std::unique_ptr<PatternGenerationJob> EncodePatternForFault(size_t faultIndex);
+	bool SolvePatternForFault(size_t faultIndex, PatternGenerationJob& job);
+	void ExtractPatternForFault(size_t faultIndex, PatternGenerationJob& job);
+	void FinishPatternForFault(PatternGenerationJob& job);
+
+	// Returns the inputs of the circuit which are observed by the VCM and therefore
+	// can not be relaxed or filled without breaking the VCM constraints.
+	Pattern::FixedInputs GetVcmFixedInputs(void) const;
+
 	MaximizeDontCareValues maximizeDontCareValues;
 	MaximizeDontCarePorts maximizeDontCarePorts;
 	MaximizeDontCareFlipFlops maximizeDontCareFlipFlops;
 	size_t maximizeDontCarePortWeight;
 	size_t maximizeDontCareFlipFlopWeight;
 
+	DontCareRelaxation dontCareRelaxation;
+	Pattern::FillMode dontCareFill;
+	size_t dontCareFillSeed;
+	Pattern::FixedInputs vcmFixedInputs;
+	std::atomic<size_t> extractedCareBits;
+	std::atomic<size_t> relaxedCareBits;
+	Statistic::AverageStatistic relaxationTime;
+	Statistic::ThreadLocalStatistic<Statistic::AverageStatistic> relaxationTimeLocal;
+
+	PatternGenerationPipeline patternGenerationPipeline;
+	size_t pipelineDepth;
+	size_t pipelineEncodingThreadLimit;
+	size_t pipelineSolvingThreadLimit;
+	size_t pipelineExtractionThreadLimit;
+
 };
 
 };
@@ -146,11 +146,16 @@ void SatSequentialAtpg<FaultModel, FaultList>::Run(void)
 		}
 	}
 
+	AtpgBase<FaultModel, FaultList>::StartCheckpoints();
+
 	// Generate test patterns in the first iteration where each pattern is generated in one step
-	Parallel::ExecuteParallel(this->faultListBegin, this->faultListEnd, Parallel::Arena::PatternGeneration, Parallel::Order::Parallel, [&](size_t index) {
-		GeneratePatternForFault(index);
+	AtpgBase<FaultModel, FaultList>::RunPatternGeneration([&](size_t begin, size_t end) {
+		Parallel::ExecuteParallel(begin, end, Parallel::Arena::PatternGeneration, Parallel::Order::Parallel, [&](size_t index) {
+			GeneratePatternForFault(index);
+		});
 	});
 	Logging::ClearCurrentFault();
+	AtpgBase<FaultModel, FaultList>::StopCheckpoints();
 
 	this->statistics.Add("Encoding.PatternGeneration.LogicContainer", std::string("LogicContainer") + get_logic_container_name<LogicContainer>, "Type", "LogicContainer used");
 	this->statistics.Add("Encoding.PatternGeneration.PinData", std::string("PinData") + get_pin_data_name_v<PinData>, "Type", "PinData used");
@@ -177,7 +182,7 @@ void SatSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 
 	// Check for already detected faults
 	auto [fault, metadata] = this->faultList[faultIndex];
-	if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
 	{
 		return;
 	}
@@ -291,13 +296,9 @@ void SatSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 				cnfGenerationTimer.Stop();
 				LOG(INFO) << "Fault is untestable with " << timeframes << " timeframes and no test pattern has been generated";
 
-				std::scoped_lock lock { this->parallelMutex };
-				if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-				{
-					AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex,
-						Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-						Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS);
-				}
+				AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+					Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+					Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS);
 				goto nextFault;
 			}
 
@@ -327,7 +328,7 @@ void SatSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 			size_t testPatternIndex = this->testPatterns.emplace_back(pattern);
 			AtpgBase<FaultModel, FaultList>::RunFaultSimulation(vcmContext, faultIndex, testPatternIndex, Pattern::OutputCapture::PrimaryOutputsOnly, simConfig);
 
-			if (metadata->faultStatus != Fault::FaultStatus::FAULT_STATUS_DETECTED)
+			if (metadata->GetFaultStatus() != Fault::FaultStatus::FAULT_STATUS_DETECTED)
 			{
 				LOG(FATAL) << "Invalid test pattern was generated";
 			}
@@ -340,13 +341,9 @@ void SatSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 
 			if (timeframes == this->settingsMaximumTimeframes)
 			{
-				std::scoped_lock lock { this->parallelMutex };
-				if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-				{
-					AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex,
-						Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-						Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS);
-				}
+				AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+					Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+					Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_MAX_ITERATIONS);
 				goto nextFault;
 			}
 			continue;
@@ -357,13 +354,9 @@ void SatSequentialAtpg<FaultModel, FaultList>::GeneratePatternForFault(size_t fa
 		{
 			LOG(WARNING) << "No conclusion about testability could be found (" << to_string(result) << ")";
 
-			std::scoped_lock lock { this->parallelMutex };
-			if (metadata->faultStatus == Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED)
-			{
-				AtpgBase<FaultModel, FaultList>::SetFaultStatus(this->faultList, faultIndex,
-					Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
-					Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
-			}
+			AtpgBase<FaultModel, FaultList>::TrySetFaultStatus(this->faultList, faultIndex, Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				Fault::FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+				Fault::TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
 			goto nextFault;
 		}
 		} // end case
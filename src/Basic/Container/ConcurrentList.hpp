@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <mutex>
@@ -208,6 +209,17 @@ public:
 	reference operator[](index_type index) { std::scoped_lock lock { _mutex }; return _elements[index]; }
 	const_reference operator[](index_type index) const { std::scoped_lock lock { _mutex }; return _elements[index]; }
 
+	// Copies the elements of the range [begin, end) while the list is locked.
+	// The end is limited to the current size of the list.
+	std::vector<value_type> copy_range(index_type begin, index_type end) const
+	{
+		std::scoped_lock lock { _mutex };
+		end = std::min(end, _elements.size());
+		return (begin < end)
+			? std::vector<value_type>(_elements.begin() + begin, _elements.begin() + end)
+			: std::vector<value_type>();
+	}
+
 	reference front(void) { return (*this)[0u]; }
 	reference back(void) { return (*this)[this->size()]; }
 	const_reference front(void) const { return (*this)[0u]; }
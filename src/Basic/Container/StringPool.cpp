@@ -0,0 +1,139 @@
+#include "Basic/Container/StringPool.hpp"
+
+namespace FreiTest
+{
+namespace Basic
+{
+namespace Container
+{
+
+static const std::string EMPTY_STRING { };
+
+InternedString::InternedString(void):
+	_value(&EMPTY_STRING)
+{
+}
+
+InternedString::InternedString(const std::string& value):
+	_value(&value)
+{
+}
+
+const std::string& InternedString::Get(void) const
+{
+	return *_value;
+}
+
+InternedString::operator const std::string&(void) const
+{
+	return *_value;
+}
+
+bool InternedString::operator==(const InternedString& other) const
+{
+	// Strings of the same pool are equal if they have the same address
+	return _value == other._value || *_value == *other._value;
+}
+
+bool InternedString::operator!=(const InternedString& other) const
+{
+	return !(*this == other);
+}
+
+bool InternedString::operator==(const std::string& other) const
+{
+	return *_value == other;
+}
+
+bool InternedString::operator!=(const std::string& other) const
+{
+	return *_value != other;
+}
+
+bool InternedString::operator==(const char* other) const
+{
+	return *_value == other;
+}
+
+bool InternedString::operator!=(const char* other) const
+{
+	return *_value != other;
+}
+
+std::ostream& operator<<(std::ostream& out, const InternedString& value)
+{
+	return out << value.Get();
+}
+
+std::string operator+(const std::string& lhs, const InternedString& rhs)
+{
+	return lhs + rhs.Get();
+}
+
+std::string operator+(const InternedString& lhs, const std::string& rhs)
+{
+	return lhs.Get() + rhs;
+}
+
+std::string operator+(const char* lhs, const InternedString& rhs)
+{
+	return lhs + rhs.Get();
+}
+
+std::string operator+(const InternedString& lhs, const char* rhs)
+{
+	return lhs.Get() + rhs;
+}
+
+StringPool::StringPool(void):
+	_strings(),
+	_index(),
+	_characters(0u)
+{
+}
+
+StringPool::~StringPool(void) = default;
+
+InternedString StringPool::Intern(std::string_view value)
+{
+	if (auto it = _index.find(value); it != _index.end())
+	{
+		return InternedString(*it->second);
+	}
+
+	return Intern(std::string(value));
+}
+
+InternedString StringPool::Intern(const char* value)
+{
+	return Intern(std::string_view(value));
+}
+
+InternedString StringPool::Intern(std::string&& value)
+{
+	if (auto it = _index.find(value); it != _index.end())
+	{
+		return InternedString(*it->second);
+	}
+
+	// The index references the characters of the stored string.
+	// This is valid as the strings never move inside of the deque.
+	const std::string& stored { _strings.emplace_back(std::move(value)) };
+	_index.emplace(stored, &stored);
+	_characters += stored.size();
+	return InternedString(stored);
+}
+
+size_t StringPool::GetNumberOfStrings(void) const
+{
+	return _strings.size();
+}
+
+size_t StringPool::GetNumberOfCharacters(void) const
+{
+	return _characters;
+}
+
+};
+};
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace FreiTest
+{
+namespace Basic
+{
+namespace Container
+{
+
+/**
+ * @brief A reference to an immutable string that is stored in a StringPool.
+ *
+ * The reference has the size of a pointer and can be used like a const std::string&.
+ * The referenced string has to outlive the InternedString.
+ */
+class InternedString
+{
+public:
+	InternedString(void);
+	explicit InternedString(const std::string& value);
+
+	const std::string& Get(void) const;
+	operator const std::string&(void) const;
+
+	bool operator==(const InternedString& other) const;
+	bool operator!=(const InternedString& other) const;
+	bool operator==(const std::string& other) const;
+	bool operator!=(const std::string& other) const;
+	bool operator==(const char* other) const;
+	bool operator!=(const char* other) const;
+
+	friend std::ostream& operator<<(std::ostream& out, const InternedString& value);
+
+private:
+	const std::string* _value;
+
+};
+
+std::string operator+(const std::string& lhs, const InternedString& rhs);
+std::string operator+(const InternedString& lhs, const std::string& rhs);
+std::string operator+(const char* lhs, const InternedString& rhs);
+std::string operator+(const InternedString& lhs, const char* rhs);
+
+/**
+ * @brief Stores every distinct string once.
+ *
+ * The strings are stored in a std::deque, which never moves its elements
+ * when strings are appended, and are released together with the pool.
+ * A hash map from the characters to the stored string finds equal strings.
+ * Equal names (types, pins, ports, wires) are shared by all users of the pool
+ * instead of being copied for every node.
+ * The pool is not thread-safe.
+ */
+class StringPool
+{
+public:
+	StringPool(void);
+	virtual ~StringPool(void);
+
+	// The interned strings are referenced by address
+	StringPool(const StringPool& other) = delete;
+	StringPool(StringPool&& other) = delete;
+	StringPool& operator=(const StringPool& other) = delete;
+	StringPool& operator=(StringPool&& other) = delete;
+
+	InternedString Intern(std::string_view value);
+	InternedString Intern(const char* value);
+	InternedString Intern(std::string&& value);
+
+	size_t GetNumberOfStrings(void) const;
+	size_t GetNumberOfCharacters(void) const;
+
+private:
+	std::deque<std::string> _strings;
+	std::unordered_map<std::string_view, const std::string*> _index;
+	size_t _characters;
+
+};
+
+};
+};
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -52,17 +53,30 @@ public:
 	}
 
 	ConcurrentFaultList(container_type&& other):
-		Basic::Container::ConcurrentList<FaultT, MetaDataT>(other)
+		Basic::Container::ConcurrentList<FaultT, MetaDataT>(std::move(other))
 	{
 	}
 
 	ConcurrentFaultList(const std::vector<FaultT>& other):
 		Basic::Container::ConcurrentList<FaultT, MetaDataT>()
 	{
+		// The faults and metadata are stored by value in contiguous arrays
+		// instead of one heap allocation per fault and per metadata.
+		// The list entries are aliasing pointers into the arrays.
+		// Each chunk of the arrays has its own reference count, as the threads
+		// would otherwise contend on one counter when they copy the entries.
 		this->_elements.reserve(other.size());
-		std::transform(other.begin(), other.end(), std::back_inserter(this->_elements), [](const auto& fault) {
-			return std::make_tuple(std::make_shared<FaultT>(fault), std::make_shared<MetaDataT>());
-		});
+		for (size_t begin { 0u }; begin < other.size(); begin += STORAGE_CHUNK_SIZE)
+		{
+			const size_t end { std::min(other.size(), begin + STORAGE_CHUNK_SIZE) };
+			auto storage { std::make_shared<Storage>(other.begin() + begin, other.begin() + end) };
+			for (size_t index { 0u }; index < end - begin; ++index)
+			{
+				this->_elements.emplace_back(
+					std::shared_ptr<FaultT>(storage, &storage->faults[index]),
+					std::shared_ptr<MetaDataT>(storage, &storage->metaData[index]));
+			}
+		}
 	}
 
 	virtual ~ConcurrentFaultList(void) = default;
@@ -76,7 +90,7 @@ public:
 
 	container_type& operator=(container_type&& other)
 	{
-		Basic::Container::ConcurrentList<FaultT, MetaDataT>::operator=(other);
+		Basic::Container::ConcurrentList<FaultT, MetaDataT>::operator=(std::move(other));
 		return *this;
 	}
 
@@ -92,6 +106,22 @@ public:
 		return std::get<1>(this->_elements[index]);
 	}
 
+private:
+	// The number of faults that share one reference count
+	static constexpr size_t STORAGE_CHUNK_SIZE { 256u };
+
+	struct Storage
+	{
+		Storage(typename std::vector<FaultT>::const_iterator begin, typename std::vector<FaultT>::const_iterator end):
+			faults(begin, end),
+			metaData(faults.size())
+		{
+		}
+
+		std::vector<FaultT> faults;
+		std::vector<MetaDataT> metaData;
+	};
+
 };
 
 };
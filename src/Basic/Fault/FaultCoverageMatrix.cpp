@@ -0,0 +1,367 @@
+#include "Basic/Fault/FaultCoverageMatrix.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+#include "Basic/Logging.hpp"
+
+namespace FreiTest
+{
+namespace Fault
+{
+
+// Number of faults / patterns that are checked for dominance against one fault / pattern
+static constexpr size_t DOMINANCE_CANDIDATE_LIMIT { 1024u };
+
+FaultCoverageMatrix::FaultCoverageMatrix(void):
+	FaultCoverageMatrix(0u, { })
+{
+}
+
+FaultCoverageMatrix::FaultCoverageMatrix(size_t numberOfFaults, std::vector<std::vector<index_type>>&& patternDetections):
+	_patternOffsets(patternDetections.size() + 1u, 0u),
+	_patternFaults(),
+	_faultOffsets(numberOfFaults + 1u, 0u),
+	_faultPatterns()
+{
+	ASSERT(patternDetections.size() <= std::numeric_limits<index_type>::max()) << "Too many patterns for the coverage matrix";
+	ASSERT(numberOfFaults <= std::numeric_limits<index_type>::max()) << "Too many faults for the coverage matrix";
+
+	for (size_t pattern { 0u }; pattern < patternDetections.size(); ++pattern)
+	{
+		_patternOffsets[pattern + 1u] = _patternOffsets[pattern] + patternDetections[pattern].size();
+	}
+
+	_patternFaults.reserve(_patternOffsets.back());
+	for (auto& detections : patternDetections)
+	{
+		DASSERT(std::is_sorted(detections.begin(), detections.end())) << "The detected faults of a pattern have to be sorted";
+		for (const auto fault : detections)
+		{
+			ASSERT(fault < numberOfFaults) << "The fault " << fault << " is not part of the coverage matrix";
+			_faultOffsets[fault + 1u]++;
+		}
+
+		_patternFaults.insert(_patternFaults.end(), detections.begin(), detections.end());
+		std::vector<index_type>().swap(detections);
+	}
+	std::partial_sum(_faultOffsets.begin(), _faultOffsets.end(), _faultOffsets.begin());
+
+	// Transpose the rows. As the patterns are processed in ascending
+	// order the patterns of each fault are sorted too.
+	_faultPatterns.resize(_patternFaults.size());
+	std::vector<size_t> positions(_faultOffsets.begin(), _faultOffsets.end() - 1u);
+	for (size_t pattern { 0u }; pattern + 1u < _patternOffsets.size(); ++pattern)
+	{
+		for (const auto fault : GetDetectedFaults(pattern))
+		{
+			_faultPatterns[positions[fault]++] = static_cast<index_type>(pattern);
+		}
+	}
+}
+
+FaultCoverageMatrix::~FaultCoverageMatrix(void) = default;
+
+size_t FaultCoverageMatrix::GetNumberOfPatterns(void) const
+{
+	return _patternOffsets.size() - 1u;
+}
+
+size_t FaultCoverageMatrix::GetNumberOfFaults(void) const
+{
+	return _faultOffsets.size() - 1u;
+}
+
+size_t FaultCoverageMatrix::GetNumberOfDetections(void) const
+{
+	return _patternFaults.size();
+}
+
+FaultCoverageMatrix::IndexRange FaultCoverageMatrix::GetDetectedFaults(size_t pattern) const
+{
+	return { _patternFaults.data() + _patternOffsets[pattern], _patternFaults.data() + _patternOffsets[pattern + 1u] };
+}
+
+FaultCoverageMatrix::IndexRange FaultCoverageMatrix::GetDetectingPatterns(size_t fault) const
+{
+	return { _faultPatterns.data() + _faultOffsets[fault], _faultPatterns.data() + _faultOffsets[fault + 1u] };
+}
+
+bool FaultCoverageMatrix::IsDetected(size_t pattern, size_t fault) const
+{
+	const auto faults { GetDetectedFaults(pattern) };
+	return std::binary_search(faults.begin(), faults.end(), fault);
+}
+
+// Checks if the active elements of the subset are all contained in the superset.
+static bool IsActiveSubset(FaultCoverageMatrix::IndexRange subset, FaultCoverageMatrix::IndexRange superset, const std::vector<bool>& active)
+{
+	auto position { superset.begin() };
+	for (const auto element : subset)
+	{
+		if (!active[element])
+		{
+			continue;
+		}
+
+		position = std::lower_bound(position, superset.end(), element);
+		if (position == superset.end() || *position != element)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+SetCoverReduction ReduceSetCover(const FaultCoverageMatrix& matrix)
+{
+	const size_t numberOfPatterns { matrix.GetNumberOfPatterns() };
+	const size_t numberOfFaults { matrix.GetNumberOfFaults() };
+
+	// The number of active faults of each pattern and active patterns of each fault
+	std::vector<bool> patternActive(numberOfPatterns);
+	std::vector<bool> faultActive(numberOfFaults);
+	std::vector<size_t> patternCount(numberOfPatterns);
+	std::vector<size_t> faultCount(numberOfFaults);
+	std::vector<size_t> singleFaults;
+
+	for (size_t pattern { 0u }; pattern < numberOfPatterns; ++pattern)
+	{
+		patternCount[pattern] = matrix.GetDetectedFaults(pattern).size();
+		patternActive[pattern] = (patternCount[pattern] > 0u);
+	}
+	for (size_t fault { 0u }; fault < numberOfFaults; ++fault)
+	{
+		faultCount[fault] = matrix.GetDetectingPatterns(fault).size();
+		faultActive[fault] = (faultCount[fault] > 0u);
+		if (faultCount[fault] == 1u)
+		{
+			singleFaults.push_back(fault);
+		}
+	}
+
+	SetCoverReduction result { };
+	result.dominatedPatterns = 0u;
+	result.dominatedFaults = 0u;
+
+	// A removed fault is either covered or implied by another fault.
+	// Patterns without active faults are not required anymore.
+	const auto remove_fault = [&](size_t fault) {
+		faultActive[fault] = false;
+		for (const auto pattern : matrix.GetDetectingPatterns(fault))
+		{
+			if (patternActive[pattern] && --patternCount[pattern] == 0u)
+			{
+				patternActive[pattern] = false;
+			}
+		}
+	};
+	const auto remove_pattern = [&](size_t pattern) {
+		patternActive[pattern] = false;
+		for (const auto fault : matrix.GetDetectedFaults(pattern))
+		{
+			if (faultActive[fault] && --faultCount[fault] == 1u)
+			{
+				singleFaults.push_back(fault);
+			}
+		}
+	};
+
+	const auto select_essential_patterns = [&]() {
+		while (!singleFaults.empty())
+		{
+			const size_t fault { singleFaults.back() };
+			singleFaults.pop_back();
+			if (!faultActive[fault])
+			{
+				continue;
+			}
+
+			const auto patterns { matrix.GetDetectingPatterns(fault) };
+			const auto essential { *std::find_if(patterns.begin(), patterns.end(), [&](auto pattern) { return patternActive[pattern]; }) };
+			result.essentialPatterns.push_back(essential);
+			for (const auto covered : matrix.GetDetectedFaults(essential))
+			{
+				if (faultActive[covered])
+				{
+					remove_fault(covered);
+				}
+			}
+		}
+	};
+
+	const auto remove_dominated_faults = [&]() {
+		bool changed { false };
+		for (size_t fault { 0u }; fault < numberOfFaults; ++fault)
+		{
+			if (!faultActive[fault])
+			{
+				continue;
+			}
+
+			// All faults that have a superset of the patterns are detected
+			// by the pattern with the fewest active faults too.
+			size_t candidate { std::numeric_limits<size_t>::max() };
+			for (const auto pattern : matrix.GetDetectingPatterns(fault))
+			{
+				if (patternActive[pattern] && (candidate == std::numeric_limits<size_t>::max() || patternCount[pattern] < patternCount[candidate]))
+				{
+					candidate = pattern;
+				}
+			}
+			if (patternCount[candidate] > DOMINANCE_CANDIDATE_LIMIT)
+			{
+				continue;
+			}
+
+			for (const auto other : matrix.GetDetectedFaults(candidate))
+			{
+				if (other == fault || !faultActive[other] || faultCount[other] < faultCount[fault])
+				{
+					continue;
+				}
+
+				if (IsActiveSubset(matrix.GetDetectingPatterns(fault), matrix.GetDetectingPatterns(other), patternActive))
+				{
+					remove_fault(other);
+					result.dominatedFaults++;
+					changed = true;
+				}
+			}
+		}
+		return changed;
+	};
+
+	const auto remove_dominated_patterns = [&]() {
+		bool changed { false };
+		for (size_t pattern { 0u }; pattern < numberOfPatterns; ++pattern)
+		{
+			if (!patternActive[pattern])
+			{
+				continue;
+			}
+
+			// All patterns that have a superset of the faults detect
+			// the fault with the fewest active patterns too.
+			size_t candidate { std::numeric_limits<size_t>::max() };
+			for (const auto fault : matrix.GetDetectedFaults(pattern))
+			{
+				if (faultActive[fault] && (candidate == std::numeric_limits<size_t>::max() || faultCount[fault] < faultCount[candidate]))
+				{
+					candidate = fault;
+				}
+			}
+			if (faultCount[candidate] > DOMINANCE_CANDIDATE_LIMIT)
+			{
+				continue;
+			}
+
+			for (const auto other : matrix.GetDetectingPatterns(candidate))
+			{
+				if (other == pattern || !patternActive[other] || patternCount[other] < patternCount[pattern])
+				{
+					continue;
+				}
+
+				if (IsActiveSubset(matrix.GetDetectedFaults(pattern), matrix.GetDetectedFaults(other), faultActive))
+				{
+					remove_pattern(pattern);
+					result.dominatedPatterns++;
+					changed = true;
+					break;
+				}
+			}
+		}
+		return changed;
+	};
+
+	while (true)
+	{
+		select_essential_patterns();
+		const bool faultsChanged { remove_dominated_faults() };
+		const bool patternsChanged { remove_dominated_patterns() };
+		if (!faultsChanged && !patternsChanged)
+		{
+			break;
+		}
+	}
+
+	std::sort(result.essentialPatterns.begin(), result.essentialPatterns.end());
+	for (size_t pattern { 0u }; pattern < numberOfPatterns; ++pattern)
+	{
+		if (patternActive[pattern])
+		{
+			result.corePatterns.push_back(pattern);
+		}
+	}
+	for (size_t fault { 0u }; fault < numberOfFaults; ++fault)
+	{
+		if (faultActive[fault])
+		{
+			result.coreFaults.push_back(fault);
+		}
+	}
+
+	return result;
+}
+
+std::vector<size_t> OrderByMarginalCoverage(const FaultCoverageMatrix& matrix, const std::vector<double>& faultWeights)
+{
+	ASSERT(faultWeights.empty() || faultWeights.size() == matrix.GetNumberOfFaults()) << "The number of fault weights does not match the coverage matrix";
+
+	std::vector<bool> detected(matrix.GetNumberOfFaults(), false);
+	const auto get_gain = [&](size_t pattern) {
+		double gain { 0.0 };
+		for (const auto fault : matrix.GetDetectedFaults(pattern))
+		{
+			if (!detected[fault])
+			{
+				gain += faultWeights.empty() ? 1.0 : faultWeights[fault];
+			}
+		}
+		return gain;
+	};
+
+	// The candidate with the highest gain and the lowest index is at the top of the queue
+	using Candidate = std::pair<double, size_t>;
+	const auto compare = [](const Candidate& lhs, const Candidate& rhs) {
+		return (lhs.first != rhs.first) ? (lhs.first < rhs.first) : (lhs.second > rhs.second);
+	};
+	std::priority_queue<Candidate, std::vector<Candidate>, decltype(compare)> candidates { compare };
+	for (size_t pattern { 0u }; pattern < matrix.GetNumberOfPatterns(); ++pattern)
+	{
+		candidates.emplace(get_gain(pattern), pattern);
+	}
+
+	std::vector<size_t> order;
+	order.reserve(matrix.GetNumberOfPatterns());
+	while (!candidates.empty())
+	{
+		const auto [gain, pattern] = candidates.top();
+		candidates.pop();
+
+		// The stored gain is an upper bound. If the updated gain is lower than
+		// the gain of the next candidate the pattern is queued again.
+		const double currentGain { get_gain(pattern) };
+		if (currentGain != gain && !candidates.empty() && compare({ currentGain, pattern }, candidates.top()))
+		{
+			candidates.emplace(currentGain, pattern);
+			continue;
+		}
+
+		order.push_back(pattern);
+		for (const auto fault : matrix.GetDetectedFaults(pattern))
+		{
+			detected[fault] = true;
+		}
+	}
+
+	return order;
+}
+
+};
+};
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FreiTest
+{
+namespace Fault
+{
+
+/**
+ * @brief Sparse matrix that stores which test patterns detect which faults.
+ *
+ * The detections are stored twice in compressed sparse form: For each pattern
+ * the detected faults (rows) and for each fault the detecting patterns (columns).
+ * Both index lists are sorted in ascending order. Contrary to a dense
+ * pattern × fault matrix the memory grows only with the number of detections.
+ */
+class FaultCoverageMatrix
+{
+public:
+	using index_type = uint32_t;
+
+	struct IndexRange
+	{
+		const index_type* first;
+		const index_type* last;
+
+		const index_type* begin(void) const { return first; }
+		const index_type* end(void) const { return last; }
+		size_t size(void) const { return last - first; }
+		bool empty(void) const { return first == last; }
+	};
+
+	FaultCoverageMatrix(void);
+	/**
+	 * @brief Creates the matrix from the faults detected by each pattern.
+	 *
+	 * The fault indices of each pattern have to be sorted in ascending order.
+	 * The per-pattern lists are released during the construction.
+	 */
+	FaultCoverageMatrix(size_t numberOfFaults, std::vector<std::vector<index_type>>&& patternDetections);
+	virtual ~FaultCoverageMatrix(void);
+
+	size_t GetNumberOfPatterns(void) const;
+	size_t GetNumberOfFaults(void) const;
+	size_t GetNumberOfDetections(void) const;
+
+	IndexRange GetDetectedFaults(size_t pattern) const;
+	IndexRange GetDetectingPatterns(size_t fault) const;
+	bool IsDetected(size_t pattern, size_t fault) const;
+
+private:
+	std::vector<size_t> _patternOffsets;
+	std::vector<index_type> _patternFaults;
+	std::vector<size_t> _faultOffsets;
+	std::vector<index_type> _faultPatterns;
+
+};
+
+/**
+ * @brief The result of the set cover reductions of a fault coverage matrix.
+ *
+ * - essentialPatterns: Patterns that are required in every solution of the reduced problem.
+ * - corePatterns: Patterns that remain as candidates for the remaining faults.
+ * - coreFaults: Faults that are neither covered by an essential pattern nor implied by another fault.
+ *
+ * A minimum set of patterns covering all detected faults is given by the essential
+ * patterns together with a minimum subset of the core patterns that covers the core faults.
+ */
+struct SetCoverReduction
+{
+	std::vector<size_t> essentialPatterns;
+	std::vector<size_t> corePatterns;
+	std::vector<size_t> coreFaults;
+
+	size_t dominatedPatterns;
+	size_t dominatedFaults;
+};
+
+/**
+ * @brief Reduces the problem to find a minimum set of patterns that detects all (detected) faults.
+ *
+ * The following reductions are applied until no further reduction is possible:
+ * 1. A fault that is detected by a single pattern makes the pattern essential.
+ *    The pattern and all faults that it detects are removed.
+ * 2. Fault (row) dominance: A fault whose patterns are a superset of the patterns
+ *    of another fault is removed, as it is detected whenever the other fault is detected.
+ * 3. Pattern (column) dominance: A pattern whose faults are a subset of the faults
+ *    of another pattern is removed, as the other pattern can always replace it.
+ *
+ * Faults without a detecting pattern are ignored. The dominance checks are limited
+ * to a bounded number of candidates per fault / pattern to keep the runtime
+ * proportional to the number of detections.
+ */
+SetCoverReduction ReduceSetCover(const FaultCoverageMatrix& matrix);
+
+/**
+ * @brief Orders the patterns greedily by the (weighted) number of faults that they detect additionally.
+ *
+ * In each step the pattern that detects the largest weight of not yet detected faults
+ * is selected. Ties are resolved by the lower pattern index. Patterns without new
+ * detections are appended in ascending order. The gains are updated lazily, as the
+ * gain of a pattern can only decrease during the ordering.
+ *
+ * @param faultWeights The weight of each fault. If empty, all faults have the weight 1.
+ * @return The pattern indices in the order of selection.
+ */
+std::vector<size_t> OrderByMarginalCoverage(const FaultCoverageMatrix& matrix, const std::vector<double>& faultWeights);
+
+};
+};
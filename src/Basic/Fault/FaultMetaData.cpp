@@ -8,20 +8,93 @@ namespace Fault
 {
 
 BaseFaultMetaData::BaseFaultMetaData(void):
-	faultStatus(FaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	detectionCount(0u),
+	statusWord(PackStatus(FaultStatus::FAULT_STATUS_UNCLASSIFIED, TargetedFaultStatus::FAULT_STATUS_UNCLASSIFIED))
+{
+}
+
+BaseFaultMetaData::BaseFaultMetaData(const BaseFaultMetaData& other):
+	detectionCount(other.detectionCount.load(std::memory_order_acquire)),
+	statusWord(other.statusWord.load(std::memory_order_acquire))
 {
 }
 
 BaseFaultMetaData::~BaseFaultMetaData(void) = default;
 
+BaseFaultMetaData& BaseFaultMetaData::operator=(const BaseFaultMetaData& other)
+{
+	statusWord.store(other.statusWord.load(std::memory_order_acquire), std::memory_order_release);
+	detectionCount.store(other.detectionCount.load(std::memory_order_acquire), std::memory_order_release);
+	return *this;
+}
+
+void BaseFaultMetaData::SetFaultStatus(FaultStatus status)
+{
+	uint32_t word { statusWord.load(std::memory_order_acquire) };
+	while (!statusWord.compare_exchange_weak(word, (word & ~STATUS_MASK) | static_cast<uint32_t>(status), std::memory_order_acq_rel, std::memory_order_acquire))
+	{
+	}
+}
+
+bool BaseFaultMetaData::IncrementDetectionCount(size_t limit)
+{
+	size_t count { detectionCount.load(std::memory_order_acquire) };
+	while (count < limit)
+	{
+		if (detectionCount.compare_exchange_weak(count, count + 1u, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 TargetedFaultMetaData::TargetedFaultMetaData(void):
-	BaseFaultMetaData(),
-	targetedFaultStatus(TargetedFaultStatus::FAULT_STATUS_UNCLASSIFIED)
+	BaseFaultMetaData()
+{
+}
+
+TargetedFaultMetaData::TargetedFaultMetaData(const TargetedFaultMetaData& other):
+	BaseFaultMetaData(other)
 {
 }
 
 TargetedFaultMetaData::~TargetedFaultMetaData(void) = default;
 
+TargetedFaultMetaData& TargetedFaultMetaData::operator=(const TargetedFaultMetaData& other)
+{
+	BaseFaultMetaData::operator=(other);
+	return *this;
+}
+
+void TargetedFaultMetaData::SetTargetedFaultStatus(TargetedFaultStatus targetedStatus)
+{
+	uint32_t word { statusWord.load(std::memory_order_acquire) };
+	while (!statusWord.compare_exchange_weak(word, (word & STATUS_MASK) | (static_cast<uint32_t>(targetedStatus) << TARGETED_STATUS_SHIFT),
+		std::memory_order_acq_rel, std::memory_order_acquire))
+	{
+	}
+}
+
+FaultStatusPair TargetedFaultMetaData::ExchangeStatus(FaultStatus status, TargetedFaultStatus targetedStatus)
+{
+	return UnpackStatus(statusWord.exchange(PackStatus(status, targetedStatus), std::memory_order_acq_rel));
+}
+
+std::optional<FaultStatusPair> TargetedFaultMetaData::CompareExchangeStatus(FaultStatus expectedStatus, FaultStatus status, TargetedFaultStatus targetedStatus)
+{
+	const uint32_t newWord { PackStatus(status, targetedStatus) };
+	uint32_t word { statusWord.load(std::memory_order_acquire) };
+	while ((word & STATUS_MASK) == static_cast<uint32_t>(expectedStatus))
+	{
+		if (statusWord.compare_exchange_weak(word, newWord, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			return UnpackStatus(word);
+		}
+	}
+	return std::nullopt;
+}
+
 std::string to_string(const FaultStatus& status)
 {
 	switch (status)
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
 
 namespace FreiTest
@@ -38,24 +42,112 @@ enum class TargetedFaultStatus
 	FAULT_STATUS_EQUIVALENT
 };
 
+/**
+ * @brief The fault status together with the targeted fault status of a fault.
+ */
+struct FaultStatusPair
+{
+	FaultStatus status;
+	TargetedFaultStatus targetedStatus;
+};
+
 class BaseFaultMetaData
 {
 public:
 	BaseFaultMetaData(void);
+	BaseFaultMetaData(const BaseFaultMetaData& other);
 	virtual ~BaseFaultMetaData(void);
 
-	FaultStatus faultStatus;
+	BaseFaultMetaData& operator=(const BaseFaultMetaData& other);
+
+	FaultStatus GetFaultStatus(void) const;
+	void SetFaultStatus(FaultStatus status);
+
+	/**
+	 * @brief Increments the detection count if it is below the given limit.
+	 *
+	 * The count saturates at the limit which allows the fault simulation to drop
+	 * the fault once it has been detected by the requested number of patterns.
+	 *
+	 * @return true if the count has been incremented, false if it was saturated
+	 */
+	bool IncrementDetectionCount(size_t limit);
+
+	// The number of test patterns that detect the fault (n-detect)
+	std::atomic<size_t> detectionCount;
+
+protected:
+	static constexpr uint32_t STATUS_MASK { 0xFFu };
+	static constexpr uint32_t TARGETED_STATUS_SHIFT { 8u };
+
+	static uint32_t PackStatus(FaultStatus status, TargetedFaultStatus targetedStatus);
+	static FaultStatusPair UnpackStatus(uint32_t word);
+
+	// The fault status and the targeted fault status are stored in one word.
+	// This allows lock-free (compare-and-swap) transitions of both
+	// from the parallel fault simulation and test pattern generation.
+	std::atomic<uint32_t> statusWord;
 };
 
 class TargetedFaultMetaData: public BaseFaultMetaData
 {
 public:
 	TargetedFaultMetaData(void);
+	TargetedFaultMetaData(const TargetedFaultMetaData& other);
 	virtual ~TargetedFaultMetaData(void);
 
-	TargetedFaultStatus targetedFaultStatus;
+	TargetedFaultMetaData& operator=(const TargetedFaultMetaData& other);
+
+	TargetedFaultStatus GetTargetedFaultStatus(void) const;
+	void SetTargetedFaultStatus(TargetedFaultStatus targetedStatus);
+
+	/**
+	 * @brief Returns both status values from the same point in time.
+	 */
+	FaultStatusPair GetStatus(void) const;
+	/**
+	 * @brief Replaces both status values at once.
+	 *
+	 * @return The status values before the replacement
+	 */
+	FaultStatusPair ExchangeStatus(FaultStatus status, TargetedFaultStatus targetedStatus);
+	/**
+	 * @brief Replaces both status values at once if the fault status equals the expected status.
+	 *
+	 * The targeted status is replaced in the same compare-and-swap as the fault status.
+	 * Therefore, a transition that keeps the fault status can not overwrite
+	 * the targeted status of a concurrent transition to another fault status.
+	 *
+	 * @return The status values before the replacement if it has been applied
+	 */
+	std::optional<FaultStatusPair> CompareExchangeStatus(FaultStatus expectedStatus, FaultStatus status, TargetedFaultStatus targetedStatus);
 };
 
+inline uint32_t BaseFaultMetaData::PackStatus(FaultStatus status, TargetedFaultStatus targetedStatus)
+{
+	return static_cast<uint32_t>(status) | (static_cast<uint32_t>(targetedStatus) << TARGETED_STATUS_SHIFT);
+}
+
+inline FaultStatusPair BaseFaultMetaData::UnpackStatus(uint32_t word)
+{
+	return { static_cast<FaultStatus>(word & STATUS_MASK), static_cast<TargetedFaultStatus>(word >> TARGETED_STATUS_SHIFT) };
+}
+
+inline FaultStatus BaseFaultMetaData::GetFaultStatus(void) const
+{
+	return static_cast<FaultStatus>(statusWord.load(std::memory_order_acquire) & STATUS_MASK);
+}
+
+inline TargetedFaultStatus TargetedFaultMetaData::GetTargetedFaultStatus(void) const
+{
+	return static_cast<TargetedFaultStatus>(statusWord.load(std::memory_order_acquire) >> TARGETED_STATUS_SHIFT);
+}
+
+inline FaultStatusPair TargetedFaultMetaData::GetStatus(void) const
+{
+	return UnpackStatus(statusWord.load(std::memory_order_acquire));
+}
+
 std::string to_string(const FaultStatus& status);
 std::string to_string(const TargetedFaultStatus& status);
 
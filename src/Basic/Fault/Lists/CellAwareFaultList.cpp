@@ -1,8 +1,11 @@
 #include "Basic/Fault/Lists/CellAwareFaultList.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <numeric>
 #include <regex>
 
+#include "Basic/Parallel.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 
 using namespace FreiTest::Basic;
@@ -22,8 +25,32 @@ CellAwareMetaData::CellAwareMetaData(void):
 {
 }
 
+CellAwareMetaData::CellAwareMetaData(const CellAwareMetaData& other):
+	TargetedFaultMetaData(other)
+{
+	// The pattern id is loaded first as it publishes the remaining detection data
+	const size_t patternId { other.detectingPatternId.load(std::memory_order_acquire) };
+	detectingNode = other.detectingNode;
+	detectingOutputGood = other.detectingOutputGood;
+	detectingOutputBad = other.detectingOutputBad;
+	detectingTimeframe.store(other.detectingTimeframe.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	detectingPatternId.store(patternId, std::memory_order_release);
+}
+
 CellAwareMetaData::~CellAwareMetaData(void) = default;
 
+CellAwareMetaData& CellAwareMetaData::operator=(const CellAwareMetaData& other)
+{
+	TargetedFaultMetaData::operator=(other);
+	const size_t patternId { other.detectingPatternId.load(std::memory_order_acquire) };
+	detectingNode = other.detectingNode;
+	detectingOutputGood = other.detectingOutputGood;
+	detectingOutputBad = other.detectingOutputBad;
+	detectingTimeframe.store(other.detectingTimeframe.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	detectingPatternId.store(patternId, std::memory_order_release);
+	return *this;
+}
+
 CellAwareFaultListDebug::CellAwareFaultListDebug(const CellAwareFaultList &faultList, const Circuit::MappedCircuit& circuit):
 	faultList(faultList),
 	circuit(circuit)
@@ -175,37 +202,58 @@ std::vector<CellAwareFault> GenerateCellAwareFaultList(const Circuit::CircuitEnv
 	const auto& circuitMetaData { circuit.GetMetaData() };
 	const auto& udfmCells { udfm.GetCells() };
 
-	// Find cell instances and map ports
-	std::vector<CellAwareFault> faults;
-	for (auto const& group: circuitMetaData.GetGroups())
-	{
-		auto sourceInfo = group->GetSourceInfo();
-		if (!sourceInfo.GetProperty<bool>("module-is-cell").value_or(false))
+	// Find cell instances and map ports in parallel for ranges of groups.
+	// The faults of each range are concatenated in group order afterwards.
+	constexpr size_t GROUP_BLOCK_SIZE { 1024u };
+	const auto& groups { circuitMetaData.GetGroups() };
+	std::vector<std::vector<CellAwareFault>> blockFaults((groups.size() + GROUP_BLOCK_SIZE - 1u) / GROUP_BLOCK_SIZE);
+	Parallel::ExecuteParallelInBlocks(0u, groups.size(), GROUP_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+		auto& faults { blockFaults[begin / GROUP_BLOCK_SIZE] };
+		for (size_t groupIndex { begin }; groupIndex < end; ++groupIndex)
 		{
-			continue;
-		}
+			auto const& group { groups[groupIndex] };
 
-		auto name = sourceInfo.GetProperty<std::string>("module-name").value_or("");
-		auto type = sourceInfo.GetProperty<std::string>("module-type").value_or("");
+			auto sourceInfo = group->GetSourceInfo();
+			if (!sourceInfo.GetProperty<bool>("module-is-cell").value_or(false))
+			{
+				continue;
+			}
 
-		auto it = udfmCells.find(type);
-		if (it == udfmCells.end())
-		{
-			continue;
-		}
+			auto name = sourceInfo.GetProperty<std::string>("module-name").value_or("");
+			auto type = sourceInfo.GetProperty<std::string>("module-type").value_or("");
 
-		// Generate the expanded test pattern
-		auto& udfmEntry = it->second;
-		for (auto& [faultName, udfmFault] : udfmEntry->GetFaults())
-		{
-			auto fault { MapUdfmFaultToCell(circuit, group, udfmFault) };
-			if (!fault.has_value())
+			auto it = udfmCells.find(type);
+			if (it == udfmCells.end())
 			{
 				continue;
 			}
 
-			faults.push_back(fault.value());
+			// Generate the expanded test pattern
+			auto& udfmEntry = it->second;
+			for (auto& [faultName, udfmFault] : udfmEntry->GetFaults())
+			{
+				auto fault { MapUdfmFaultToCell(circuit, group, udfmFault) };
+				if (!fault.has_value())
+				{
+					continue;
+				}
+
+				faults.push_back(fault.value());
+			}
 		}
+	});
+
+	size_t numberOfFaults { 0u };
+	for (auto const& groupFaults : blockFaults)
+	{
+		numberOfFaults += groupFaults.size();
+	}
+
+	std::vector<CellAwareFault> faults;
+	faults.reserve(numberOfFaults);
+	for (auto& groupFaults : blockFaults)
+	{
+		std::move(groupFaults.begin(), groupFaults.end(), std::back_inserter(faults));
 	}
 
 	return faults;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <optional>
 #include <iostream>
@@ -21,11 +22,17 @@ struct CellAwareMetaData:
 {
 public:
 	CellAwareMetaData(void);
+	CellAwareMetaData(const CellAwareMetaData& other);
 	virtual ~CellAwareMetaData(void);
 
-	size_t detectingPatternId;
+	CellAwareMetaData& operator=(const CellAwareMetaData& other);
+
+	// The detection data is read by the checkpoint thread while the fault simulation runs.
+	// The remaining detection data is written before the pattern id, which is stored with release semantics.
+	// Readers load the pattern id with acquire semantics before they access the remaining data.
+	std::atomic<size_t> detectingPatternId;
 	Circuit::MappedCircuit::NodeAndPort detectingNode;
-	size_t detectingTimeframe;
+	std::atomic<size_t> detectingTimeframe;
 	Basic::Logic detectingOutputGood;
 	Basic::Logic detectingOutputBad;
 };
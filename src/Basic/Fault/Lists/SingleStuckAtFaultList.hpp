@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <type_traits>
 
 #include "Basic/Fault/ConcurrentFaultList.hpp"
@@ -23,11 +24,17 @@ class SingleStuckAtFaultMetaData: public TargetedFaultMetaData
 {
 public:
 	SingleStuckAtFaultMetaData(void);
+	SingleStuckAtFaultMetaData(const SingleStuckAtFaultMetaData& other);
 	virtual ~SingleStuckAtFaultMetaData(void);
 
-	size_t detectingPatternId;
+	SingleStuckAtFaultMetaData& operator=(const SingleStuckAtFaultMetaData& other);
+
+	// The detection data is read by the checkpoint thread while the fault simulation runs.
+	// The remaining detection data is written before the pattern id, which is stored with release semantics.
+	// Readers load the pattern id with acquire semantics before they access the remaining data.
+	std::atomic<size_t> detectingPatternId;
 	Circuit::MappedCircuit::NodeAndPort detectingNode;
-	size_t detectingTimeframe;
+	std::atomic<size_t> detectingTimeframe;
 	Basic::Logic detectingOutputGood;
 	Basic::Logic detectingOutputBad;
 };
@@ -47,6 +54,7 @@ using SingleStuckAtFaultList = ConcurrentFaultList<SingleStuckAtFault, SingleStu
  * - RemoveSequentialSetReset: Removes faults at the set and reset lines of sequential elements.
  * - RemoveConnectedToDontCare: Removes faults that are at input ports connected to a constant don't care logic signal.
  * - RemoveConnectedToUnknown: Removes faults that are at input ports connected to a constant unknown logic signal.
+ * - RemoveDominating: Merges the output fault of AND / NAND / OR / NOR gates into a dominated fault at one of the gate inputs.
  */
 enum class StuckAtFaultReduction: size_t
 {
@@ -56,7 +64,8 @@ enum class StuckAtFaultReduction: size_t
 	RemoveSequentialClock = 4u,
 	RemoveSequentialSetReset = 8u,
 	RemoveConnectedToDontCare = 16u,
-	RemoveConnectedToUnknown = 32u
+	RemoveConnectedToUnknown = 32u,
+	RemoveDominating = 64u
 };
 
 StuckAtFaultReduction operator|(StuckAtFaultReduction lhs, StuckAtFaultReduction rhs);
@@ -6,6 +6,7 @@
 #include <numeric>
 #include <regex>
 
+#include "Basic/Parallel.hpp"
 #include "Circuit/MappedCircuit.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 
@@ -17,6 +18,10 @@ namespace FreiTest
 namespace Fault
 {
 
+// Number of nodes / faults that are processed by one parallel task
+constexpr size_t FAULT_LIST_NODE_BLOCK_SIZE { 4096u };
+constexpr size_t FAULT_LIST_FAULT_BLOCK_SIZE { 16384u };
+
 SingleTransitionDelayFaultMetaData::SingleTransitionDelayFaultMetaData(void):
 	TargetedFaultMetaData(),
 	detectingPatternId(std::numeric_limits<size_t>::max()),
@@ -27,8 +32,32 @@ SingleTransitionDelayFaultMetaData::SingleTransitionDelayFaultMetaData(void):
 {
 }
 
+SingleTransitionDelayFaultMetaData::SingleTransitionDelayFaultMetaData(const SingleTransitionDelayFaultMetaData& other):
+	TargetedFaultMetaData(other)
+{
+	// The pattern id is loaded first as it publishes the remaining detection data
+	const size_t patternId { other.detectingPatternId.load(std::memory_order_acquire) };
+	detectingNode = other.detectingNode;
+	detectingOutputGood = other.detectingOutputGood;
+	detectingOutputBad = other.detectingOutputBad;
+	detectingTimeframe.store(other.detectingTimeframe.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	detectingPatternId.store(patternId, std::memory_order_release);
+}
+
 SingleTransitionDelayFaultMetaData::~SingleTransitionDelayFaultMetaData(void) = default;
 
+SingleTransitionDelayFaultMetaData& SingleTransitionDelayFaultMetaData::operator=(const SingleTransitionDelayFaultMetaData& other)
+{
+	TargetedFaultMetaData::operator=(other);
+	const size_t patternId { other.detectingPatternId.load(std::memory_order_acquire) };
+	detectingNode = other.detectingNode;
+	detectingOutputGood = other.detectingOutputGood;
+	detectingOutputBad = other.detectingOutputBad;
+	detectingTimeframe.store(other.detectingTimeframe.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	detectingPatternId.store(patternId, std::memory_order_release);
+	return *this;
+}
+
 std::vector<SingleTransitionDelayFault> GenerateTransitionDelayFaultList(const CircuitEnvironment& circuit)
 {
 	const auto& mappedCircuit { circuit.GetMappedCircuit() };
@@ -75,35 +104,55 @@ std::vector<SingleTransitionDelayFault> GenerateTransitionDelayFaultList(const C
 		}
 	}
 
-	// Now create the fault list
-	std::vector<SingleTransitionDelayFault> faultList;
-	for(auto [nodeId, node] : mappedCircuit.EnumerateNodes())
-	{
-		if(!forwardConnection[nodeId] || !backwardConnection[nodeId])
+	// Now create the fault list in parallel for ranges of nodes.
+	// The faults of each range are concatenated in node order afterwards.
+	const size_t numberOfNodes { mappedCircuit.GetNumberOfNodes() };
+	std::vector<std::vector<SingleTransitionDelayFault>> blockFaultLists((numberOfNodes + FAULT_LIST_NODE_BLOCK_SIZE - 1u) / FAULT_LIST_NODE_BLOCK_SIZE);
+	Parallel::ExecuteParallelInBlocks(0u, numberOfNodes, FAULT_LIST_NODE_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+		auto& faultList { blockFaultLists[begin / FAULT_LIST_NODE_BLOCK_SIZE] };
+		for (size_t nodeId { begin }; nodeId < end; ++nodeId)
 		{
-			continue;
-		}
+			if(!forwardConnection[nodeId] || !backwardConnection[nodeId])
+			{
+				continue;
+			}
 
-		if (node->GetCellCategory() != MAIN_IN && node->GetCellCategory() != MAIN_CONSTANT)
-		{
-			for(auto [inputId, input] : node->EnumerateInputs())
+			const MappedNode* node { mappedCircuit.GetNode(nodeId) };
+
+			if (node->GetCellCategory() != MAIN_IN && node->GetCellCategory() != MAIN_CONSTANT)
 			{
-				// Don't include inputs that are unconnected
-				if (input == nullptr || !forwardConnection[input->GetNodeId()])
+				for(auto [inputId, input] : node->EnumerateInputs())
 				{
-					continue;
+					// Don't include inputs that are unconnected
+					if (input == nullptr || !forwardConnection[input->GetNodeId()])
+					{
+						continue;
+					}
+
+					faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Input, inputId } }, TransitionDelayFaultType::SLOW_TO_RISE);
+					faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Input, inputId } }, TransitionDelayFaultType::SLOW_TO_FALL);
 				}
+			}
 
-				faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Input, inputId } }, TransitionDelayFaultType::SLOW_TO_RISE);
-				faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Input, inputId } }, TransitionDelayFaultType::SLOW_TO_FALL);
+			if (node->GetCellCategory() != MAIN_OUT && node->GetCellCategory() != MAIN_CONSTANT)
+			{
+				faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Output, 0u } }, TransitionDelayFaultType::SLOW_TO_RISE);
+				faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Output, 0u } }, TransitionDelayFaultType::SLOW_TO_FALL);
 			}
 		}
+	});
 
-		if (node->GetCellCategory() != MAIN_OUT && node->GetCellCategory() != MAIN_CONSTANT)
-		{
-			faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Output, 0u } }, TransitionDelayFaultType::SLOW_TO_RISE);
-			faultList.emplace_back(MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { PortType::Output, 0u } }, TransitionDelayFaultType::SLOW_TO_FALL);
-		}
+	size_t numberOfFaults { 0u };
+	for (auto const& blockFaultList : blockFaultLists)
+	{
+		numberOfFaults += blockFaultList.size();
+	}
+
+	std::vector<SingleTransitionDelayFault> faultList;
+	faultList.reserve(numberOfFaults);
+	for (auto const& blockFaultList : blockFaultLists)
+	{
+		faultList.insert(faultList.end(), blockFaultList.begin(), blockFaultList.end());
 	}
 
 	return faultList;
@@ -187,22 +236,16 @@ std::pair<std::vector<SingleTransitionDelayFault>, std::vector<size_t>> ReduceTr
 	const MappedCircuit& mappedCircuit = circuitEnvironment.GetMappedCircuit();
 	const CircuitMetaData& metaData = circuitEnvironment.GetMetaData();
 
-	std::vector<bool> faultMergedOrRemoved(faultList.size(), false);
+	// A fault is kept as long as it maps to itself.
+	// Merged faults map to the equivalent fault and removed faults to REMOVED_FAULT.
 	std::vector<size_t> newFaultIndices(faultList.size());
 	std::iota(newFaultIndices.begin(), newFaultIndices.end(), 0u);
 
 	if ((reduction & TransitionDelayFaultReduction::RemoveEquivalent) == TransitionDelayFaultReduction::RemoveEquivalent)
 	{
-		// Sort the index list by node-id to arrange consecutive faults after each other
-		newFaultIndices = GetSortIndicesForTransitionDelayFaultList(faultList);
-
-		// Build a reverse mapping to be able to traverse the fault list in sorted order.
-		// This mapping is not updated to enable the lookup if a fault has been remapped or not.
-		std::vector<size_t> reverseFaultIndices(newFaultIndices.size());
-		for (size_t index = 0u; index < newFaultIndices.size(); ++index)
-		{
-			reverseFaultIndices[newFaultIndices[index]] = index;
-		}
+		// Sort the index list by node-id to arrange consecutive faults after each other.
+		// This is used to traverse the fault list in sorted order.
+		const std::vector<size_t> reverseFaultIndices { GetSortIndicesForTransitionDelayFaultList(faultList) };
 
 		// Start index and end index + 1u for the faults for each node in the reverseFaultIndices array.
 		// This is used as an optimization to search for faults that share a specific node.
@@ -225,247 +268,279 @@ std::pair<std::vector<SingleTransitionDelayFault>, std::vector<size_t>> ReduceTr
 			startIndex = nextIndex;
 		}
 
-		// Now filter the faults by removing duplicate entries.
+		// Now find the equivalent fault of each fault in parallel.
 		// Use the sorted indices as a look-up table to get clusters of faults for the same node.
-		for (size_t revIndex = 0u; revIndex < reverseFaultIndices.size(); ++revIndex)
-		{
-			const size_t faultIndex = reverseFaultIndices[revIndex];
-			const auto& fault { faultList[faultIndex] };
-
-			// Case 1: Fan-outs: Fault f1 at output and f2 at input of single successor are equivalent.
-			// Condition: The parent node only has one successor.
-			// Since we are iterating the faults in node order from inputs to outputs
-			// we will always merge the faults at the input pins (node with larger id).
-			// => Keep only fault f1 and declare f2 as equivalent.
-			if (fault.GetPort().portType == PortType::Input)
+		std::vector<size_t> equivalentFaults(faultList.size());
+		std::iota(equivalentFaults.begin(), equivalentFaults.end(), 0u);
+		Parallel::ExecuteParallelInBlocks(0u, reverseFaultIndices.size(), FAULT_LIST_FAULT_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t revIndex { begin }; revIndex < end; ++revIndex)
 			{
-				const MappedNode* parentNode = fault.GetNode()->GetInput(fault.GetPort().portNumber);
-				const size_t parentNodeId = parentNode->GetNodeId();
-				if (parentNode->GetNumberOfSuccessors() == 1)
+				const size_t faultIndex = reverseFaultIndices[revIndex];
+				const auto& fault { faultList[faultIndex] };
+
+				// Case 1: Fan-outs: Fault f1 at output and f2 at input of single successor are equivalent.
+				// Condition: The parent node only has one successor.
+				// Since we are iterating the faults in node order from inputs to outputs
+				// we will always merge the faults at the input pins (node with larger id).
+				// => Keep only fault f1 and declare f2 as equivalent.
+				if (fault.GetPort().portType == PortType::Input)
 				{
-					// Check all faults at the parent node for a match
-					const auto [parentRevFaultsStart, parentRevFaultsEnd] = nodeFaults[parentNodeId];
-					for (size_t parentRevFaultIndex = parentRevFaultsStart; parentRevFaultIndex <= parentRevFaultsEnd; ++parentRevFaultIndex)
+					const MappedNode* parentNode = fault.GetNode()->GetInput(fault.GetPort().portNumber);
+					const size_t parentNodeId = parentNode->GetNodeId();
+					if (parentNode->GetNumberOfSuccessors() == 1)
 					{
-						const size_t parentFaultIndex = reverseFaultIndices[parentRevFaultIndex];
-						const SingleTransitionDelayFault& parentFault = faultList[parentFaultIndex];
-						if (parentFault.GetType() == fault.GetType()
-							&& parentFault.GetPort().portType == PortType::Output)
+						// Check all faults at the parent node for a match
+						const auto [parentRevFaultsStart, parentRevFaultsEnd] = nodeFaults[parentNodeId];
+						for (size_t parentRevFaultIndex = parentRevFaultsStart; parentRevFaultIndex <= parentRevFaultsEnd; ++parentRevFaultIndex)
 						{
-							faultMergedOrRemoved[faultIndex] = true;
-							newFaultIndices[faultIndex] = newFaultIndices[parentFaultIndex];
-							// Do not update the reverse mapping as it is still used.
-							goto nextFault;
+							const size_t parentFaultIndex = reverseFaultIndices[parentRevFaultIndex];
+							const SingleTransitionDelayFault& parentFault = faultList[parentFaultIndex];
+							if (parentFault.GetType() == fault.GetType()
+								&& parentFault.GetPort().portType == PortType::Output)
+							{
+								equivalentFaults[faultIndex] = parentFaultIndex;
+								goto nextFault;
+							}
 						}
 					}
 				}
-			}
 
-			// Case 2: Controlling values at the inputs of an AND / NAND / OR / NOR / BUF / INV gate
-			//         and the resulting output values are equivalent (keep only the input fault).
-			if (fault.GetPort().portType == PortType::Output)
-			{
-				if ((fault.GetNode()->GetCellCategory() == CellCategory::MAIN_AND && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_RISE)
-					|| (fault.GetNode()->GetCellCategory() == CellCategory::MAIN_NAND && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_FALL)
-					|| (fault.GetNode()->GetCellCategory() == CellCategory::MAIN_OR && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_FALL)
-					|| (fault.GetNode()->GetCellCategory() == CellCategory::MAIN_NOR && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_RISE)
-					|| fault.GetNode()->GetCellCategory() == CellCategory::MAIN_BUF || fault.GetNode()->GetCellCategory() == CellCategory::MAIN_INV)
+				// Case 2: Controlling values at the inputs of an AND / NAND / OR / NOR / BUF / INV gate
+				//         and the resulting output values are equivalent (keep only the input fault).
+				if (fault.GetPort().portType == PortType::Output)
 				{
-					// Check all faults that are earlier in the fault list of the current node for a match
-					const auto [nodeRevFaultsStart, nodeRevFaultsEnd] = nodeFaults[fault.GetNode()->GetNodeId()];
-					for (size_t nodeRevFaultIndex = nodeRevFaultsStart; nodeRevFaultIndex < revIndex; ++nodeRevFaultIndex)
+					if ((fault.GetNode()->GetCellCategory() == CellCategory::MAIN_AND && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_RISE)
+						|| (fault.GetNode()->GetCellCategory() == CellCategory::MAIN_NAND && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_FALL)
+						|| (fault.GetNode()->GetCellCategory() == CellCategory::MAIN_OR && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_FALL)
+						|| (fault.GetNode()->GetCellCategory() == CellCategory::MAIN_NOR && fault.GetTransitionDelay() == TransitionDelayFaultType::SLOW_TO_RISE)
+						|| fault.GetNode()->GetCellCategory() == CellCategory::MAIN_BUF || fault.GetNode()->GetCellCategory() == CellCategory::MAIN_INV)
 					{
-						const size_t nodeFaultIndex = reverseFaultIndices[nodeRevFaultIndex];
-						const SingleTransitionDelayFault& nodeFault = faultList[nodeFaultIndex];
-						if (nodeFault.GetTransitionDelay() == invert_fault_type(fault.GetTransitionDelay(), is_inverting_gate(fault.GetNode()->GetCellCategory()))
-							&& nodeFault.GetPort().portType == PortType::Input)
+						// Check all faults that are earlier in the fault list of the current node for a match
+						const auto [nodeRevFaultsStart, nodeRevFaultsEnd] = nodeFaults[fault.GetNode()->GetNodeId()];
+						for (size_t nodeRevFaultIndex = nodeRevFaultsStart; nodeRevFaultIndex < revIndex; ++nodeRevFaultIndex)
 						{
-							faultMergedOrRemoved[faultIndex] = true;
-							newFaultIndices[faultIndex] = newFaultIndices[nodeFaultIndex];
-							// Do not update the reverse mapping as it is still used.
-							goto nextFault;
+							const size_t nodeFaultIndex = reverseFaultIndices[nodeRevFaultIndex];
+							const SingleTransitionDelayFault& nodeFault = faultList[nodeFaultIndex];
+							if (nodeFault.GetTransitionDelay() == invert_fault_type(fault.GetTransitionDelay(), is_inverting_gate(fault.GetNode()->GetCellCategory()))
+								&& nodeFault.GetPort().portType == PortType::Input)
+							{
+								equivalentFaults[faultIndex] = nodeFaultIndex;
+								goto nextFault;
+							}
 						}
 					}
 				}
-			}
 
-		nextFault:
+			nextFault:
 
-			; // Continue the loop
-		}
-	}
+				; // Continue the loop
+			}
+		});
 
-	if ((reduction & TransitionDelayFaultReduction::RemoveCellInternal) == TransitionDelayFaultReduction::RemoveCellInternal)
-	{
-		for (size_t index { 0u }; index < newFaultIndices.size(); ++index)
-		{
-			if (faultMergedOrRemoved[index])
+		// Merge the equivalent faults into equivalence classes (union-find) in a single pass.
+		// The representative of each class is the fault with the smallest index.
+		auto find_class = [&newFaultIndices](size_t faultIndex) -> size_t {
+			while (newFaultIndices[faultIndex] != faultIndex)
 			{
-				continue;
+				// Path halving to keep the trees flat
+				newFaultIndices[faultIndex] = newFaultIndices[newFaultIndices[faultIndex]];
+				faultIndex = newFaultIndices[faultIndex];
 			}
-
-			auto const& fault { faultList[newFaultIndices[index]] };
-			auto const* group { metaData.GetGroup(fault.GetNode()) };
-			auto const* cell { group->GetParent() };
-			if (cell == nullptr)
+			return faultIndex;
+		};
+		for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+		{
+			const size_t class1 { find_class(faultIndex) };
+			const size_t class2 { find_class(equivalentFaults[faultIndex]) };
+			if (class1 != class2)
 			{
-				faultMergedOrRemoved[index] = true;
-				newFaultIndices[index] = REMOVED_FAULT;
-				continue;
+				newFaultIndices[std::max(class1, class2)] = std::min(class1, class2);
 			}
+		}
+		for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+		{
+			newFaultIndices[faultIndex] = find_class(faultIndex);
+		}
+	}
 
-			auto const& sourceInfo { cell->GetSourceInfo() };
-			if (!sourceInfo.GetProperty<bool>("module-is-cell").value_or(false))
+	if ((reduction & TransitionDelayFaultReduction::RemoveCellInternal) == TransitionDelayFaultReduction::RemoveCellInternal)
+	{
+		Parallel::ExecuteParallelInBlocks(0u, faultList.size(), FAULT_LIST_FAULT_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t index { begin }; index < end; ++index)
 			{
-				faultMergedOrRemoved[index] = true;
-				newFaultIndices[index] = REMOVED_FAULT;
-				continue;
-			}
+				if (newFaultIndices[index] != index)
+				{
+					continue;
+				}
 
-			const size_t connectionId { fault.GetNode()->GetPortConnectionId(fault.GetPort()) };
+				auto const& fault { faultList[index] };
+				auto const* group { metaData.GetGroup(fault.GetNode()) };
+				auto const* cell { group->GetParent() };
+				if (cell == nullptr)
+				{
+					newFaultIndices[index] = REMOVED_FAULT;
+					continue;
+				}
 
-			bool connectedToPort = false;
-			for (auto port: cell->GetPorts())
-			{
-				ASSERT(port.GetConnections().size() == 1u) << "Found a cell with a port that has more than a single wire in the bus.";
-				if (port.GetConnections()[0u] == nullptr)
+				auto const& sourceInfo { cell->GetSourceInfo() };
+				if (!sourceInfo.GetProperty<bool>("module-is-cell").value_or(false))
 				{
+					newFaultIndices[index] = REMOVED_FAULT;
 					continue;
 				}
 
-				if (port.GetConnections()[0u]->GetConnectionId() == connectionId)
+				const size_t connectionId { fault.GetNode()->GetPortConnectionId(fault.GetPort()) };
+
+				bool connectedToPort = false;
+				for (auto port: cell->GetPorts())
 				{
-					connectedToPort = true;
-					break;
+					ASSERT(port.GetConnections().size() == 1u) << "Found a cell with a port that has more than a single wire in the bus.";
+					if (port.GetConnections()[0u] == nullptr)
+					{
+						continue;
+					}
+
+					if (port.GetConnections()[0u]->GetConnectionId() == connectionId)
+					{
+						connectedToPort = true;
+						break;
+					}
 				}
-			}
 
-			if (!connectedToPort)
-			{
-				faultMergedOrRemoved[index] = true;
-				newFaultIndices[index] = REMOVED_FAULT;
-				continue;
+				if (!connectedToPort)
+				{
+					newFaultIndices[index] = REMOVED_FAULT;
+					continue;
+				}
 			}
-		}
+		});
 	}
 
 	if ((reduction & TransitionDelayFaultReduction::RemoveSequentialClock) == TransitionDelayFaultReduction::RemoveSequentialClock)
 	{
-		for (size_t index { 0u }; index < newFaultIndices.size(); ++index)
-		{
-			if (faultMergedOrRemoved[index])
+		Parallel::ExecuteParallelInBlocks(0u, faultList.size(), FAULT_LIST_FAULT_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t index { begin }; index < end; ++index)
 			{
-				continue;
-			}
+				if (newFaultIndices[index] != index)
+				{
+					continue;
+				}
 
-			auto const& fault { faultList[newFaultIndices[index]] };
-			if (fault.GetPort().portType != PortType::Input
-				|| fault.GetPort().portNumber != 1u)
-			{
-				continue;
-			}
+				auto const& fault { faultList[index] };
+				if (fault.GetPort().portType != PortType::Input
+					|| fault.GetPort().portNumber != 1u)
+				{
+					continue;
+				}
 
-			auto const* mappedNode { fault.GetNode() };
-			if (mappedNode->GetCellType() != CellType::S_OUT_CLK)
-			{
-				continue;
-			}
+				auto const* mappedNode { fault.GetNode() };
+				if (mappedNode->GetCellType() != CellType::S_OUT_CLK)
+				{
+					continue;
+				}
 
-			faultMergedOrRemoved[index] = true;
-			newFaultIndices[index] = REMOVED_FAULT;
-		}
+				newFaultIndices[index] = REMOVED_FAULT;
+			}
+		});
 	}
 
 	if ((reduction & TransitionDelayFaultReduction::RemoveSequentialSetReset) == TransitionDelayFaultReduction::RemoveSequentialSetReset)
 	{
-		for (size_t index { 0u }; index < newFaultIndices.size(); ++index)
-		{
-			if (faultMergedOrRemoved[index])
+		Parallel::ExecuteParallelInBlocks(0u, faultList.size(), FAULT_LIST_FAULT_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t index { begin }; index < end; ++index)
 			{
-				continue;
-			}
+				if (newFaultIndices[index] != index)
+				{
+					continue;
+				}
 
-			auto const& fault = faultList[newFaultIndices[index]];
-			if (fault.GetPort().portType != PortType::Input
-				|| (fault.GetPort().portNumber < 2u) || (fault.GetPort().portNumber > 3u))
-			{
-				continue;
-			}
+				auto const& fault = faultList[index];
+				if (fault.GetPort().portType != PortType::Input
+					|| (fault.GetPort().portNumber < 2u) || (fault.GetPort().portNumber > 3u))
+				{
+					continue;
+				}
 
-			auto const* mappedNode { fault.GetNode() };
-			if (mappedNode->GetCellType() != CellType::S_OUT
-				&& mappedNode->GetCellType() != CellType::S_OUT_CLK
-				&& mappedNode->GetCellType() != CellType::S_OUT_EN)
-			{
-				continue;
-			}
+				auto const* mappedNode { fault.GetNode() };
+				if (mappedNode->GetCellType() != CellType::S_OUT
+					&& mappedNode->GetCellType() != CellType::S_OUT_CLK
+					&& mappedNode->GetCellType() != CellType::S_OUT_EN)
+				{
+					continue;
+				}
 
-			faultMergedOrRemoved[index] = true;
-			newFaultIndices[index] = REMOVED_FAULT;
-		}
+				newFaultIndices[index] = REMOVED_FAULT;
+			}
+		});
 	}
 
 	if ((reduction & TransitionDelayFaultReduction::RemoveConnectedToDontCare) == TransitionDelayFaultReduction::RemoveConnectedToDontCare)
 	{
-		for (size_t index { 0u }; index < newFaultIndices.size(); ++index)
-		{
-			if (faultMergedOrRemoved[index])
+		Parallel::ExecuteParallelInBlocks(0u, faultList.size(), FAULT_LIST_FAULT_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t index { begin }; index < end; ++index)
 			{
-				continue;
-			}
+				if (newFaultIndices[index] != index)
+				{
+					continue;
+				}
 
-			auto const& fault { faultList[newFaultIndices[index]] };
-			if (fault.GetPort().portType != PortType::Input)
-			{
-				continue;
-			}
+				auto const& fault { faultList[index] };
+				if (fault.GetPort().portType != PortType::Input)
+				{
+					continue;
+				}
 
-			auto const* driverNode { fault.GetNode()->GetInput(fault.GetPort().portNumber) };
-			if (driverNode->GetCellType() != CellType::PRESET_X)
-			{
-				continue;
-			}
+				auto const* driverNode { fault.GetNode()->GetInput(fault.GetPort().portNumber) };
+				if (driverNode->GetCellType() != CellType::PRESET_X)
+				{
+					continue;
+				}
 
-			faultMergedOrRemoved[index] = true;
-			newFaultIndices[index] = REMOVED_FAULT;
-		}
+				newFaultIndices[index] = REMOVED_FAULT;
+			}
+		});
 	}
 
 	if ((reduction & TransitionDelayFaultReduction::RemoveConnectedToUnknown) == TransitionDelayFaultReduction::RemoveConnectedToUnknown)
 	{
-		for (size_t index { 0u }; index < newFaultIndices.size(); ++index)
-		{
-			if (faultMergedOrRemoved[index])
+		Parallel::ExecuteParallelInBlocks(0u, faultList.size(), FAULT_LIST_FAULT_BLOCK_SIZE, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+			for (size_t index { begin }; index < end; ++index)
 			{
-				continue;
-			}
+				if (newFaultIndices[index] != index)
+				{
+					continue;
+				}
 
-			auto const& fault { faultList[newFaultIndices[index]] };
-			if (fault.GetPort().portType != PortType::Input)
-			{
-				continue;
-			}
+				auto const& fault { faultList[index] };
+				if (fault.GetPort().portType != PortType::Input)
+				{
+					continue;
+				}
 
-			auto const* driverNode { fault.GetNode()->GetInput(fault.GetPort().portNumber) };
-			if (driverNode->GetCellType() != CellType::PRESET_U)
-			{
-				continue;
-			}
+				auto const* driverNode { fault.GetNode()->GetInput(fault.GetPort().portNumber) };
+				if (driverNode->GetCellType() != CellType::PRESET_U)
+				{
+					continue;
+				}
 
-			faultMergedOrRemoved[index] = true;
-			newFaultIndices[index] = REMOVED_FAULT;
-		}
+				newFaultIndices[index] = REMOVED_FAULT;
+			}
+		});
 	}
 
 	// Construct the new fault list by copying the untouched elements.
+	size_t numberOfFaults { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		numberOfFaults += (newFaultIndices[faultIndex] == faultIndex) ? 1u : 0u;
+	}
+
 	std::vector<SingleTransitionDelayFault> newFaultList;
-	newFaultList.reserve(std::count_if(faultMergedOrRemoved.begin(), faultMergedOrRemoved.end(), [](bool faultMergedOrRemoved) {
-		return !faultMergedOrRemoved;
-	}));
+	newFaultList.reserve(numberOfFaults);
 
 	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
 	{
-		if (!faultMergedOrRemoved[faultIndex])
+		if (newFaultIndices[faultIndex] == faultIndex)
 		{
 			// Update the fault index to the new location.
 			newFaultIndices[faultIndex] = newFaultList.size();
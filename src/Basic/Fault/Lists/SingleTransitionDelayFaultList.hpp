@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <type_traits>
 
 #include "Basic/Fault/ConcurrentFaultList.hpp"
@@ -23,11 +24,17 @@ class SingleTransitionDelayFaultMetaData: public TargetedFaultMetaData
 {
 public:
 	SingleTransitionDelayFaultMetaData(void);
+	SingleTransitionDelayFaultMetaData(const SingleTransitionDelayFaultMetaData& other);
 	virtual ~SingleTransitionDelayFaultMetaData(void);
 
-	size_t detectingPatternId;
+	SingleTransitionDelayFaultMetaData& operator=(const SingleTransitionDelayFaultMetaData& other);
+
+	// The detection data is read by the checkpoint thread while the fault simulation runs.
+	// The remaining detection data is written before the pattern id, which is stored with release semantics.
+	// Readers load the pattern id with acquire semantics before they access the remaining data.
+	std::atomic<size_t> detectingPatternId;
 	Circuit::MappedCircuit::NodeAndPort detectingNode;
-	size_t detectingTimeframe;
+	std::atomic<size_t> detectingTimeframe;
 	Basic::Logic detectingOutputGood;
 	Basic::Logic detectingOutputBad;
 };
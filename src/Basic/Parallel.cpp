@@ -2,12 +2,21 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <execution>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <random>
 #include <vector>
 #include <type_traits>
 
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_queue.h>
+#include <tbb/info.h>
+#include <tbb/parallel_for.h>
 #include <tbb/task_arena.h>
 #include <tbb/task_group.h>
 
@@ -35,50 +44,234 @@ static tbb::task_arena& GetArena(Arena arena)
 	return arenas[static_cast<size_t>(arena)];
 }
 
+struct NumaArenas
+{
+	NumaPolicy policy { NumaPolicy::Disabled };
+	size_t threads { 0u };
+
+	// One sub-arena per NUMA node (empty if the policy is disabled)
+	std::vector<std::unique_ptr<tbb::task_arena>> nodeArenas;
+	std::vector<size_t> nodeThreads;
+};
+
+static std::array<NumaArenas, static_cast<size_t>(Arena::NUM_ITEMS)> numaArenas;
+static NumaArenas& GetNumaArenas(Arena arena)
+{
+	return numaArenas[static_cast<size_t>(arena)];
+}
+
+static void InitializeNumaArenas(Arena arenaId)
+{
+	NumaArenas& numa { GetNumaArenas(arenaId) };
+	numa.nodeArenas.clear();
+	numa.nodeThreads.clear();
+
+	if (numa.policy != NumaPolicy::Distributed)
+	{
+		return;
+	}
+
+	const std::vector<tbb::numa_node_id> nodes { tbb::info::numa_nodes() };
+	if (nodes.size() <= 1u)
+	{
+		return;
+	}
+
+	std::vector<size_t> nodeConcurrency;
+	for (const auto node : nodes)
+	{
+		nodeConcurrency.push_back(static_cast<size_t>(tbb::info::default_concurrency(node)));
+	}
+
+	const size_t totalConcurrency { std::accumulate(nodeConcurrency.begin(), nodeConcurrency.end(), size_t { 0u }) };
+	const size_t threads { (numa.threads != 0u) ? std::min(numa.threads, totalConcurrency) : totalConcurrency };
+
+	// Distribute the threads proportionally to the cores of each node.
+	// The threads that are left after rounding down are given to the nodes with the largest remainder,
+	// which keeps the sum of all nodes equal to the thread limit.
+	std::vector<size_t> threadsForNode(nodes.size());
+	size_t assignedThreads { 0u };
+	for (size_t node { 0u }; node < nodes.size(); ++node)
+	{
+		threadsForNode[node] = (threads * nodeConcurrency[node]) / totalConcurrency;
+		assignedThreads += threadsForNode[node];
+	}
+
+	std::vector<size_t> nodeOrder(nodes.size());
+	std::iota(nodeOrder.begin(), nodeOrder.end(), 0u);
+	std::stable_sort(nodeOrder.begin(), nodeOrder.end(), [&](size_t first, size_t second) {
+		return (threads * nodeConcurrency[first]) % totalConcurrency > (threads * nodeConcurrency[second]) % totalConcurrency;
+	});
+	for (size_t index { 0u }; assignedThreads < threads; ++index, ++assignedThreads)
+	{
+		threadsForNode[nodeOrder[index]]++;
+	}
+
+	for (size_t node { 0u }; node < nodes.size(); ++node)
+	{
+		if (threadsForNode[node] == 0u)
+		{
+			continue;
+		}
+
+		numa.nodeArenas.emplace_back(std::make_unique<tbb::task_arena>(
+			tbb::task_arena::constraints { nodes[node], static_cast<int>(threadsForNode[node]) }));
+		numa.nodeThreads.push_back(threadsForNode[node]);
+	}
+}
+
 void SetThreads(Arena arenaId, size_t threads)
 {
 	GetArena(arenaId).initialize((threads != 0u) ? static_cast<int>(threads) : tbb::task_arena::automatic);
+	GetNumaArenas(arenaId).threads = threads;
+	InitializeNumaArenas(arenaId);
 }
 
 size_t GetThreads(Arena arenaId)
 {
+	const NumaArenas& numa { GetNumaArenas(arenaId) };
+	if (!numa.nodeArenas.empty())
+	{
+		return std::accumulate(numa.nodeThreads.begin(), numa.nodeThreads.end(), size_t { 0u });
+	}
+
 	return GetArena(arenaId).max_concurrency();
 }
 
-void ExecuteParallelImpl(Arena arenaId, size_t begin, size_t end, Order order, std::function<void(size_t)> function)
+void SetNumaPolicy(Arena arenaId, NumaPolicy policy)
+{
+	GetNumaArenas(arenaId).policy = policy;
+	InitializeNumaArenas(arenaId);
+}
+
+// Returns the number of indices that are processed by one task of the arena.
+// Each thread gets several chunks to balance work items with different runtimes.
+static size_t GetGrainSize(size_t items, size_t threads)
+{
+	return std::max<size_t>(1u, items / (std::max<size_t>(1u, threads) * 8u));
+}
+
+static void ExecuteNumaDistributedInBlocks(NumaArenas& numa, size_t begin, size_t end, size_t blockSize, const std::function<void(size_t, size_t)>& function)
 {
-	if (order == Order::Sequential || GetArena(arenaId).max_concurrency() == 1)
+	const size_t nodes { numa.nodeArenas.size() };
+	const size_t totalThreads { std::accumulate(numa.nodeThreads.begin(), numa.nodeThreads.end(), size_t { 0u }) };
+	std::vector<tbb::task_group> groups(nodes);
+
+	// Each node starts with a contiguous range of the blocks, which is proportional to the threads of the node.
+	// The ranges are aligned to the block size to get the same blocks as without NUMA distribution.
+	const size_t blocks { (end - begin + blockSize - 1u) / blockSize };
+	std::vector<size_t> nodeBlockEnd(nodes);
+	std::vector<std::atomic<size_t>> nodeNextBlock(nodes);
+	std::vector<size_t> nodeGrainSize(nodes);
+	size_t nodeBlockBegin { 0u };
+	size_t cumulativeThreads { 0u };
+	for (size_t node { 0u }; node < nodes; ++node)
 	{
-		for (size_t index {begin}; index != end; ++index)
+		cumulativeThreads += numa.nodeThreads[node];
+		nodeBlockEnd[node] = (node + 1u == nodes) ? blocks : (blocks * cumulativeThreads) / totalThreads;
+		nodeNextBlock[node] = nodeBlockBegin;
+		nodeGrainSize[node] = GetGrainSize(nodeBlockEnd[node] - nodeBlockBegin, numa.nodeThreads[node]);
+		nodeBlockBegin = nodeBlockEnd[node];
+	}
+
+	// The workers of a node take chunks of blocks from the range of their own node first.
+	// When the range is exhausted they take the remaining chunks of the other nodes.
+	auto run_worker = [&](size_t node) {
+		for (size_t offset { 0u }; offset < nodes; ++offset)
 		{
-			function(index);
+			const size_t victim { (node + offset) % nodes };
+			for (size_t block { nodeNextBlock[victim].fetch_add(nodeGrainSize[victim]) };
+				block < nodeBlockEnd[victim];
+				block = nodeNextBlock[victim].fetch_add(nodeGrainSize[victim]))
+			{
+				const size_t chunkEnd { std::min(block + nodeGrainSize[victim], nodeBlockEnd[victim]) };
+				for (; block < chunkEnd; ++block)
+				{
+					function(begin + block * blockSize, std::min(begin + (block + 1u) * blockSize, end));
+				}
+			}
+		}
+	};
+
+	// Manager schedules one worker task for each thread of a node
+	for (size_t node { 0u }; node < nodes; ++node)
+	{
+		numa.nodeArenas[node]->execute([&, node=node]() {
+			for (size_t thread { 0u }; thread < numa.nodeThreads[node]; ++thread)
+			{
+				groups[node].run([&, node=node]() { run_worker(node); });
+			}
+		});
+	}
+
+	// Manager joins all task groups before the first exception is rethrown.
+	// Otherwise, the tasks of the other nodes would still reference the local state.
+	std::exception_ptr exception;
+	for (size_t node { 0u }; node < nodes; ++node)
+	{
+		try
+		{
+			numa.nodeArenas[node]->execute([&]() {
+				groups[node].wait();
+			});
+		}
+		catch (...)
+		{
+			if (!exception)
+			{
+				exception = std::current_exception();
+			}
 		}
 	}
-	else
+
+	if (exception)
 	{
-		tbb::task_arena& arena { GetArena(arenaId) };
-		tbb::task_group group {};
+		std::rethrow_exception(exception);
+	}
+}
 
-		// Manager schedules work for the task  group
+void ExecuteParallelImpl(Arena arenaId, size_t begin, size_t end, Order order, std::function<void(size_t)> function)
+{
+	if (order == Order::Parallel && !GetNumaArenas(arenaId).nodeArenas.empty())
+	{
+		ExecuteNumaDistributedInBlocks(GetNumaArenas(arenaId), begin, end, 1u, [&function](size_t blockBegin, size_t blockEnd) {
+			for (size_t index { blockBegin }; index < blockEnd; ++index)
+			{
+				function(index);
+			}
+		});
+	}
+	else if (order == Order::Sequential || GetArena(arenaId).max_concurrency() == 1)
+	{
 		for (size_t index {begin}; index != end; ++index)
 		{
-			arena.execute([&, index=index]() {
-				group.run([&, index=index]() {
-					function(index);
-				});
-			});
+			function(index);
 		}
+	}
+	else if (begin < end)
+	{
+		tbb::task_arena& arena { GetArena(arenaId) };
 
-		// Manager can now join the task group
+		// The range is split into chunks of several indices that are balanced by work stealing
+		const size_t grainSize { GetGrainSize(end - begin, static_cast<size_t>(arena.max_concurrency())) };
 		arena.execute([&]() {
-			group.wait();
+			tbb::parallel_for(tbb::blocked_range<size_t>(begin, end, grainSize), [&](const tbb::blocked_range<size_t>& range) {
+				for (size_t index { range.begin() }; index != range.end(); ++index)
+				{
+					function(index);
+				}
+			}, tbb::simple_partitioner());
 		});
 	}
 };
 
 void ExecuteParallelInBlocksImpl(Arena arenaId, size_t begin, size_t end, size_t blockSize, Order order, std::function<void(size_t, size_t)> function)
 {
-	if (order == Order::Sequential || GetArena(arenaId).max_concurrency() == 1)
+	if (order == Order::Parallel && !GetNumaArenas(arenaId).nodeArenas.empty())
+	{
+		ExecuteNumaDistributedInBlocks(GetNumaArenas(arenaId), begin, end, blockSize, function);
+	}
+	else if (order == Order::Sequential || GetArena(arenaId).max_concurrency() == 1)
 	{
 		for (size_t index {begin}; index < end; index += blockSize)
 		{
@@ -107,5 +300,121 @@ void ExecuteParallelInBlocksImpl(Arena arenaId, size_t begin, size_t end, size_t
 	}
 };
 
+struct PipelineState
+{
+	PipelineState(const std::vector<PipelineStage>& stages):
+		stages(stages),
+		tokens(),
+		failed(false),
+		exceptionMutex(),
+		exception()
+	{
+	}
+
+	const std::vector<PipelineStage>& stages;
+	tbb::concurrent_bounded_queue<size_t> tokens;
+
+	// The first exception of a stage is rethrown by the manager
+	std::atomic<bool> failed;
+	std::mutex exceptionMutex;
+	std::exception_ptr exception;
+};
+
+// The state is shared with every enqueued task, which keeps it alive
+// until the last task has returned its token and has finished.
+// The stages are only accessed before the token is returned.
+static void RunPipelineStage(std::shared_ptr<PipelineState> state, size_t stageIndex, size_t index, size_t token)
+{
+	GetArena(state->stages[stageIndex].arena).enqueue([state, stageIndex, index, token]() {
+		bool passOn { false };
+		try
+		{
+			passOn = !state->failed
+				&& state->stages[stageIndex].function(index)
+				&& stageIndex + 1u < state->stages.size();
+		}
+		catch (...)
+		{
+			std::scoped_lock lock { state->exceptionMutex };
+			if (!state->exception)
+			{
+				state->exception = std::current_exception();
+			}
+			state->failed = true;
+		}
+
+		if (passOn)
+		{
+			RunPipelineStage(state, stageIndex + 1u, index, token);
+		}
+		else
+		{
+			state->tokens.push(token);
+		}
+	});
+}
+
+void ExecutePipeline(size_t begin, size_t end, size_t maxLiveItems, Order order, const std::vector<PipelineStage>& stages)
+{
+	if (stages.empty() || begin >= end)
+	{
+		return;
+	}
+
+	if (order == Order::Sequential)
+	{
+		for (size_t index { begin }; index != end; ++index)
+		{
+			for (const auto& stage : stages)
+			{
+				if (!stage.function(index))
+				{
+					break;
+				}
+			}
+		}
+		return;
+	}
+
+	if (maxLiveItems == 0u)
+	{
+		for (const auto& stage : stages)
+		{
+			maxLiveItems += GetThreads(stage.arena);
+		}
+	}
+
+	// Each token allows one work item to be in flight.
+	// The tokens are returned when the last stage of the work item has finished
+	// or when a stage has thrown an exception.
+	auto state { std::make_shared<PipelineState>(stages) };
+	for (size_t token { 0u }; token < maxLiveItems; ++token)
+	{
+		state->tokens.push(token);
+	}
+
+	// The stages never block and hand over the work item by enqueueing
+	// the next stage into its arena. Therefore, the stages can't dead-lock
+	// independent of the number of threads that are assigned to each arena.
+	// Manager feeds the pipeline as soon as a token is available.
+	size_t token;
+	for (size_t index { begin }; index != end && !state->failed; ++index)
+	{
+		state->tokens.pop(token);
+		RunPipelineStage(state, 0u, index, token);
+	}
+
+	// Manager waits until all tokens have been returned
+	for (size_t returned { 0u }; returned < maxLiveItems; ++returned)
+	{
+		state->tokens.pop(token);
+	}
+
+	if (state->exception)
+	{
+		std::rethrow_exception(state->exception);
+	}
+}
+
 };
 };
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 namespace FreiTest
 {
@@ -19,12 +20,70 @@ enum class Arena {
 	PatternGeneration,
 	FaultSimulation,
 
+	// Stages of the pipelined pattern generation
+	Encoding,
+	Solving,
+	Extraction,
+
 	NUM_ITEMS
 };
 
+/**
+ * @brief The placement of the threads of an arena on NUMA nodes.
+ *
+ * - Disabled: The threads are not bound to a NUMA node.
+ * - Distributed: The arena is split into one sub-arena per NUMA node with the
+ *   threads bound to that node. The work items are partitioned into contiguous
+ *   ranges (one per node, proportional to the number of threads on the node).
+ *   Each node processes its own range first, so that data which is first touched
+ *   in a parallel region mostly stays local to the node. A node that has finished
+ *   its range takes over the remaining work items of the other nodes.
+ *
+ * If the system has only one NUMA node (or the TBB NUMA support library is
+ * not available) the Distributed policy behaves like Disabled.
+ */
+enum class NumaPolicy
+{
+	Disabled,
+	Distributed
+};
+
 void SetThreads(Arena arena, size_t threads);
 size_t GetThreads(Arena arena);
 
+void SetNumaPolicy(Arena arena, NumaPolicy policy);
+
+/**
+ * @brief One stage of a pipeline that is executed by ExecutePipeline.
+ *
+ * The function is called with the index of the work item in the arena of the stage.
+ * It returns true if the work item should be passed on to the next stage
+ * and false if the processing of the work item is finished.
+ */
+struct PipelineStage
+{
+	Arena arena;
+	std::function<bool(size_t)> function;
+};
+
+/**
+ * @brief Passes each index of the range through all stages in order.
+ *
+ * Different work items are processed concurrently in all stages and each stage
+ * only uses the threads of its own arena. This allows to overlap the stages
+ * with different thread budgets, e.g. to prepare the next work items while
+ * the current ones are still processed by the following stage.
+ * At most maxLiveItems work items are in flight at the same time, which bounds
+ * the memory that is used for the intermediate results of the stages.
+ * A value of 0 uses the sum of the threads of the stage arenas.
+ *
+ * If a stage throws an exception, no further work items are started and
+ * the first exception is rethrown after all work items in flight have finished.
+ *
+ * The NUMA policy of the stage arenas is not considered by the pipeline.
+ */
+void ExecutePipeline(size_t begin, size_t end, size_t maxLiveItems, Order order, const std::vector<PipelineStage>& stages);
+
 void ExecuteParallelImpl(Arena arena, size_t begin, size_t end, Order order, std::function<void(size_t)> function);
 void ExecuteParallelInBlocksImpl(Arena arena, size_t begin, size_t end, size_t blockSize, Order order, std::function<void(size_t, size_t)> function);
 
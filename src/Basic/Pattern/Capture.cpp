@@ -34,5 +34,21 @@ CaptureOutputs GetCaptureOutputs(OutputCapture capture)
 	}
 }
 
+OutputCapture GetOutputCapture(InputCapture capture)
+{
+	switch (capture)
+	{
+		case InputCapture::PrimaryInputsOnly:
+		case InputCapture::PrimaryAndInitialSecondaryInputs:
+			return OutputCapture::PrimaryOutputsOnly;
+		case InputCapture::SecondaryInputsOnly:
+			return OutputCapture::SecondaryOutputsOnly;
+		case InputCapture::PrimaryAndSecondaryInputs:
+			return OutputCapture::PrimaryAndSecondaryOutputs;
+		default:
+			Logging::Panic("Unsupported capture operation mode");
+	}
+}
+
 };
 };
@@ -27,6 +27,8 @@ struct CaptureOutputs
 };
 
 CaptureOutputs GetCaptureOutputs(OutputCapture capture);
+// Returns the outputs that are observed for patterns with the given input capture.
+OutputCapture GetOutputCapture(InputCapture capture);
 
 };
 };
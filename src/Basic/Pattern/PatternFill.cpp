@@ -0,0 +1,119 @@
+#include "Basic/Pattern/PatternFill.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Logic.hpp"
+
+using namespace FreiTest::Basic;
+
+namespace FreiTest
+{
+namespace Pattern
+{
+
+bool FixedInputs::IsPrimaryInputFixed(size_t input) const
+{
+	return input < primaryInputs.size() && primaryInputs[input];
+}
+
+bool FixedInputs::IsSecondaryInputFixed(size_t input) const
+{
+	return input < secondaryInputs.size() && secondaryInputs[input];
+}
+
+static size_t FillInputs(std::vector<Logic>& inputs, FillMode mode, std::mt19937_64& random, const std::vector<bool>& fixed)
+{
+	const auto is_fixed = [&](size_t index) { return index < fixed.size() && fixed[index]; };
+
+	size_t filled { 0u };
+	switch (mode)
+	{
+		case FillMode::None:
+			break;
+
+		case FillMode::Zero:
+		case FillMode::One:
+		{
+			const Logic value { (mode == FillMode::One) ? Logic::LOGIC_ONE : Logic::LOGIC_ZERO };
+			for (size_t index { 0u }; index < inputs.size(); ++index)
+			{
+				if (!IsValidLogic01(inputs[index]) && !is_fixed(index))
+				{
+					inputs[index] = value;
+					filled++;
+				}
+			}
+			break;
+		}
+
+		case FillMode::Adjacent:
+		{
+			// Leading don't care values take the first specified value
+			const auto first = std::find_if(inputs.begin(), inputs.end(), [](const Logic& value) { return IsValidLogic01(value); });
+			Logic previous { (first != inputs.end()) ? *first : Logic::LOGIC_ZERO };
+			for (size_t index { 0u }; index < inputs.size(); ++index)
+			{
+				if (is_fixed(index) && !IsValidLogic01(inputs[index]))
+				{
+					continue;
+				}
+				if (!IsValidLogic01(inputs[index]))
+				{
+					inputs[index] = previous;
+					filled++;
+				}
+				previous = inputs[index];
+			}
+			break;
+		}
+
+		case FillMode::Random:
+			for (size_t index { 0u }; index < inputs.size(); ++index)
+			{
+				if (!IsValidLogic01(inputs[index]) && !is_fixed(index))
+				{
+					inputs[index] = (random() & 1u) ? Logic::LOGIC_ONE : Logic::LOGIC_ZERO;
+					filled++;
+				}
+			}
+			break;
+
+		default:
+			Logging::Panic("The fill mode is not supported");
+			break;
+	}
+
+	return filled;
+}
+
+size_t FillDontCareValues(TestPattern& pattern, FillMode mode, uint64_t seed, const FixedInputs& fixedInputs)
+{
+	std::mt19937_64 random { seed };
+
+	size_t filled { 0u };
+	for (size_t timeframe { 0u }; timeframe < pattern.GetNumberOfTimeframes(); ++timeframe)
+	{
+		filled += FillInputs(pattern.GetPrimaryInputs(timeframe), mode, random, fixedInputs.primaryInputs);
+		filled += FillInputs(pattern.GetSecondaryInputs(timeframe), mode, random, fixedInputs.secondaryInputs);
+	}
+	return filled;
+}
+
+size_t GetNumberOfCareBits(const TestPattern& pattern)
+{
+	size_t careBits { 0u };
+	for (size_t timeframe { 0u }; timeframe < pattern.GetNumberOfTimeframes(); ++timeframe)
+	{
+		const auto& primaryInputs { pattern.GetPrimaryInputs(timeframe) };
+		const auto& secondaryInputs { pattern.GetSecondaryInputs(timeframe) };
+		careBits += std::count_if(primaryInputs.begin(), primaryInputs.end(), [](const Logic& value) { return IsValidLogic01(value); });
+		careBits += std::count_if(secondaryInputs.begin(), secondaryInputs.end(), [](const Logic& value) { return IsValidLogic01(value); });
+	}
+	return careBits;
+}
+
+};
+};
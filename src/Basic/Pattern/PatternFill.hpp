@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Basic/Pattern/TestPattern.hpp"
+
+namespace FreiTest
+{
+namespace Pattern
+{
+
+/**
+ * @brief The strategy to assign the don't care (X) values of a test pattern.
+ *
+ * - None: The don't care values are kept.
+ * - Zero / One: All don't care values are set to the constant.
+ * - Adjacent: A don't care value repeats the last specified value before it
+ *   (in input order of the timeframe). Leading don't care values use the first
+ *   specified value. This minimizes the transitions while shifting scan chains.
+ * - Random: The don't care values are set randomly which maximizes the
+ *   chance of fortuitous detections of other faults.
+ */
+enum class FillMode
+{
+	None,
+	Zero,
+	One,
+	Adjacent,
+	Random
+};
+
+/**
+ * @brief The inputs of a pattern that have to keep their value in all timeframes.
+ *
+ * Inputs beyond the size of the vectors are not fixed, so an empty mask fixes no input.
+ * This is used for inputs which are constrained by a surrounding circuit (e.g. the VCM)
+ * and must neither be relaxed nor filled.
+ */
+struct FixedInputs
+{
+	std::vector<bool> primaryInputs;
+	std::vector<bool> secondaryInputs;
+
+	bool IsPrimaryInputFixed(size_t input) const;
+	bool IsSecondaryInputFixed(size_t input) const;
+};
+
+/**
+ * @brief Assigns the don't care values of the pattern according to the fill mode.
+ *
+ * The primary and secondary inputs of each timeframe are filled separately.
+ * The seed is only used for the random fill.
+ * Fixed inputs are skipped and keep their (don't care) value.
+ *
+ * @return The number of don't care values that have been assigned.
+ */
+size_t FillDontCareValues(TestPattern& pattern, FillMode mode, uint64_t seed = 0u, const FixedInputs& fixedInputs = { });
+
+/**
+ * @brief Returns the number of specified (0 / 1) values of the pattern.
+ */
+size_t GetNumberOfCareBits(const TestPattern& pattern);
+
+};
+};
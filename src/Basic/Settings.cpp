@@ -11,6 +11,7 @@
 #include <iterator>
 
 #include "Basic/Logging.hpp"
+#include "Helper/Compression.hpp"
 #include "Helper/StringHelper.hpp"
 #include "SolverProxy/Sat/SatSolverProxy.hpp"
 #include "SolverProxy/Bmc/BmcSolverProxy.hpp"
@@ -26,6 +27,7 @@ Settings::Settings(void):
 	DataImportDirectory("./output"),
 	DataExportDirectory("./output"),
 	StatisticsExportFilename("[DataExportDirectory]/statistics.json"),
+	DataExchangeFormat(Settings::ExchangeFormat::Json),
 	SatSolver(SolverProxy::Sat::SatSolver::PROD_SAT_MINISAT),
 	BmcSolver(SolverProxy::Bmc::BmcSolver::PROD_NCIP),
 	CircuitName("UnnamedCircuit"),
@@ -35,7 +37,9 @@ Settings::Settings(void):
 	VerilogLibraryFilenames({}),
 	VerilogExportPreprocessedFilename(""),
 	VerilogExportProcessedFilename(""),
-	TopLevelModuleName("LAST_DEFINED")
+	TopLevelModuleName("LAST_DEFINED"),
+	CircuitSnapshotFilename(""),
+	VerilogLibraryCacheDirectory("")
 {
 }
 
@@ -279,6 +283,21 @@ bool Settings::SetSetting(LoadContext context, string key, string value, bool op
 	{
 		this->StatisticsExportFilename = value;
 	}
+	else if (key == "DataExchangeFormat")
+	{
+		if (value == "Json")
+		{
+			this->DataExchangeFormat = Settings::ExchangeFormat::Json;
+		}
+		else if (value == "Binary")
+		{
+			this->DataExchangeFormat = Settings::ExchangeFormat::Binary;
+		}
+		else
+		{
+			return false;
+		}
+	}
 
 	// Solver configuration
 	else if (key == "SatSolver")
@@ -344,6 +363,10 @@ bool Settings::SetSetting(LoadContext context, string key, string value, bool op
 		{
 			this->CircuitSourceType = Settings::CircuitSourceType::Verilog;
 		}
+		else if (value == "Snapshot")
+		{
+			this->CircuitSourceType = Settings::CircuitSourceType::Snapshot;
+		}
 		else
 		{
 			return false;
@@ -384,6 +407,19 @@ bool Settings::SetSetting(LoadContext context, string key, string value, bool op
 	{
 		this->TopLevelModuleName = value;
 	}
+	else if (key == "CircuitSnapshotFilename")
+	{
+		// The snapshot is memory-mapped and can't be compressed
+		if (GetCompressionFormat(value) != CompressionFormat::None)
+		{
+			return false;
+		}
+		this->CircuitSnapshotFilename = value;
+	}
+	else if (key == "VerilogLibraryCacheDirectory")
+	{
+		this->VerilogLibraryCacheDirectory = value;
+	}
 	else
 	{
 		_applicationSettings.emplace_back(key, value, optional, overwrite);
@@ -404,6 +440,7 @@ string Settings::ReplacePlaceholder(LoadContext context, string value)
 
 		value = StringHelper::ReplaceString("[DataExportDirectory]", this->DataExportDirectory, value);
 		value = StringHelper::ReplaceString("[DataImportDirectory]", this->DataImportDirectory, value);
+		value = StringHelper::ReplaceString("[DataExchangeExtension]", GetExchangeExtension(this->DataExchangeFormat), value);
 
 		value = StringHelper::ReplaceString("[Circuit]", this->CircuitName, value);
 		value = StringHelper::ReplaceString("[CircuitName]", this->CircuitName, value);
@@ -412,6 +449,11 @@ string Settings::ReplacePlaceholder(LoadContext context, string value)
 	return value;
 }
 
+string Settings::GetExchangeExtension(ExchangeFormat format)
+{
+	return (format == ExchangeFormat::Binary) ? "bin" : "json";
+}
+
 string Settings::MapFileName(string rawFilename, bool forReading)
 {
 	LoadContext context { "" };
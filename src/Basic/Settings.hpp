@@ -83,15 +83,25 @@ public:
 	enum class CircuitSourceType
 	{
 		None = 1,
-		Verilog
+		Verilog,
+		Snapshot
 	};
 
+	enum class ExchangeFormat
+	{
+		Json = 1,
+		Binary
+	};
+
+	static std::string GetExchangeExtension(ExchangeFormat format);
+
 	std::string Application;
 	std::map<std::string, std::string> Defines;
 	std::vector<std::string> Parameters;
 	std::string DataImportDirectory;
 	std::string DataExportDirectory;
 	std::string StatisticsExportFilename;
+	ExchangeFormat DataExchangeFormat;
 
 	SolverProxy::Sat::SatSolver SatSolver;
 	SolverProxy::Bmc::BmcSolver BmcSolver;
@@ -105,6 +115,8 @@ public:
 	std::string VerilogExportPreprocessedFilename;
 	std::string VerilogExportProcessedFilename;
 	std::string TopLevelModuleName;
+	std::string CircuitSnapshotFilename;
+	std::string VerilogLibraryCacheDirectory;
 
 private:
 	struct LoadContext
@@ -45,6 +45,29 @@ void AverageStatistic::AddValue(double value)
 	}
 }
 
+void AverageStatistic::Merge(const AverageStatistic& other)
+{
+	if (other.count == 0u)
+	{
+		return;
+	}
+
+	if (collectValues)
+	{
+		collectedValues.insert(collectedValues.end(), other.collectedValues.begin(), other.collectedValues.end());
+	}
+	if (count == 0u || other.valueMin < valueMin)
+	{
+		valueMin = other.valueMin;
+	}
+	if (count == 0u || other.valueMax > valueMax)
+	{
+		valueMax = other.valueMax;
+	}
+	count += other.count;
+	valueSum += other.valueSum;
+}
+
 void AverageStatistic::SetCollectValues(bool newValue)
 {
 	collectValues = newValue;
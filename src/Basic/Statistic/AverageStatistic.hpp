@@ -17,6 +17,7 @@ public:
 
 	void Reset();
 	void AddValue(double value);
+	void Merge(const AverageStatistic& other);
 	void SetCollectValues(bool newValue);
 	bool IsCollectValues();
 	double GetAverageValue();
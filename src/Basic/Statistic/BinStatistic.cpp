@@ -1,5 +1,7 @@
 #include "Basic/Statistic/BinStatistic.hpp"
 
+#include <algorithm>
+
 #include "Basic/Logging.hpp"
 
 namespace FreiTest
@@ -42,6 +44,23 @@ void BinStatistic::AddValue(double value)
 	bins[bin]++;
 }
 
+// adds the bins of another statistic with the same size
+void BinStatistic::Merge(const BinStatistic& other)
+{
+	ASSERT(bins.size() == other.bins.size()) << "BinStatistic with " << other.bins.size() << " bins can not be merged into one with " << bins.size() << " bins";
+
+	for (size_t bin = 0u; bin < bins.size(); ++bin)
+	{
+		bins[bin] += other.bins[bin];
+	}
+}
+
+// clears all bins but keeps the size
+void BinStatistic::Reset()
+{
+	std::fill(bins.begin(), bins.end(), 0u);
+}
+
 // returns a string with the number of items in each bin
 std::string BinStatistic::ReportValues() {
 	std::string retVal;
@@ -20,6 +20,12 @@ public:
 	// add a value (and performs some basic sanity checks)
 	void AddValue(double value);
 
+	// adds the bins of another statistic with the same size
+	void Merge(const BinStatistic& other);
+
+	// clears all bins but keeps the size
+	void Reset();
+
 	// returns a string with the number of items in each bin
 	std::string ReportValues();
 
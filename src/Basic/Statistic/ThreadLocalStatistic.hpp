@@ -0,0 +1,68 @@
+#pragma once
+
+#include <tbb/enumerable_thread_specific.h>
+
+namespace FreiTest
+{
+namespace Statistic
+{
+
+/**
+ * @brief Collects values for a statistic in one accumulator per thread.
+ *
+ * Adding values only touches the accumulator of the calling thread and
+ * therefore requires no locking inside of parallel regions.
+ * The accumulators are merged into the target statistic by calling Merge
+ * at a phase boundary (when no thread is adding values anymore).
+ *
+ * The statistic type has to provide AddValue, Merge and Reset methods
+ * (e.g. AverageStatistic and BinStatistic).
+ */
+template<typename Statistic>
+class ThreadLocalStatistic
+{
+public:
+	ThreadLocalStatistic(Statistic& target):
+		_target(target),
+		// Copy the target on first use to inherit its configuration
+		// (collected values, bin sizes, ...) but not its values.
+		_locals([&target]() {
+			Statistic local { target };
+			local.Reset();
+			return local;
+		})
+	{
+	}
+	virtual ~ThreadLocalStatistic(void) = default;
+
+	ThreadLocalStatistic(const ThreadLocalStatistic& other) = delete;
+	ThreadLocalStatistic& operator=(const ThreadLocalStatistic& other) = delete;
+
+	Statistic& Local(void)
+	{
+		return _locals.local();
+	}
+
+	void AddValue(double value)
+	{
+		_locals.local().AddValue(value);
+	}
+
+	// Must not be called while other threads are adding values.
+	void Merge(void)
+	{
+		for (auto& local : _locals)
+		{
+			_target.Merge(local);
+			local.Reset();
+		}
+	}
+
+private:
+	Statistic& _target;
+	tbb::enumerable_thread_specific<Statistic> _locals;
+
+};
+
+};
+};
@@ -3,6 +3,7 @@
 #include <boost/format.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <set>
 #include <type_traits>
@@ -1684,6 +1685,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 	auto& unmappedCircuit = environment->_unmappedCircuit;
 	auto& mappedCircuit = environment->_circuit;
 	auto& metaData = environment->_metaData;
+	auto& stringPool = environment->_stringPool;
 
 	const auto find_topmost_parent_with_connection = [&](auto connectionId, auto& groupId) -> GroupId {
 		// The following assumptions are made:
@@ -1942,8 +1944,8 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 
 		// General attributes
 		auto& newNode = unmappedCircuit._nodeContainer[tsort];
-		newNode.name = unmappedNode.name; // The name is updated at the end of this method
-		newNode.typeName = unmappedNode.type;
+		// The name is assigned at the end of this method when the hierarchy is known
+		newNode.typeName = stringPool.Intern(unmappedNode.type);
 		newNode.tsort = tsort;
 
 		// Input pins
@@ -2065,9 +2067,9 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 		for (size_t output = 0u; output < node.numberOfOutputPins; output++)
 		{
 			node.outData[output].PinSort = pinId;
-			node.outData[output].PinName = unmappedNode.outputPortNames[output];
+			node.outData[output].PinName = stringPool.Intern(unmappedNode.outputPortNames[output]);
 			node.outData[output].PinWireId = UnmappedCircuit::NO_CONNECTION; // Replaced later
-			node.outData[output].PinWireName = unmappedNode.outputConnectionNames[output];
+			node.outData[output].PinWireName = stringPool.Intern(unmappedNode.outputConnectionNames[output]);
 			unmappedCircuit._pinIdToNodeIdAndPort[pinId] = { tsort, { Circuit::PortType::Output, output } };
 
 			// Associate the wire name with the driving gate.
@@ -2078,9 +2080,9 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 		for (size_t input = 0u; input < node.numberOfIns; input++)
 		{
 			node.inData[input].PinSort = pinId;
-			node.inData[input].PinName = unmappedNode.inputPortNames[input];
+			node.inData[input].PinName = stringPool.Intern(unmappedNode.inputPortNames[input]);
 			node.inData[input].PinWireId = UnmappedCircuit::NO_CONNECTION; // Replaced later
-			node.inData[input].PinWireName = unmappedNode.inputConnectionNames[input];
+			node.inData[input].PinWireName = stringPool.Intern(unmappedNode.inputConnectionNames[input]);
 			unmappedCircuit._pinIdToNodeIdAndPort[pinId] = { tsort, { Circuit::PortType::Input, input } };
 			pinId++;
 		}
@@ -2330,8 +2332,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 		// General attributes
 		auto& newNode = mappedCircuit._nodeContainer[tsort];
 		newNode.tsort = tsort;
-		newNode.name = mappedNode.name;  // The name is updated at the end of this method
-		newNode.signalName = mappedNode.outputConnectionName;
+		// The name and signal name are assigned at the end of this method when the hierarchy is known
 		newNode.mainType = mappedNode.cellCategory;
 		newNode.type = mappedNode.cellType;
 
@@ -2836,7 +2837,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 		}
 
 		groupMapping[groupId] = metaData.groups.size();
-		metaData.groups.emplace_back(_groups[groupId].name);
+		metaData.groups.emplace_back(stringPool.Intern(_groups[groupId].name));
 
 		// metaData.groups has been pre-allocated, so taking the address is possible.
 		metaData.allGroups.emplace_back(&metaData.groups.back());
@@ -2881,6 +2882,44 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 			newGroup.subGroups.push_back(&metaData.groups[groupMapping[subGroupId]]);
 			metaData.groups[groupMapping[subGroupId]].parent = &metaData.groups[groupMapping[groupId]];
 		}
+	}
+
+	// Compute the hierarchical group names once instead of walking the parents for every name.
+	// The root groups already use their own name as hierarchical name.
+	std::function<void(GroupId)> assign_hierarchy_name = [&](GroupId groupId) {
+		const auto& newGroup = metaData.groups[groupMapping[groupId]];
+		for (const auto& subGroupId : _groups[groupId].groupIds)
+		{
+			if (IsDeletedGroup(subGroupId))
+			{
+				continue;
+			}
+
+			auto& newSubGroup = metaData.groups[groupMapping[subGroupId]];
+			newSubGroup.hierarchyName = stringPool.Intern(newGroup.GetHierarchyName() + "/" + newSubGroup.GetName());
+			assign_hierarchy_name(subGroupId);
+		}
+	};
+	for (GroupId groupId = 0u; groupId < _groups.size(); ++groupId)
+	{
+		if (!IsDeletedGroup(groupId) && metaData.groups[groupMapping[groupId]].GetParent() == nullptr)
+		{
+			assign_hierarchy_name(groupId);
+		}
+	}
+
+	for (GroupId groupId = 0u; groupId < _groups.size(); ++groupId)
+	{
+		if (IsDeletedGroup(groupId))
+		{
+			continue;
+		}
+
+		auto& newGroup = metaData.groups[groupMapping[groupId]];
+
+		// The node names are prefixed with the name of the parent group
+		const std::string parentPrefix { (newGroup.GetParent() != nullptr)
+			? newGroup.GetParent()->GetHierarchyName() + "/" : "" };
 
 		// Propagate the unmapped node information
 		for (const auto& unmappedNodeId : _groups[groupId].unmappedNodeIds)
@@ -2895,11 +2934,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 			newGroup.unmappedNodes.push_back(node);
 			metaData.unmappedNodeGroups[tsort] = &(metaData.groups[groupMapping[groupId]]);
 
-			if (auto parent = newGroup.GetParent(); parent)
-			{
-				// Update the name if the parent group exists
-				node->name = parent->GetHierarchyName() + "/" + node->name;
-			}
+			node->name = stringPool.Intern(parentPrefix + _unmappedNodes[unmappedNodeId].name);
 
 			for (size_t input = 0u; input < _unmappedNodes[unmappedNodeId].inputConnectionIds.size(); ++input)
 			{
@@ -2936,16 +2971,18 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 			newGroup.mappedNodes.push_back(node);
 			metaData.mappedNodeGroups[tsort] = &(metaData.groups[groupMapping[groupId]]);
 
-			// Fix the node's name to include the parent group's name
-			if (auto parent = newGroup.GetParent(); parent)
+			// Prefix the node's name with the parent group's name
+			node->name = stringPool.Intern(parentPrefix + _mappedNodes[mappedNodeId].name);
+
+			// Prefix the unconnected wire's names with the group's name
+			const std::string& signalName { _mappedNodes[mappedNodeId].outputConnectionName };
+			if (signalName == "UNCONNECTED_OUTPUT_WIRE" || signalName.rfind("UNCONNECTED_INPUT_WIRE_", 0u) == 0u)
 			{
-				node->name = parent->GetHierarchyName() + "/" + node->name;
+				node->signalName = stringPool.Intern(newGroup.GetHierarchyName() + "/" + signalName);
 			}
-
-			// Fix the unconnected wire's names to include the group's name
-			if (node->signalName == "UNCONNECTED_OUTPUT_WIRE" || node->signalName.rfind("UNCONNECTED_INPUT_WIRE_", 0u) == 0u)
+			else
 			{
-				node->signalName = newGroup.GetHierarchyName() + "/" + node->signalName;
+				node->signalName = stringPool.Intern(signalName);
 			}
 
 			for (size_t input = 0u; input < _mappedNodes[mappedNodeId].inputConnectionIds.size(); ++input)
@@ -3000,6 +3037,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 			}
 
 			// Add the wire name as an alias into the wire name to node mapping
+			const std::string wireName { newGroup.GetHierarchyName() + "/" + wire.name };
 			const size_t min = std::min(top, bottom);
 			for (size_t index = 0u; index < wire.connections.size(); ++index)
 			{
@@ -3009,19 +3047,19 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 					continue;
 				}
 
-				metaData.nameToConnections.emplace(boost::str(boost::format("%s/%s [%d]")
-					% newGroup.GetHierarchyName() % wire.name % (min + index)), connectionMapping[connectionId]);
+				metaData.nameToConnections.emplace(boost::str(boost::format("%s [%d]")
+					% wireName % (min + index)), connectionMapping[connectionId]);
 
 				for (auto [node, port] : metaData.connections[connectionMapping[connectionId]].unmappedSources)
 				{
-					unmappedCircuit._wireNameToNodeId.emplace(boost::str(boost::format("%s/%s [%d]")
-							% newGroup.GetHierarchyName() % wire.name % (min + index)),
+					unmappedCircuit._wireNameToNodeId.emplace(boost::str(boost::format("%s [%d]")
+							% wireName % (min + index)),
 						UnmappedCircuit::NodeIdAndPinIndex { node->tsort, port.portNumber });
 				}
 				for (auto [node, port] : metaData.connections[connectionMapping[connectionId]].mappedSources)
 				{
-					mappedCircuit._wireNameToNodeId.emplace(boost::str(boost::format("%s/%s [%d]")
-							% newGroup.GetHierarchyName() % wire.name % (min + index)), node->tsort);
+					mappedCircuit._wireNameToNodeId.emplace(boost::str(boost::format("%s [%d]")
+							% wireName % (min + index)), node->tsort);
 				}
 			}
 
@@ -3031,11 +3069,10 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 				sourceInfo = _sourceInformation[wire.sourceInfo];
 			}
 
-			newGroup.wires.emplace_back(wire.name, SizeMetaData { top, bottom }, sourceInfo, connections, &newGroup);
+			newGroup.wires.emplace_back(stringPool.Intern(wire.name), SizeMetaData { top, bottom }, sourceInfo, connections, &newGroup);
 			newGroup.nameToWires.emplace(wire.name, newGroup.wires.size() - 1u);
 			metaData.allWires.push_back(&newGroup.wires.back());
-			metaData.nameToWires.emplace(boost::str(boost::format("%s/%s")
-				% newGroup.GetHierarchyName() % wire.name), metaData.allWires.size() - 1u);
+			metaData.nameToWires.emplace(wireName, metaData.allWires.size() - 1u);
 		}
 
 		// Propagate the port information
@@ -3060,6 +3097,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 			}
 
 			// Add the port name as an alias into the wire name to node mapping
+			const std::string portName { newGroup.GetHierarchyName() + "/" + port.name };
 			const size_t min = std::min(top, bottom);
 			for (size_t index = 0u; index < port.connections.size(); ++index)
 			{
@@ -3069,14 +3107,14 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 					continue;
 				}
 
-				metaData.nameToConnections.emplace(boost::str(boost::format("%s/%s [%d]")
-					% newGroup.GetHierarchyName() % port.name % (min + index)), connectionMapping[connectionId]);
+				metaData.nameToConnections.emplace(boost::str(boost::format("%s [%d]")
+					% portName % (min + index)), connectionMapping[connectionId]);
 
 				auto& unmappedSources = metaData.connections[connectionMapping[connectionId]].GetUnmappedSources();
 				for (auto& [sourceNode, sourcePort] : unmappedSources)
 				{
 					unmappedCircuit._wireNameToNodeId.emplace(
-						boost::str(boost::format("%s/%s [%d]") % newGroup.GetHierarchyName() % port.name % (min + index)),
+						boost::str(boost::format("%s [%d]") % portName % (min + index)),
 						UnmappedCircuit::NodeIdAndPinIndex { sourceNode->tsort, sourcePort.portNumber });
 				}
 
@@ -3084,7 +3122,7 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 				for (auto& [sourceNode, sourcePort] : mappedSources)
 				{
 					mappedCircuit._wireNameToNodeId.emplace(
-						boost::str(boost::format("%s/%s [%d]") % newGroup.GetHierarchyName() % port.name % (min + index)),
+						boost::str(boost::format("%s [%d]") % portName % (min + index)),
 						sourceNode->tsort);
 				}
 			}
@@ -3094,11 +3132,10 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 			{
 				sourceInfo = _sourceInformation[port.sourceInfo];
 			}
-			newGroup.ports.emplace_back(port.name, SizeMetaData { top, bottom }, sourceInfo, connections, &newGroup);
+			newGroup.ports.emplace_back(stringPool.Intern(port.name), SizeMetaData { top, bottom }, sourceInfo, connections, &newGroup);
 			newGroup.nameToPorts.emplace(port.name, newGroup.ports.size() - 1u);
 			metaData.allPorts.push_back(&newGroup.ports.back());
-			metaData.nameToPorts.emplace(boost::str(boost::format("%s/%s")
-				% newGroup.GetHierarchyName() % port.name), metaData.allPorts.size() - 1u);
+			metaData.nameToPorts.emplace(portName, metaData.allPorts.size() - 1u);
 
 			switch (port.type)
 			{
@@ -3116,18 +3153,37 @@ std::unique_ptr<CircuitEnvironment> CircuitBuilder::BuildCircuitEnvironment(cons
 		}
 	}
 
+	// Nodes without a group have not been named yet
+	for (UnmappedNodeId unmappedNodeId = 0u; unmappedNodeId < _unmappedNodes.size(); ++unmappedNodeId)
+	{
+		if (const auto tsort = unmappedTopologicalSort[unmappedNodeId];
+			!IsDeletedUnmappedNode(unmappedNodeId) && metaData.unmappedNodeGroups[tsort] == nullptr)
+		{
+			unmappedCircuit._nodeContainer[tsort].name = stringPool.Intern(_unmappedNodes[unmappedNodeId].name);
+		}
+	}
+	for (MappedNodeId mappedNodeId = 0u; mappedNodeId < _mappedNodes.size(); ++mappedNodeId)
+	{
+		if (const auto tsort = mappedTopologicalSort[mappedNodeId];
+			!IsDeletedMappedNode(mappedNodeId) && metaData.mappedNodeGroups[tsort] == nullptr)
+		{
+			mappedCircuit._nodeContainer[tsort].name = stringPool.Intern(_mappedNodes[mappedNodeId].name);
+			mappedCircuit._nodeContainer[tsort].signalName = stringPool.Intern(_mappedNodes[mappedNodeId].outputConnectionName);
+		}
+	}
+
 	for (size_t unmappedNodeId = 0; unmappedNodeId < unmappedCircuit._nodeContainer.size(); unmappedNodeId++)
 	{
 		// Associate the node name with the node id
-		unmappedCircuit._nodeNameToNodeId.insert(unmappedCircuit._nodeContainer[unmappedNodeId].name, unmappedNodeId);
+		unmappedCircuit._nodeNameToNodeId.insert(unmappedCircuit._nodeContainer[unmappedNodeId].name.Get(), unmappedNodeId);
 	}
 
 	for (size_t mappedNodeId = 0; mappedNodeId < mappedCircuit._nodeContainer.size(); mappedNodeId++)
 	{
 		// Associate the node name with the node id
-		mappedCircuit._nodeNameToNodeId.insert(mappedCircuit._nodeContainer[mappedNodeId].name, mappedNodeId);
+		mappedCircuit._nodeNameToNodeId.insert(mappedCircuit._nodeContainer[mappedNodeId].name.Get(), mappedNodeId);
 		// Associate the wire name with the node id
-		mappedCircuit._wireNameToNodeId.insert(mappedCircuit._nodeContainer[mappedNodeId].signalName, mappedNodeId);
+		mappedCircuit._wireNameToNodeId.insert(mappedCircuit._nodeContainer[mappedNodeId].signalName.Get(), mappedNodeId);
 	}
 
 	// Apply the connection IDs to the unmapped node information
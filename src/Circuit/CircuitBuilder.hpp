@@ -1,6 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <iostream>
 #include <limits>
+#include <string>
+#include <string_view>
 #include <vector>
 #include <map>
 
@@ -415,6 +419,33 @@ public:
 
 	std::unique_ptr<CircuitEnvironment> BuildCircuitEnvironment(const BuildConfiguration& configuration);
 
+	/**
+	 * @brief Writes the state of the builder into a versioned binary snapshot.
+	 *
+	 * The snapshot has to be taken before BuildCircuitEnvironment is called.
+	 * It allows to restore the builder without parsing and instantiating the circuit sources again.
+	 * The source key identifies the sources the builder was created from.
+	 *
+	 * @return false if the builder contains data that can't be stored in a snapshot.
+	 */
+	bool ExportSnapshot(std::ostream& output, const std::string& sourceKey) const;
+
+	/**
+	 * @brief Restores the state of an empty builder from a snapshot in memory.
+	 *
+	 * The data is not required after the import and can be a memory-mapped file.
+	 * An empty source key accepts snapshots of any sources.
+	 *
+	 * @return false if the snapshot is corrupt, has a different version or source key.
+	 */
+	bool ImportSnapshot(const char* data, size_t size, const std::string& sourceKey);
+	/**
+	 * @brief Restores the state of an empty builder from a snapshot in memory.
+	 *
+	 * The snapshot is only used if the function accepts its source key.
+	 */
+	bool ImportSnapshot(const char* data, size_t size, const std::function<bool(std::string_view)>& isValidSourceKey);
+
 private:
 	void LinkMappedToUnmappedPin(MappedNodeId mappedNode, UnmappedNodeId unmappedNode, MappedPinId mappedPin, UnmappedPinId unmappedPin);
 
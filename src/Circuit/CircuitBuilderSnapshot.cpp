@@ -0,0 +1,604 @@
+#include "Circuit/CircuitBuilder.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+
+namespace FreiTest
+{
+namespace Circuit
+{
+namespace Builder
+{
+
+// ----------------------------------------------------------------------------
+// Snapshot format
+// ----------------------------------------------------------------------------
+//
+// Header:       magic, version, byte order marker, string count, payload words
+// String table: one length word per string followed by the concatenated
+//               characters of all strings (padded to a multiple of 8 bytes)
+// Payload:      sequence of 64-bit words, strings are stored as index into the
+//               string table and all lists are prefixed with their size
+//
+// All words are stored in the byte order of the host.
+// Increment the version when the state of the builder or the encoding of
+// the cell categories / types changes.
+
+static constexpr char SNAPSHOT_MAGIC[8] { 'F', 'T', 'C', 'I', 'R', 'C', 'S', 'N' };
+static constexpr uint64_t SNAPSHOT_VERSION { 1u };
+static constexpr uint64_t SNAPSHOT_BYTE_ORDER { 0x0102030405060708u };
+
+enum class SnapshotPropertyType: uint64_t
+{
+	Bool,
+	Size,
+	String,
+	SizeVector
+};
+
+namespace
+{
+
+class SnapshotWriter
+{
+public:
+	void Write(uint64_t value)
+	{
+		_payload.push_back(value);
+	}
+
+	void WriteString(const std::string& value)
+	{
+		auto [it, inserted] = _stringIds.try_emplace(value, _strings.size());
+		if (inserted)
+		{
+			_strings.push_back(&it->first);
+		}
+		Write(it->second);
+	}
+
+	template<typename Container>
+	void WriteIds(const Container& values)
+	{
+		Write(values.size());
+		for (const auto& value : values)
+		{
+			Write(static_cast<uint64_t>(value));
+		}
+	}
+
+	void WriteStrings(const std::vector<std::string>& values)
+	{
+		Write(values.size());
+		for (const auto& value : values)
+		{
+			WriteString(value);
+		}
+	}
+
+	void Export(std::ostream& output) const
+	{
+		const uint64_t header[4] { SNAPSHOT_VERSION, SNAPSHOT_BYTE_ORDER, _strings.size(), _payload.size() };
+		output.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+		output.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+		size_t stringBytes { 0u };
+		for (const auto* string : _strings)
+		{
+			const uint64_t length { string->size() };
+			output.write(reinterpret_cast<const char*>(&length), sizeof(length));
+			stringBytes += length;
+		}
+		for (const auto* string : _strings)
+		{
+			output.write(string->data(), string->size());
+		}
+
+		const char padding[8] { };
+		output.write(padding, (8u - (stringBytes % 8u)) % 8u);
+		output.write(reinterpret_cast<const char*>(_payload.data()), _payload.size() * sizeof(uint64_t));
+	}
+
+private:
+	std::unordered_map<std::string, uint64_t> _stringIds;
+	std::vector<const std::string*> _strings;
+	std::vector<uint64_t> _payload;
+};
+
+class SnapshotReader
+{
+public:
+	SnapshotReader(const char* data, size_t size):
+		_valid(false),
+		_payload(nullptr),
+		_payloadWords(0u),
+		_position(0u)
+	{
+		uint64_t header[4];
+		if (size < sizeof(SNAPSHOT_MAGIC) + sizeof(header)
+			|| std::memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+		{
+			LOG(WARNING) << "The circuit snapshot has an invalid header";
+			return;
+		}
+
+		std::memcpy(header, data + sizeof(SNAPSHOT_MAGIC), sizeof(header));
+		const auto [version, byteOrder, stringCount, payloadWords] = header;
+		if (version != SNAPSHOT_VERSION || byteOrder != SNAPSHOT_BYTE_ORDER)
+		{
+			LOG(WARNING) << "The circuit snapshot has an incompatible version or byte order";
+			return;
+		}
+
+		size_t offset { sizeof(SNAPSHOT_MAGIC) + sizeof(header) };
+		if (stringCount > (size - offset) / sizeof(uint64_t))
+		{
+			LOG(WARNING) << "The circuit snapshot is truncated";
+			return;
+		}
+
+		// The string table only holds views of the characters in the snapshot memory.
+		// The strings are copied into the builder when they are read.
+		const char* lengths { data + offset };
+		offset += stringCount * sizeof(uint64_t);
+		_strings.reserve(stringCount);
+		for (size_t index { 0u }; index < stringCount; ++index)
+		{
+			uint64_t length;
+			std::memcpy(&length, lengths + index * sizeof(uint64_t), sizeof(length));
+			if (length > size - offset)
+			{
+				LOG(WARNING) << "The circuit snapshot is truncated";
+				return;
+			}
+			_strings.emplace_back(data + offset, length);
+			offset += length;
+		}
+
+		offset += (8u - (offset % 8u)) % 8u;
+		if (offset > size || payloadWords != (size - offset) / sizeof(uint64_t))
+		{
+			LOG(WARNING) << "The circuit snapshot is truncated";
+			return;
+		}
+
+		_payload = data + offset;
+		_payloadWords = payloadWords;
+		_valid = true;
+	}
+
+	bool IsValid(void) const
+	{
+		return _valid;
+	}
+
+	bool IsAtEnd(void) const
+	{
+		return _position == _payloadWords;
+	}
+
+	uint64_t Read(void)
+	{
+		if (_position >= _payloadWords)
+		{
+			_valid = false;
+			return 0u;
+		}
+
+		uint64_t value;
+		std::memcpy(&value, _payload + (_position++) * sizeof(uint64_t), sizeof(value));
+		return value;
+	}
+
+	// Sizes are checked against the remaining payload to never allocate
+	// huge amounts of memory for a corrupt snapshot.
+	size_t ReadSize(void)
+	{
+		const uint64_t size { Read() };
+		if (size > _payloadWords - _position)
+		{
+			_valid = false;
+			_position = _payloadWords;
+			return 0u;
+		}
+		return size;
+	}
+
+	std::string_view ReadStringView(void)
+	{
+		const uint64_t index { Read() };
+		if (index >= _strings.size())
+		{
+			_valid = false;
+			return { };
+		}
+		return _strings[index];
+	}
+
+	std::string ReadString(void)
+	{
+		return std::string { ReadStringView() };
+	}
+
+	template<typename T>
+	std::vector<T> ReadIds(void)
+	{
+		std::vector<T> values(ReadSize());
+		for (auto& value : values)
+		{
+			value = static_cast<T>(Read());
+		}
+		return values;
+	}
+
+	// Node ids are checked against the number of nodes, as they are used
+	// without further checks to index the nodes when the circuit is built.
+	// Unconnected ports are marked with the maximum id and are accepted.
+	uint64_t ReadNodeId(size_t numberOfNodes)
+	{
+		const uint64_t value { Read() };
+		if (value >= numberOfNodes && value != std::numeric_limits<uint64_t>::max())
+		{
+			_valid = false;
+		}
+		return value;
+	}
+
+	template<typename T>
+	std::vector<T> ReadNodeIds(size_t numberOfNodes)
+	{
+		std::vector<T> values(ReadSize());
+		for (auto& value : values)
+		{
+			value = static_cast<T>(ReadNodeId(numberOfNodes));
+		}
+		return values;
+	}
+
+	std::vector<std::string> ReadStrings(void)
+	{
+		std::vector<std::string> values(ReadSize());
+		for (auto& value : values)
+		{
+			value = ReadString();
+		}
+		return values;
+	}
+
+private:
+	bool _valid;
+	std::vector<std::string_view> _strings;
+	const char* _payload;
+	size_t _payloadWords;
+	size_t _position;
+};
+
+};
+
+// ----------------------------------------------------------------------------
+// CircuitBuilder
+// ----------------------------------------------------------------------------
+
+bool CircuitBuilder::ExportSnapshot(std::ostream& output, const std::string& sourceKey) const
+{
+	SnapshotWriter writer;
+	writer.WriteString(sourceKey);
+	writer.WriteString(_name);
+
+	writer.Write(_unmappedNodes.size());
+	for (size_t nodeId { 0u }; nodeId < _unmappedNodes.size(); ++nodeId)
+	{
+		const UnmappedNode& node { _unmappedNodes[nodeId] };
+		writer.Write(_deletedUnmappedNodes[nodeId] ? 1u : 0u);
+		writer.WriteString(node.name);
+		writer.WriteString(node.type);
+		writer.Write(node.group);
+		writer.WriteIds(node.inputs);
+		writer.Write(node.outputs.size());
+		for (const auto& successors : node.outputs)
+		{
+			writer.WriteIds(successors);
+		}
+		writer.WriteStrings(node.inputPortNames);
+		writer.WriteStrings(node.outputPortNames);
+		writer.WriteIds(node.inputConnectionIds);
+		writer.WriteIds(node.outputConnectionIds);
+		writer.WriteStrings(node.inputConnectionNames);
+		writer.WriteStrings(node.outputConnectionNames);
+	}
+
+	writer.Write(_mappedNodes.size());
+	for (size_t nodeId { 0u }; nodeId < _mappedNodes.size(); ++nodeId)
+	{
+		const MappedNode& node { _mappedNodes[nodeId] };
+		writer.Write(_deletedMappedNodes[nodeId] ? 1u : 0u);
+		writer.WriteString(node.name);
+		writer.Write(static_cast<uint64_t>(node.cellCategory));
+		writer.Write(static_cast<uint64_t>(node.cellType));
+		writer.WriteIds(node.inputs);
+		writer.WriteIds(node.successors);
+		writer.Write(node.group);
+		writer.WriteStrings(node.inputPortNames);
+		writer.WriteString(node.outputPortName);
+		writer.WriteIds(node.inputConnectionIds);
+		writer.WriteStrings(node.inputConnectionNames);
+		writer.Write(node.outputConnectionId);
+		writer.WriteString(node.outputConnectionName);
+	}
+
+	writer.Write(_mappedToUnmappedNodes.size());
+	for (auto const& [mappedNode, unmappedNode] : _mappedToUnmappedNodes)
+	{
+		writer.Write(mappedNode);
+		writer.Write(unmappedNode);
+	}
+	writer.Write(_mappedToUnmappedPins.size());
+	for (auto const& [mappedPin, unmappedPin] : _mappedToUnmappedPins)
+	{
+		writer.Write(mappedPin.first);
+		writer.Write(static_cast<uint64_t>(mappedPin.second));
+		writer.Write(unmappedPin.first);
+		writer.Write(static_cast<uint64_t>(unmappedPin.second));
+	}
+
+	writer.WriteIds(_unmappedPrimaryInputs);
+	writer.WriteIds(_unmappedPrimaryOutputs);
+	writer.WriteIds(_mappedPrimaryInputs);
+	writer.WriteIds(_mappedPrimaryOutputs);
+	writer.WriteIds(_mappedSecondaryInputs);
+	writer.WriteIds(_mappedSecondaryOutputs);
+	writer.Write(_secondaryInputToOutput.size());
+	for (auto const& [input, output] : _secondaryInputToOutput)
+	{
+		writer.Write(input);
+		writer.Write(output);
+	}
+
+	writer.Write(_sourceInformation.size());
+	for (const SourceInformation& sourceInfo : _sourceInformation)
+	{
+		writer.WriteString(sourceInfo.sourceFile);
+		writer.WriteString(sourceInfo.sourceLocation);
+		writer.WriteString(sourceInfo.sourceName);
+		writer.WriteString(sourceInfo.sourceType);
+		writer.Write(sourceInfo.properties.size());
+		for (auto const& [key, value] : sourceInfo.properties)
+		{
+			writer.WriteString(key);
+			if (auto boolValue = std::any_cast<bool>(&value); boolValue != nullptr)
+			{
+				writer.Write(static_cast<uint64_t>(SnapshotPropertyType::Bool));
+				writer.Write(*boolValue ? 1u : 0u);
+			}
+			else if (auto sizeValue = std::any_cast<size_t>(&value); sizeValue != nullptr)
+			{
+				writer.Write(static_cast<uint64_t>(SnapshotPropertyType::Size));
+				writer.Write(*sizeValue);
+			}
+			else if (auto stringValue = std::any_cast<std::string>(&value); stringValue != nullptr)
+			{
+				writer.Write(static_cast<uint64_t>(SnapshotPropertyType::String));
+				writer.WriteString(*stringValue);
+			}
+			else if (auto vectorValue = std::any_cast<std::vector<size_t>>(&value); vectorValue != nullptr)
+			{
+				writer.Write(static_cast<uint64_t>(SnapshotPropertyType::SizeVector));
+				writer.WriteIds(*vectorValue);
+			}
+			else
+			{
+				LOG(ERROR) << "The source property " << key << " has a type that can't be stored in a circuit snapshot";
+				return false;
+			}
+		}
+	}
+
+	writer.Write(_groups.size());
+	for (const Group& group : _groups)
+	{
+		writer.WriteString(group.name);
+		writer.Write(group.sourceInfo);
+		writer.Write(group.parent);
+		writer.WriteIds(group.groupIds);
+		writer.Write(group.ports.size());
+		for (const Port& port : group.ports)
+		{
+			writer.WriteString(port.name);
+			writer.Write(port.size.first);
+			writer.Write(port.size.second);
+			writer.Write(static_cast<uint64_t>(port.type));
+			writer.Write(port.sourceInfo);
+			writer.WriteIds(port.connections);
+		}
+		writer.Write(group.wires.size());
+		for (const Wire& wire : group.wires)
+		{
+			writer.WriteString(wire.name);
+			writer.Write(wire.size.first);
+			writer.Write(wire.size.second);
+			writer.Write(wire.sourceInfo);
+			writer.WriteIds(wire.connections);
+		}
+		writer.WriteIds(group.unmappedNodeIds);
+		writer.WriteIds(group.mappedNodeIds);
+	}
+
+	writer.Write(_connections.size());
+
+	writer.Export(output);
+	return static_cast<bool>(output);
+}
+
+bool CircuitBuilder::ImportSnapshot(const char* data, size_t size, const std::string& sourceKey)
+{
+	return ImportSnapshot(data, size, [&sourceKey](std::string_view snapshotKey) {
+		return sourceKey.empty() || snapshotKey == sourceKey;
+	});
+}
+
+bool CircuitBuilder::ImportSnapshot(const char* data, size_t size, const std::function<bool(std::string_view)>& isValidSourceKey)
+{
+	SnapshotReader reader { data, size };
+	if (!reader.IsValid())
+	{
+		return false;
+	}
+
+	if (const auto snapshotKey = reader.ReadStringView(); !reader.IsValid() || !isValidSourceKey(snapshotKey))
+	{
+		LOG(INFO) << "The circuit snapshot was created from different sources";
+		return false;
+	}
+	_name = reader.ReadString();
+
+	_unmappedNodes.resize(reader.ReadSize());
+	_deletedUnmappedNodes.resize(_unmappedNodes.size());
+	for (size_t nodeId { 0u }; nodeId < _unmappedNodes.size(); ++nodeId)
+	{
+		UnmappedNode& node { _unmappedNodes[nodeId] };
+		_deletedUnmappedNodes[nodeId] = (reader.Read() != 0u);
+		node.name = reader.ReadString();
+		node.type = reader.ReadString();
+		node.group = reader.Read();
+		node.inputs = reader.ReadNodeIds<UnmappedNodeId>(_unmappedNodes.size());
+		node.outputs.resize(reader.ReadSize());
+		for (auto& successors : node.outputs)
+		{
+			successors = reader.ReadNodeIds<UnmappedNodeId>(_unmappedNodes.size());
+		}
+		node.inputPortNames = reader.ReadStrings();
+		node.outputPortNames = reader.ReadStrings();
+		node.inputConnectionIds = reader.ReadIds<ConnectionId>();
+		node.outputConnectionIds = reader.ReadIds<ConnectionId>();
+		node.inputConnectionNames = reader.ReadStrings();
+		node.outputConnectionNames = reader.ReadStrings();
+	}
+
+	_mappedNodes.resize(reader.ReadSize());
+	_deletedMappedNodes.resize(_mappedNodes.size());
+	for (size_t nodeId { 0u }; nodeId < _mappedNodes.size(); ++nodeId)
+	{
+		MappedNode& node { _mappedNodes[nodeId] };
+		_deletedMappedNodes[nodeId] = (reader.Read() != 0u);
+		node.name = reader.ReadString();
+		node.cellCategory = static_cast<CellCategory>(reader.Read());
+		node.cellType = static_cast<CellType>(reader.Read());
+		node.inputs = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+		node.successors = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+		node.group = reader.Read();
+		node.inputPortNames = reader.ReadStrings();
+		node.outputPortName = reader.ReadString();
+		node.inputConnectionIds = reader.ReadIds<size_t>();
+		node.inputConnectionNames = reader.ReadStrings();
+		node.outputConnectionId = reader.Read();
+		node.outputConnectionName = reader.ReadString();
+	}
+
+	for (size_t index { 0u }, size { reader.ReadSize() }; index < size; ++index)
+	{
+		const MappedNodeId mappedNode { reader.ReadNodeId(_mappedNodes.size()) };
+		_mappedToUnmappedNodes.insert_or_assign(mappedNode, reader.ReadNodeId(_unmappedNodes.size()));
+	}
+	for (size_t index { 0u }, size { reader.ReadSize() }; index < size; ++index)
+	{
+		const MappedNodeId mappedNode { reader.ReadNodeId(_mappedNodes.size()) };
+		const MappedPinId mappedPin { static_cast<MappedPinId>(reader.Read()) };
+		const UnmappedNodeId unmappedNode { reader.ReadNodeId(_unmappedNodes.size()) };
+		const UnmappedPinId unmappedPin { static_cast<UnmappedPinId>(reader.Read()) };
+		LinkMappedToUnmappedPin(mappedNode, unmappedNode, mappedPin, unmappedPin);
+	}
+
+	_unmappedPrimaryInputs = reader.ReadNodeIds<UnmappedNodeId>(_unmappedNodes.size());
+	_unmappedPrimaryOutputs = reader.ReadNodeIds<UnmappedNodeId>(_unmappedNodes.size());
+	_mappedPrimaryInputs = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+	_mappedPrimaryOutputs = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+	_mappedSecondaryInputs = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+	_mappedSecondaryOutputs = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+	for (size_t index { 0u }, size { reader.ReadSize() }; index < size; ++index)
+	{
+		const MappedNodeId input { reader.ReadNodeId(_mappedNodes.size()) };
+		LinkSecondaryPorts(input, reader.ReadNodeId(_mappedNodes.size()));
+	}
+
+	_sourceInformation.resize(reader.ReadSize());
+	for (SourceInformation& sourceInfo : _sourceInformation)
+	{
+		sourceInfo.sourceFile = reader.ReadString();
+		sourceInfo.sourceLocation = reader.ReadString();
+		sourceInfo.sourceName = reader.ReadString();
+		sourceInfo.sourceType = reader.ReadString();
+		for (size_t index { 0u }, size { reader.ReadSize() }; index < size; ++index)
+		{
+			std::string key { reader.ReadString() };
+			switch (static_cast<SnapshotPropertyType>(reader.Read()))
+			{
+			case SnapshotPropertyType::Bool:
+				sourceInfo.AddProperty<bool>(key, reader.Read() != 0u);
+				break;
+			case SnapshotPropertyType::Size:
+				sourceInfo.AddProperty<size_t>(key, reader.Read());
+				break;
+			case SnapshotPropertyType::String:
+				sourceInfo.AddProperty<std::string>(key, reader.ReadString());
+				break;
+			case SnapshotPropertyType::SizeVector:
+				sourceInfo.AddProperty<std::vector<size_t>>(key, reader.ReadIds<size_t>());
+				break;
+			default:
+				LOG(WARNING) << "The circuit snapshot contains an unknown property type";
+				return false;
+			}
+		}
+	}
+
+	_groups.resize(reader.ReadSize());
+	for (Group& group : _groups)
+	{
+		group.name = reader.ReadString();
+		group.sourceInfo = reader.Read();
+		group.parent = reader.Read();
+		group.groupIds = reader.ReadIds<GroupId>();
+		group.ports.resize(reader.ReadSize());
+		for (Port& port : group.ports)
+		{
+			port.name = reader.ReadString();
+			port.size.first = reader.Read();
+			port.size.second = reader.Read();
+			port.type = static_cast<PortType>(reader.Read());
+			port.sourceInfo = reader.Read();
+			port.connections = reader.ReadIds<ConnectionId>();
+		}
+		group.wires.resize(reader.ReadSize());
+		for (Wire& wire : group.wires)
+		{
+			wire.name = reader.ReadString();
+			wire.size.first = reader.Read();
+			wire.size.second = reader.Read();
+			wire.sourceInfo = reader.Read();
+			wire.connections = reader.ReadIds<ConnectionId>();
+		}
+		group.unmappedNodeIds = reader.ReadNodeIds<UnmappedNodeId>(_unmappedNodes.size());
+		group.mappedNodeIds = reader.ReadNodeIds<MappedNodeId>(_mappedNodes.size());
+	}
+
+	// The connections only consist of their number, which is not a list in the payload
+	const uint64_t connections { reader.Read() };
+	if (!reader.IsValid() || !reader.IsAtEnd())
+	{
+		LOG(WARNING) << "The circuit snapshot is corrupt";
+		return false;
+	}
+	_connections.resize(connections);
+	return true;
+}
+
+};
+};
+};
@@ -0,0 +1,202 @@
+#include "Circuit/CircuitDifference.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace FreiTest
+{
+namespace Circuit
+{
+
+CircuitDifference::CircuitDifference(const MappedCircuit& previous, const MappedCircuit& current, size_t timeframes):
+	circuit(current),
+	timeframes(timeframes),
+	changed(current.GetNumberOfNodes(), false),
+	affected(current.GetNumberOfNodes(), false),
+	removedNodes(0u)
+{
+	CompareNodes(previous);
+	PropagateChanges();
+}
+
+CircuitDifference::~CircuitDifference(void) = default;
+
+// Maps the names to the nodes of the circuit.
+// Names that are used by multiple nodes are mapped to nullptr.
+static std::unordered_map<std::string, const MappedNode*> GetNodesByName(const MappedCircuit& circuit)
+{
+	std::unordered_map<std::string, const MappedNode*> nodes;
+	for (auto [nodeId, node] : circuit.EnumerateNodes())
+	{
+		if (auto [it, inserted] = nodes.emplace(node->GetName(), node); !inserted)
+		{
+			it->second = nullptr;
+		}
+	}
+	return nodes;
+}
+
+static const std::string& GetNodeName(const MappedNode* node)
+{
+	static const std::string unconnected { };
+	return (node != nullptr) ? node->GetName() : unconnected;
+}
+
+static bool HasSameStructure(const MappedNode* previous, const MappedNode* current)
+{
+	if (previous->GetCellType() != current->GetCellType()
+		|| previous->GetCellCategory() != current->GetCellCategory()
+		|| previous->GetNumberOfInputs() != current->GetNumberOfInputs()
+		|| previous->GetNumberOfSuccessors() != current->GetNumberOfSuccessors())
+	{
+		return false;
+	}
+
+	for (size_t input { 0u }; input < current->GetNumberOfInputs(); ++input)
+	{
+		if (GetNodeName(previous->GetInput(input)) != GetNodeName(current->GetInput(input)))
+		{
+			return false;
+		}
+	}
+
+	// The order of the successors is not significant
+	auto get_successor_names = [](const MappedNode* node) {
+		std::vector<std::string> names;
+		for (auto successor : node->GetSuccessors())
+		{
+			names.push_back(GetNodeName(successor));
+		}
+		std::sort(names.begin(), names.end());
+		return names;
+	};
+	return get_successor_names(previous) == get_successor_names(current);
+}
+
+void CircuitDifference::CompareNodes(const MappedCircuit& previous)
+{
+	const auto previousNodes { GetNodesByName(previous) };
+	const auto currentNodes { GetNodesByName(circuit) };
+
+	for (auto [nodeId, node] : circuit.EnumerateNodes())
+	{
+		const auto it { previousNodes.find(node->GetName()) };
+		changed[nodeId] = (it == previousNodes.end()) || (it->second == nullptr)
+			|| (currentNodes.at(node->GetName()) == nullptr)
+			|| !HasSameStructure(it->second, node);
+	}
+
+	// The removed nodes have been an input or successor of a current node,
+	// which is therefore already marked as changed.
+	for (auto [name, node] : previousNodes)
+	{
+		removedNodes += (currentNodes.find(name) == currentNodes.end()) ? 1u : 0u;
+	}
+}
+
+void CircuitDifference::PropagateChanges(void)
+{
+	// The node ids are not a topological order if the circuit contains loops.
+	// Therefore, both directions are propagated with a worklist until a fixpoint is reached.
+	std::vector<const MappedNode*> worklist;
+
+	// First, the changed values are propagated forward to the outputs.
+	// With multiple timeframes a different value at a secondary output is loaded
+	// into the secondary input of the next timeframe and propagated again.
+	std::vector<bool> differentValue(changed.size(), false);
+	auto mark_different = [&](const MappedNode* node) {
+		if (!differentValue[node->GetNodeId()])
+		{
+			differentValue[node->GetNodeId()] = true;
+			worklist.push_back(node);
+		}
+	};
+
+	for (auto [nodeId, node] : circuit.EnumerateNodes())
+	{
+		if (changed[nodeId])
+		{
+			mark_different(node);
+		}
+	}
+	while (!worklist.empty())
+	{
+		const MappedNode* node { worklist.back() };
+		worklist.pop_back();
+
+		for (auto successor : node->GetSuccessors())
+		{
+			mark_different(successor);
+		}
+		if (timeframes > 1u && circuit.IsSecondaryOutput(node))
+		{
+			mark_different(circuit.GetSecondaryInputForSecondaryOutput(node));
+		}
+	}
+
+	// Second, all nodes in the fan-in of a node with a different value are affected.
+	// With multiple timeframes a fault effect at a secondary output reaches the
+	// secondary input of the next timeframe, so the fan-in continues at the secondary output.
+	std::fill(affected.begin(), affected.end(), false);
+	auto mark_affected = [&](const MappedNode* node) {
+		if (!affected[node->GetNodeId()])
+		{
+			affected[node->GetNodeId()] = true;
+			worklist.push_back(node);
+		}
+	};
+
+	for (auto [nodeId, node] : circuit.EnumerateNodes())
+	{
+		if (differentValue[nodeId])
+		{
+			mark_affected(node);
+		}
+	}
+	while (!worklist.empty())
+	{
+		const MappedNode* node { worklist.back() };
+		worklist.pop_back();
+
+		for (auto input : node->GetInputs())
+		{
+			if (input != nullptr)
+			{
+				mark_affected(input);
+			}
+		}
+		if (timeframes > 1u && circuit.IsSecondaryInput(node))
+		{
+			mark_affected(circuit.GetSecondaryOutputForSecondaryInput(node));
+		}
+	}
+}
+
+bool CircuitDifference::IsChanged(const MappedNode* node) const
+{
+	return changed[node->GetNodeId()];
+}
+
+bool CircuitDifference::IsAffected(const MappedNode* node) const
+{
+	return affected[node->GetNodeId()];
+}
+
+size_t CircuitDifference::GetNumberOfChangedNodes(void) const
+{
+	return std::count(changed.begin(), changed.end(), true);
+}
+
+size_t CircuitDifference::GetNumberOfRemovedNodes(void) const
+{
+	return removedNodes;
+}
+
+size_t CircuitDifference::GetNumberOfAffectedNodes(void) const
+{
+	return std::count(affected.begin(), affected.end(), true);
+}
+
+};
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Circuit/MappedCircuit.hpp"
+
+namespace FreiTest
+{
+namespace Circuit
+{
+
+/**
+ * @brief Structural difference between two versions of a mapped circuit (e.g. after an engineering change order).
+ *
+ * The nodes of both circuits are matched by their name. A node of the current circuit
+ * is changed if it has no unique counterpart in the previous circuit or if the cell type,
+ * the names of the input nodes or the names of the successor nodes differ.
+ *
+ * The values of the changed nodes and their transitive fanout can differ between
+ * both circuits. A node is affected if its transitive fanout contains such a node.
+ * Faults at unaffected nodes have the same fault-free and faulty responses in both circuits.
+ *
+ * For full-scan test patterns with a single timeframe the secondary inputs and outputs
+ * cut the fanout and fan-in cones. Patterns with multiple timeframes (e.g. launch-on-capture
+ * for transition delay faults) load the secondary outputs of one timeframe into the secondary
+ * inputs of the next. Both cones are then continued through the flip-flops until no further
+ * node is added.
+ */
+class CircuitDifference
+{
+public:
+	CircuitDifference(const MappedCircuit& previous, const MappedCircuit& current, size_t timeframes = 1u);
+	virtual ~CircuitDifference(void);
+
+	bool IsChanged(const MappedNode* node) const;
+	bool IsAffected(const MappedNode* node) const;
+
+	size_t GetNumberOfChangedNodes(void) const;
+	size_t GetNumberOfRemovedNodes(void) const;
+	size_t GetNumberOfAffectedNodes(void) const;
+
+private:
+	void CompareNodes(const MappedCircuit& previous);
+	void PropagateChanges(void);
+
+	const MappedCircuit& circuit;
+	size_t timeframes;
+	std::vector<bool> changed;
+	std::vector<bool> affected;
+	size_t removedNodes;
+
+};
+
+};
+};
@@ -10,6 +10,7 @@ namespace Circuit
 {
 
 CircuitEnvironment::CircuitEnvironment(void):
+	_stringPool(),
 	_mappedToUnmappedPSorts(),
 	_unmappedToMappedPSorts(),
 	_unmappedToMappedTSorts(),
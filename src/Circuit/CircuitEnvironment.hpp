@@ -5,6 +5,7 @@
 #include <vector>
 #include <limits>
 
+#include "Basic/Container/StringPool.hpp"
 #include "Circuit/MappedCircuit.hpp"
 #include "Circuit/UnmappedCircuit.hpp"
 #include "Circuit/CircuitMetaData.hpp"
@@ -53,6 +54,10 @@ public:
 	friend Builder::CircuitBuilder;
 
 private:
+	// Stores the names of the nodes, pins and metadata.
+	// Declared first as it has to outlive all of them.
+	Basic::Container::StringPool _stringPool;
+
 	std::vector<size_t> _mappedToUnmappedPSorts;
 	std::vector<std::vector<size_t>> _unmappedToMappedPSorts;
 
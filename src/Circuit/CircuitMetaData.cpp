@@ -115,7 +115,7 @@ std::vector<size_t> SizeMetaData::GetIndicesMaxToMin(void) const
 	return result;
 }
 
-WireMetaData::WireMetaData(std::string name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group):
+WireMetaData::WireMetaData(Basic::Container::InternedString name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group):
 	name(name),
 	size(size),
 	sourceInfo(sourceInfo),
@@ -128,7 +128,7 @@ WireMetaData::~WireMetaData(void) = default;
 
 const std::string& WireMetaData::GetName(void) const
 {
-	return name;
+	return name.Get();
 }
 
 const SizeMetaData& WireMetaData::GetSize(void) const
@@ -161,7 +161,7 @@ const GroupMetaData* WireMetaData::GetGroup(void) const
 	return group;
 }
 
-PortMetaData::PortMetaData(std::string name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group):
+PortMetaData::PortMetaData(Basic::Container::InternedString name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group):
 	name(name),
 	size(size),
 	sourceInfo(sourceInfo),
@@ -174,7 +174,7 @@ PortMetaData::~PortMetaData(void) = default;
 
 const std::string& PortMetaData::GetName(void) const
 {
-	return name;
+	return name.Get();
 }
 
 const SizeMetaData& PortMetaData::GetSize(void) const
@@ -207,8 +207,9 @@ const GroupMetaData* PortMetaData::GetGroup(void) const
 	return group;
 }
 
-GroupMetaData::GroupMetaData(std::string name):
+GroupMetaData::GroupMetaData(Basic::Container::InternedString name):
 	name(name),
+	hierarchyName(name),
 	sourceInfo(),
 	parent(nullptr),
 	subGroups(),
@@ -223,17 +224,12 @@ GroupMetaData::~GroupMetaData(void) = default;
 
 const std::string& GroupMetaData::GetName(void) const
 {
-	return name;
+	return name.Get();
 }
 
-std::string GroupMetaData::GetHierarchyName(void) const
+const std::string& GroupMetaData::GetHierarchyName(void) const
 {
-	if (parent != nullptr)
-	{
-		return parent->GetHierarchyName() + "/" + name;
-	}
-
-	return name;
+	return hierarchyName.Get();
 }
 
 const SourceInformation& GroupMetaData::GetSourceInfo(void) const
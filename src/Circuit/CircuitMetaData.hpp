@@ -6,6 +6,7 @@
 #include <tuple>
 #include <vector>
 
+#include "Basic/Container/StringPool.hpp"
 #include "Circuit/SourceInformation.hpp"
 #include "Circuit/MappedCircuit.hpp"
 #include "Circuit/UnmappedCircuit.hpp"
@@ -83,7 +84,7 @@ class WireMetaData
 {
 public:
 
-	WireMetaData(std::string name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group);
+	WireMetaData(Basic::Container::InternedString name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group);
 	virtual ~WireMetaData(void);
 
 	const std::string& GetName(void) const;
@@ -95,7 +96,7 @@ public:
 	const GroupMetaData* GetGroup(void) const;
 
 private:
-	std::string name;
+	Basic::Container::InternedString name;
 	SizeMetaData size;
 	SourceInformation sourceInfo;
 	std::vector<const ConnectionMetaData*> connections;
@@ -106,7 +107,7 @@ private:
 class PortMetaData
 {
 public:
-	PortMetaData(std::string name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group);
+	PortMetaData(Basic::Container::InternedString name, SizeMetaData size, SourceInformation sourceInfo, std::vector<const ConnectionMetaData*> connections, const GroupMetaData* group);
 	virtual ~PortMetaData(void);
 
 	const std::string& GetName(void) const;
@@ -118,7 +119,7 @@ public:
 	const GroupMetaData* GetGroup(void) const;
 
 private:
-	std::string name;
+	Basic::Container::InternedString name;
 	SizeMetaData size;
 	SourceInformation sourceInfo;
 	std::vector<const ConnectionMetaData*> connections;
@@ -129,11 +130,11 @@ private:
 class GroupMetaData
 {
 public:
-	GroupMetaData(std::string name);
+	GroupMetaData(Basic::Container::InternedString name);
 	virtual ~GroupMetaData(void);
 
 	const std::string& GetName(void) const;
-	std::string GetHierarchyName(void) const;
+	const std::string& GetHierarchyName(void) const;
 	const SourceInformation& GetSourceInfo(void) const;
 	const GroupMetaData* GetParent(void) const;
 	const std::vector<const GroupMetaData*>& GetSubGroups(void) const;
@@ -229,7 +230,8 @@ public:
 	friend Builder::CircuitBuilder;
 
 private:
-	std::string name;
+	Basic::Container::InternedString name;
+	Basic::Container::InternedString hierarchyName;
 	SourceInformation sourceInfo;
 	const GroupMetaData* parent;
 	std::vector<const GroupMetaData*> subGroups;
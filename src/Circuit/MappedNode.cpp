@@ -36,12 +36,12 @@ size_t MappedNode::GetNodeId(void) const
 
 const std::string& MappedNode::GetName(void) const
 {
-	return name;
+	return name.Get();
 }
 
 const std::string& MappedNode::GetOutputSignalName(void) const
 {
-	return signalName;
+	return signalName.Get();
 }
 
 CellType MappedNode::GetCellType(void) const
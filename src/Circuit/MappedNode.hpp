@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <string>
 
+#include "Basic/Container/StringPool.hpp"
 #include "Basic/Iterator/RawIterable.hpp"
 #include "Basic/Iterator/RawEnumerable.hpp"
 #include "Circuit/CellLibrary.hpp"
@@ -105,8 +106,8 @@ private:
 	size_t numberOfIns;
 	size_t numberOfOuts;
 
-	std::string name;
-	std::string signalName;
+	Basic::Container::InternedString name;
+	Basic::Container::InternedString signalName;
 
 };
 
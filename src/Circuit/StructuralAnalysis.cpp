@@ -0,0 +1,230 @@
+#include "Circuit/StructuralAnalysis.hpp"
+
+using namespace FreiTest::Basic;
+
+namespace FreiTest
+{
+namespace Circuit
+{
+
+StructuralAnalysis::StructuralAnalysis(const MappedCircuit& circuit):
+	circuit(circuit),
+	constantValues(circuit.GetNumberOfNodes(), Logic::LOGIC_DONT_CARE),
+	observable(circuit.GetNumberOfNodes(), false)
+{
+	PropagateConstants();
+	PropagateObservability();
+}
+
+StructuralAnalysis::~StructuralAnalysis(void) = default;
+
+void StructuralAnalysis::PropagateConstants(void)
+{
+	auto get_input_value = [&](const MappedNode* input) -> Logic {
+		return (input != nullptr) ? constantValues[input->GetNodeId()] : Logic::LOGIC_DONT_CARE;
+	};
+	auto invert = [](Logic value) -> Logic {
+		switch (value)
+		{
+		case Logic::LOGIC_ZERO: return Logic::LOGIC_ONE;
+		case Logic::LOGIC_ONE: return Logic::LOGIC_ZERO;
+		default: return value;
+		}
+	};
+
+	// A single forward pass over the node ids. The node ids are not guaranteed to be in
+	// topological order in the presence of loops, where an input that has not been visited
+	// yet is still unknown (X). Therefore, the result is only conservative for loops.
+	for (auto [nodeId, node] : circuit.EnumerateNodes())
+	{
+		Logic value { Logic::LOGIC_DONT_CARE };
+		switch (node->GetCellType())
+		{
+		case CellType::PRESET_0:
+			value = Logic::LOGIC_ZERO;
+			break;
+		case CellType::PRESET_1:
+			value = Logic::LOGIC_ONE;
+			break;
+
+		case CellType::BUF:
+		case CellType::INV:
+			value = get_input_value(node->GetInput(0u));
+			value = (node->GetCellType() == CellType::INV) ? invert(value) : value;
+			break;
+
+		case CellType::AND:
+		case CellType::NAND:
+		case CellType::OR:
+		case CellType::NOR:
+		{
+			const bool isAnd { node->GetCellType() == CellType::AND || node->GetCellType() == CellType::NAND };
+			const bool isInverting { node->GetCellType() == CellType::NAND || node->GetCellType() == CellType::NOR };
+			const Logic controlling { isAnd ? Logic::LOGIC_ZERO : Logic::LOGIC_ONE };
+
+			// A single controlling value defines the output,
+			// otherwise all inputs have to be the non-controlling value.
+			bool allNonControlling { node->GetNumberOfInputs() > 0u };
+			value = Logic::LOGIC_DONT_CARE;
+			for (auto input : node->GetInputs())
+			{
+				const Logic inputValue { get_input_value(input) };
+				if (inputValue == controlling)
+				{
+					value = controlling;
+					break;
+				}
+				allNonControlling &= (inputValue == invert(controlling));
+			}
+			if (value == Logic::LOGIC_DONT_CARE && allNonControlling)
+			{
+				value = invert(controlling);
+			}
+			value = isInverting ? invert(value) : value;
+			break;
+		}
+
+		case CellType::XOR:
+		case CellType::XNOR:
+		{
+			bool parity { node->GetCellType() == CellType::XNOR };
+			value = Logic::LOGIC_ZERO;
+			for (auto input : node->GetInputs())
+			{
+				const Logic inputValue { get_input_value(input) };
+				if (inputValue != Logic::LOGIC_ZERO && inputValue != Logic::LOGIC_ONE)
+				{
+					value = Logic::LOGIC_DONT_CARE;
+					break;
+				}
+				parity ^= (inputValue == Logic::LOGIC_ONE);
+			}
+			if (value != Logic::LOGIC_DONT_CARE)
+			{
+				value = parity ? Logic::LOGIC_ONE : Logic::LOGIC_ZERO;
+			}
+			break;
+		}
+
+		default:
+			// Inputs, outputs, tri-state drivers and multiplexers are handled
+			// as unconstrained to keep the analysis conservative.
+			value = Logic::LOGIC_DONT_CARE;
+			break;
+		}
+
+		constantValues[nodeId] = value;
+	}
+}
+
+bool StructuralAnalysis::IsInputBlocked(const MappedNode* node, size_t input) const
+{
+	Logic controlling;
+	switch (node->GetCellType())
+	{
+	case CellType::AND:
+	case CellType::NAND:
+		controlling = Logic::LOGIC_ZERO;
+		break;
+	case CellType::OR:
+	case CellType::NOR:
+		controlling = Logic::LOGIC_ONE;
+		break;
+	default:
+		return false;
+	}
+
+	// The input is blocked if any other input is constant at the controlling value
+	for (auto [inputId, inputNode] : node->EnumerateInputs())
+	{
+		if (inputId != input && inputNode != nullptr
+			&& constantValues[inputNode->GetNodeId()] == controlling)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void StructuralAnalysis::PropagateObservability(void)
+{
+	// The node ids are not a topological order if the circuit contains loops.
+	// Therefore, the observability is propagated with a worklist until a fixpoint
+	// is reached, starting from all primary, bidirectional and secondary outputs.
+	std::vector<const MappedNode*> worklist;
+	auto mark_observable = [&](const MappedNode* node) {
+		if (!observable[node->GetNodeId()])
+		{
+			observable[node->GetNodeId()] = true;
+			worklist.push_back(node);
+		}
+	};
+
+	for (auto node : circuit.GetNodes())
+	{
+		if (node->GetCellCategory() == CellCategory::MAIN_OUT
+			|| node->GetCellCategory() == CellCategory::MAIN_INOUT
+			|| circuit.IsOutput(node))
+		{
+			mark_observable(node);
+		}
+	}
+
+	while (!worklist.empty())
+	{
+		const MappedNode* node { worklist.back() };
+		worklist.pop_back();
+
+		for (auto [inputId, inputNode] : node->EnumerateInputs())
+		{
+			if (inputNode != nullptr && !IsInputBlocked(node, inputId))
+			{
+				mark_observable(inputNode);
+			}
+		}
+	}
+}
+
+Logic StructuralAnalysis::GetConstantValue(const MappedNode* node) const
+{
+	return constantValues[node->GetNodeId()];
+}
+
+bool StructuralAnalysis::IsObservable(const MappedCircuit::NodeAndPort& nodeAndPort) const
+{
+	const auto& [node, port] = nodeAndPort;
+	if (port.portType == PortType::Input)
+	{
+		return observable[node->GetNodeId()] && !IsInputBlocked(node, port.portNumber);
+	}
+
+	return observable[node->GetNodeId()];
+}
+
+bool StructuralAnalysis::IsStuckAtUntestable(const MappedCircuit::NodeAndPort& nodeAndPort, Logic stuckAtValue) const
+{
+	const auto& [node, port] = nodeAndPort;
+	const MappedNode* driver { (port.portType == PortType::Input) ? node->GetInput(port.portNumber) : node };
+	if (driver != nullptr && constantValues[driver->GetNodeId()] == stuckAtValue)
+	{
+		return true;
+	}
+
+	return !IsObservable(nodeAndPort);
+}
+
+bool StructuralAnalysis::IsTransitionUntestable(const MappedCircuit::NodeAndPort& nodeAndPort) const
+{
+	const auto& [node, port] = nodeAndPort;
+	const MappedNode* driver { (port.portType == PortType::Input) ? node->GetInput(port.portNumber) : node };
+	if (driver != nullptr && constantValues[driver->GetNodeId()] != Logic::LOGIC_DONT_CARE)
+	{
+		return true;
+	}
+
+	return !IsObservable(nodeAndPort);
+}
+
+};
+};
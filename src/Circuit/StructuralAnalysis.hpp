@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Circuit/MappedCircuit.hpp"
+
+namespace FreiTest
+{
+namespace Circuit
+{
+
+/**
+ * @brief Cheap structural analysis of a mapped circuit without any solver.
+ *
+ * The analysis propagates the constant values of tie cells (PRESET_0 / PRESET_1)
+ * through the circuit and determines which nodes have a path to a primary,
+ * bidirectional or secondary output that is not blocked by a constant controlling value.
+ *
+ * Primary and secondary inputs are treated as unconstrained and all
+ * primary and secondary outputs as observable. Therefore, the results
+ * are valid for full-scan as well as sequential test generation.
+ */
+class StructuralAnalysis
+{
+public:
+	StructuralAnalysis(const MappedCircuit& circuit);
+	virtual ~StructuralAnalysis(void);
+
+	/**
+	 * @brief Returns the constant value of the node output.
+	 *
+	 * @return LOGIC_ZERO or LOGIC_ONE if the node is constant, LOGIC_DONT_CARE otherwise.
+	 */
+	Basic::Logic GetConstantValue(const MappedNode* node) const;
+
+	/**
+	 * @brief Returns if the value at the node and port can be observed at any output.
+	 */
+	bool IsObservable(const MappedCircuit::NodeAndPort& nodeAndPort) const;
+
+	/**
+	 * @brief Returns if a stuck-at fault with the given value can not be detected.
+	 *
+	 * This is the case if the line is constant at the stuck-at value (no excitation)
+	 * or if the line is not observable (no propagation).
+	 */
+	bool IsStuckAtUntestable(const MappedCircuit::NodeAndPort& nodeAndPort, Basic::Logic stuckAtValue) const;
+
+	/**
+	 * @brief Returns if a transition delay fault can not be detected.
+	 *
+	 * This is the case if the line is constant (no transition) or if the line is not observable.
+	 */
+	bool IsTransitionUntestable(const MappedCircuit::NodeAndPort& nodeAndPort) const;
+
+private:
+	void PropagateConstants(void);
+	void PropagateObservability(void);
+	bool IsInputBlocked(const MappedNode* node, size_t input) const;
+
+	const MappedCircuit& circuit;
+	std::vector<Basic::Logic> constantValues;
+	std::vector<bool> observable;
+
+};
+
+};
+};
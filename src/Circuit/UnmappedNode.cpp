@@ -44,12 +44,12 @@ size_t UnmappedNode::GetNodeId(void) const
 
 const std::string& UnmappedNode::GetName(void) const
 {
-	return name;
+	return name.Get();
 }
 
 const std::string& UnmappedNode::GetType(void) const
 {
-	return typeName;
+	return typeName.Get();
 }
 
 size_t UnmappedNode::GetNumberOfInputs(void) const
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <string>
 
+#include "Basic/Container/StringPool.hpp"
 #include "Basic/Iterator/RawIterable.hpp"
 #include "Basic/Iterator/TwoDRawIterable.hpp"
 #include "Basic/Iterator/RawEnumerable.hpp"
@@ -23,10 +24,10 @@ class UnmappedNode;
 struct UnmappedPinData
 {
 	size_t PinSort;
-	std::string PinName;
+	Basic::Container::InternedString PinName;
 
 	size_t PinWireId;
-	std::string PinWireName;
+	Basic::Container::InternedString PinWireName;
 };
 
 using UnmappedInputList = RawIterable<const UnmappedNode *const, const size_t>;
@@ -123,8 +124,8 @@ private:
 	size_t numberOfIns;
 	size_t* numberOfOuts;  // -> * -> Can have several outputs with different numbers of outs each!
 	size_t numberOfOutputPins;
-	std::string name;
-	std::string typeName;
+	Basic::Container::InternedString name;
+	Basic::Container::InternedString typeName;
 
 };
 
@@ -0,0 +1,111 @@
+#include "Helper/Compression.hpp"
+
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/lzma.hpp>
+#include <boost/iostreams/filter/zstd.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
+#include "Helper/StringHelper.hpp"
+
+using namespace std;
+using namespace FreiTest;
+
+CompressionFormat GetCompressionFormat(const string& filename)
+{
+	if (StringHelper::EndsWith(".gz", filename)) return CompressionFormat::Gzip;
+	if (StringHelper::EndsWith(".zst", filename)) return CompressionFormat::Zstd;
+	if (StringHelper::EndsWith(".bz2", filename)) return CompressionFormat::Bzip2;
+	if (StringHelper::EndsWith(".xz", filename)) return CompressionFormat::Lzma;
+	return CompressionFormat::None;
+}
+
+ParallelCompressor::ParallelCompressor(CompressionFormat format):
+	_format(format),
+	_blocksPerBatch(max<size_t>(Parallel::GetThreads(Parallel::Arena::General), 1u)),
+	_blocks(),
+	_hasWrittenBlocks(false)
+{
+	ASSERT(format == CompressionFormat::Gzip || format == CompressionFormat::Zstd)
+		<< "Only gzip and zstd are supported by the parallel compressor";
+}
+
+void ParallelCompressor::CompressBlocks(void)
+{
+	Parallel::ExecuteParallel(0u, _blocks.size(), Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t index) {
+		string compressed;
+		{
+			boost::iostreams::filtering_ostream output;
+			switch (_format)
+			{
+				case CompressionFormat::Gzip:
+					output.push(boost::iostreams::gzip_compressor());
+					break;
+				case CompressionFormat::Zstd:
+					output.push(boost::iostreams::zstd_compressor());
+					break;
+				default:
+					Logging::Panic();
+			}
+			output.push(boost::iostreams::back_inserter(compressed));
+			output.write(_blocks[index].data(), _blocks[index].size());
+		}
+
+		_blocks[index] = move(compressed);
+	});
+}
+
+template<typename Chain>
+void PushCompressor(Chain& chain, CompressionFormat format)
+{
+	switch (format)
+	{
+		case CompressionFormat::None:
+			break;
+		case CompressionFormat::Gzip:
+		case CompressionFormat::Zstd:
+			chain.push(ParallelCompressor(format));
+			break;
+		case CompressionFormat::Bzip2:
+			chain.push(boost::iostreams::bzip2_compressor());
+			break;
+		case CompressionFormat::Lzma:
+			chain.push(boost::iostreams::lzma_compressor());
+			break;
+		default:
+			Logging::Panic();
+	}
+}
+
+template<typename Chain>
+void PushDecompressor(Chain& chain, CompressionFormat format)
+{
+	switch (format)
+	{
+		case CompressionFormat::None:
+			break;
+		case CompressionFormat::Gzip:
+			chain.push(boost::iostreams::gzip_decompressor());
+			break;
+		case CompressionFormat::Zstd:
+			chain.push(boost::iostreams::zstd_decompressor());
+			break;
+		case CompressionFormat::Bzip2:
+			chain.push(boost::iostreams::bzip2_decompressor());
+			break;
+		case CompressionFormat::Lzma:
+			chain.push(boost::iostreams::lzma_decompressor());
+			break;
+		default:
+			Logging::Panic();
+	}
+}
+
+template void PushCompressor(boost::iostreams::filtering_ostream& chain, CompressionFormat format);
+template void PushCompressor(boost::iostreams::filtering_ostreambuf& chain, CompressionFormat format);
+template void PushDecompressor(boost::iostreams::filtering_istream& chain, CompressionFormat format);
+template void PushDecompressor(boost::iostreams::filtering_istreambuf& chain, CompressionFormat format);
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/operations.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+enum class CompressionFormat
+{
+	None,
+	Gzip,
+	Zstd,
+	Bzip2,
+	Lzma
+};
+
+/**
+ * @brief Returns the compression format that is selected by the file extension.
+ *
+ * The extensions ".gz", ".zst", ".bz2" and ".xz" are recognized.
+ * All other files are not compressed.
+ */
+CompressionFormat GetCompressionFormat(const std::string& filename);
+
+/**
+ * @brief Boost iostreams output filter that compresses gzip or zstd data with multiple threads.
+ *
+ * The data is split into blocks which are compressed independently
+ * as separate gzip members / zstd frames and written in order.
+ * The concatenation of the members is a valid gzip / zstd file which
+ * can be read by all standard decompressors (including the boost ones).
+ */
+class ParallelCompressor
+{
+public:
+	typedef char char_type;
+	struct category:
+		boost::iostreams::multichar_output_filter_tag,
+		boost::iostreams::closable_tag
+	{ };
+
+	ParallelCompressor(CompressionFormat format);
+
+	template<typename Sink>
+	std::streamsize write(Sink& sink, const char* data, std::streamsize size)
+	{
+		std::streamsize written { 0 };
+		while (written < size)
+		{
+			if (_blocks.empty() || _blocks.back().size() == BLOCK_SIZE)
+			{
+				if (_blocks.size() == _blocksPerBatch)
+				{
+					WriteBlocks(sink);
+				}
+
+				_blocks.emplace_back();
+				_blocks.back().reserve(BLOCK_SIZE);
+			}
+
+			auto& block { _blocks.back() };
+			const auto count { std::min<std::streamsize>(size - written, BLOCK_SIZE - block.size()) };
+			block.append(data + written, count);
+			written += count;
+		}
+
+		return written;
+	}
+
+	template<typename Sink>
+	void close(Sink& sink)
+	{
+		// An empty file still has to contain one (empty) member
+		if (_blocks.empty() && !_hasWrittenBlocks)
+		{
+			_blocks.emplace_back();
+		}
+
+		WriteBlocks(sink);
+		_hasWrittenBlocks = false;
+	}
+
+private:
+	static constexpr size_t BLOCK_SIZE { 1u << 20u };
+
+	template<typename Sink>
+	void WriteBlocks(Sink& sink)
+	{
+		CompressBlocks();
+		for (auto const& block : _blocks)
+		{
+			boost::iostreams::write(sink, block.data(), block.size());
+		}
+
+		_blocks.clear();
+		_hasWrittenBlocks = true;
+	}
+
+	void CompressBlocks(void);
+
+	CompressionFormat _format;
+	size_t _blocksPerBatch;
+	std::vector<std::string> _blocks;
+	bool _hasWrittenBlocks;
+
+};
+
+/**
+ * @brief Pushes the compressor for the format to a boost iostreams chain.
+ *
+ * Gzip and zstd are compressed with the ParallelCompressor.
+ */
+template<typename Chain>
+void PushCompressor(Chain& chain, CompressionFormat format);
+
+/**
+ * @brief Pushes the decompressor for the format to a boost iostreams chain.
+ */
+template<typename Chain>
+void PushDecompressor(Chain& chain, CompressionFormat format);
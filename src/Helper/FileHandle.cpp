@@ -1,7 +1,5 @@
 #include "Helper/FileHandle.hpp"
 
-#include <boost/iostreams/chain.hpp>
-
 #include <fstream>
 #include <filesystem>
 
@@ -17,32 +15,42 @@ FileHandle::FileHandle(string rawFilename, bool forReading)
 	ASSERT(rawFilename.size() > 0) << "Got empty file name";
 	_ifstream = nullptr;
 	_ofstream = nullptr;
-	_zipMode = false;
 	_forReading = forReading;
 
 	string mappedFilename = Settings::GetInstance()->MapFileName(rawFilename, forReading);
 	mappedFilename = StringHelper::ReplaceString("/./","/",mappedFilename);
 	_filename = mappedFilename;
-
+	_compression = GetCompressionFormat(mappedFilename);
 
 	if (forReading)
 	{
 
 		_ifstream = new ifstream(mappedFilename, std::ios_base::in | std::ios_base::binary );
 
-		if (StringHelper::EndsWith(".gz", mappedFilename))
+		if (_compression != CompressionFormat::None)
 		{
-			_inFilter.push(_boostZipDecompressor);
+			PushDecompressor(_inFilter, _compression);
 			_inFilter.push(*_ifstream);
-			_zipMode = true;
 		}
 	}
 	else
 	{
-		DASSERT(!StringHelper::EndsWith(".gz", mappedFilename)) << " Writing to gz files is not supported!";
-
 		FileHandle::CreateDirectoryIfNotExisting(mappedFilename);
-		_ofstream = new ofstream(mappedFilename, std::ios_base::out);
+
+		if (_compression != CompressionFormat::None)
+		{
+			_ofstream = new ofstream(mappedFilename, std::ios_base::out | std::ios_base::binary);
+			PushCompressor(_outFilter, _compression);
+			_outFilter.push(*_ofstream);
+			if (!_ofstream->is_open())
+			{
+				_outFilter.setstate(std::ios_base::failbit);
+			}
+		}
+		else
+		{
+			_ofstream = new ofstream(mappedFilename, std::ios_base::out);
+		}
 	}
 
 }
@@ -65,6 +73,10 @@ void FileHandle::CreateDirectoryIfNotExisting(string path)
 
 FileHandle::~FileHandle()
 {
+	// The filters have to be closed before the files to write the remaining compressed data
+	_inFilter.reset();
+	_outFilter.reset();
+
 	if (_ifstream != nullptr)
 	{
 		_ifstream->close();
@@ -92,7 +104,7 @@ string FileHandle::GetCanonicalFilename(string filename)
 std::istream& FileHandle::GetStream()
 {
 	DASSERT(_forReading) << "Stream has not been configured for reading, use GetOutStream instead";
-	if (_zipMode)
+	if (_compression != CompressionFormat::None)
 	{
 		return _inFilter;
 	}
@@ -103,8 +115,15 @@ std::istream& FileHandle::GetStream()
 }
 
 
-ofstream& FileHandle::GetOutStream()
+ostream& FileHandle::GetOutStream()
 {
 	DASSERT(!_forReading) << "Stream has not been configured for writing, use GetStream instead";
-	return *_ofstream;
+	if (_compression != CompressionFormat::None)
+	{
+		return _outFilter;
+	}
+	else
+	{
+		return *_ofstream;
+	}
 }
@@ -1,18 +1,27 @@
 #pragma once
 
-#include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
 #include <iostream>
+#include <fstream>
 #include <string>
 
+#include "Helper/Compression.hpp"
+
+/**
+ * @brief Opens a file for reading or writing.
+ *
+ * The file is compressed / decompressed transparently when the file name
+ * has the extension of a compression format (see GetCompressionFormat).
+ * Gzip and zstd files are compressed with multiple threads.
+ */
 class FileHandle
 {
 public:
 	FileHandle(std::string filename, bool forReading);
 	virtual ~FileHandle();
 	std::istream& GetStream();
-	std::ofstream& GetOutStream();
+	std::ostream& GetOutStream();
 	std::string GetFilename() {return _filename;};
 	std::string GetCanonicalFilename();
 	static std::string GetCanonicalFilename(std::string filename);
@@ -23,8 +32,8 @@ private:
 	std::ifstream* _ifstream;
 	std::ofstream* _ofstream;
 	boost::iostreams::filtering_istream _inFilter;
-	boost::iostreams::gzip_decompressor _boostZipDecompressor;
-	bool _zipMode;
+	boost::iostreams::filtering_ostream _outFilter;
+	CompressionFormat _compression;
 	bool _forReading;
 
 };
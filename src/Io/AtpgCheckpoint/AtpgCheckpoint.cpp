@@ -0,0 +1,373 @@
+#include "Io/AtpgCheckpoint/AtpgCheckpoint.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <system_error>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Helper/FileHandle.hpp"
+
+using namespace FreiTest::Basic;
+
+namespace FreiTest
+{
+namespace Io
+{
+
+// ----------------------------------------------------------------------------
+// Binary checkpoint format
+// ----------------------------------------------------------------------------
+//
+// Header:  magic, version, byte order marker, circuit guard, number of faults, fault list hash
+// Records: tag followed by the record data
+//   Pattern: number of timeframes, primary and secondary inputs,
+//            one character per input value for each timeframe
+//   Faults:  number of faults followed by the index, status, targeted status,
+//            detecting pattern, detecting timeframe and detection count of each fault
+//   Commit:  number of patterns that have been written up to this commit
+//
+// Increment the version when the encoding changes.
+
+static constexpr Binary::Magic CHECKPOINT_MAGIC { '\x89', 'F', 'T', 'C', 'H', 'K', 'P', 'T' };
+static constexpr uint64_t CHECKPOINT_VERSION { 2u };
+
+static constexpr uint64_t RECORD_PATTERN { 1u };
+static constexpr uint64_t RECORD_FAULTS { 2u };
+static constexpr uint64_t RECORD_COMMIT { 3u };
+
+static bool IsValidLogicCode(char code)
+{
+	switch (static_cast<Logic>(code))
+	{
+		case Logic::LOGIC_INVALID:
+		case Logic::LOGIC_UNKNOWN:
+		case Logic::LOGIC_ZERO:
+		case Logic::LOGIC_ONE:
+		case Logic::LOGIC_DONT_CARE:
+			return true;
+		default:
+			return false;
+	}
+}
+
+CheckpointWriter::CheckpointWriter(const Circuit::CircuitEnvironment& circuit, std::string filename, size_t numberOfFaults, uint64_t faultListHash):
+	circuit(circuit),
+	filename(Settings::GetInstance()->MapFileName(filename, false)),
+	numberOfFaults(numberOfFaults),
+	faultListHash(faultListHash),
+	numberOfPatterns(0u),
+	output(),
+	writer()
+{
+}
+
+CheckpointWriter::~CheckpointWriter(void) = default;
+
+bool CheckpointWriter::Create(void)
+{
+	FileHandle::CreateDirectoryIfNotExisting(filename);
+	output.open(filename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+	if (!output.is_open())
+	{
+		LOG(ERROR) << "The checkpoint file " << filename << " could not be created";
+		return false;
+	}
+
+	writer = std::make_unique<Binary::BinaryExchangeWriter>(output);
+	writer->WriteHeader(CHECKPOINT_MAGIC, CHECKPOINT_VERSION);
+	writer->WriteCircuitGuard(circuit);
+	writer->Write(numberOfFaults);
+	writer->Write(faultListHash);
+	numberOfPatterns = 0u;
+	return Commit();
+}
+
+bool CheckpointWriter::Continue(const Checkpoint& checkpoint)
+{
+	// Compressed files can not be appended to. Therefore, the file is written without compression.
+	std::error_code error;
+	std::filesystem::resize_file(filename, checkpoint.committedSize, error);
+	if (error)
+	{
+		LOG(ERROR) << "The checkpoint file " << filename << " could not be truncated: " << error.message();
+		return false;
+	}
+
+	output.open(filename, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+	if (!output.is_open())
+	{
+		LOG(ERROR) << "The checkpoint file " << filename << " could not be opened";
+		return false;
+	}
+
+	writer = std::make_unique<Binary::BinaryExchangeWriter>(output);
+	numberOfPatterns = checkpoint.patterns.size();
+	return true;
+}
+
+void CheckpointWriter::WritePattern(const Pattern::TestPattern& pattern)
+{
+	writer->Write(RECORD_PATTERN);
+	WriteCheckpointPattern(*writer, pattern);
+	numberOfPatterns++;
+}
+
+void CheckpointWriter::WriteFaults(const std::vector<CheckpointFault>& faults)
+{
+	writer->Write(RECORD_FAULTS);
+	writer->Write(faults.size());
+	for (const auto& fault : faults)
+	{
+		WriteCheckpointFault(*writer, fault);
+	}
+}
+
+bool CheckpointWriter::Commit(void)
+{
+	writer->Write(RECORD_COMMIT);
+	writer->Write(numberOfPatterns);
+	output.flush();
+
+	if (!writer->IsGood())
+	{
+		LOG(ERROR) << "Could not write the checkpoint file " << filename;
+		return false;
+	}
+
+	return true;
+}
+
+size_t CheckpointWriter::GetNumberOfPatterns(void) const
+{
+	return numberOfPatterns;
+}
+
+template<typename FaultList>
+uint64_t GetCheckpointFaultListHash(const FaultList& faultList)
+{
+	// 64-bit FNV-1a over the descriptions of the faults, which are terminated by a zero byte
+	uint64_t hash { 0xcbf29ce484222325u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		const auto [fault, metaData] = faultList[faultIndex];
+		const std::string description { to_string(*fault) };
+		for (const char character : description)
+		{
+			hash ^= static_cast<uint8_t>(character);
+			hash *= 0x100000001b3u;
+		}
+		hash *= 0x100000001b3u;
+	}
+	return hash;
+}
+
+void WriteCheckpointPattern(Binary::BinaryExchangeWriter& writer, const Pattern::TestPattern& pattern)
+{
+	std::vector<char> buffer;
+	writer.Write(pattern.GetNumberOfTimeframes());
+	writer.Write(pattern.GetNumberOfPrimaryInputs());
+	writer.Write(pattern.GetNumberOfSecondaryInputs());
+	for (size_t timeframe { 0u }; timeframe < pattern.GetNumberOfTimeframes(); ++timeframe)
+	{
+		for (const auto* values : { &pattern.GetPrimaryInputs(timeframe), &pattern.GetSecondaryInputs(timeframe) })
+		{
+			buffer.assign(values->size(), '\0');
+			std::transform(values->begin(), values->end(), buffer.begin(), [](Logic value) { return static_cast<char>(value); });
+			writer.WriteBytes(buffer.data(), buffer.size());
+		}
+	}
+}
+
+std::optional<Pattern::TestPattern> ReadCheckpointPattern(Binary::BinaryExchangeReader& reader, const Circuit::MappedCircuit& circuit)
+{
+	uint64_t timeframes;
+	uint64_t primaryInputs;
+	uint64_t secondaryInputs;
+	if (!reader.Read(timeframes) || !reader.Read(primaryInputs) || !reader.Read(secondaryInputs))
+	{
+		return std::nullopt;
+	}
+	if (primaryInputs != circuit.GetNumberOfPrimaryInputs() || secondaryInputs != circuit.GetNumberOfSecondaryInputs())
+	{
+		LOG(ERROR) << "Found a test pattern with " << primaryInputs << " primary and " << secondaryInputs << " secondary inputs";
+		return std::nullopt;
+	}
+
+	Pattern::TestPattern pattern(timeframes, primaryInputs, secondaryInputs, Logic::LOGIC_DONT_CARE);
+	std::vector<char> buffer;
+	for (size_t timeframe { 0u }; timeframe < timeframes; ++timeframe)
+	{
+		for (auto* values : { &pattern.GetPrimaryInputs(timeframe), &pattern.GetSecondaryInputs(timeframe) })
+		{
+			buffer.resize(values->size());
+			if (!reader.ReadBytes(buffer.data(), buffer.size())
+				|| !std::all_of(buffer.begin(), buffer.end(), IsValidLogicCode))
+			{
+				return std::nullopt;
+			}
+			std::transform(buffer.begin(), buffer.end(), values->begin(), [](char code) { return static_cast<Logic>(code); });
+		}
+	}
+
+	return pattern;
+}
+
+void WriteCheckpointFault(Binary::BinaryExchangeWriter& writer, const CheckpointFault& fault)
+{
+	writer.Write(fault.faultIndex);
+	writer.Write(static_cast<uint64_t>(fault.status));
+	writer.Write(static_cast<uint64_t>(fault.targetedStatus));
+	writer.Write(fault.detectingPatternId);
+	writer.Write(fault.detectingTimeframe);
+	writer.Write(fault.detectionCount);
+}
+
+std::optional<CheckpointFault> ReadCheckpointFault(Binary::BinaryExchangeReader& reader, size_t numberOfFaults)
+{
+	uint64_t faultIndex;
+	uint64_t status;
+	uint64_t targetedStatus;
+	uint64_t detectingPatternId;
+	uint64_t detectingTimeframe;
+	uint64_t detectionCount;
+	if (!reader.Read(faultIndex) || !reader.Read(status) || !reader.Read(targetedStatus)
+		|| !reader.Read(detectingPatternId) || !reader.Read(detectingTimeframe) || !reader.Read(detectionCount))
+	{
+		return std::nullopt;
+	}
+	if (faultIndex >= numberOfFaults
+		|| status > static_cast<uint64_t>(Fault::FaultStatus::FAULT_STATUS_EXTENDED)
+		|| targetedStatus > static_cast<uint64_t>(Fault::TargetedFaultStatus::FAULT_STATUS_EQUIVALENT))
+	{
+		LOG(ERROR) << "Found an invalid record for fault " << faultIndex;
+		return std::nullopt;
+	}
+
+	return CheckpointFault {
+		.faultIndex = faultIndex,
+		.status = static_cast<Fault::FaultStatus>(status),
+		.targetedStatus = static_cast<Fault::TargetedFaultStatus>(targetedStatus),
+		.detectingPatternId = detectingPatternId,
+		.detectingTimeframe = detectingTimeframe,
+		.detectionCount = detectionCount
+	};
+}
+
+static bool ReadPatternRecord(Binary::BinaryExchangeReader& reader, const Circuit::MappedCircuit& circuit, std::vector<Pattern::TestPattern>& patterns)
+{
+	auto pattern { ReadCheckpointPattern(reader, circuit) };
+	if (!pattern)
+	{
+		return false;
+	}
+
+	patterns.emplace_back(std::move(*pattern));
+	return true;
+}
+
+static bool ReadFaultsRecord(Binary::BinaryExchangeReader& reader, size_t numberOfFaults, std::vector<CheckpointFault>& faults)
+{
+	uint64_t count;
+	if (!reader.Read(count))
+	{
+		return false;
+	}
+
+	for (size_t index { 0u }; index < count; ++index)
+	{
+		auto fault { ReadCheckpointFault(reader, numberOfFaults) };
+		if (!fault)
+		{
+			return false;
+		}
+		faults.push_back(*fault);
+	}
+
+	return true;
+}
+
+std::optional<Checkpoint> ImportCheckpoint(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t numberOfFaults, uint64_t faultListHash)
+{
+	Binary::BinaryExchangeReader reader(input);
+	if (!reader.ReadHeader(CHECKPOINT_MAGIC, CHECKPOINT_VERSION) || !reader.ValidateCircuitGuard(circuit))
+	{
+		return std::nullopt;
+	}
+
+	uint64_t fileFaults;
+	uint64_t fileFaultListHash;
+	if (!reader.Read(fileFaults) || !reader.Read(fileFaultListHash))
+	{
+		LOG(ERROR) << "The checkpoint is truncated";
+		return std::nullopt;
+	}
+	if (fileFaults != numberOfFaults)
+	{
+		LOG(ERROR) << "The checkpoint has been created for " << fileFaults << " faults while the fault list has " << numberOfFaults << " faults";
+		return std::nullopt;
+	}
+	if (fileFaultListHash != faultListHash)
+	{
+		LOG(ERROR) << "The checkpoint has been created for a different fault list";
+		return std::nullopt;
+	}
+
+	// The records of a checkpoint are only applied when its commit has been read
+	Checkpoint checkpoint { { }, { }, reader.GetOffset() };
+	std::vector<CheckpointFault> pendingFaults;
+	std::vector<Pattern::TestPattern> pendingPatterns;
+	uint64_t tag;
+	while (reader.Read(tag))
+	{
+		bool valid { false };
+		switch (tag)
+		{
+			case RECORD_PATTERN:
+				valid = ReadPatternRecord(reader, circuit.GetMappedCircuit(), pendingPatterns);
+				break;
+
+			case RECORD_FAULTS:
+				valid = ReadFaultsRecord(reader, numberOfFaults, pendingFaults);
+				break;
+
+			case RECORD_COMMIT:
+			{
+				uint64_t patterns;
+				valid = reader.Read(patterns) && patterns == checkpoint.patterns.size() + pendingPatterns.size();
+				if (valid)
+				{
+					checkpoint.faults.insert(checkpoint.faults.end(), pendingFaults.begin(), pendingFaults.end());
+					std::move(pendingPatterns.begin(), pendingPatterns.end(), std::back_inserter(checkpoint.patterns));
+					checkpoint.committedSize = reader.GetOffset();
+					pendingFaults.clear();
+					pendingPatterns.clear();
+				}
+				break;
+			}
+
+			default:
+				break;
+		}
+
+		if (!valid)
+		{
+			break;
+		}
+	}
+
+	LOG_IF(checkpoint.committedSize != reader.GetOffset(), WARNING) << "The checkpoint ends with an incomplete record which is ignored";
+	return checkpoint;
+}
+
+template uint64_t GetCheckpointFaultListHash(const Fault::SingleStuckAtFaultList& faultList);
+template uint64_t GetCheckpointFaultListHash(const Fault::SingleTransitionDelayFaultList& faultList);
+template uint64_t GetCheckpointFaultListHash(const Fault::CellAwareFaultList& faultList);
+
+};
+};
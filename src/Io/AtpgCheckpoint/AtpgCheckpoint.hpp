@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Basic/Fault/FaultMetaData.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+
+/**
+ * @brief The state of one fault that is stored in a checkpoint.
+ */
+struct CheckpointFault
+{
+	size_t faultIndex;
+	Fault::FaultStatus status;
+	Fault::TargetedFaultStatus targetedStatus;
+	size_t detectingPatternId;
+	size_t detectingTimeframe;
+	size_t detectionCount;
+};
+
+/**
+ * @brief The committed content of a checkpoint file.
+ *
+ * - faults: The fault records in the order they have been written.
+ *   A later record of a fault replaces the earlier ones.
+ * - patterns: The test patterns in the order they have been generated.
+ * - committedSize: The size of the file up to the last commit.
+ *   Data after the last commit has been written by an interrupted checkpoint and is invalid.
+ */
+struct Checkpoint
+{
+	std::vector<CheckpointFault> faults;
+	std::vector<Pattern::TestPattern> patterns;
+	uint64_t committedSize;
+};
+
+/**
+ * @brief Appends checkpoints of a running test pattern generation to a binary file.
+ *
+ * Each checkpoint only contains the patterns and faults that have changed since the previous one
+ * and is finished by a commit record. The file is never rewritten, which keeps the cost
+ * of a checkpoint proportional to the progress since the previous checkpoint.
+ * A checkpoint that has been interrupted (e.g. by the preemption of the job) is ignored when the file is imported.
+ */
+class CheckpointWriter
+{
+public:
+	CheckpointWriter(const Circuit::CircuitEnvironment& circuit, std::string filename, size_t numberOfFaults, uint64_t faultListHash);
+	virtual ~CheckpointWriter(void);
+
+	/**
+	 * @brief Creates a new checkpoint file.
+	 */
+	bool Create(void);
+
+	/**
+	 * @brief Continues an imported checkpoint file.
+	 *
+	 * The data after the last commit is removed before the new checkpoints are appended.
+	 */
+	bool Continue(const Checkpoint& checkpoint);
+
+	void WritePattern(const Pattern::TestPattern& pattern);
+	void WriteFaults(const std::vector<CheckpointFault>& faults);
+	bool Commit(void);
+
+	size_t GetNumberOfPatterns(void) const;
+
+private:
+	const Circuit::CircuitEnvironment& circuit;
+	std::string filename;
+	size_t numberOfFaults;
+	uint64_t faultListHash;
+	size_t numberOfPatterns;
+
+	std::ofstream output;
+	std::unique_ptr<Binary::BinaryExchangeWriter> writer;
+
+};
+
+/**
+ * @brief Returns a hash of the faults and their order in the fault list.
+ *
+ * The fault records of a checkpoint refer to the faults by their index.
+ * The hash ensures that a checkpoint is only resumed with the same fault list.
+ */
+template<typename FaultList>
+uint64_t GetCheckpointFaultListHash(const FaultList& faultList);
+
+/**
+ * @brief Writes the inputs of a test pattern in the binary checkpoint encoding.
+ */
+void WriteCheckpointPattern(Binary::BinaryExchangeWriter& writer, const Pattern::TestPattern& pattern);
+/**
+ * @brief Reads a test pattern that has been written by WriteCheckpointPattern.
+ *
+ * The number of inputs and the logic values are validated for the circuit.
+ */
+std::optional<Pattern::TestPattern> ReadCheckpointPattern(Binary::BinaryExchangeReader& reader, const Circuit::MappedCircuit& circuit);
+void WriteCheckpointFault(Binary::BinaryExchangeWriter& writer, const CheckpointFault& fault);
+std::optional<CheckpointFault> ReadCheckpointFault(Binary::BinaryExchangeReader& reader, size_t numberOfFaults);
+
+/**
+ * @brief Imports the committed checkpoints of a checkpoint file.
+ *
+ * The file has to be created for the same circuit and the same fault list,
+ * which is identified by the number of faults and the hash of GetCheckpointFaultListHash.
+ */
+std::optional<Checkpoint> ImportCheckpoint(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t numberOfFaults, uint64_t faultListHash);
+
+};
+};
@@ -0,0 +1,342 @@
+#include "Io/AtpgSharding/ShardingProtocol.hpp"
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "Basic/Logging.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
+
+extern char** environ;
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Sharding
+{
+
+// Increment the version when the encoding of a message changes.
+// The coordinator and the workers are the same program, but the version
+// protects against a worker that has been started from a different build.
+static constexpr Binary::Magic SHARDING_MAGIC { '\x89', 'F', 'T', 'S', 'H', 'A', 'R', 'D' };
+static constexpr uint64_t SHARDING_VERSION { 1u };
+
+// The size of a message is limited to reject corrupted headers before the payload is allocated.
+// The largest messages are the results, which contain the test patterns of a chunk.
+static constexpr uint64_t MAX_MESSAGE_SIZE { 1ull << 30u };
+
+Channel::Channel(int descriptor):
+	descriptor(descriptor)
+{
+}
+
+Channel::~Channel(void)
+{
+	close(descriptor);
+}
+
+static bool SendAll(int descriptor, const char* data, size_t size)
+{
+	while (size > 0u)
+	{
+		// MSG_NOSIGNAL reports a terminated peer as error instead of raising SIGPIPE
+		const ssize_t sent { send(descriptor, data, size, MSG_NOSIGNAL) };
+		if (sent < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return false;
+		}
+
+		data += sent;
+		size -= static_cast<size_t>(sent);
+	}
+	return true;
+}
+
+static bool ReceiveAll(int descriptor, char* data, size_t size)
+{
+	while (size > 0u)
+	{
+		const ssize_t received { recv(descriptor, data, size, 0) };
+		if (received == 0)
+		{
+			return false;
+		}
+		if (received < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			return false;
+		}
+
+		data += received;
+		size -= static_cast<size_t>(received);
+	}
+	return true;
+}
+
+bool Channel::Send(MessageType type, const std::string& payload)
+{
+	if (payload.size() > MAX_MESSAGE_SIZE)
+	{
+		LOG(ERROR) << "The message with " << payload.size() << " bytes exceeds the limit of " << MAX_MESSAGE_SIZE << " bytes";
+		return false;
+	}
+
+	const uint64_t header[2] { static_cast<uint64_t>(type), payload.size() };
+	return SendAll(descriptor, reinterpret_cast<const char*>(header), sizeof(header))
+		&& SendAll(descriptor, payload.data(), payload.size());
+}
+
+std::optional<Message> Channel::Receive(void)
+{
+	uint64_t header[2];
+	if (!ReceiveAll(descriptor, reinterpret_cast<char*>(header), sizeof(header)))
+	{
+		return std::nullopt;
+	}
+	if (header[0] < static_cast<uint64_t>(MessageType::Hello) || header[0] > static_cast<uint64_t>(MessageType::Finish))
+	{
+		LOG(ERROR) << "Received a message with the invalid type " << header[0];
+		return std::nullopt;
+	}
+	if (header[1] > MAX_MESSAGE_SIZE)
+	{
+		LOG(ERROR) << "Received a message with " << header[1] << " bytes which exceeds the limit of " << MAX_MESSAGE_SIZE << " bytes";
+		return std::nullopt;
+	}
+
+	Message message { static_cast<MessageType>(header[0]), std::string(header[1], '\0') };
+	if (!ReceiveAll(descriptor, message.payload.data(), message.payload.size()))
+	{
+		return std::nullopt;
+	}
+	return message;
+}
+
+int Channel::GetDescriptor(void) const
+{
+	return descriptor;
+}
+
+static std::vector<std::string> GetCommandLine(void)
+{
+	std::ifstream input("/proc/self/cmdline", std::ios_base::in | std::ios_base::binary);
+	std::vector<std::string> arguments;
+	for (std::string argument; std::getline(input, argument, '\0'); )
+	{
+		arguments.push_back(argument);
+	}
+	return arguments;
+}
+
+std::optional<WorkerProcess> SpawnWorker(const std::vector<std::string>& additionalArguments, const std::string& socketOption)
+{
+	std::vector<std::string> arguments { GetCommandLine() };
+	if (arguments.empty())
+	{
+		LOG(ERROR) << "The command line of the process could not be read";
+		return std::nullopt;
+	}
+
+	int descriptors[2];
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors) != 0)
+	{
+		LOG(ERROR) << "Could not create the socket for a worker: " << std::strerror(errno);
+		return std::nullopt;
+	}
+	// Only the socket of the worker is inherited by the new process
+	fcntl(descriptors[0], F_SETFD, FD_CLOEXEC);
+
+	arguments.insert(arguments.end(), additionalArguments.begin(), additionalArguments.end());
+	arguments.push_back("--" + socketOption);
+	arguments.push_back(std::to_string(descriptors[1]));
+
+	std::vector<char*> argv;
+	for (auto& argument : arguments)
+	{
+		argv.push_back(argument.data());
+	}
+	argv.push_back(nullptr);
+
+	pid_t pid;
+	const int error { posix_spawn(&pid, "/proc/self/exe", nullptr, nullptr, argv.data(), environ) };
+	close(descriptors[1]);
+	if (error != 0)
+	{
+		close(descriptors[0]);
+		LOG(ERROR) << "Could not start a worker process: " << std::strerror(error);
+		return std::nullopt;
+	}
+
+	return WorkerProcess { pid, std::make_unique<Channel>(descriptors[0]) };
+}
+
+bool WaitForWorker(pid_t pid)
+{
+	int status;
+	while (waitpid(pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+		{
+			return false;
+		}
+	}
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+std::string EncodeHello(const Circuit::CircuitEnvironment& circuit, size_t numberOfFaults)
+{
+	std::ostringstream output;
+	Binary::BinaryExchangeWriter writer(output);
+	writer.WriteHeader(SHARDING_MAGIC, SHARDING_VERSION);
+	writer.WriteCircuitGuard(circuit);
+	writer.Write(numberOfFaults);
+	return output.str();
+}
+
+bool ValidateHello(const std::string& payload, const Circuit::CircuitEnvironment& circuit, size_t numberOfFaults)
+{
+	std::istringstream input(payload);
+	Binary::BinaryExchangeReader reader(input);
+	if (!reader.ReadHeader(SHARDING_MAGIC, SHARDING_VERSION) || !reader.ValidateCircuitGuard(circuit))
+	{
+		return false;
+	}
+
+	uint64_t workerFaults { 0u };
+	if (!reader.Read(workerFaults) || workerFaults != numberOfFaults)
+	{
+		LOG(ERROR) << "The worker has a fault list with " << workerFaults << " instead of " << numberOfFaults << " faults";
+		return false;
+	}
+	return true;
+}
+
+std::string EncodeChunk(size_t begin, size_t end)
+{
+	std::ostringstream output;
+	Binary::BinaryExchangeWriter writer(output);
+	writer.Write(begin);
+	writer.Write(end);
+	return output.str();
+}
+
+std::optional<std::pair<size_t, size_t>> DecodeChunk(const std::string& payload)
+{
+	std::istringstream input(payload);
+	Binary::BinaryExchangeReader reader(input);
+	uint64_t begin;
+	uint64_t end;
+	if (!reader.Read(begin) || !reader.Read(end) || begin > end)
+	{
+		return std::nullopt;
+	}
+	return std::make_pair(begin, end);
+}
+
+static void WriteFaults(Binary::BinaryExchangeWriter& writer, const std::vector<CheckpointFault>& faults)
+{
+	writer.Write(faults.size());
+	for (const auto& fault : faults)
+	{
+		WriteCheckpointFault(writer, fault);
+	}
+}
+
+static bool ReadFaults(Binary::BinaryExchangeReader& reader, size_t numberOfFaults, std::vector<CheckpointFault>& faults)
+{
+	uint64_t count;
+	if (!reader.Read(count))
+	{
+		return false;
+	}
+	for (size_t index { 0u }; index < count; ++index)
+	{
+		auto fault { ReadCheckpointFault(reader, numberOfFaults) };
+		if (!fault)
+		{
+			return false;
+		}
+		faults.push_back(*fault);
+	}
+	return true;
+}
+
+std::string EncodeResult(const Pattern::TestPatternList& patterns, size_t patternBegin, size_t patternEnd, const std::vector<CheckpointFault>& faults)
+{
+	std::ostringstream output;
+	Binary::BinaryExchangeWriter writer(output);
+	writer.Write(patternEnd - patternBegin);
+	for (size_t patternIndex { patternBegin }; patternIndex < patternEnd; ++patternIndex)
+	{
+		WriteCheckpointPattern(writer, *patterns[patternIndex]);
+	}
+	WriteFaults(writer, faults);
+	return output.str();
+}
+
+std::optional<Result> DecodeResult(const std::string& payload, const Circuit::MappedCircuit& circuit, size_t numberOfFaults)
+{
+	std::istringstream input(payload);
+	Binary::BinaryExchangeReader reader(input);
+	Result result;
+
+	uint64_t patterns;
+	if (!reader.Read(patterns))
+	{
+		return std::nullopt;
+	}
+	for (size_t index { 0u }; index < patterns; ++index)
+	{
+		auto pattern { ReadCheckpointPattern(reader, circuit) };
+		if (!pattern)
+		{
+			return std::nullopt;
+		}
+		result.patterns.emplace_back(std::move(*pattern));
+	}
+
+	if (!ReadFaults(reader, numberOfFaults, result.faults))
+	{
+		return std::nullopt;
+	}
+	return result;
+}
+
+std::string EncodeFaults(const std::vector<CheckpointFault>& faults)
+{
+	std::ostringstream output;
+	Binary::BinaryExchangeWriter writer(output);
+	WriteFaults(writer, faults);
+	return output.str();
+}
+
+std::optional<std::vector<CheckpointFault>> DecodeFaults(const std::string& payload, size_t numberOfFaults)
+{
+	std::istringstream input(payload);
+	Binary::BinaryExchangeReader reader(input);
+	std::vector<CheckpointFault> faults;
+	if (!ReadFaults(reader, numberOfFaults, faults))
+	{
+		return std::nullopt;
+	}
+	return faults;
+}
+
+};
+};
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Io/AtpgCheckpoint/AtpgCheckpoint.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Sharding
+{
+
+/**
+ * @brief The messages that are exchanged between the coordinator and the workers.
+ *
+ * - Hello (worker -> coordinator): The circuit guard and the size of the fault list of the worker.
+ * - Chunk (coordinator -> worker): A range of faults for which the worker generates test patterns.
+ * - Result (worker -> coordinator): The new test patterns and the changed faults of the worker.
+ *   The worker requests the next chunk with each result.
+ * - Drop (coordinator -> worker): Faults that have been classified by the coordinator or another worker
+ *   and are no longer targeted or simulated by the worker.
+ * - Finish (coordinator -> worker): No more chunks are left.
+ */
+enum class MessageType : uint64_t
+{
+	Hello = 1u,
+	Chunk = 2u,
+	Result = 3u,
+	Drop = 4u,
+	Finish = 5u
+};
+
+struct Message
+{
+	MessageType type;
+	std::string payload;
+};
+
+/**
+ * @brief The result that a worker reports after a chunk.
+ *
+ * - patterns: The test patterns that have been generated since the previous result.
+ * - faults: The faults that have changed since the previous result.
+ *   The detecting pattern is the index in the pattern list of the worker
+ *   and the detection count is the number of new detections since the previous result.
+ */
+struct Result
+{
+	std::vector<Pattern::TestPattern> patterns;
+	std::vector<CheckpointFault> faults;
+};
+
+/**
+ * @brief A message channel over a local (UNIX domain) socket between two processes on the same host.
+ *
+ * Each message is framed by its type and size. The size of a message is limited to 1 GiB
+ * and a message with a larger size is rejected. The channel is not thread-safe.
+ * Sending and receiving from two different threads is supported.
+ */
+class Channel
+{
+public:
+	Channel(int descriptor);
+	virtual ~Channel(void);
+
+	Channel(const Channel& other) = delete;
+	Channel& operator=(const Channel& other) = delete;
+
+	bool Send(MessageType type, const std::string& payload);
+	std::optional<Message> Receive(void);
+	int GetDescriptor(void) const;
+
+private:
+	int descriptor;
+
+};
+
+struct WorkerProcess
+{
+	pid_t pid;
+	std::unique_ptr<Channel> channel;
+};
+
+/**
+ * @brief Starts a worker process by executing the current program with the command line of this process.
+ *
+ * The additional arguments are appended to the command line.
+ * The descriptor of the socket is passed to the worker with the setting that is given by socketOption.
+ */
+std::optional<WorkerProcess> SpawnWorker(const std::vector<std::string>& additionalArguments, const std::string& socketOption);
+/**
+ * @brief Waits for the termination of a worker process.
+ *
+ * @return true if the worker has exited successfully
+ */
+bool WaitForWorker(pid_t pid);
+
+std::string EncodeHello(const Circuit::CircuitEnvironment& circuit, size_t numberOfFaults);
+bool ValidateHello(const std::string& payload, const Circuit::CircuitEnvironment& circuit, size_t numberOfFaults);
+
+std::string EncodeChunk(size_t begin, size_t end);
+std::optional<std::pair<size_t, size_t>> DecodeChunk(const std::string& payload);
+
+std::string EncodeResult(const Pattern::TestPatternList& patterns, size_t patternBegin, size_t patternEnd, const std::vector<CheckpointFault>& faults);
+std::optional<Result> DecodeResult(const std::string& payload, const Circuit::MappedCircuit& circuit, size_t numberOfFaults);
+
+std::string EncodeFaults(const std::vector<CheckpointFault>& faults);
+std::optional<std::vector<CheckpointFault>> DecodeFaults(const std::string& payload, size_t numberOfFaults);
+
+};
+};
+};
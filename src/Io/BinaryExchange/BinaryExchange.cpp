@@ -0,0 +1,199 @@
+#include "Io/BinaryExchange/BinaryExchange.hpp"
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <cstring>
+#include <sstream>
+
+#include "Basic/Logging.hpp"
+#include "Io/CircuitGuard/CircuitGuard.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Binary
+{
+
+bool IsBinaryExchangeStream(std::istream& input)
+{
+	return input.peek() == static_cast<unsigned char>(BINARY_EXCHANGE_MARKER);
+}
+
+BinaryExchangeWriter::BinaryExchangeWriter(std::ostream& output):
+	_output(output),
+	_offset(0u)
+{
+}
+
+BinaryExchangeWriter::~BinaryExchangeWriter(void) = default;
+
+void BinaryExchangeWriter::WriteHeader(const Magic& magic, uint64_t version)
+{
+	WriteBytes(magic, sizeof(Magic));
+	Write(version);
+	Write(BINARY_EXCHANGE_BYTE_ORDER);
+}
+
+void BinaryExchangeWriter::WriteCircuitGuard(const Circuit::CircuitEnvironment& circuit)
+{
+	// The guard is rarely read and small compared to the data.
+	// It is stored as JSON to reuse the validation of the JSON formats.
+	std::ostringstream guard;
+	boost::property_tree::write_json(guard, CreateCircuitGuard(circuit), false);
+
+	const std::string data { guard.str() };
+	Write(data.size());
+	WriteBytes(data.data(), data.size());
+}
+
+void BinaryExchangeWriter::Write(uint64_t value)
+{
+	WriteBytes(&value, sizeof(value));
+}
+
+void BinaryExchangeWriter::WriteBytes(const void* data, size_t size)
+{
+	_output.write(reinterpret_cast<const char*>(data), size);
+	_offset += size;
+}
+
+uint64_t BinaryExchangeWriter::GetOffset(void) const
+{
+	return _offset;
+}
+
+bool BinaryExchangeWriter::IsGood(void) const
+{
+	return _output.good();
+}
+
+BinaryExchangeReader::BinaryExchangeReader(std::istream& input):
+	_input(input),
+	_offset(0u),
+	_size(std::nullopt)
+{
+	// Compressed streams report an invalid position
+	const auto begin { _input.tellg() };
+	if (begin == std::istream::pos_type(-1))
+	{
+		return;
+	}
+
+	_input.seekg(0, std::ios_base::end);
+	const auto end { _input.tellg() };
+	_input.seekg(begin, std::ios_base::beg);
+	if (end != std::istream::pos_type(-1) && end >= begin && _input.good())
+	{
+		_size = static_cast<uint64_t>(end - begin);
+	}
+	_input.clear(_input.rdstate() & ~std::ios_base::failbit);
+}
+
+BinaryExchangeReader::~BinaryExchangeReader(void) = default;
+
+bool BinaryExchangeReader::ReadHeader(const Magic& magic, uint64_t version)
+{
+	Magic fileMagic;
+	uint64_t fileVersion;
+	uint64_t fileByteOrder;
+	if (!ReadBytes(fileMagic, sizeof(Magic)) || !Read(fileVersion) || !Read(fileByteOrder))
+	{
+		LOG(ERROR) << "The binary file has no valid header";
+		return false;
+	}
+
+	if (std::memcmp(fileMagic, magic, sizeof(Magic)) != 0)
+	{
+		LOG(ERROR) << "The binary file has an unexpected type";
+		return false;
+	}
+	if (fileVersion != version)
+	{
+		LOG(ERROR) << "The binary file has version " << fileVersion << " while version " << version << " is supported";
+		return false;
+	}
+	if (fileByteOrder != BINARY_EXCHANGE_BYTE_ORDER)
+	{
+		LOG(ERROR) << "The binary file has been created on a host with a different byte order";
+		return false;
+	}
+
+	return true;
+}
+
+bool BinaryExchangeReader::ValidateCircuitGuard(const Circuit::CircuitEnvironment& circuit)
+{
+	uint64_t size;
+	if (!Read(size))
+	{
+		return false;
+	}
+
+	std::string data;
+	if (!ReadBlock(data, size))
+	{
+		LOG(ERROR) << "The binary file has a truncated circuit guard";
+		return false;
+	}
+
+	try
+	{
+		std::istringstream guardStream(data);
+		boost::property_tree::ptree guard;
+		boost::property_tree::read_json(guardStream, guard);
+		return Io::ValidateCircuitGuard(guard, circuit);
+	}
+	catch (boost::property_tree::ptree_error& exception)
+	{
+		LOG(ERROR) << "The binary file has an invalid circuit guard: " << exception.what();
+		return false;
+	}
+}
+
+bool BinaryExchangeReader::Read(uint64_t& value)
+{
+	return ReadBytes(&value, sizeof(value));
+}
+
+bool BinaryExchangeReader::ReadBytes(void* data, size_t size)
+{
+	_input.read(reinterpret_cast<char*>(data), size);
+	_offset += _input.gcount();
+	return _input.good() && static_cast<size_t>(_input.gcount()) == size;
+}
+
+bool BinaryExchangeReader::Skip(size_t size)
+{
+	_input.ignore(size);
+	_offset += _input.gcount();
+	return _input.good() && static_cast<size_t>(_input.gcount()) == size;
+}
+
+bool BinaryExchangeReader::Seek(uint64_t offset)
+{
+	// Compressed streams can not be positioned, but skipping forward is always possible
+	if (offset >= _offset)
+	{
+		return Skip(offset - _offset);
+	}
+
+	_input.seekg(offset, std::ios_base::beg);
+	_offset = offset;
+	return _input.good();
+}
+
+bool BinaryExchangeReader::HasRemaining(uint64_t size) const
+{
+	return !_size.has_value() || (_offset <= _size.value() && size <= _size.value() - _offset);
+}
+
+uint64_t BinaryExchangeReader::GetOffset(void) const
+{
+	return _offset;
+}
+
+};
+};
+};
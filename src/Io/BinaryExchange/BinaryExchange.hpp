@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include "Circuit/CircuitEnvironment.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Binary
+{
+
+// All binary exchange files start with this character.
+// It can never be the first character of a JSON document.
+static constexpr char BINARY_EXCHANGE_MARKER { '\x89' };
+static constexpr uint64_t BINARY_EXCHANGE_BYTE_ORDER { 0x0102030405060708u };
+
+using Magic = char[8];
+
+/**
+ * @brief Returns true if the stream contains a binary exchange file.
+ *
+ * Only the next character is peeked and no data is consumed.
+ * Therefore, the stream can be handed to the JSON parser if it is no binary file.
+ */
+bool IsBinaryExchangeStream(std::istream& input);
+
+/**
+ * @brief Writes 64-bit words and raw data to a stream and keeps track of the offset.
+ *
+ * All words are stored in the byte order of the host.
+ * The byte order is verified with the header of the file.
+ */
+class BinaryExchangeWriter
+{
+public:
+	BinaryExchangeWriter(std::ostream& output);
+	virtual ~BinaryExchangeWriter(void);
+
+	void WriteHeader(const Magic& magic, uint64_t version);
+	void WriteCircuitGuard(const Circuit::CircuitEnvironment& circuit);
+
+	void Write(uint64_t value);
+	void WriteBytes(const void* data, size_t size);
+
+	uint64_t GetOffset(void) const;
+	bool IsGood(void) const;
+
+private:
+	std::ostream& _output;
+	uint64_t _offset;
+
+};
+
+/**
+ * @brief Counterpart of the BinaryExchangeWriter.
+ *
+ * All read functions return false if the stream ended prematurely.
+ * Sizes that are read from the file have to be checked with HasRemaining
+ * or read with ReadBlock before memory is allocated for them.
+ */
+class BinaryExchangeReader
+{
+public:
+	BinaryExchangeReader(std::istream& input);
+	virtual ~BinaryExchangeReader(void);
+
+	bool ReadHeader(const Magic& magic, uint64_t version);
+	bool ValidateCircuitGuard(const Circuit::CircuitEnvironment& circuit);
+
+	bool Read(uint64_t& value);
+	bool ReadBytes(void* data, size_t size);
+	bool Skip(size_t size);
+	bool Seek(uint64_t offset);
+
+	/**
+	 * @brief Returns false if less than size bytes remain in the stream.
+	 *
+	 * The remaining size is only known for streams that can be positioned.
+	 * Compressed streams always pass the check.
+	 */
+	bool HasRemaining(uint64_t size) const;
+
+	/**
+	 * @brief Reads count elements into the container.
+	 *
+	 * The container grows in steps while the data is read.
+	 * Therefore, a corrupt count does not allocate more memory than the stream provides,
+	 * even if the remaining size of the stream is unknown.
+	 */
+	template<typename Container>
+	bool ReadBlock(Container& data, uint64_t count)
+	{
+		using ValueT = typename Container::value_type;
+		constexpr uint64_t BLOCK_ELEMENTS { std::max<uint64_t>(READ_BLOCK_SIZE / sizeof(ValueT), 1u) };
+
+		data.clear();
+		if (count > std::numeric_limits<uint64_t>::max() / sizeof(ValueT) || !HasRemaining(count * sizeof(ValueT)))
+		{
+			return false;
+		}
+
+		for (uint64_t offset { 0u }; offset < count; offset += BLOCK_ELEMENTS)
+		{
+			const uint64_t elements { std::min<uint64_t>(count - offset, BLOCK_ELEMENTS) };
+			data.resize(offset + elements);
+			if (!ReadBytes(&data[offset], elements * sizeof(ValueT)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	uint64_t GetOffset(void) const;
+
+private:
+	static constexpr uint64_t READ_BLOCK_SIZE { 1u << 20u };
+
+	std::istream& _input;
+	uint64_t _offset;
+	std::optional<uint64_t> _size;
+
+};
+
+};
+};
+};
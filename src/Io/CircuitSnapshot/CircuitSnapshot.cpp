@@ -0,0 +1,170 @@
+#include "Io/CircuitSnapshot/CircuitSnapshot.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+
+#include "Basic/Logging.hpp"
+#include "Helper/Compression.hpp"
+#include "Helper/FileHandle.hpp"
+#include "Io/VerilogPreprocessor/VerilogPreprocessor.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+
+// The included files are appended to the source key with one line per file,
+// as they are only known after the preprocessing.
+static constexpr std::string_view INCLUDE_PREFIX { "\ninclude=" };
+
+// Returns the size and modification time of the file
+static std::string GetFileStamp(const std::filesystem::path& path)
+{
+	std::error_code error;
+	const auto size { std::filesystem::file_size(path, error) };
+	const auto time { std::filesystem::last_write_time(path, error) };
+	return std::to_string(error ? 0u : size) + "," + std::to_string(error ? 0 : time.time_since_epoch().count());
+}
+
+static std::string GetIncludedFilesKey(const std::vector<std::string>& includedFiles)
+{
+	std::string key;
+	for (const auto& file : std::set<std::string>(includedFiles.begin(), includedFiles.end()))
+	{
+		key += std::string(INCLUDE_PREFIX) + file + "," + GetFileStamp(file);
+	}
+	return key;
+}
+
+// Checks that the snapshot key starts with the source key
+// and that none of the included files has changed since the snapshot was created.
+static bool IsValidSnapshotKey(std::string_view snapshotKey, const std::string& sourceKey)
+{
+	if (snapshotKey.substr(0u, snapshotKey.find('\n')) != sourceKey)
+	{
+		return false;
+	}
+
+	std::vector<std::string> includedFiles;
+	for (size_t begin { snapshotKey.find(INCLUDE_PREFIX) }; begin != std::string_view::npos; )
+	{
+		const size_t end { snapshotKey.find(INCLUDE_PREFIX, begin + 1u) };
+		const std::string_view line { snapshotKey.substr(begin + INCLUDE_PREFIX.size(), end - begin - INCLUDE_PREFIX.size()) };
+
+		// The stamp consists of two numbers and is the end of the line, which allows commas in the path
+		const size_t timeSeparator { line.rfind(',') };
+		const size_t sizeSeparator { (timeSeparator != std::string_view::npos && timeSeparator > 0u) ? line.rfind(',', timeSeparator - 1u) : std::string_view::npos };
+		if (sizeSeparator == std::string_view::npos)
+		{
+			return false;
+		}
+		includedFiles.emplace_back(line.substr(0u, sizeSeparator));
+		begin = end;
+	}
+
+	return snapshotKey.substr(sourceKey.size()) == GetIncludedFilesKey(includedFiles);
+}
+
+std::string GetCircuitSnapshotSourceKey(std::shared_ptr<Settings> settings)
+{
+	std::ostringstream key;
+	key << "top=" << settings->TopLevelModuleName;
+
+	for (const auto& [symbol, value] : Verilog::VerilogPreprocessor().GetDefinedSymbols())
+	{
+		key << ";define=" << symbol << "," << value;
+	}
+
+	auto add_files = [&](const std::string& type, const std::vector<std::string>& files) {
+		for (const auto& file : files)
+		{
+			const std::filesystem::path path { settings->MapFileName(file, true) };
+			key << ";" << type << "=" << path.string() << "," << GetFileStamp(path);
+		}
+	};
+	add_files("library", settings->VerilogLibraryFilenames);
+	add_files("import", settings->VerilogImportFilenames);
+
+	return key.str();
+}
+
+bool ExportCircuitSnapshot(const Circuit::Builder::CircuitBuilder& builder, const std::string& sourceKey, const std::vector<std::string>& includedFiles, const std::string& filename)
+{
+	if (GetCompressionFormat(filename) != CompressionFormat::None)
+	{
+		LOG(ERROR) << "Could not write circuit snapshot " << filename << ": Compressed snapshots can not be memory-mapped";
+		return false;
+	}
+
+	const std::string temporaryFilename { filename + ".tmp." + std::to_string(::getpid()) };
+	{
+		FileHandle handle(temporaryFilename, false);
+		if (!builder.ExportSnapshot(handle.GetOutStream(), sourceKey + GetIncludedFilesKey(includedFiles)))
+		{
+			LOG(ERROR) << "Could not write circuit snapshot " << filename;
+			std::error_code error;
+			std::filesystem::remove(temporaryFilename, error);
+			return false;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(temporaryFilename, filename, error);
+	if (error)
+	{
+		LOG(ERROR) << "Could not write circuit snapshot " << filename << ": " << error.message();
+		std::filesystem::remove(temporaryFilename, error);
+		return false;
+	}
+
+	LOG(INFO) << "Exported circuit snapshot to " << filename;
+	return true;
+}
+
+std::unique_ptr<Circuit::Builder::CircuitBuilder> ImportCircuitSnapshot(const std::string& filename, const std::string& sourceKey)
+{
+	if (GetCompressionFormat(filename) != CompressionFormat::None)
+	{
+		LOG(ERROR) << "Could not map circuit snapshot " << filename << ": Compressed snapshots can not be memory-mapped";
+		return std::unique_ptr<Circuit::Builder::CircuitBuilder>();
+	}
+	if (!std::filesystem::exists(filename))
+	{
+		return std::unique_ptr<Circuit::Builder::CircuitBuilder>();
+	}
+
+	boost::iostreams::mapped_file_source snapshot;
+	try
+	{
+		snapshot.open(filename);
+	}
+	catch (const std::exception& exception)
+	{
+		LOG(WARNING) << "Could not map circuit snapshot " << filename << ": " << exception.what();
+		return std::unique_ptr<Circuit::Builder::CircuitBuilder>();
+	}
+
+	auto builder = std::make_unique<Circuit::Builder::CircuitBuilder>();
+	const auto is_valid_key = [&sourceKey](std::string_view snapshotKey) {
+		return sourceKey.empty() || IsValidSnapshotKey(snapshotKey, sourceKey);
+	};
+	if (!builder->ImportSnapshot(snapshot.data(), snapshot.size(), is_valid_key))
+	{
+		LOG(INFO) << "Ignoring circuit snapshot " << filename;
+		return std::unique_ptr<Circuit::Builder::CircuitBuilder>();
+	}
+
+	LOG(INFO) << "Imported circuit snapshot from " << filename;
+	return builder;
+}
+
+};
+};
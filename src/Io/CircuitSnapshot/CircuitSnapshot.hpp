@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Basic/Settings.hpp"
+#include "Circuit/CircuitBuilder.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+
+/**
+ * @brief Returns a key that identifies the circuit sources of the settings.
+ *
+ * The key contains the Verilog library and import files (with their size and
+ * modification time), the predefined preprocessor symbols and the top-level module name.
+ * A snapshot is only reused if it was created with the same key.
+ */
+std::string GetCircuitSnapshotSourceKey(std::shared_ptr<Settings> settings);
+
+/**
+ * @brief Writes the circuit builder into a binary snapshot file.
+ *
+ * The snapshot is written to a temporary file first and then renamed.
+ * Therefore, parallel runs that create the same snapshot never read a partially written file.
+ * The snapshot is never compressed and file names with a compression extension are rejected.
+ * The files included by the preprocessor are stored with their size and modification time.
+ */
+bool ExportCircuitSnapshot(const Circuit::Builder::CircuitBuilder& builder, const std::string& sourceKey, const std::vector<std::string>& includedFiles, const std::string& filename);
+
+/**
+ * @brief Memory-maps the binary snapshot file and restores the circuit builder from it.
+ *
+ * An empty source key accepts snapshots of any sources.
+ *
+ * @return nullptr if the file does not exist, has a compression extension,
+ *         the snapshot can not be used for the source key or an included file has changed.
+ */
+std::unique_ptr<Circuit::Builder::CircuitBuilder> ImportCircuitSnapshot(const std::string& filename, const std::string& sourceKey);
+
+};
+};
@@ -0,0 +1,240 @@
+#include "Io/FaultCoverage/CoverageDatabase.hpp"
+
+#include <string>
+#include <type_traits>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Basic/Fault/Models/SingleTransitionDelayFaultModel.hpp"
+#include "Basic/Fault/Models/CellAwareFaultModel.hpp"
+#include "Circuit/CircuitMetaData.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace FaultCoverage
+{
+
+// ----------------------------------------------------------------------------
+// Binary coverage database format
+// ----------------------------------------------------------------------------
+//
+// Header: magic, version, byte order marker, number of patterns, number of faults
+// Faults: length and characters of the location, length and characters of the type,
+//         status, detecting pattern id and detection count
+//
+// Increment the version when the encoding changes.
+
+static constexpr Binary::Magic COVERAGE_MAGIC { '\x89', 'F', 'T', 'C', 'O', 'V', 'D', 'B' };
+static constexpr uint64_t COVERAGE_VERSION { 1u };
+
+CoverageDatabase::CoverageDatabase(void):
+	CoverageDatabase(0u)
+{
+}
+
+CoverageDatabase::CoverageDatabase(size_t numberOfPatterns):
+	_numberOfPatterns(numberOfPatterns),
+	_faults(),
+	_ambiguousFaults()
+{
+}
+
+CoverageDatabase::~CoverageDatabase(void) = default;
+
+void CoverageDatabase::AddFault(const FaultInformation& fault, const FaultRecord& record)
+{
+	if (_ambiguousFaults.find(fault) != _ambiguousFaults.end())
+	{
+		return;
+	}
+
+	if (auto [it, inserted] = _faults.emplace(fault, record); !inserted)
+	{
+		VLOG(3) << "The fault " << fault.location << " " << fault.type << " is not unique and is removed from the coverage database";
+		_faults.erase(it);
+		_ambiguousFaults.insert(fault);
+	}
+}
+
+std::optional<FaultRecord> CoverageDatabase::GetFault(const FaultInformation& fault) const
+{
+	if (auto it = _faults.find(fault); it != _faults.end())
+	{
+		return it->second;
+	}
+
+	return std::nullopt;
+}
+
+size_t CoverageDatabase::GetNumberOfPatterns(void) const
+{
+	return _numberOfPatterns;
+}
+
+size_t CoverageDatabase::GetNumberOfFaults(void) const
+{
+	return _faults.size();
+}
+
+const std::map<FaultInformation, FaultRecord>& CoverageDatabase::GetFaults(void) const
+{
+	return _faults;
+}
+
+template<typename FaultModel>
+FaultInformation GetFaultInformation(const Circuit::CircuitEnvironment& circuit, const FaultModel& faultModel)
+{
+	const auto& metaData = circuit.GetMetaData();
+	const auto& fault = faultModel.GetFault();
+	if constexpr (std::is_same_v<FaultModel, Fault::SingleStuckAtFaultModel>)
+	{
+		auto location { metaData.GetFriendlyName(fault->GetNodeAndPort()) };
+		switch (fault->GetType())
+		{
+			case Fault::StuckAtFaultType::STUCK_AT_0: return { location, "StuckAt0" };
+			case Fault::StuckAtFaultType::STUCK_AT_1: return { location, "StuckAt1" };
+			case Fault::StuckAtFaultType::STUCK_AT_U: return { location, "StuckAtU" };
+			case Fault::StuckAtFaultType::STUCK_AT_X: return { location, "StuckAtX" };
+			default: __builtin_unreachable();
+		}
+	}
+	else if constexpr (std::is_same_v<FaultModel, Fault::SingleTransitionDelayFaultModel>)
+	{
+		auto location { metaData.GetFriendlyName(fault->GetNodeAndPort()) };
+		switch (fault->GetType())
+		{
+			case Fault::TransitionDelayFaultType::SLOW_TO_RISE: return { location, "SlowToRise" };
+			case Fault::TransitionDelayFaultType::SLOW_TO_FALL: return { location, "SlowToFall" };
+			case Fault::TransitionDelayFaultType::SLOW_TO_TRANSITION: return { location, "SlowToTransition" };
+			default: __builtin_unreachable();
+		}
+	}
+	else if constexpr (std::is_same_v<FaultModel, Fault::CellAwareFaultModel>)
+	{
+		auto location { fault->GetCell()->GetHierarchyName() };
+		auto type { fault->GetUserDefinedFault()->GetFaultName() };
+		return { location, type };
+	}
+}
+
+template<typename FaultModel, typename FaultList>
+CoverageDatabase CreateCoverageDatabase(const Circuit::CircuitEnvironment& circuit, const FaultList& faultList, size_t numberOfPatterns)
+{
+	CoverageDatabase database { numberOfPatterns };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metadata] = faultList[faultIndex];
+		database.AddFault(GetFaultInformation<FaultModel>(circuit, { fault }), {
+			.status = metadata->GetFaultStatus(),
+			.detectingPatternId = metadata->detectingPatternId,
+			.detectionCount = metadata->detectionCount
+		});
+	}
+
+	return database;
+}
+
+static void WriteString(Binary::BinaryExchangeWriter& writer, const std::string& value)
+{
+	writer.Write(value.size());
+	writer.WriteBytes(value.data(), value.size());
+}
+
+static bool ReadString(Binary::BinaryExchangeReader& reader, std::string& value)
+{
+	uint64_t size;
+	if (!reader.Read(size))
+	{
+		return false;
+	}
+
+	value.assign(size, '\0');
+	return reader.ReadBytes(value.data(), size);
+}
+
+bool ExportCoverageDatabase(std::ostream& output, const CoverageDatabase& database)
+{
+	Binary::BinaryExchangeWriter writer(output);
+	writer.WriteHeader(COVERAGE_MAGIC, COVERAGE_VERSION);
+	writer.Write(database.GetNumberOfPatterns());
+	writer.Write(database.GetNumberOfFaults());
+	for (const auto& [fault, record] : database.GetFaults())
+	{
+		WriteString(writer, fault.location);
+		WriteString(writer, fault.type);
+		writer.Write(static_cast<uint64_t>(record.status));
+		writer.Write(record.detectingPatternId);
+		writer.Write(record.detectionCount);
+	}
+
+	if (!writer.IsGood())
+	{
+		LOG(ERROR) << "Could not write the coverage database";
+		return false;
+	}
+
+	return true;
+}
+
+std::optional<CoverageDatabase> ImportCoverageDatabase(std::istream& input)
+{
+	Binary::BinaryExchangeReader reader(input);
+	if (!reader.ReadHeader(COVERAGE_MAGIC, COVERAGE_VERSION))
+	{
+		return std::nullopt;
+	}
+
+	uint64_t numberOfPatterns;
+	uint64_t numberOfFaults;
+	if (!reader.Read(numberOfPatterns) || !reader.Read(numberOfFaults))
+	{
+		LOG(ERROR) << "The coverage database is truncated";
+		return std::nullopt;
+	}
+
+	CoverageDatabase database { numberOfPatterns };
+	for (size_t faultIndex { 0u }; faultIndex < numberOfFaults; ++faultIndex)
+	{
+		FaultInformation fault;
+		uint64_t status;
+		uint64_t detectingPatternId;
+		uint64_t detectionCount;
+		if (!ReadString(reader, fault.location) || !ReadString(reader, fault.type)
+			|| !reader.Read(status) || !reader.Read(detectingPatternId) || !reader.Read(detectionCount))
+		{
+			LOG(ERROR) << "The coverage database is truncated";
+			return std::nullopt;
+		}
+		if (status > static_cast<uint64_t>(Fault::FaultStatus::FAULT_STATUS_EXTENDED))
+		{
+			LOG(ERROR) << "The coverage database has an invalid status for fault " << fault.location << " " << fault.type;
+			return std::nullopt;
+		}
+
+		database.AddFault(fault, {
+			.status = static_cast<Fault::FaultStatus>(status),
+			.detectingPatternId = detectingPatternId,
+			.detectionCount = detectionCount
+		});
+	}
+
+	return database;
+}
+
+template FaultInformation GetFaultInformation(const Circuit::CircuitEnvironment& circuit, const Fault::SingleStuckAtFaultModel& faultModel);
+template FaultInformation GetFaultInformation(const Circuit::CircuitEnvironment& circuit, const Fault::SingleTransitionDelayFaultModel& faultModel);
+template FaultInformation GetFaultInformation(const Circuit::CircuitEnvironment& circuit, const Fault::CellAwareFaultModel& faultModel);
+
+template CoverageDatabase CreateCoverageDatabase<Fault::SingleStuckAtFaultModel>(const Circuit::CircuitEnvironment& circuit, const Fault::SingleStuckAtFaultList& faultList, size_t numberOfPatterns);
+template CoverageDatabase CreateCoverageDatabase<Fault::SingleTransitionDelayFaultModel>(const Circuit::CircuitEnvironment& circuit, const Fault::SingleTransitionDelayFaultList& faultList, size_t numberOfPatterns);
+template CoverageDatabase CreateCoverageDatabase<Fault::CellAwareFaultModel>(const Circuit::CircuitEnvironment& circuit, const Fault::CellAwareFaultList& faultList, size_t numberOfPatterns);
+
+};
+};
+};
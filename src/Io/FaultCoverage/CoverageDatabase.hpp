@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <set>
+
+#include "Basic/Fault/FaultMetaData.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Io/FaultCoverage/Coverage.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace FaultCoverage
+{
+
+/**
+ * @brief The detection data of one fault that is stored in the coverage database.
+ *
+ * - status: The fault status at the end of the run.
+ * - detectingPatternId: The index of the first test pattern that detects the fault.
+ * - detectionCount: The number of test patterns that detect the fault (n-detect).
+ */
+struct FaultRecord
+{
+	Fault::FaultStatus status;
+	size_t detectingPatternId;
+	size_t detectionCount;
+};
+
+/**
+ * @brief Stores the per-fault detection data of a test pattern set.
+ *
+ * The faults are identified by their location and type (see GetFaultInformation)
+ * instead of node ids. Therefore, the data can be reused for a modified netlist
+ * of the same design (engineering change order) as long as the hierarchy names
+ * of the unchanged cells are kept.
+ *
+ * Faults with the same location and type can not be told apart.
+ * These are removed from the database and have to be simulated again.
+ */
+class CoverageDatabase
+{
+public:
+	CoverageDatabase(void);
+	CoverageDatabase(size_t numberOfPatterns);
+	virtual ~CoverageDatabase(void);
+
+	void AddFault(const FaultInformation& fault, const FaultRecord& record);
+	std::optional<FaultRecord> GetFault(const FaultInformation& fault) const;
+
+	size_t GetNumberOfPatterns(void) const;
+	size_t GetNumberOfFaults(void) const;
+	const std::map<FaultInformation, FaultRecord>& GetFaults(void) const;
+
+private:
+	size_t _numberOfPatterns;
+	std::map<FaultInformation, FaultRecord> _faults;
+	std::set<FaultInformation> _ambiguousFaults;
+
+};
+
+/**
+ * @brief Returns the location and type of the fault that identify it independent of the node ids.
+ *
+ * The stuck-at and transition delay faults use the friendly name of the fault location.
+ * The cell-aware faults use the hierarchy name of the cell and the name of the UDFM fault.
+ */
+template<typename FaultModel>
+FaultInformation GetFaultInformation(const Circuit::CircuitEnvironment& circuit, const FaultModel& faultModel);
+
+/**
+ * @brief Creates a coverage database from the metadata of the fault list.
+ */
+template<typename FaultModel, typename FaultList>
+CoverageDatabase CreateCoverageDatabase(const Circuit::CircuitEnvironment& circuit, const FaultList& faultList, size_t numberOfPatterns);
+
+/**
+ * @brief Exports the coverage database in the binary exchange format.
+ *
+ * The database contains no circuit guard as it is intended to be
+ * imported for a different version of the circuit.
+ */
+bool ExportCoverageDatabase(std::ostream& output, const CoverageDatabase& database);
+
+/**
+ * @brief Imports a coverage database from the binary exchange format.
+ */
+std::optional<CoverageDatabase> ImportCoverageDatabase(std::istream& input);
+
+};
+};
+};
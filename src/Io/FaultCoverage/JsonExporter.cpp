@@ -40,9 +40,9 @@ void JsonExporter::ExportFaultCoverage(const CircuitEnvironment& circuitEnvironm
 	const auto& metaData = circuitEnvironment.GetMetaData();
 
 	FileHandle handle(fileName, false);
-	std::ofstream& output = handle.GetOutStream();
+	std::ostream& output = handle.GetOutStream();
 
-	if (!output.is_open())
+	if (!output.good())
 	{
 		LOG(FATAL) << "The file " << fileName << " could not be opened";
 	}
@@ -0,0 +1,279 @@
+#include "Io/FaultListParser/FaultListBinaryParser.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
+#include "Io/FaultListParser/FaultListParser.hpp"
+
+using namespace FreiTest::Basic;
+
+namespace FreiTest
+{
+namespace Io
+{
+
+// ----------------------------------------------------------------------------
+// Binary fault list format
+// ----------------------------------------------------------------------------
+//
+// Header:  magic, version, byte order marker, fault type, record size,
+//          circuit guard, number of faults
+// Records: one FaultRecord for each fault
+//
+// As all records have the same size the fault N starts at the offset
+// (start of records + N * record size).
+// Increment the version when the record layout or the encoding changes.
+
+static constexpr Binary::Magic FAULT_MAGIC { '\x89', 'F', 'T', 'F', 'A', 'U', 'L', 'T' };
+static constexpr uint64_t FAULT_VERSION { 1u };
+static constexpr uint64_t NO_NODE { std::numeric_limits<uint64_t>::max() };
+
+struct FaultRecord
+{
+	uint64_t nodeIndex;
+	uint32_t portNumber;
+	uint8_t portType;
+	uint8_t faultType;
+	uint8_t status;
+	uint8_t targetedStatus;
+
+	uint64_t detectingPatternId;
+	uint64_t detectingNodeIndex;
+	uint32_t detectingPortNumber;
+	uint8_t detectingPortType;
+	uint8_t detectingOutputGood;
+	uint8_t detectingOutputBad;
+	uint8_t reserved;
+	uint64_t detectingTimeframe;
+};
+
+static_assert(sizeof(FaultRecord) == 48u, "The fault record should not contain padding");
+
+template<typename FaultT>
+static constexpr FaultType GetFaultType(void)
+{
+	if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>)
+	{
+		return FaultType::SingleStuckAtFault;
+	}
+	else if constexpr (std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
+	{
+		return FaultType::SingleTransitionDelayFault;
+	}
+	else
+	{
+		static_assert(std::is_same_v<FaultT, Fault::SingleStuckAtFault>, "Unsupported fault type given");
+	}
+}
+
+template<typename FaultT>
+static constexpr uint8_t GetNumberOfFaultSubTypes(void)
+{
+	if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>)
+	{
+		return static_cast<uint8_t>(Fault::StuckAtFaultType::STUCK_AT_FREE) + 1u;
+	}
+	else if constexpr (std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
+	{
+		return static_cast<uint8_t>(Fault::TransitionDelayFaultType::SLOW_TO_TRANSITION) + 1u;
+	}
+}
+
+static bool IsValidPort(const Circuit::MappedNode* node, Circuit::PortType portType, size_t portNumber)
+{
+	return (portType == Circuit::PortType::Output)
+		? (portNumber == 0u)
+		: (portNumber < node->GetNumberOfInputs());
+}
+
+template<typename FaultList>
+bool ExportFaultsBinary(std::ostream& output, const FaultListExchangeFormat<FaultList>& faultList)
+{
+	using FaultT = typename FaultList::fault_type;
+
+	const auto& circuit { faultList.GetCircuit() };
+	const auto& faults { faultList.GetFaults() };
+
+	Binary::BinaryExchangeWriter writer(output);
+	writer.WriteHeader(FAULT_MAGIC, FAULT_VERSION);
+	writer.Write(static_cast<uint64_t>(GetFaultType<FaultT>()));
+	writer.Write(sizeof(FaultRecord));
+	writer.WriteCircuitGuard(circuit);
+	writer.Write(faults.size());
+
+	for (auto const& [fault, metaData] : faults)
+	{
+		FaultRecord record { };
+		record.nodeIndex = fault->GetNode()->GetNodeId();
+		record.portNumber = fault->GetPort().portNumber;
+		record.portType = static_cast<uint8_t>(fault->GetPort().portType);
+		record.faultType = static_cast<uint8_t>(fault->GetType());
+		record.status = static_cast<uint8_t>(metaData->GetFaultStatus());
+		record.targetedStatus = static_cast<uint8_t>(metaData->GetTargetedFaultStatus());
+
+		// The pattern id publishes the remaining detection data and is therefore loaded first
+		record.detectingPatternId = metaData->detectingPatternId.load(std::memory_order_acquire);
+		record.detectingNodeIndex = (metaData->detectingNode.node != nullptr) ? metaData->detectingNode.node->GetNodeId() : NO_NODE;
+		record.detectingPortNumber = metaData->detectingNode.port.portNumber;
+		record.detectingPortType = static_cast<uint8_t>(metaData->detectingNode.port.portType);
+		record.detectingOutputGood = static_cast<uint8_t>(metaData->detectingOutputGood);
+		record.detectingOutputBad = static_cast<uint8_t>(metaData->detectingOutputBad);
+		record.detectingTimeframe = metaData->detectingTimeframe.load(std::memory_order_relaxed);
+		writer.WriteBytes(&record, sizeof(record));
+	}
+
+	if (!writer.IsGood())
+	{
+		LOG(ERROR) << "Could not write binary fault data";
+		return false;
+	}
+
+	return true;
+}
+
+template<typename FaultList>
+std::optional<FaultListExchangeFormat<FaultList>> ImportFaultRangeBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t begin, size_t end)
+{
+	using FaultT = typename FaultList::fault_type;
+	using MetaDataT = typename FaultList::metadata_type;
+
+	const auto& mappedCircuit { circuit.GetMappedCircuit() };
+
+	Binary::BinaryExchangeReader reader(input);
+	if (!reader.ReadHeader(FAULT_MAGIC, FAULT_VERSION))
+	{
+		return std::nullopt;
+	}
+
+	uint64_t faultType;
+	uint64_t recordSize;
+	if (!reader.Read(faultType) || !reader.Read(recordSize))
+	{
+		LOG(ERROR) << "The binary fault file is truncated";
+		return std::nullopt;
+	}
+	if (faultType != static_cast<uint64_t>(GetFaultType<FaultT>()))
+	{
+		const auto detected { (faultType < static_cast<uint64_t>(FaultType::UnknownFault))
+			? static_cast<FaultType>(faultType) : FaultType::UnknownFault };
+		VLOG(1) << "Invalid parser used for file. Expected " << ConvertFaultTypeToString(GetFaultType<FaultT>())
+			<< " but got " << ConvertFaultTypeToString(detected);
+
+		throw FaultTypeException(ConvertFaultTypeToString(GetFaultType<FaultT>()), ConvertFaultTypeToString(detected));
+	}
+	if (recordSize != sizeof(FaultRecord))
+	{
+		LOG(ERROR) << "The binary fault file has records with " << recordSize << " bytes while " << sizeof(FaultRecord) << " bytes are expected";
+		return std::nullopt;
+	}
+	if (!reader.ValidateCircuitGuard(circuit))
+	{
+		return std::nullopt;
+	}
+
+	uint64_t numberOfFaults;
+	if (!reader.Read(numberOfFaults))
+	{
+		LOG(ERROR) << "The binary fault file is truncated";
+		return std::nullopt;
+	}
+
+	end = std::min<size_t>(end, numberOfFaults);
+	begin = std::min<size_t>(begin, end);
+	if (!reader.Seek(reader.GetOffset() + begin * sizeof(FaultRecord)))
+	{
+		LOG(ERROR) << "Could not seek to fault " << begin;
+		return std::nullopt;
+	}
+
+	FaultList faultList;
+	for (size_t faultIndex { begin }; faultIndex < end; ++faultIndex)
+	{
+		FaultRecord record;
+		if (!reader.ReadBytes(&record, sizeof(record)))
+		{
+			LOG(ERROR) << "The binary fault file is truncated";
+			return std::nullopt;
+		}
+
+		const auto portType { static_cast<Circuit::PortType>(record.portType) };
+		if (record.nodeIndex >= mappedCircuit.GetNumberOfNodes())
+		{
+			LOG(ERROR) << "Invalid node which does not exist was given for fault " << faultIndex;
+			return std::nullopt;
+		}
+		if (record.portType > static_cast<uint8_t>(Circuit::PortType::Output)
+			|| !IsValidPort(mappedCircuit.GetNode(record.nodeIndex), portType, record.portNumber))
+		{
+			LOG(ERROR) << "Invalid port " << record.portNumber << " was selected for fault " << faultIndex;
+			return std::nullopt;
+		}
+		if (record.faultType >= GetNumberOfFaultSubTypes<FaultT>()
+			|| record.status > static_cast<uint8_t>(Fault::FaultStatus::FAULT_STATUS_EXTENDED)
+			|| record.targetedStatus > static_cast<uint8_t>(Fault::TargetedFaultStatus::FAULT_STATUS_EQUIVALENT))
+		{
+			LOG(ERROR) << "Invalid fault type or status was given for fault " << faultIndex;
+			return std::nullopt;
+		}
+
+		auto fault { std::make_shared<FaultT>(
+			Circuit::MappedCircuit::NodeAndPort { mappedCircuit.GetNode(record.nodeIndex), { portType, record.portNumber } },
+			static_cast<std::decay_t<decltype(std::declval<FaultT>().GetType())>>(record.faultType)
+		) };
+
+		auto metaData { std::make_shared<MetaDataT>() };
+		metaData->SetFaultStatus(static_cast<Fault::FaultStatus>(record.status));
+		metaData->SetTargetedFaultStatus(static_cast<Fault::TargetedFaultStatus>(record.targetedStatus));
+
+		// Same as for the JSON format, the detection is only restored for detected faults
+		if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		{
+			metaData->detectingPatternId = record.detectingPatternId;
+			metaData->detectionCount = 1u;
+			if (record.detectingNodeIndex != NO_NODE)
+			{
+				const auto detectingPortType { static_cast<Circuit::PortType>(record.detectingPortType) };
+				if (record.detectingNodeIndex >= mappedCircuit.GetNumberOfNodes())
+				{
+					LOG(ERROR) << "Detecting node index for fault " << faultIndex << " is not valid";
+					return std::nullopt;
+				}
+
+				metaData->detectingNode = { mappedCircuit.GetNode(record.detectingNodeIndex), { detectingPortType, record.detectingPortNumber } };
+				metaData->detectingTimeframe = record.detectingTimeframe;
+				metaData->detectingOutputGood = static_cast<Logic>(record.detectingOutputGood);
+				metaData->detectingOutputBad = static_cast<Logic>(record.detectingOutputBad);
+			}
+		}
+
+		faultList.emplace_back(std::move(fault), std::move(metaData));
+	}
+
+	return std::make_optional<FaultListExchangeFormat<FaultList>>(circuit, faultList);
+}
+
+template<typename FaultList>
+std::optional<FaultListExchangeFormat<FaultList>> ImportFaultsBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit)
+{
+	return ImportFaultRangeBinary<FaultList>(input, circuit, 0u, std::numeric_limits<size_t>::max());
+}
+
+template bool ExportFaultsBinary(std::ostream& output, const FaultListExchangeFormat<Fault::SingleStuckAtFaultList>& faultList);
+template std::optional<FaultListExchangeFormat<Fault::SingleStuckAtFaultList>> ImportFaultsBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit);
+template std::optional<FaultListExchangeFormat<Fault::SingleStuckAtFaultList>> ImportFaultRangeBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t begin, size_t end);
+
+template bool ExportFaultsBinary(std::ostream& output, const FaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>& faultList);
+template std::optional<FaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>> ImportFaultsBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit);
+template std::optional<FaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>> ImportFaultRangeBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t begin, size_t end);
+
+};
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <iostream>
+#include <optional>
+
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Io/FaultListParser/FaultListExchangeFormat.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+
+/**
+ * @brief Exports the faults in the binary exchange format.
+ *
+ * Every fault is stored as a fixed-width record with the fault location, the fault status
+ * and the detecting pattern. Only the single stuck-at and transition delay fault lists are supported.
+ */
+template<typename FaultList>
+bool ExportFaultsBinary(std::ostream& output, const FaultListExchangeFormat<FaultList>& faultList);
+
+/**
+ * @brief Imports all faults of a binary exchange file.
+ *
+ * @throw FaultTypeException if the file contains a different fault type.
+ */
+template<typename FaultList>
+std::optional<FaultListExchangeFormat<FaultList>> ImportFaultsBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit);
+
+/**
+ * @brief Imports the faults [begin, end) of a binary exchange file.
+ *
+ * The faults before begin are skipped without decoding them.
+ * The first imported fault has the index 0 in the result.
+ *
+ * @throw FaultTypeException if the file contains a different fault type.
+ */
+template<typename FaultList>
+std::optional<FaultListExchangeFormat<FaultList>> ImportFaultRangeBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t begin, size_t end);
+
+};
+};
@@ -16,7 +16,11 @@
 #include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
 #include "Basic/Fault/Lists/CellAwareFaultList.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
 #include "Io/CircuitGuard/CircuitGuard.hpp"
+#include "Io/FaultListParser/FaultListBinaryParser.hpp"
+#include "Io/JsoncParser/JsonStreamReader.hpp"
+#include "Io/JsoncParser/JsonStreamWriter.hpp"
 
 using namespace FreiTest::Basic;
 
@@ -337,196 +341,223 @@ static Circuit::PortType ConvertStringToPortType(std::string str)
 	__builtin_unreachable();
 }
 
+static std::string GetTargetedFaultStatusString(const boost::property_tree::ptree& faultItem)
+{
+	// Older versions of the importer expected the key "status-targeted"
+	// while the exporter has always written "status_targeted".
+	if (auto status = faultItem.get_child_optional("status_targeted"); status)
+	{
+		return status->get_value<std::string>();
+	}
+
+	return faultItem.get_child("status-targeted").get_value<std::string>();
+}
+
 static bool CheckOutputLogic(Logic goodOutput, Logic badOutput)
 {
 	return (goodOutput == Logic::LOGIC_ZERO && badOutput == Logic::LOGIC_ONE)
 		|| (badOutput == Logic::LOGIC_ZERO && goodOutput == Logic::LOGIC_ONE);
 }
 
+static void WriteNodeAndPort(Json::JsonStreamWriter& writer, const Circuit::CircuitEnvironment& circuit, const Circuit::MappedCircuit::NodeAndPort& nodeAndPort)
+{
+	const auto& [node, port] = nodeAndPort;
+	writer.WriteMember("node_index", node->GetNodeId());
+	writer.WriteMember("node_name", node->GetName());
+	writer.WriteMember("signal_name", circuit.GetMappedCircuit().GetDriverForPort(nodeAndPort)->GetOutputSignalName());
+	writer.WriteMember("friendly_name", circuit.GetMetaData().GetFriendlyName(nodeAndPort));
+	writer.WriteMember("port_type", ConvertPortTypeToString(port.portType));
+	writer.WriteMember("port_number", port.portNumber);
+}
+
+template<typename MetaDataT>
+static void WriteDetection(Json::JsonStreamWriter& writer, const Circuit::CircuitEnvironment& circuit, const MetaDataT& metaData)
+{
+	const auto& mappedCircuit { circuit.GetMappedCircuit() };
+	const auto& circuitMetaData { circuit.GetMetaData() };
+
+	writer.WriteMember("status", ConvertFaultStatusToString(metaData.GetFaultStatus()));
+	writer.WriteMember("status_targeted", ConvertTargetedFaultStatusToString(metaData.GetTargetedFaultStatus()));
+
+	if (metaData.GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+	{
+		writer.WriteKey("pattern");
+		writer.BeginObject();
+		// The pattern id publishes the remaining detection data and is therefore loaded first
+		writer.WriteMember("pattern_index", metaData.detectingPatternId.load(std::memory_order_acquire));
+		writer.WriteMember("detection_count", metaData.detectionCount.load());
+		writer.WriteKey("detected_by");
+		writer.BeginObject();
+		if (metaData.detectingNode.node != nullptr)
+		{
+			writer.WriteMember("node_index", metaData.detectingNode.node->GetNodeId());
+			writer.WriteMember("port_type", ConvertPortTypeToString(metaData.detectingNode.port.portType));
+			writer.WriteMember("port_number", metaData.detectingNode.port.portNumber);
+			writer.WriteMember("node_name", metaData.detectingNode.node->GetName());
+			writer.WriteMember("signal_name", mappedCircuit.GetDriverForPort(metaData.detectingNode)->GetOutputSignalName());
+			writer.WriteMember("friendly_name", circuitMetaData.GetFriendlyName(metaData.detectingNode));
+			writer.WriteMember("timeframe", metaData.detectingTimeframe.load(std::memory_order_relaxed));
+			writer.WriteMember("good_value", static_cast<char>(metaData.detectingOutputGood));
+			writer.WriteMember("bad_value", static_cast<char>(metaData.detectingOutputBad));
+		}
+		writer.EndObject();
+		writer.EndObject();
+	}
+}
+
 template<typename FaultList, typename... Params>
 bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<FaultList>& faultList, const Params&... params)
 {
-	using ptree = boost::property_tree::ptree;
 	using FaultT = typename FaultList::fault_type;
 	using MetaDataT = typename FaultList::metadata_type;
 
 	const auto& circuit { faultList.GetCircuit() };
-	const auto& circuitMetaData { circuit.GetMetaData() };
-	const auto& mappedCircuit { circuit.GetMappedCircuit() };
 	const auto& faults { faultList.GetFaults() };
 
-	ptree faultListType;
-	faultListType.put("fault_list_type", GetFaultTypeString<FaultT>());
+	// The faults are written one by one to keep the memory usage independent of the number of faults
+	Json::JsonStreamWriter writer(output);
+	writer.BeginObject();
+	writer.WriteKey("meta_data");
+	writer.BeginObject();
+	writer.WriteMember("fault_list_type", GetFaultTypeString<FaultT>());
+	writer.EndObject();
 
-	ptree exportFaultList;
+	writer.WriteKey("faults");
+	writer.BeginArray();
 	size_t faultIndex = 0u;
 	for (auto const& [fault, metaData] : faults)
 	{
-		ptree faultItem;
+		writer.BeginObject();
+		writer.WriteMember("index", faultIndex++);
+		writer.WriteKey("fault");
+		writer.BeginObject();
 
 		// Implement other fault types below
 		if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>
 			|| std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
 		{
-			faultItem.put("node_index", fault->GetNode()->GetNodeId());
-			faultItem.put("node_name", fault->GetNode()->GetName());
-			faultItem.put("signal_name", mappedCircuit.GetDriverForPort(*fault)->GetOutputSignalName());
-			faultItem.put("friendly_name", circuitMetaData.GetFriendlyName(*fault));
-			faultItem.put("port_type", ConvertPortTypeToString(fault->GetPort().portType));
-			faultItem.put("port_number", fault->GetPort().portNumber);
-			faultItem.put("type", GetFaultTypeString<FaultT>());
-			faultItem.put("subtype", ConvertFaultSubTypeToString(fault->GetType()));
+			WriteNodeAndPort(writer, circuit, fault->GetNodeAndPort());
+			writer.WriteMember("type", GetFaultTypeString<FaultT>());
+			writer.WriteMember("subtype", ConvertFaultSubTypeToString(fault->GetType()));
 		}
 		else if constexpr (std::is_same_v<FaultT, Fault::CellAwareFault>)
 		{
 			const auto userDefinedFault = fault->GetUserDefinedFault();
-			faultItem.put("type", GetFaultTypeString<FaultT>());
-			faultItem.put("fault_name", userDefinedFault->GetFaultName());
-			faultItem.put("fault_category", userDefinedFault->GetFaultCategory());
-			faultItem.put("cell_name", userDefinedFault->GetCellName());
-			faultItem.put("cell_group", fault->GetCell()->GetHierarchyName());
-
-			ptree alternativesItem;
-			ptree alternativeList;
+			writer.WriteMember("type", GetFaultTypeString<FaultT>());
+			writer.WriteMember("fault_name", userDefinedFault->GetFaultName());
+			writer.WriteMember("fault_category", userDefinedFault->GetFaultCategory());
+			writer.WriteMember("cell_name", userDefinedFault->GetCellName());
+			writer.WriteMember("cell_group", fault->GetCell()->GetHierarchyName());
+
+			writer.WriteKey("alternatives");
+			writer.BeginArray();
 			for (size_t alternativesIndex = 0; alternativesIndex < userDefinedFault->GetAlternatives().size(); ++alternativesIndex)
 			{
-				alternativeList.put("index", alternativesIndex);
-				alternativeList.put("test_type", userDefinedFault->GetAlternative(alternativesIndex)->GetTestType());
-				ptree faultConditionsItem;
+				writer.BeginObject();
+				writer.WriteMember("index", alternativesIndex);
+				writer.WriteMember("test_type", userDefinedFault->GetAlternative(alternativesIndex)->GetTestType());
+
+				writer.WriteKey("fault_conditions");
+				writer.BeginArray();
 				for (const auto& condition : fault->GetAlternatives()[alternativesIndex].conditions)
 				{
-					const auto& [conditionNode, conditionPort] = condition.nodeAndPort;
-
-					ptree singleFaultConditionItem;
-					singleFaultConditionItem.put("node_index", conditionNode->GetNodeId());
-					singleFaultConditionItem.put("node_name", conditionNode->GetName());
-					singleFaultConditionItem.put("signal_name", mappedCircuit.GetDriverForPort(condition.nodeAndPort)->GetOutputSignalName());
-					singleFaultConditionItem.put("friendly_name", circuitMetaData.GetFriendlyName(condition.nodeAndPort));
-					singleFaultConditionItem.put("port_type", ConvertPortTypeToString(conditionPort.portType));
-					singleFaultConditionItem.put("port_number", conditionPort.portNumber);
-					singleFaultConditionItem.put("port_name", condition.portName);
-					singleFaultConditionItem.put("port_value", condition.logicConstraints);
-
-					faultConditionsItem.push_back(std::make_pair("", singleFaultConditionItem));
+					writer.BeginObject();
+					WriteNodeAndPort(writer, circuit, condition.nodeAndPort);
+					writer.WriteMember("port_name", condition.portName);
+					writer.WriteMember("port_value", condition.logicConstraints);
+					writer.EndObject();
 				}
-				alternativeList.put_child("fault_conditions", faultConditionsItem);
+				writer.EndArray();
 
-				ptree faultEffectsItem;
+				writer.WriteKey("fault_effects");
+				writer.BeginArray();
 				for (const auto& effect : fault->GetAlternatives()[alternativesIndex].effects)
 				{
-					const auto& [effectNode, effectPort] = effect.nodeAndPort;
-
-					ptree singleFaultEffectsItem;
-					singleFaultEffectsItem.put("node_index", effectNode->GetNodeId());
-					singleFaultEffectsItem.put("node_name", effectNode->GetName());
-					singleFaultEffectsItem.put("signal_name", mappedCircuit.GetDriverForPort(effect.nodeAndPort)->GetOutputSignalName());
-					singleFaultEffectsItem.put("friendly_name", circuitMetaData.GetFriendlyName(effect.nodeAndPort));
-					singleFaultEffectsItem.put("port_type", ConvertPortTypeToString(effectPort.portType));
-					singleFaultEffectsItem.put("port_number", effectPort.portNumber);
-					singleFaultEffectsItem.put("port_name", effect.portName);
-					singleFaultEffectsItem.put("faulty_port_value", effect.logicConstraints);
-
-					faultEffectsItem.push_back(std::make_pair("", singleFaultEffectsItem));
+					writer.BeginObject();
+					WriteNodeAndPort(writer, circuit, effect.nodeAndPort);
+					writer.WriteMember("port_name", effect.portName);
+					writer.WriteMember("faulty_port_value", effect.logicConstraints);
+					writer.EndObject();
 				}
-				alternativeList.put_child("fault_effects", faultEffectsItem);
-				alternativesItem.push_back(std::make_pair("", alternativeList));
+				writer.EndArray();
+				writer.EndObject();
 			}
-
-			faultItem.put_child("alternatives", alternativesItem);
+			writer.EndArray();
 		}
 		else
 		{
 			static_assert(std::is_same_v<FaultT, Fault::SingleStuckAtFault>, "Unsupported fault type given");
 		}
 
-		ptree faultResultItem;
-		faultResultItem.put("index", faultIndex++);
-		faultResultItem.put_child("fault", faultItem);
+		writer.EndObject();
 
 		// Implement other metaData types below
 		if constexpr (std::is_same_v<MetaDataT, Fault::SingleStuckAtFaultMetaData>
-			|| std::is_same_v<MetaDataT, Fault::SingleTransitionDelayFaultMetaData>)
+			|| std::is_same_v<MetaDataT, Fault::SingleTransitionDelayFaultMetaData>
+			|| std::is_same_v<MetaDataT, Fault::CellAwareMetaData>)
 		{
-			faultResultItem.put("status", ConvertFaultStatusToString(metaData->faultStatus));
-			faultResultItem.put("status_targeted", ConvertTargetedFaultStatusToString(metaData->targetedFaultStatus));
-
-			if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED)
-			{
-				ptree detectedByItem;
-				if (metaData->detectingNode.node != nullptr)
-				{
-					detectedByItem.put("node_index", metaData->detectingNode.node->GetNodeId());
-					detectedByItem.put("port_type", ConvertPortTypeToString(metaData->detectingNode.port.portType));
-					detectedByItem.put("port_number", metaData->detectingNode.port.portNumber);
-					detectedByItem.put("node_name", metaData->detectingNode.node->GetName());
-					detectedByItem.put("signal_name", mappedCircuit.GetDriverForPort(metaData->detectingNode)->GetOutputSignalName());
-					detectedByItem.put("friendly_name", circuitMetaData.GetFriendlyName(metaData->detectingNode));
-					detectedByItem.put("timeframe", metaData->detectingTimeframe);
-					detectedByItem.put("good_value", static_cast<char>(metaData->detectingOutputGood));
-					detectedByItem.put("bad_value", static_cast<char>(metaData->detectingOutputBad));
-				}
-
-				ptree testPatternItem;
-				testPatternItem.put("pattern_index", metaData->detectingPatternId);
-				testPatternItem.put_child("detected_by", detectedByItem);
-
-				faultResultItem.put_child("pattern", testPatternItem);
-			}
-		}
-		else if constexpr (std::is_same_v<MetaDataT, Fault::CellAwareMetaData>)
-		{
-			faultResultItem.put("status", ConvertFaultStatusToString(metaData->faultStatus));
-			faultResultItem.put("status_targeted", ConvertTargetedFaultStatusToString(metaData->targetedFaultStatus));
-
-			if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED)
-			{
-				ptree detectedByItem;
-				if (metaData->detectingNode.node != nullptr)
-				{
-					detectedByItem.put("node_index", metaData->detectingNode.node->GetNodeId());
-					detectedByItem.put("port_type", ConvertPortTypeToString(metaData->detectingNode.port.portType));
-					detectedByItem.put("port_number", metaData->detectingNode.port.portNumber);
-					detectedByItem.put("node_name", metaData->detectingNode.node->GetName());
-					detectedByItem.put("signal_name", mappedCircuit.GetDriverForPort(metaData->detectingNode)->GetOutputSignalName());
-					detectedByItem.put("friendly_name", circuitMetaData.GetFriendlyName(metaData->detectingNode));
-					detectedByItem.put("timeframe", metaData->detectingTimeframe);
-					detectedByItem.put("good_value", static_cast<char>(metaData->detectingOutputGood));
-					detectedByItem.put("bad_value", static_cast<char>(metaData->detectingOutputBad));
-				}
-
-				ptree testPatternItem;
-				testPatternItem.put("pattern_index", metaData->detectingPatternId);
-				testPatternItem.put_child("detected_by", detectedByItem);
-
-				faultResultItem.put_child("pattern", testPatternItem);
-			}
+			WriteDetection(writer, circuit, *metaData);
 		}
 		else
 		{
 			static_assert(std::is_same_v<MetaDataT, Fault::SingleStuckAtFaultMetaData>, "Unsupported fault metaData type given");
 		}
 
-		exportFaultList.push_back(std::make_pair("", faultResultItem));
+		writer.EndObject();
 	}
+	writer.EndArray();
 
-	ptree root;
-	root.put_child("meta_data", faultListType);
-	root.put_child("faults", exportFaultList);
-	root.put_child("circuit", CreateCircuitGuard(circuit));
+	writer.WriteKey("circuit");
+	writer.WriteTree(CreateCircuitGuard(circuit));
+	writer.EndObject();
+	writer.Finish();
 
-	try
-	{
-		boost::property_tree::write_json(output, root);
-	}
-	catch (boost::property_tree::json_parser_error& exception)
+	if (!writer.IsGood())
 	{
-		LOG(ERROR) << "Could not write json data: " << exception.what();
+		LOG(ERROR) << "Could not write json data";
 		return false;
 	}
 
 	return true;
 }
 
+template<typename FaultList>
+Settings::ExchangeFormat GetFaultListExchangeFormat(Settings::ExchangeFormat format)
+{
+	using FaultT = typename FaultList::fault_type;
+
+	if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>
+		|| std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
+	{
+		return format;
+	}
+	else
+	{
+		return Settings::ExchangeFormat::Json;
+	}
+}
+
+template<typename FaultList>
+std::string GetFaultListExchangeExtension(Settings::ExchangeFormat format)
+{
+	return Settings::GetExchangeExtension(GetFaultListExchangeFormat<FaultList>(format));
+}
+
+template<typename FaultList>
+bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<FaultList>& faultList, Settings::ExchangeFormat format)
+{
+	if constexpr (std::is_same_v<typename FaultList::fault_type, Fault::SingleStuckAtFault>
+		|| std::is_same_v<typename FaultList::fault_type, Fault::SingleTransitionDelayFault>)
+	{
+		if (GetFaultListExchangeFormat<FaultList>(format) == Settings::ExchangeFormat::Binary)
+		{
+			return ExportFaultsBinary(output, faultList);
+		}
+	}
+
+	return ExportFaults(output, faultList);
+}
+
 template<typename FaultList, typename... Params>
 std::optional<FaultListExchangeFormat<FaultList>> ImportFaults(std::istream& input, const Circuit::CircuitEnvironment& circuit, const Params&... params)
 {
@@ -534,20 +565,23 @@ std::optional<FaultListExchangeFormat<FaultList>> ImportFaults(std::istream& inp
 	using FaultT = typename FaultList::fault_type;
 	using MetaDataT = typename FaultList::metadata_type;
 
-	const auto& mappedCircuit = circuit.GetMappedCircuit();
-	const auto parameters { std::make_tuple(std::forward<const Params&>(params)...) };
-
-	try
+	if (Binary::IsBinaryExchangeStream(input))
 	{
-		ptree root;
-		boost::property_tree::read_json(input, root);
-		if (!ValidateCircuitGuard(root.get_child("circuit"), circuit))
+		if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>
+			|| std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
 		{
-			return std::nullopt;
+			return ImportFaultsBinary<FaultList>(input, circuit);
 		}
 
-		ptree& listMetaData = root.get_child("meta_data");
-		std::string faultListTypeString = listMetaData.get_child("fault_list_type").get_value<std::string>();
+		LOG(ERROR) << "The binary exchange format does not support " << GetFaultTypeString<FaultT>();
+		return std::nullopt;
+	}
+
+	const auto& mappedCircuit = circuit.GetMappedCircuit();
+	const auto parameters { std::make_tuple(std::forward<const Params&>(params)...) };
+
+	const auto check_fault_list_type = [&](const ptree& document) {
+		std::string faultListTypeString = document.get_child("meta_data.fault_list_type").get_value<std::string>();
 		if (faultListTypeString != GetFaultTypeString<FaultT>())
 		{
 			VLOG(1) << "Invalid parser used for file. Expected " << GetFaultTypeString<FaultT>()
@@ -555,450 +589,488 @@ std::optional<FaultListExchangeFormat<FaultList>> ImportFaults(std::istream& inp
 
 			throw FaultTypeException(GetFaultTypeString<FaultT>(), faultListTypeString);
 		}
+	};
 
-		Fault::ConcurrentFaultList<FaultT, MetaDataT> faultList;
-
-		ptree& treeFaults = root.get_child("faults");
-		for (auto it = treeFaults.ordered_begin(); it != treeFaults.not_found(); ++it)
+	// The circuit guard and the fault list type are checked as soon as they have been read.
+	// Members that follow the faults are checked after the streaming. Therefore, every
+	// node index of a fault is range-checked before the node is accessed.
+	bool circuitValidated { false };
+	bool faultListTypeChecked { false };
+	const auto check_document = [&](const ptree& document) -> bool {
+		if (!circuitValidated && document.find("circuit") != document.not_found())
 		{
-			ptree& faultItem = it->second;
-
-			DVLOG(5) << "Importing fault with index " << faultList.size();
-			if (faultItem.get_child("index").get_value<size_t>() != faultList.size())
+			if (!ValidateCircuitGuard(document.get_child("circuit"), circuit))
 			{
-				LOG(ERROR) << "Fault has invalid index";
-				return std::nullopt;
+				return false;
 			}
+			circuitValidated = true;
+		}
+		if (!faultListTypeChecked && document.find("meta_data") != document.not_found())
+		{
+			check_fault_list_type(document);
+			faultListTypeChecked = true;
+		}
+		return true;
+	};
+
+	Fault::ConcurrentFaultList<FaultT, MetaDataT> faultList;
+	const auto import_fault = [&](ptree& faultItem, const ptree& document) -> bool {
+		if (faultList.size() == 0u && !check_document(document))
+		{
+			return false;
+		}
+
+		DVLOG(5) << "Importing fault with index " << faultList.size();
+		if (faultItem.get_child("index").get_value<size_t>() != faultList.size())
+		{
+			LOG(ERROR) << "Fault has invalid index";
+			return false;
+		}
+		if (faultItem.get_child("fault.type").get_value<std::string>() != GetFaultTypeString<FaultT>())
+		{
+			LOG(ERROR) << "Invalid parser used for file. Expected " << GetFaultTypeString<FaultT>()
+				<< " but got " << faultItem.get_child("fault.type").get_value<std::string>();
+			return false;
+		}
+
+		std::shared_ptr<FaultT> fault;
+		std::shared_ptr<MetaDataT> metaData;
 
-			std::shared_ptr<FaultT> fault;
-			std::shared_ptr<MetaDataT> metaData;
+		// Implement other fault types below
+		if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>
+			|| std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
+		{
+			Circuit::PortType portType = ConvertStringToPortType(faultItem.get_child("fault.port_type").get_value<std::string>());
+			size_t nodeId = faultItem.get_child("fault.node_index").get_value<size_t>();
+			size_t portNumber = faultItem.get_child("fault.port_number").get_value<size_t>();
 
-			// Implement other fault types below
-			if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>
-				|| std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
+			if (nodeId >= mappedCircuit.GetNumberOfNodes())
 			{
-				if (faultItem.get_child("fault.type").get_value<std::string>() != GetFaultTypeString<FaultT>())
-				{
-					LOG(ERROR) << "Invalid parser used for file. Expected " << GetFaultTypeString<FaultT>()
-						<< " but got " << faultItem.get_child("fault.type").get_value<std::string>();
-					return std::nullopt;
-				}
+				LOG(ERROR) << "Invalid node which does not exist was given for fault";
+				return false;
+			}
 
-				Circuit::PortType portType = ConvertStringToPortType(faultItem.get_child("fault.port_type").get_value<std::string>());
-				size_t nodeId = faultItem.get_child("fault.node_index").get_value<size_t>();
-				size_t portNumber = faultItem.get_child("fault.port_number").get_value<size_t>();
+			if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>)
+			{
+				fault = std::make_shared<FaultT>(
+					Circuit::MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { portType, portNumber } },
+					ConvertStringToFaultSubType<Fault::StuckAtFaultType>(faultItem.get_child("fault.subtype").get_value<std::string>())
+				);
+			}
+			else if constexpr (std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
+			{
+				fault = std::make_shared<FaultT>(
+					Circuit::MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { portType, portNumber } },
+					ConvertStringToFaultSubType<Fault::TransitionDelayFaultType>(faultItem.get_child("fault.subtype").get_value<std::string>())
+				);
+			}
 
-				if constexpr (std::is_same_v<FaultT, Fault::SingleStuckAtFault>)
-				{
-					fault = std::make_shared<FaultT>(
-						Circuit::MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { portType, portNumber } },
-						ConvertStringToFaultSubType<Fault::StuckAtFaultType>(faultItem.get_child("fault.subtype").get_value<std::string>())
-					);
-				}
-				else if constexpr (std::is_same_v<FaultT, Fault::SingleTransitionDelayFault>)
-				{
-					fault = std::make_shared<FaultT>(
-						Circuit::MappedCircuit::NodeAndPort { mappedCircuit.GetNode(nodeId), { portType, portNumber } },
-						ConvertStringToFaultSubType<Fault::TransitionDelayFaultType>(faultItem.get_child("fault.subtype").get_value<std::string>())
-					);
-				}
+			if (fault->GetNode()->GetName() != faultItem.get_child("fault.node_name").get_value<std::string>())
+			{
+				LOG(ERROR) << "Fault node has invalid name \"" << faultItem.get_child("fault.node_name").get_value<std::string>()
+					<< "\", expected \"" << fault->GetNode()->GetName() << "\"";
+				return false;
+			}
+			if (fault->GetNode()->GetOutputSignalName() != faultItem.get_child("fault.signal_name").get_value<std::string>())
+			{
+				LOG(ERROR) << "Fault node has invalid signal name \"" << faultItem.get_child("fault.signal_name").get_value<std::string>()
+					<< "\", expected \"" << fault->GetNode()->GetOutputSignalName() << "\"";
+				return false;
+			}
 
-				if (fault->GetNode()->GetNodeId() >= mappedCircuit.GetNumberOfNodes())
-				{
-					LOG(ERROR) << "Invalid node which does not exist was given for fault";
-					return std::nullopt;
-				}
-				if (fault->GetNode()->GetName() != faultItem.get_child("fault.node_name").get_value<std::string>())
+			if (fault->GetPort().portType == Circuit::PortType::Output)
+			{
+				if (fault->GetPort().portNumber != 0u)
 				{
-					LOG(ERROR) << "Fault node has invalid name \"" << faultItem.get_child("fault.node_name").get_value<std::string>()
-						<< "\", expected \"" << fault->GetNode()->GetName() << "\"";
-					return std::nullopt;
+					LOG(ERROR) << "Invalid output port " << fault->GetPort().portNumber << " was selected";
+					return false;
 				}
-				if (fault->GetNode()->GetOutputSignalName() != faultItem.get_child("fault.signal_name").get_value<std::string>())
+			}
+			else
+			{
+				if (fault->GetPort().portNumber >= fault->GetNode()->GetNumberOfInputs())
 				{
-					LOG(ERROR) << "Fault node has invalid signal name \"" << faultItem.get_child("fault.signal_name").get_value<std::string>()
-						<< "\", expected \"" << fault->GetNode()->GetOutputSignalName() << "\"";
-					return std::nullopt;
+					LOG(ERROR) << "Invalid input port " << fault->GetPort().portNumber << " was selected";
+					return false;
 				}
+			}
+		}
+		else if constexpr(std::is_same_v<FaultT, Fault::CellAwareFault>)
+		{
+			auto [udfm] = parameters;
 
-				if (fault->GetPort().portType == Circuit::PortType::Output)
-				{
-					if (fault->GetPort().portNumber != 0u)
-					{
-						LOG(ERROR) << "Invalid output port " << fault->GetPort().portNumber << " was selected";
-						return std::nullopt;
-					}
-				}
-				else
-				{
-					if (fault->GetPort().portNumber >= fault->GetNode()->GetNumberOfInputs())
-					{
-						LOG(ERROR) << "Invalid input port " << fault->GetPort().portNumber << " was selected";
-						return std::nullopt;
-					}
-				}
+			if (faultItem.get_child("fault.fault_name").get_value<std::string>().empty())
+			{
+				LOG(ERROR) << "Fault name is empty!";
+				return false;
+			}
+			if (faultItem.get_child("fault.fault_category").get_value<std::string>().empty())
+			{
+				LOG(ERROR) << "Fault category is empty!";
+				return false;
+			}
+			if (faultItem.get_child("fault.cell_name").get_value<std::string>().empty())
+			{
+				LOG(ERROR) << "Cell name is empty!";
+				return false;
 			}
-			else if constexpr(std::is_same_v<FaultT, Fault::CellAwareFault>)
+			if (faultItem.get_child("fault.cell_group").get_value<std::string>().empty())
 			{
-				auto [udfm] = parameters;
+				LOG(ERROR) << "Cell group is empty!";
+				return false;
+			}
 
-				if (faultItem.get_child("fault.type").get_value<std::string>() != GetFaultTypeString<FaultT>())
-				{
-					LOG(ERROR) << "Invalid parser used for file. Expected " << GetFaultTypeString<FaultT>()
-						<< " but got " << faultItem.get_child("fault.type").get_value<std::string>();
-					return std::nullopt;
-				}
+			size_t nodeId;
+			std::string nodeName;
+			std::string signalName;
+			Circuit::PortType portType;
+			size_t portNumber;
+			std::string portName;
+			std::vector<LogicConstraint> portConstraints;
+
+			Io::Udfm::UdfmPortMap faultConditionMap;
+			Io::Udfm::UdfmPortMap faultEffectMap;
+			std::vector<Fault::CellAwareAlternative> faultAlternatives;
+
+			ptree& alternativesItem = faultItem.get_child("fault.alternatives");
+			size_t alternativesIndex = 0;
+			for (auto altIt = alternativesItem.ordered_begin(); altIt != alternativesItem.not_found(); ++altIt, ++alternativesIndex)
+			{
+				ptree& alternativeItem = altIt->second;
 
-				if (faultItem.get_child("fault.fault_name").get_value<std::string>().empty())
-				{
-					LOG(ERROR) << "Fault name is empty!";
-					return std::nullopt;
-				}
-				if (faultItem.get_child("fault.fault_category").get_value<std::string>().empty())
+				if (alternativeItem.get_child("index").get_value<size_t>() != alternativesIndex)
 				{
-					LOG(ERROR) << "Fault category is empty!";
-					return std::nullopt;
-				}
-				if (faultItem.get_child("fault.cell_name").get_value<std::string>().empty())
-				{
-					LOG(ERROR) << "Cell name is empty!";
-					return std::nullopt;
-				}
-				if (faultItem.get_child("fault.cell_group").get_value<std::string>().empty())
-				{
-					LOG(ERROR) << "Cell group is empty!";
-					return std::nullopt;
+					LOG(ERROR) << "Alternative has invalid index!";
+					return false;
 				}
 
-				size_t nodeId;
-				std::string nodeName;
-				std::string signalName;
-				Circuit::PortType portType;
-				size_t portNumber;
-				std::string portName;
-				std::vector<LogicConstraint> portConstraints;
-
-				Io::Udfm::UdfmPortMap faultConditionMap;
-				Io::Udfm::UdfmPortMap faultEffectMap;
-				std::vector<Fault::CellAwareAlternative> faultAlternatives;
-
-				ptree& alternativesItem = faultItem.get_child("fault.alternatives");
-				size_t alternativesIndex = 0;
-				for (auto altIt = alternativesItem.ordered_begin(); altIt != alternativesItem.not_found(); ++altIt, ++alternativesIndex)
+				faultConditionMap.clear();
+				faultAlternatives.push_back( { .conditions = { }, .effects = { } } );
+				ptree& faultConditionsItem = alternativeItem.get_child("fault_conditions");
+				for (auto fConIt = faultConditionsItem.ordered_begin(); fConIt != faultConditionsItem.not_found(); ++fConIt)
 				{
-					ptree& alternativeItem = altIt->second;
+					ptree& faultConditionItem = fConIt->second;
+
+					nodeId = faultConditionItem.get_child("node_index").get_value<size_t>();
+					nodeName = faultConditionItem.get_child("node_name").get_value<std::string>();
+					signalName = faultConditionItem.get_child("signal_name").get_value<std::string>();
+					portType = ConvertStringToPortType(faultConditionItem.get_child("port_type").get_value<std::string>());
+					portNumber = faultConditionItem.get_child("port_number").get_value<size_t>();
+					portName = faultConditionItem.get_child("port_name").get_value<std::string>();
+					portConstraints = GetLogicConstraintsForString(faultConditionItem.get_child("port_value").get_value<std::string>());
 
-					if (alternativeItem.get_child("index").get_value<size_t>() != alternativesIndex)
+					if (nodeId >= mappedCircuit.GetNumberOfNodes())
 					{
-						LOG(ERROR) << "Alternative has invalid index!";
-						return std::nullopt;
+						LOG(ERROR) << "Invalid node which does not exist was given for fault";
+						return false;
 					}
+					const auto node = mappedCircuit.GetNode(nodeId);
 
-					faultConditionMap.clear();
-					faultAlternatives.push_back( { .conditions = { }, .effects = { } } );
-					ptree& faultConditionsItem = alternativeItem.get_child("fault_conditions");
-					for (auto fConIt = faultConditionsItem.ordered_begin(); fConIt != faultConditionsItem.not_found(); ++fConIt)
+					if (nodeName != node->GetName())
 					{
-						ptree& faultConditionItem = fConIt->second;
-
-						nodeId = faultConditionItem.get_child("node_index").get_value<size_t>();
-						nodeName = faultConditionItem.get_child("node_name").get_value<std::string>();
-						signalName = faultConditionItem.get_child("signal_name").get_value<std::string>();
-						portType = ConvertStringToPortType(faultConditionItem.get_child("port_type").get_value<std::string>());
-						portNumber = faultConditionItem.get_child("port_number").get_value<size_t>();
-						portName = faultConditionItem.get_child("port_name").get_value<std::string>();
-						portConstraints = GetLogicConstraintsForString(faultConditionItem.get_child("port_value").get_value<std::string>());
-
-						const auto node = mappedCircuit.GetNode(nodeId);
-						if (nodeId >= mappedCircuit.GetNumberOfNodes())
-						{
-							LOG(ERROR) << "Invalid node which does not exist was given for fault";
-							return std::nullopt;
-						}
-
-						if (nodeName != node->GetName())
-						{
-							LOG(ERROR) << "Node has invalid name \"" << nodeName << "\", expected \"" << node->GetName() << "\"";
-							return std::nullopt;
-						}
-						if (signalName != node->GetOutputSignalName())
-						{
-							LOG(ERROR) << "Fault node has invalid signal name \"" << signalName << "\", expected \"" << node->GetOutputSignalName() << "\"";
-							return std::nullopt;
-						}
-
-						if (portType == Circuit::PortType::Output)
-						{
-							if (portNumber != 0u)
-							{
-								LOG(ERROR) << "Found invalid output port with portNumber " << portNumber;
-								return std::nullopt;
-							}
-						}
-						else
-						{
-							if (portNumber >= node->GetNumberOfInputs())
-							{
-								LOG(ERROR) << "Found input port with portNumber " << portNumber << "is too big";
-							}
-						}
-
-						if (portName.size() == 0)
-						{
-							LOG(ERROR) << "Port has empty name!";
-							return std::nullopt;
-						}
-
-						if (faultConditionMap.find(portName) != faultConditionMap.end())
-						{
-							LOG(ERROR) << "Port with name \"" << portName << "\" appeared twice in fault_condition!";
-							return std::nullopt;
-						}
-						faultConditionMap[portName] = portConstraints;
-						faultAlternatives[alternativesIndex].conditions.push_back( {
-							{ mappedCircuit.GetNode(nodeId), { portType, portNumber } },	// NodeAndPort
-							portName,
-							portConstraints
-						} );
+						LOG(ERROR) << "Node has invalid name \"" << nodeName << "\", expected \"" << node->GetName() << "\"";
+						return false;
 					}
-
-					faultEffectMap.clear();
-					ptree& faultEffectsItem = alternativeItem.get_child("fault_effects");
-					for (auto fEffIt = faultEffectsItem.ordered_begin(); fEffIt != faultEffectsItem.not_found(); ++fEffIt)
+					if (signalName != node->GetOutputSignalName())
 					{
-						ptree& faultEffectItem = fEffIt->second;
-
-						nodeId = faultEffectItem.get_child("node_index").get_value<size_t>();
-						nodeName = faultEffectItem.get_child("node_name").get_value<std::string>();
-						signalName = faultEffectItem.get_child("signal_name").get_value<std::string>();
-						portType = ConvertStringToPortType(faultEffectItem.get_child("port_type").get_value<std::string>());
-						portNumber = faultEffectItem.get_child("port_number").get_value<size_t>();
-						portName = faultEffectItem.get_child("port_name").get_value<std::string>();
-						portConstraints = GetLogicConstraintsForString(faultEffectItem.get_child("faulty_port_value").get_value<std::string>());
-
-						const auto node = mappedCircuit.GetNode(nodeId);
-						if (nodeId >= mappedCircuit.GetNumberOfNodes())
-						{
-							LOG(ERROR) << "Invalid node which does not exist was given for fault";
-							return std::nullopt;
-						}
-
-						if (nodeName != node->GetName())
-						{
-							LOG(ERROR) << "Node has invalid name \"" << nodeName << "\", expected \"" << node->GetName() << "\"";
-							return std::nullopt;
-						}
-						if (signalName != node->GetOutputSignalName())
-						{
-							LOG(ERROR) << "Fault node has invalid signal name \"" << signalName << "\", expected \"" << node->GetOutputSignalName() << "\"";
-							return std::nullopt;
-						}
-
-						if (portType == Circuit::PortType::Output)
-						{
-							if (portNumber != 0u)
-							{
-								LOG(ERROR) << "Found invalid output port with portNumber " << portNumber;
-								return std::nullopt;
-							}
-						}
-						else
-						{
-							if (portNumber >= node->GetNumberOfInputs())
-							{
-								LOG(ERROR) << "Found input port with portNumber " << portNumber << "is too big";
-							}
-						}
+						LOG(ERROR) << "Fault node has invalid signal name \"" << signalName << "\", expected \"" << node->GetOutputSignalName() << "\"";
+						return false;
+					}
 
-						if (portName.size() == 0)
+					if (portType == Circuit::PortType::Output)
+					{
+						if (portNumber != 0u)
 						{
-							LOG(ERROR) << "Port has empty name!";
-							return std::nullopt;
+							LOG(ERROR) << "Found invalid output port with portNumber " << portNumber;
+							return false;
 						}
-
-						if (faultEffectMap.find(portName) != faultEffectMap.end())
+					}
+					else
+					{
+						if (portNumber >= node->GetNumberOfInputs())
 						{
-							LOG(ERROR) << "Port with name \"" << portName << "\" appeared twice in fault effect!";
-							return std::nullopt;
+							LOG(ERROR) << "Found input port with portNumber " << portNumber << " is too big";
+							return false;
 						}
-
-						faultEffectMap[portName] = portConstraints;
-						faultAlternatives[alternativesIndex].effects.push_back( {
-							{ mappedCircuit.GetNode(nodeId), { portType, portNumber } },	// NodeAndPort
-							portName,
-							portConstraints
-						} );
 					}
 
-					std::string cellName = faultItem.get_child("fault.cell_name").get_value<std::string>();
-					std::string cellGroup = faultItem.get_child("fault.cell_group").get_value<std::string>();
-					std::string faultName = faultItem.get_child("fault.fault_name").get_value<std::string>();
-					std::string faultCategory = faultItem.get_child("fault.fault_category").get_value<std::string>();
-
-					if (faultName.size() == 0)
+					if (portName.size() == 0)
 					{
-						LOG(ERROR) << "Got empty faultName for cellName " << cellName;
-						return std::nullopt;
+						LOG(ERROR) << "Port has empty name!";
+						return false;
 					}
-					if (!udfm.HasCell(cellName))
+
+					if (faultConditionMap.find(portName) != faultConditionMap.end())
 					{
-						LOG(ERROR) << "Was not able to find cellName \"" << cellName << "\" in the UDFM:\n" << to_string(udfm);
-						return std::nullopt;
+						LOG(ERROR) << "Port with name \"" << portName << "\" appeared twice in fault_condition!";
+						return false;
 					}
-					if (!udfm.HasFault(cellName, faultName))
+					faultConditionMap[portName] = portConstraints;
+					faultAlternatives[alternativesIndex].conditions.push_back( {
+						{ mappedCircuit.GetNode(nodeId), { portType, portNumber } },	// NodeAndPort
+						portName,
+						portConstraints
+					} );
+				}
+
+				faultEffectMap.clear();
+				ptree& faultEffectsItem = alternativeItem.get_child("fault_effects");
+				for (auto fEffIt = faultEffectsItem.ordered_begin(); fEffIt != faultEffectsItem.not_found(); ++fEffIt)
+				{
+					ptree& faultEffectItem = fEffIt->second;
+
+					nodeId = faultEffectItem.get_child("node_index").get_value<size_t>();
+					nodeName = faultEffectItem.get_child("node_name").get_value<std::string>();
+					signalName = faultEffectItem.get_child("signal_name").get_value<std::string>();
+					portType = ConvertStringToPortType(faultEffectItem.get_child("port_type").get_value<std::string>());
+					portNumber = faultEffectItem.get_child("port_number").get_value<size_t>();
+					portName = faultEffectItem.get_child("port_name").get_value<std::string>();
+					portConstraints = GetLogicConstraintsForString(faultEffectItem.get_child("faulty_port_value").get_value<std::string>());
+
+					if (nodeId >= mappedCircuit.GetNumberOfNodes())
 					{
-						LOG(ERROR) << "Was not able to find faultName \"" << faultName << "\" for cellName \"" << cellName
-									<< "\" in the UDFM; faults are:\n" << to_string(*udfm.GetCell(cellName));
-						return std::nullopt;
+						LOG(ERROR) << "Invalid node which does not exist was given for fault";
+						return false;
 					}
+					const auto node = mappedCircuit.GetNode(nodeId);
 
-					const auto& udfmFault = udfm.GetFault(cellName, faultName);
-					if (udfmFault->GetFaultCategory() != faultCategory)
+					if (nodeName != node->GetName())
+					{
+						LOG(ERROR) << "Node has invalid name \"" << nodeName << "\", expected \"" << node->GetName() << "\"";
+						return false;
+					}
+					if (signalName != node->GetOutputSignalName())
 					{
-						LOG(ERROR) << "Invalid fault category \"" << faultCategory << "\" in the UDFM:\n" << to_string(udfm);
-						return std::nullopt;
+						LOG(ERROR) << "Fault node has invalid signal name \"" << signalName << "\", expected \"" << node->GetOutputSignalName() << "\"";
+						return false;
 					}
 
-					for (size_t testAlternativeIndex = 0u; testAlternativeIndex < udfmFault->GetAlternatives().size(); ++testAlternativeIndex)
+					if (portType == Circuit::PortType::Output)
 					{
-						if (udfmFault->GetAlternativeConditions(testAlternativeIndex) == faultConditionMap)
+						if (portNumber != 0u)
 						{
-							break;
+							LOG(ERROR) << "Found invalid output port with portNumber " << portNumber;
+							return false;
 						}
-						if (testAlternativeIndex == udfmFault->GetAlternatives().size() - 1)
+					}
+					else
+					{
+						if (portNumber >= node->GetNumberOfInputs())
 						{
-							LOG(ERROR) << "Was not able to find conditions: \n" << Io::Udfm::to_string(faultConditionMap)
-										<< "\nin any UDFM test alternative of the UserDefinedFault:\n" << to_string(*udfmFault);
-							return std::nullopt;
+							LOG(ERROR) << "Found input port with portNumber " << portNumber << " is too big";
+							return false;
 						}
 					}
 
-					// Some effects may be missing in the fault list (because of unconnected ports, which are removed)
-					// -> Check, if the fault effects in the fault list are a subset of the effects in the UDFM
-					for (size_t testAlternativeIndex = 0u; testAlternativeIndex < udfmFault->GetAlternatives().size(); ++testAlternativeIndex)
+					if (portName.size() == 0)
 					{
-						if (udfmFault->GetAlternativeEffects(testAlternativeIndex) == faultEffectMap)
-						{
-							break;
-						}
-						if (testAlternativeIndex == udfmFault->GetAlternatives().size() - 1)
-						{
-							LOG(ERROR) << "Was not able to find effects: \n" << Io::Udfm::to_string(faultEffectMap)
-										<< "\nin any UDFM test alternative of the UserDefinedFault:\n" << to_string(*udfmFault);
-							return std::nullopt;
-						}
+						LOG(ERROR) << "Port has empty name!";
+						return false;
+					}
+
+					if (faultEffectMap.find(portName) != faultEffectMap.end())
+					{
+						LOG(ERROR) << "Port with name \"" << portName << "\" appeared twice in fault effect!";
+						return false;
 					}
+
+					faultEffectMap[portName] = portConstraints;
+					faultAlternatives[alternativesIndex].effects.push_back( {
+						{ mappedCircuit.GetNode(nodeId), { portType, portNumber } },	// NodeAndPort
+						portName,
+						portConstraints
+					} );
+				}
+
+				std::string cellName = faultItem.get_child("fault.cell_name").get_value<std::string>();
+				std::string cellGroup = faultItem.get_child("fault.cell_group").get_value<std::string>();
+				std::string faultName = faultItem.get_child("fault.fault_name").get_value<std::string>();
+				std::string faultCategory = faultItem.get_child("fault.fault_category").get_value<std::string>();
+
+				if (faultName.size() == 0)
+				{
+					LOG(ERROR) << "Got empty faultName for cellName " << cellName;
+					return false;
+				}
+				if (!udfm.HasCell(cellName))
+				{
+					LOG(ERROR) << "Was not able to find cellName \"" << cellName << "\" in the UDFM:\n" << to_string(udfm);
+					return false;
+				}
+				if (!udfm.HasFault(cellName, faultName))
+				{
+					LOG(ERROR) << "Was not able to find faultName \"" << faultName << "\" for cellName \"" << cellName
+								<< "\" in the UDFM; faults are:\n" << to_string(*udfm.GetCell(cellName));
+					return false;
 				}
 
-				auto group = circuit.GetMetaData().GetGroup(faultItem.get_child("fault.cell_group").get_value<std::string>());
-				if (group == nullptr)
+				const auto& udfmFault = udfm.GetFault(cellName, faultName);
+				if (udfmFault->GetFaultCategory() != faultCategory)
 				{
-					LOG(ERROR) << "Could not find cell " << faultItem.get_child("fault.cell_group").get_value<std::string>() << " in circuit!";
-					return std::nullopt;
+					LOG(ERROR) << "Invalid fault category \"" << faultCategory << "\" in the UDFM:\n" << to_string(udfm);
+					return false;
 				}
 
-				fault = std::make_shared<Fault::CellAwareFault>(
-					udfm.GetFault(
-						faultItem.get_child("fault.cell_name").get_value<std::string>(),
-						faultItem.get_child("fault.fault_name").get_value<std::string>()
-					),
-					group,
-					faultAlternatives
-				);
+				for (size_t testAlternativeIndex = 0u; testAlternativeIndex < udfmFault->GetAlternatives().size(); ++testAlternativeIndex)
+				{
+					if (udfmFault->GetAlternativeConditions(testAlternativeIndex) == faultConditionMap)
+					{
+						break;
+					}
+					if (testAlternativeIndex == udfmFault->GetAlternatives().size() - 1)
+					{
+						LOG(ERROR) << "Was not able to find conditions: \n" << Io::Udfm::to_string(faultConditionMap)
+									<< "\nin any UDFM test alternative of the UserDefinedFault:\n" << to_string(*udfmFault);
+						return false;
+					}
+				}
+
+				// Some effects may be missing in the fault list (because of unconnected ports, which are removed)
+				// -> Check, if the fault effects in the fault list are a subset of the effects in the UDFM
+				for (size_t testAlternativeIndex = 0u; testAlternativeIndex < udfmFault->GetAlternatives().size(); ++testAlternativeIndex)
+				{
+					if (udfmFault->GetAlternativeEffects(testAlternativeIndex) == faultEffectMap)
+					{
+						break;
+					}
+					if (testAlternativeIndex == udfmFault->GetAlternatives().size() - 1)
+					{
+						LOG(ERROR) << "Was not able to find effects: \n" << Io::Udfm::to_string(faultEffectMap)
+									<< "\nin any UDFM test alternative of the UserDefinedFault:\n" << to_string(*udfmFault);
+						return false;
+					}
+				}
 			}
-			else
+
+			auto group = circuit.GetMetaData().GetGroup(faultItem.get_child("fault.cell_group").get_value<std::string>());
+			if (group == nullptr)
 			{
-				static_assert(std::is_same_v<FaultT, Fault::SingleStuckAtFault>, "Unsupported fault type given");
+				LOG(ERROR) << "Could not find cell " << faultItem.get_child("fault.cell_group").get_value<std::string>() << " in circuit!";
+				return false;
 			}
 
-			// Implement other metaData types below
-			if constexpr (std::is_same_v<MetaDataT, Fault::SingleStuckAtFaultMetaData>
-				|| std::is_same_v<MetaDataT, Fault::SingleTransitionDelayFaultMetaData>)
-			{
-				metaData = std::make_shared<MetaDataT>();
-				metaData->faultStatus = ConvertStringToFaultStatus(faultItem.get_child("status").get_value<std::string>());
-				metaData->targetedFaultStatus = ConvertStringToTargetedFaultStatus(faultItem.get_child("status-targeted").get_value<std::string>());
+			fault = std::make_shared<Fault::CellAwareFault>(
+				udfm.GetFault(
+					faultItem.get_child("fault.cell_name").get_value<std::string>(),
+					faultItem.get_child("fault.fault_name").get_value<std::string>()
+				),
+				group,
+				faultAlternatives
+			);
+		}
+		else
+		{
+			static_assert(std::is_same_v<FaultT, Fault::SingleStuckAtFault>, "Unsupported fault type given");
+		}
 
-				if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+		// Implement other metaData types below
+		if constexpr (std::is_same_v<MetaDataT, Fault::SingleStuckAtFaultMetaData>
+			|| std::is_same_v<MetaDataT, Fault::SingleTransitionDelayFaultMetaData>)
+		{
+			metaData = std::make_shared<MetaDataT>();
+			metaData->SetFaultStatus(ConvertStringToFaultStatus(faultItem.get_child("status").get_value<std::string>()));
+			metaData->SetTargetedFaultStatus(ConvertStringToTargetedFaultStatus(GetTargetedFaultStatusString(faultItem)));
+
+			if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+			{
+				metaData->detectingPatternId = faultItem.get_child("pattern.pattern_index").get_value<size_t>();
+				metaData->detectionCount = faultItem.get<size_t>("pattern.detection_count", 1u);
+				if (faultItem.find("pattern.detected_by.node_index") != faultItem.not_found())
 				{
-					metaData->detectingPatternId = faultItem.get_child("pattern.pattern_index").get_value<size_t>();
-					if (faultItem.find("pattern.detected_by.node_index") != faultItem.not_found())
-					{
-						const auto nodeId = faultItem.get_child("pattern.detected_by.node_index").get_value<size_t>();
-						const auto portType = ConvertStringToPortType(faultItem.get_child("pattern.detected_by.port_type").get_value<std::string>());
-						const auto portNumber = faultItem.get_child("pattern.detected_by.port_number").get_value<size_t>();
+					const auto nodeId = faultItem.get_child("pattern.detected_by.node_index").get_value<size_t>();
+					const auto portType = ConvertStringToPortType(faultItem.get_child("pattern.detected_by.port_type").get_value<std::string>());
+					const auto portNumber = faultItem.get_child("pattern.detected_by.port_number").get_value<size_t>();
 
-						if (nodeId >= mappedCircuit.GetNumberOfNodes())
-						{
-							LOG(ERROR) << "Detecting node index for fault is not valid";
-							return std::nullopt;
-						}
-						if (mappedCircuit.GetNode(nodeId)->GetName() != faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>())
-						{
-							LOG(ERROR) << "Fault node has invalid detecting node name \"" << faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>()
-								<< "\", expected \"" << mappedCircuit.GetNode(nodeId)->GetName() << "\"";
-							return std::nullopt;
-						}
+					if (nodeId >= mappedCircuit.GetNumberOfNodes())
+					{
+						LOG(ERROR) << "Detecting node index for fault is not valid";
+						return false;
+					}
+					if (mappedCircuit.GetNode(nodeId)->GetName() != faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>())
+					{
+						LOG(ERROR) << "Fault node has invalid detecting node name \"" << faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>()
+							<< "\", expected \"" << mappedCircuit.GetNode(nodeId)->GetName() << "\"";
+						return false;
+					}
 
-						metaData->detectingNode = { mappedCircuit.GetNode(nodeId), { portType, portNumber } };
-						metaData->detectingTimeframe = faultItem.get_child("pattern.detected_by.timeframe").get_value<size_t>();
-						metaData->detectingOutputGood = static_cast<Logic>(faultItem.get_child("pattern.detected_by.good_value").get_value<char>());
-						metaData->detectingOutputBad = static_cast<Logic>(faultItem.get_child("pattern.detected_by.bad_value").get_value<char>());
+					metaData->detectingNode = { mappedCircuit.GetNode(nodeId), { portType, portNumber } };
+					metaData->detectingTimeframe = faultItem.get_child("pattern.detected_by.timeframe").get_value<size_t>();
+					metaData->detectingOutputGood = static_cast<Logic>(faultItem.get_child("pattern.detected_by.good_value").get_value<char>());
+					metaData->detectingOutputBad = static_cast<Logic>(faultItem.get_child("pattern.detected_by.bad_value").get_value<char>());
 
-						if (!CheckOutputLogic(metaData->detectingOutputGood, metaData->detectingOutputBad))
-						{
-							LOG(ERROR) << "detectingOutputGood and detectingOutputBad show no 01 difference";
-							return std::nullopt;
-						}
+					if (!CheckOutputLogic(metaData->detectingOutputGood, metaData->detectingOutputBad))
+					{
+						LOG(ERROR) << "detectingOutputGood and detectingOutputBad show no 01 difference";
+						return false;
 					}
 				}
 			}
-			else if constexpr (std::is_same_v<MetaDataT, Fault::CellAwareMetaData>)
-			{
-				metaData = std::make_shared<Fault::CellAwareMetaData>();
-				metaData->faultStatus = ConvertStringToFaultStatus(faultItem.get_child("status").get_value<std::string>());
-				metaData->targetedFaultStatus = ConvertStringToTargetedFaultStatus(faultItem.get_child("status-targeted").get_value<std::string>());
+		}
+		else if constexpr (std::is_same_v<MetaDataT, Fault::CellAwareMetaData>)
+		{
+			metaData = std::make_shared<Fault::CellAwareMetaData>();
+			metaData->SetFaultStatus(ConvertStringToFaultStatus(faultItem.get_child("status").get_value<std::string>()));
+			metaData->SetTargetedFaultStatus(ConvertStringToTargetedFaultStatus(GetTargetedFaultStatusString(faultItem)));
 
-				if (metaData->faultStatus == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+			if (metaData->GetFaultStatus() == Fault::FaultStatus::FAULT_STATUS_DETECTED)
+			{
+				metaData->detectingPatternId = faultItem.get_child("pattern.pattern_index").get_value<size_t>();
+				metaData->detectionCount = faultItem.get<size_t>("pattern.detection_count", 1u);
+				if (faultItem.find("pattern.detected_by.node_index") != faultItem.not_found())
 				{
-					metaData->detectingPatternId = faultItem.get_child("pattern.pattern_index").get_value<size_t>();
-					if (faultItem.find("pattern.detected_by.node_index") != faultItem.not_found())
-					{
-						const auto nodeId = faultItem.get_child("pattern.detected_by.node_index").get_value<size_t>();
-						const auto portType = ConvertStringToPortType(faultItem.get_child("pattern.detected_by.port_type").get_value<std::string>());
-						const auto portNumber = faultItem.get_child("pattern.detected_by.port_number").get_value<size_t>();
+					const auto nodeId = faultItem.get_child("pattern.detected_by.node_index").get_value<size_t>();
+					const auto portType = ConvertStringToPortType(faultItem.get_child("pattern.detected_by.port_type").get_value<std::string>());
+					const auto portNumber = faultItem.get_child("pattern.detected_by.port_number").get_value<size_t>();
 
-						if (nodeId >= mappedCircuit.GetNumberOfNodes())
-						{
-							LOG(ERROR) << "Detecting node index for fault is not valid";
-							return std::nullopt;
-						}
-						if (mappedCircuit.GetNode(nodeId)->GetName() != faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>())
-						{
-							LOG(ERROR) << "Fault node has invalid detecting node name \"" << faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>()
-								<< "\", expected \"" << mappedCircuit.GetNode(nodeId)->GetName() << "\"";
-							return std::nullopt;
-						}
+					if (nodeId >= mappedCircuit.GetNumberOfNodes())
+					{
+						LOG(ERROR) << "Detecting node index for fault is not valid";
+						return false;
+					}
+					if (mappedCircuit.GetNode(nodeId)->GetName() != faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>())
+					{
+						LOG(ERROR) << "Fault node has invalid detecting node name \"" << faultItem.get_child("pattern.detected_by.node_name").get_value<std::string>()
+							<< "\", expected \"" << mappedCircuit.GetNode(nodeId)->GetName() << "\"";
+						return false;
+					}
 
-						metaData->detectingNode = { mappedCircuit.GetNode(nodeId), { portType, portNumber } };
-						metaData->detectingTimeframe = faultItem.get_child("pattern.detected_by.timeframe").get_value<size_t>();
-						metaData->detectingOutputGood = static_cast<Logic>(faultItem.get_child("pattern.detected_by.good_value").get_value<char>());
-						metaData->detectingOutputBad = static_cast<Logic>(faultItem.get_child("pattern.detected_by.bad_value").get_value<char>());
+					metaData->detectingNode = { mappedCircuit.GetNode(nodeId), { portType, portNumber } };
+					metaData->detectingTimeframe = faultItem.get_child("pattern.detected_by.timeframe").get_value<size_t>();
+					metaData->detectingOutputGood = static_cast<Logic>(faultItem.get_child("pattern.detected_by.good_value").get_value<char>());
+					metaData->detectingOutputBad = static_cast<Logic>(faultItem.get_child("pattern.detected_by.bad_value").get_value<char>());
 
-						if (!CheckOutputLogic(metaData->detectingOutputGood, metaData->detectingOutputBad))
-						{
-							LOG(ERROR) << "detectingOutputGood and detectingOutputBad show no 01 difference";
-							return std::nullopt;
-						}
+					if (!CheckOutputLogic(metaData->detectingOutputGood, metaData->detectingOutputBad))
+					{
+						LOG(ERROR) << "detectingOutputGood and detectingOutputBad show no 01 difference";
+						return false;
 					}
 				}
 			}
-			else
-			{
-				static_assert(std::is_same_v<MetaDataT, Fault::SingleStuckAtFaultMetaData>, "Unsupported fault metaData type given");
-			}
+		}
+		else
+		{
+			static_assert(std::is_same_v<MetaDataT, Fault::SingleStuckAtFaultMetaData>, "Unsupported fault metaData type given");
+		}
+
+		faultList.emplace_back(std::move(fault), std::move(metaData));
+		return true;
+	};
 
-			faultList.emplace_back(std::move(fault), std::move(metaData));
+	try
+	{
+		// The faults are imported one by one to keep the memory usage independent of the number of faults
+		auto root { Json::ReadJsonStreaming(input, "faults", import_fault) };
+		if (!root.has_value())
+		{
+			return std::nullopt;
+		}
+		if (!circuitValidated && !ValidateCircuitGuard(root->get_child("circuit"), circuit))
+		{
+			return std::nullopt;
+		}
+		if (!faultListTypeChecked)
+		{
+			check_fault_list_type(*root);
 		}
 
 		return std::make_optional<FaultListExchangeFormat<FaultList>>(circuit, faultList);
@@ -1021,12 +1093,21 @@ std::optional<FaultListExchangeFormat<FaultList>> ImportFaults(std::istream& inp
 
 template std::optional<FaultListExchangeFormat<Fault::SingleStuckAtFaultList>> ImportFaults(std::istream& input, const Circuit::CircuitEnvironment& circuit);
 template bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<Fault::SingleStuckAtFaultList>& faultList);
+template bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<Fault::SingleStuckAtFaultList>& faultList, Settings::ExchangeFormat format);
+template Settings::ExchangeFormat GetFaultListExchangeFormat<Fault::SingleStuckAtFaultList>(Settings::ExchangeFormat format);
+template std::string GetFaultListExchangeExtension<Fault::SingleStuckAtFaultList>(Settings::ExchangeFormat format);
 
 template std::optional<FaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>> ImportFaults(std::istream& input, const Circuit::CircuitEnvironment& circuit);
 template bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>& faultList);
+template bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>& faultList, Settings::ExchangeFormat format);
+template Settings::ExchangeFormat GetFaultListExchangeFormat<Fault::SingleTransitionDelayFaultList>(Settings::ExchangeFormat format);
+template std::string GetFaultListExchangeExtension<Fault::SingleTransitionDelayFaultList>(Settings::ExchangeFormat format);
 
 template std::optional<FaultListExchangeFormat<Fault::CellAwareFaultList>> ImportFaults(std::istream& input, const Circuit::CircuitEnvironment& circuit, const Io::Udfm::UdfmModel& udfm);
 template bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<Fault::CellAwareFaultList>& faultList);
+template bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<Fault::CellAwareFaultList>& faultList, Settings::ExchangeFormat format);
+template Settings::ExchangeFormat GetFaultListExchangeFormat<Fault::CellAwareFaultList>(Settings::ExchangeFormat format);
+template std::string GetFaultListExchangeExtension<Fault::CellAwareFaultList>(Settings::ExchangeFormat format);
 
 };
 };
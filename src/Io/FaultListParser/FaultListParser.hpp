@@ -3,6 +3,7 @@
 #include <iostream>
 #include <optional>
 
+#include "Basic/Settings.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Io/FaultListParser/FaultListExchangeFormat.hpp"
 
@@ -33,9 +34,25 @@ private:
 	FaultType detectedFault;
 };
 
+std::string ConvertFaultTypeToString(const FaultType& faultType);
+
 template<typename FaultList, typename... Params>
 bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<FaultList>& faultList, const Params&... params);
 
+// Returns the format that is written for the fault list type.
+// Formats without support for the fault list type fall back to JSON.
+template<typename FaultList>
+Settings::ExchangeFormat GetFaultListExchangeFormat(Settings::ExchangeFormat format);
+
+// Returns the file extension of the format that is written for the fault list type
+template<typename FaultList>
+std::string GetFaultListExchangeExtension(Settings::ExchangeFormat format);
+
+// Writes the format that GetFaultListExchangeFormat returns for the fault list type
+template<typename FaultList>
+bool ExportFaults(std::ostream& output, const FaultListExchangeFormat<FaultList>& faultList, Settings::ExchangeFormat format);
+
+// Imports JSON and binary exchange files (the format is detected automatically)
 template<typename FaultList, typename... Params>
 std::optional<FaultListExchangeFormat<FaultList>> ImportFaults(std::istream& input, const Circuit::CircuitEnvironment& circuit, const Params&... params);
 
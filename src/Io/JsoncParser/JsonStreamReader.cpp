@@ -0,0 +1,209 @@
+#include "Io/JsoncParser/JsonStreamReader.hpp"
+
+#include <iterator>
+#include <optional>
+
+#include "Io/JsoncParser/JsonCParser.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Json
+{
+
+namespace
+{
+
+struct StopParsing { };
+
+/**
+ * @brief Parser callbacks that build a property tree for the root of the
+ * document, but hand the elements of the streamed array to a handler
+ * instead of appending them to the tree.
+ *
+ * The streamed array is a direct member of the root object.
+ * Therefore, its elements start at a nesting depth of two.
+ */
+class StreamingCallbacks
+{
+public:
+	using char_type = char;
+	using TreeCallbacks = boost::property_tree::jsonc_parser::detail::standard_callbacks<boost::property_tree::ptree>;
+
+	StreamingCallbacks(const std::string& arrayKey, const JsonElementHandler& handler):
+		_arrayKey(arrayKey),
+		_handler(handler),
+		_root(),
+		_element(),
+		_depth(0u),
+		_streaming(false),
+		_keyExpected(false),
+		_readingKey(false),
+		_key()
+	{
+	}
+
+	void on_null(void) { BeginValue(); Target().on_null(); EndValue(); }
+	void on_boolean(bool value) { BeginValue(); Target().on_boolean(value); EndValue(); }
+	template<typename Range>
+	void on_number(Range codeUnits) { BeginValue(); Target().on_number(codeUnits); EndValue(); }
+	void on_begin_number(void) { BeginValue(); Target().on_begin_number(); }
+	void on_digit(char_type digit) { Target().on_digit(digit); }
+	void on_end_number(void) { Target().on_end_number(); EndValue(); }
+
+	void on_begin_string(void)
+	{
+		if (_depth == 1u && _keyExpected && !_element)
+		{
+			_readingKey = true;
+			_key.clear();
+		}
+		else
+		{
+			BeginValue();
+		}
+
+		Target().on_begin_string();
+	}
+
+	template<typename Range>
+	void on_code_units(Range codeUnits)
+	{
+		if (_readingKey)
+		{
+			_key.append(codeUnits.begin(), codeUnits.end());
+		}
+
+		Target().on_code_units(codeUnits);
+	}
+
+	void on_code_unit(char_type codeUnit)
+	{
+		if (_readingKey)
+		{
+			_key += codeUnit;
+		}
+
+		Target().on_code_unit(codeUnit);
+	}
+
+	void on_end_string(void)
+	{
+		Target().on_end_string();
+		if (_readingKey)
+		{
+			_readingKey = false;
+			_keyExpected = false;
+			return;
+		}
+
+		EndValue();
+	}
+
+	void on_begin_array(void) { BeginValue(); Target().on_begin_array(); BeginContainer(true); }
+	void on_end_array(void) { Target().on_end_array(); EndContainer(); }
+	void on_begin_object(void) { BeginValue(); Target().on_begin_object(); BeginContainer(false); }
+	void on_end_object(void) { Target().on_end_object(); EndContainer(); }
+
+	boost::property_tree::ptree& output(void) { return _root.output(); }
+
+private:
+	TreeCallbacks& Target(void)
+	{
+		return _element ? *_element : _root;
+	}
+
+	void BeginValue(void)
+	{
+		if (_streaming && _depth == 2u && !_element)
+		{
+			_element.emplace();
+		}
+	}
+
+	void EndValue(void)
+	{
+		if (_element && _depth == 2u)
+		{
+			const bool proceed { _handler(_element->output(), _root.output()) };
+			_element.reset();
+
+			if (!proceed)
+			{
+				throw StopParsing { };
+			}
+		}
+		else if (_depth == 1u && !_element)
+		{
+			// A member of the root object has been completed
+			_keyExpected = true;
+		}
+	}
+
+	void BeginContainer(bool isArray)
+	{
+		if (_depth == 0u)
+		{
+			_keyExpected = !isArray;
+		}
+		else if (_depth == 1u && isArray && !_element && _key == _arrayKey)
+		{
+			_streaming = true;
+		}
+
+		_depth++;
+	}
+
+	void EndContainer(void)
+	{
+		_depth--;
+		if (_streaming && _depth == 1u)
+		{
+			_streaming = false;
+		}
+
+		EndValue();
+	}
+
+	const std::string& _arrayKey;
+	const JsonElementHandler& _handler;
+
+	TreeCallbacks _root;
+	std::optional<TreeCallbacks> _element;
+
+	size_t _depth;
+	bool _streaming;
+	bool _keyExpected;
+	bool _readingKey;
+	std::string _key;
+
+};
+
+};
+
+std::optional<boost::property_tree::ptree> ReadJsonStreaming(std::istream& input, const std::string& arrayKey, const JsonElementHandler& handler)
+{
+	using iterator = std::istreambuf_iterator<char>;
+
+	StreamingCallbacks callbacks(arrayKey, handler);
+	boost::property_tree::jsonc_parser::detail::encoding<char> encoding;
+
+	try
+	{
+		boost::property_tree::jsonc_parser::detail::read_jsonc_internal(iterator(input), iterator(),
+			encoding, callbacks, std::string());
+	}
+	catch (StopParsing&)
+	{
+		return std::nullopt;
+	}
+
+	boost::property_tree::ptree result;
+	result.swap(callbacks.output());
+	return result;
+}
+
+};
+};
+};
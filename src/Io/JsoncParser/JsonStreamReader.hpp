@@ -0,0 +1,42 @@
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <string>
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Json
+{
+
+/**
+ * @brief Called for every element of the streamed array.
+ *
+ * The document contains the members of the root object that precede the array.
+ * The element is discarded after the call.
+ * Returning false stops the parsing.
+ */
+using JsonElementHandler = std::function<bool(boost::property_tree::ptree& element, const boost::property_tree::ptree& document)>;
+
+/**
+ * @brief Parses a JSON document and passes the elements of the array
+ * with the given key in the root object one by one to the handler.
+ *
+ * Only the element that is currently parsed is held in memory.
+ * Therefore, the memory usage does not depend on the number of elements.
+ * Comments are allowed like in the JsonC parser.
+ *
+ * @throw boost::property_tree::json_parser_error if the JSON is malformed.
+ * @return The root of the document without the elements of the streamed array
+ *         or std::nullopt if the handler stopped the parsing.
+ */
+std::optional<boost::property_tree::ptree> ReadJsonStreaming(std::istream& input, const std::string& arrayKey, const JsonElementHandler& handler);
+
+};
+};
+};
@@ -0,0 +1,147 @@
+#include "Io/JsoncParser/JsonStreamWriter.hpp"
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "Basic/Logging.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Json
+{
+
+JsonStreamWriter::JsonStreamWriter(std::ostream& output):
+	_output(output),
+	_frames(),
+	_keyWritten(false)
+{
+}
+
+JsonStreamWriter::~JsonStreamWriter(void) = default;
+
+void JsonStreamWriter::BeginObject(void)
+{
+	BeginContainer(FrameType::Object);
+}
+
+void JsonStreamWriter::EndObject(void)
+{
+	EndContainer(FrameType::Object);
+}
+
+void JsonStreamWriter::BeginArray(void)
+{
+	BeginContainer(FrameType::Array);
+}
+
+void JsonStreamWriter::EndArray(void)
+{
+	EndContainer(FrameType::Array);
+}
+
+void JsonStreamWriter::WriteKey(const std::string& key)
+{
+	ASSERT(!_frames.empty() && _frames.back().type == FrameType::Object) << "A key can only be written inside of an object";
+	ASSERT(!_keyWritten) << "The previous key has no value";
+
+	BeginChild();
+	_output << '"' << boost::property_tree::json_parser::create_escapes(key) << "\": ";
+	_keyWritten = true;
+}
+
+void JsonStreamWriter::WriteValue(const std::string& value)
+{
+	BeginChild();
+	_output << '"' << boost::property_tree::json_parser::create_escapes(value) << '"';
+}
+
+void JsonStreamWriter::WriteTree(const boost::property_tree::ptree& tree)
+{
+	BeginChild();
+	boost::property_tree::json_parser::write_json_helper(_output, tree, static_cast<int>(_frames.size()), true);
+}
+
+void JsonStreamWriter::Finish(void)
+{
+	ASSERT(_frames.empty()) << "Not all objects / arrays have been closed";
+	_output << std::endl;
+}
+
+bool JsonStreamWriter::IsGood(void) const
+{
+	return _output.good();
+}
+
+void JsonStreamWriter::BeginChild(void)
+{
+	if (_frames.empty())
+	{
+		return;
+	}
+
+	auto& frame { _frames.back() };
+	if (frame.type == FrameType::Object && _keyWritten)
+	{
+		// The value follows the key on the same line
+		_keyWritten = false;
+		return;
+	}
+
+	// Opening brackets are written with the first child as
+	// write_json writes empty objects and arrays as empty strings.
+	if (frame.children == 0u)
+	{
+		_output << ((frame.type == FrameType::Object) ? '{' : '[') << '\n';
+	}
+	else
+	{
+		_output << ",\n";
+	}
+
+	WriteIndentation(_frames.size());
+	frame.children++;
+}
+
+void JsonStreamWriter::BeginContainer(FrameType type)
+{
+	BeginChild();
+	_frames.push_back({ type, 0u });
+}
+
+void JsonStreamWriter::EndContainer(FrameType type)
+{
+	ASSERT(!_frames.empty() && _frames.back().type == type) << "Closing object / array does not match the opened one";
+	ASSERT(!_keyWritten) << "The last key has no value";
+
+	const Frame frame { _frames.back() };
+	_frames.pop_back();
+
+	if (frame.children != 0u)
+	{
+		_output << '\n';
+		WriteIndentation(_frames.size());
+		_output << ((frame.type == FrameType::Object) ? '}' : ']');
+	}
+	else if (_frames.empty())
+	{
+		// The root is always written as object
+		_output << "{\n}";
+	}
+	else
+	{
+		_output << "\"\"";
+	}
+}
+
+void JsonStreamWriter::WriteIndentation(size_t level)
+{
+	for (size_t index = 0u; index < 4u * level; ++index)
+	{
+		_output << ' ';
+	}
+}
+
+};
+};
+};
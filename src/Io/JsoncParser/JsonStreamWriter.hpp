@@ -0,0 +1,90 @@
+#pragma once
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Json
+{
+
+/**
+ * @brief Writes a JSON document element by element to a stream.
+ *
+ * The output is identical to boost::property_tree::write_json for the
+ * equivalent property tree (pretty-printed, all values as strings,
+ * empty objects and arrays as ""). In contrast to write_json, the
+ * document is never held in memory as a whole.
+ *
+ * Usage:
+ *
+ *     JsonStreamWriter writer(output);
+ *     writer.BeginObject();
+ *     writer.WriteKey("items");
+ *     writer.BeginArray();
+ *     for (...) { writer.WriteTree(item); }
+ *     writer.EndArray();
+ *     writer.EndObject();
+ *     writer.Finish();
+ */
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& output);
+	virtual ~JsonStreamWriter(void);
+
+	void BeginObject(void);
+	void EndObject(void);
+	void BeginArray(void);
+	void EndArray(void);
+
+	void WriteKey(const std::string& key);
+	void WriteValue(const std::string& value);
+	void WriteTree(const boost::property_tree::ptree& tree);
+
+	// Writes the value with the same conversion as ptree::put
+	template<typename T>
+	void WriteValue(const T& value)
+	{
+		typename boost::property_tree::translator_between<std::string, T>::type translator;
+		WriteValue(translator.put_value(value).value());
+	}
+
+	template<typename T>
+	void WriteMember(const std::string& key, const T& value)
+	{
+		WriteKey(key);
+		WriteValue(value);
+	}
+
+	void Finish(void);
+	bool IsGood(void) const;
+
+private:
+	enum class FrameType { Object, Array };
+
+	struct Frame
+	{
+		FrameType type;
+		size_t children;
+	};
+
+	void BeginChild(void);
+	void BeginContainer(FrameType type);
+	void EndContainer(FrameType type);
+	void WriteIndentation(size_t level);
+
+	std::ostream& _output;
+	std::vector<Frame> _frames;
+	bool _keyWritten;
+
+};
+
+};
+};
+};
@@ -27,7 +27,7 @@ bool StatisticsExporter::ExportAsCsv(string path, CsvExportOptions exportOptions
 		LOG(ERROR) << "There was no statistic data collected to be exported";
 	}
 	FileHandle handle(path + ".csv", false);
-	ofstream& out = handle.GetOutStream();
+	ostream& out = handle.GetOutStream();
 	if (!out.good())
 	{
 		LOG(ERROR) << "Could not write to file " << path << " (" << handle.GetFilename() << ")";
@@ -86,7 +86,7 @@ bool StatisticsExporter::PlotCsv(string path, PlotExportOptions exportOptions)
 	{ // Limit the scope of the file handle
 		FileHandle handle(path + ".gnuplot", false);
 
-		ofstream& out = handle.GetOutStream();
+		ostream& out = handle.GetOutStream();
 		if (!out.good())
 		{
 			LOG(ERROR) << "Could not write to file " << path << " (" << handle.GetFilename() << ")";
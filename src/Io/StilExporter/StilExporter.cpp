@@ -1,7 +1,11 @@
 #include "Io/StilExporter/StilExporter.hpp"
 
+#include <algorithm>
+#include <string>
 #include <tuple>
+#include <vector>
 
+#include "Basic/Parallel.hpp"
 #include "Basic/Fault/Models/FaultFreeModel.hpp"
 #include "Simulation/CircuitSimulator.hpp"
 
@@ -55,42 +59,21 @@ static std::tuple<ScanList, ScanList> GetScanChains(const Circuit::CircuitEnviro
 	return std::make_tuple(flipFlopInputs, flipFlopOutputs);
 }
 
-static std::string GetPrimaryInputVectors(const PortList& primaryInputs, const Simulation::SimulationResult& simulation, size_t timeframe)
-{
-	std::string result;
-	for (auto& port : primaryInputs)
-	{
-		for (size_t index : port->GetSize().GetIndicesTopToBottom())
-		{
-			auto connection = port->GetConnectionForIndex(index);
-			if (connection == nullptr)
-			{
-				result += 'Z';
-				continue;
-			}
+// The patterns are formatted in parallel in chunks of this size
+static constexpr size_t PATTERNS_PER_CHUNK { 64u };
 
-			auto source = connection->GetMappedSources();
-			if (source.size() == 0u)
-			{
-				result += 'Z';
-				continue;
-			}
-
-			size_t nodeIndex = source[0u].node->GetNodeId();
-			switch (simulation[timeframe][nodeIndex])
-			{
-				case Logic::LOGIC_ZERO: result += '0'; break;
-				case Logic::LOGIC_ONE: result += '1'; break;
-				default: result += 'Z'; break;
-			}
-		}
-	}
-	return result;
-}
+// The characters for the values zero, one and all other values / unconnected bits
+using VectorSymbols = char[3];
+static constexpr VectorSymbols INPUT_SYMBOLS { '0', '1', 'Z' };
+static constexpr VectorSymbols OUTPUT_SYMBOLS { 'L', 'H', 'X' };
+static constexpr VectorSymbols SCAN_INPUT_SYMBOLS { '0', '1', 'Z' };
+static constexpr VectorSymbols SCAN_OUTPUT_SYMBOLS { 'D', 'U', 'X' };
 
-static std::string GetPrimaryOutputVectors(const PortList& ports, const Simulation::SimulationResult& simulation, size_t timeframe)
+// Returns the nodes that drive the bits of the ports (top to bottom).
+// Unconnected bits are a nullptr.
+static ScanList GetPortNodes(const PortList& ports)
 {
-	std::string result;
+	ScanList result;
 	for (auto& port : ports)
 	{
 		for (size_t index : port->GetSize().GetIndicesTopToBottom())
@@ -98,71 +81,79 @@ static std::string GetPrimaryOutputVectors(const PortList& ports, const Simulati
 			auto connection = port->GetConnectionForIndex(index);
 			if (connection == nullptr)
 			{
-				result += 'X';
+				result.push_back(nullptr);
 				continue;
 			}
 
 			auto source = connection->GetMappedSources();
-			if (source.size() == 0u)
-			{
-				result += 'X';
-				continue;
-			}
-
-			size_t nodeIndex = source[0u].node->GetNodeId();
-			switch (simulation[timeframe][nodeIndex])
-			{
-				case Logic::LOGIC_ZERO: result += 'L'; break;
-				case Logic::LOGIC_ONE: result += 'H'; break;
-				default: result += 'X'; break;
-			}
+			result.push_back((source.size() != 0u) ? source[0u].node : nullptr);
 		}
 	}
 	return result;
 }
 
-static std::string GetSecondaryInputVectors(const ScanList& secondaryInputs, const Simulation::SimulationResult& simulation, size_t timeframe)
+static void AppendVector(std::string& output, const ScanList& nodes, const VectorSymbols& symbols, const Simulation::SimulationResult& simulation, size_t timeframe)
 {
-	std::string result;
-	for (auto& ff : secondaryInputs)
+	const auto& values { simulation[timeframe] };
+	const size_t offset { output.size() };
+	output.resize(offset + nodes.size());
+	for (size_t index { 0u }; index < nodes.size(); ++index)
 	{
-		size_t nodeIndex = ff->GetNodeId();
-		switch (simulation[timeframe][nodeIndex])
+		if (nodes[index] == nullptr)
 		{
-			case Logic::LOGIC_ZERO: result += '0'; break;
-			case Logic::LOGIC_ONE: result += '1'; break;
-			default: result += 'Z'; break;
+			output[offset + index] = symbols[2u];
+			continue;
+		}
+
+		switch (values[nodes[index]->GetNodeId()])
+		{
+			case Logic::LOGIC_ZERO: output[offset + index] = symbols[0u]; break;
+			case Logic::LOGIC_ONE: output[offset + index] = symbols[1u]; break;
+			default: output[offset + index] = symbols[2u]; break;
 		}
 	}
-	return result;
 }
 
-static std::string GetSecondaryOutputVectors(const ScanList& secondaryOutputs, const Simulation::SimulationResult& simulation, size_t timeframe)
+// Formats the patterns in chunks in parallel and writes the chunks in order.
+// Only a limited number of chunks is kept in memory at the same time.
+template<typename FormatPattern>
+static void ExportPatternChunks(const Pattern::TestPatternList& patterns, std::ostream& output, FormatPattern format_pattern)
 {
-	std::string result;
-	for (auto& ff : secondaryOutputs)
+	const size_t numberOfChunks { (patterns.size() + PATTERNS_PER_CHUNK - 1u) / PATTERNS_PER_CHUNK };
+	const size_t chunksPerBatch { 4u * std::max<size_t>(Parallel::GetThreads(Parallel::Arena::General), 1u) };
+
+	std::vector<std::string> buffers;
+	for (size_t batchBegin { 0u }; batchBegin < numberOfChunks; batchBegin += chunksPerBatch)
 	{
-		size_t nodeIndex = ff->GetNodeId();
-		switch (simulation[timeframe][nodeIndex])
+		const size_t batchEnd { std::min(numberOfChunks, batchBegin + chunksPerBatch) };
+		buffers.assign(batchEnd - batchBegin, std::string());
+
+		Parallel::ExecuteParallel(batchBegin, batchEnd, Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t chunk) {
+			auto& buffer { buffers[chunk - batchBegin] };
+			const size_t patternEnd { std::min(patterns.size(), (chunk + 1u) * PATTERNS_PER_CHUNK) };
+			for (size_t patternId { chunk * PATTERNS_PER_CHUNK }; patternId < patternEnd; ++patternId)
+			{
+				format_pattern(buffer, patternId, *patterns[patternId]);
+			}
+		});
+
+		for (auto const& buffer : buffers)
 		{
-			case Logic::LOGIC_ZERO: result += 'D'; break;
-			case Logic::LOGIC_ONE: result += 'U'; break;
-			default: result += 'X'; break;
+			output.write(buffer.data(), buffer.size());
 		}
 	}
-	return result;
 }
 
 static void ExportHeader(const Circuit::CircuitEnvironment& circuit, std::ostream& output)
 {
-	output << "STIL 1.0 { Design 2005; }" << std::endl;
-	output << std::endl;
-
-	output << "Header {" << std::endl;
-	output << "    Title \"" << circuit.GetName() << "\"" << std::endl;
-	output << "    Source \"FreiTest (c) by University of Freiburg\"" << std::endl;
-	output << "}" << std::endl;
-	output << std::endl;
+	output << "STIL 1.0 { Design 2005; }" << '\n';
+	output << '\n';
+
+	output << "Header {" << '\n';
+	output << "    Title \"" << circuit.GetName() << "\"" << '\n';
+	output << "    Source \"FreiTest (c) by University of Freiburg\"" << '\n';
+	output << "}" << '\n';
+	output << '\n';
 }
 
 static void ExportPorts(const std::tuple<PortList, PortList>& ports, Scan scan, std::ostream& output)
@@ -178,26 +169,26 @@ static void ExportPorts(const std::tuple<PortList, PortList>& ports, Scan scan,
 		return result;
 	};
 
-	output << "Signals {" << std::endl;
+	output << "Signals {" << '\n';
 	for (auto& port : inputPorts)
 	{
-		output << "    " << port_to_string(port) << " In;" << std::endl;
+		output << "    " << port_to_string(port) << " In;" << '\n';
 	}
 	for (auto& port : outputPorts)
 	{
-		output << "    " << port_to_string(port) << " Out;" << std::endl;
+		output << "    " << port_to_string(port) << " Out;" << '\n';
 	}
 	if (scan == Scan::Yes)
 	{
-		output << "    \"TCK\" In;" << std::endl;
-		output << "    \"SE\" In;" << std::endl;
-		output << "    \"SI\" In;" << std::endl;
-		output << "    \"SO\" Out;" << std::endl;
+		output << "    \"TCK\" In;" << '\n';
+		output << "    \"SE\" In;" << '\n';
+		output << "    \"SI\" In;" << '\n';
+		output << "    \"SO\" Out;" << '\n';
 	}
-	output << "}" << std::endl;
-	output << std::endl;
+	output << "}" << '\n';
+	output << '\n';
 
-	output << "SignalGroups {" << std::endl;
+	output << "SignalGroups {" << '\n';
 	output << "    _PI_ = '";
 	size_t inputIndex { 0u };
 	for (auto& port : inputPorts)
@@ -205,7 +196,7 @@ static void ExportPorts(const std::tuple<PortList, PortList>& ports, Scan scan,
 		if (inputIndex++) output << " + ";
 		output << port_to_string(port);
 	}
-	output << "';" << std::endl;
+	output << "';" << '\n';
 
 	output << "    _PO_ = '";
 	size_t outputIndex { 0u };
@@ -214,55 +205,55 @@ static void ExportPorts(const std::tuple<PortList, PortList>& ports, Scan scan,
 		if (outputIndex++) output << " + ";
 		output << port_to_string(port);
 	}
-	output << "';" << std::endl;
+	output << "';" << '\n';
 
 	if (scan == Scan::Yes)
 	{
-		output << "    _SI_ = 'TCK + SE + SI';" << std::endl;
-		output << "    _SO_ = 'SO';" << std::endl;
+		output << "    _SI_ = 'TCK + SE + SI';" << '\n';
+		output << "    _SO_ = 'SO';" << '\n';
 	}
 
-	output << "}" << std::endl;
-	output << std::endl;
+	output << "}" << '\n';
+	output << '\n';
 }
 
 static void ExportScanChain(std::tuple<ScanList, ScanList> scanChain, std::ostream& output)
 {
 	auto [flipFlopInputs, flipFlopOutputs] = scanChain;
 
-	output << "ScanStructures {" << std::endl;
-	output << "    ScanChain SCAN_CHAIN {" << std::endl;
-	output << "        ScanLength " << flipFlopInputs.size() << ";" << std::endl;
-	output << "        ScanInversion 0;" << std::endl;
-	output << "        ScanIn \"SI\";" << std::endl;
-	output << "        ScanOut \"SO\";" << std::endl;
-	output << "        ScanMasterClock \"TCK\";" << std::endl;
-	output << "    }" << std::endl;
-	output << "}" << std::endl;
-	output << std::endl;
+	output << "ScanStructures {" << '\n';
+	output << "    ScanChain SCAN_CHAIN {" << '\n';
+	output << "        ScanLength " << flipFlopInputs.size() << ";" << '\n';
+	output << "        ScanInversion 0;" << '\n';
+	output << "        ScanIn \"SI\";" << '\n';
+	output << "        ScanOut \"SO\";" << '\n';
+	output << "        ScanMasterClock \"TCK\";" << '\n';
+	output << "    }" << '\n';
+	output << "}" << '\n';
+	output << '\n';
 }
 
 static void ExportScanMacros(std::ostream& output)
 {
-	output << "MacroDefs {" << std::endl;
-	output << "    SCAN_LOAD_UNLOAD {" << std::endl;
-	output << "        Shift { V { \"SE\" = 1; \"SI\" = #; \"SO\" = #; \"TCK\" = P; } }" << std::endl;
-	output << "    }" << std::endl;
-	output << "}" << std::endl;
-	output << std::endl;
+	output << "MacroDefs {" << '\n';
+	output << "    SCAN_LOAD_UNLOAD {" << '\n';
+	output << "        Shift { V { \"SE\" = 1; \"SI\" = #; \"SO\" = #; \"TCK\" = P; } }" << '\n';
+	output << "    }" << '\n';
+	output << "}" << '\n';
+	output << '\n';
 }
 
 static void ExportPatternExec(std::ostream& output)
 {
-	output << "PatternBurst PATTERNS {" << std::endl;
-	output << "    PatList { PATTERN; }" << std::endl;
-	output << "}" << std::endl;
-	output << std::endl;
-
-	output << "PatternExec {" << std::endl;
-	output << "    PatternBurst PATTERNS;" << std::endl;
-	output << "}" << std::endl;
-	output << std::endl;
+	output << "PatternBurst PATTERNS {" << '\n';
+	output << "    PatList { PATTERN; }" << '\n';
+	output << "}" << '\n';
+	output << '\n';
+
+	output << "PatternExec {" << '\n';
+	output << "    PatternBurst PATTERNS;" << '\n';
+	output << "}" << '\n';
+	output << '\n';
 }
 
 void ExportStilFullScan(const Circuit::CircuitEnvironment& circuit, const Pattern::TestPatternList& patterns, std::ostream& output)
@@ -296,54 +287,62 @@ void ExportStilFullScan(const Circuit::CircuitEnvironment& circuit, const Patter
 	noSpecSecondaryInputs = std::string(secondaryInputs.size(), 'Z');
 	noSpecSecondaryOutputs = std::string(secondaryOutputs.size(), 'X');
 
-	output << "Pattern PATTERN {" << std::endl;
-	output << "    Ann {* Initialization Pattern, has to be fully defined *}" << std::endl;
-	output << "    V {" << std::endl;
-	output << "        \"_PI_\" = " << noSpecPrimaryInputs << ";" << std::endl;
-	output << "        \"_PO_\" = " << noSpecPrimaryOutputs << ";" << std::endl;
-	output << "        \"_SI_\" = 000; \"_SO_\" = X;" << std::endl;
-	output << "    }" << std::endl;
-	output << std::endl;
-
-	size_t patternId { 0u };
-	for (auto const& pattern : patterns)
-	{
+	output << "Pattern PATTERN {" << '\n';
+	output << "    Ann {* Initialization Pattern, has to be fully defined *}" << '\n';
+	output << "    V {" << '\n';
+	output << "        \"_PI_\" = " << noSpecPrimaryInputs << ";" << '\n';
+	output << "        \"_PO_\" = " << noSpecPrimaryOutputs << ";" << '\n';
+	output << "        \"_SI_\" = 000; \"_SO_\" = X;" << '\n';
+	output << "    }" << '\n';
+	output << '\n';
+
+	const auto primaryInputNodes { GetPortNodes(primaryInputs) };
+	const auto primaryOutputNodes { GetPortNodes(primaryOutputs) };
+	ExportPatternChunks(patterns, output, [&](std::string& buffer, size_t patternId, const Pattern::TestPattern& pattern) {
 		Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
-		Simulation::SimulationResult simulation(pattern->GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
-		Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(mappedCircuit, *pattern, {}, simulation, simConfig);
-
-		output << "    Ann {* Pattern " << patternId++ << " *}" << std::endl;
-		output << "    Ann {* Step 1: Apply primary inputs *}" << std::endl;
-		output << "    V {" << std::endl;
-		output << "        \"_PI_\" = " << GetPrimaryInputVectors(primaryInputs, simulation, 0u) << ";" << std::endl;
-		output << "        \"_PO_\" = " << noSpecPrimaryOutputs << ";" << std::endl;
-		output << "        \"_SI_\" = 000; \"_SO_\" = X;" << std::endl;
-		output << "    }" << std::endl;
-		output << "    Ann {* Step 2: Apply scan chain inputs *}" << std::endl;
-		output << "    Macro SCAN_LOAD_UNLOAD {" << std::endl;
-		output << "        \"_SI_\" = " << GetSecondaryInputVectors(secondaryInputs, simulation, 0u) << ";" << std::endl;
-		output << "        \"_SO_\" = " << noSpecSecondaryOutputs << ";" << std::endl;
-		output << "    }" << std::endl;
-		output << "    Ann {* Step 3: Check primary outputs *}" << std::endl;
-		output << "    V {" << std::endl;
-		output << "        \"_PI_\" = " << GetPrimaryInputVectors(primaryInputs, simulation, 0u) << ";" << std::endl;
-		output << "        \"_PO_\" = " << GetPrimaryOutputVectors(primaryOutputs, simulation, 0u) << ";" << std::endl;
-		output << "        \"_SI_\" = 000; \"_SO_\" = X;" << std::endl;
-		output << "    }" << std::endl;
-		output << "    Ann {* Step 4: Load scan chain with next state *}" << std::endl;
-		output << "    V {" << std::endl;
-		output << "        \"_PI_\" = " << GetPrimaryInputVectors(primaryInputs, simulation, 0u) << ";" << std::endl;
-		output << "        \"_PO_\" = " << noSpecPrimaryOutputs << ";" << std::endl;
-		output << "        \"_SI_\" = P00; \"_SO_\" = X;" << std::endl;
-		output << "    }" << std::endl;
-		output << "    Ann {* Step 5: Check scan chain outputs *}" << std::endl;
-		output << "    Macro SCAN_LOAD_UNLOAD {" << std::endl;
-		output << "        \"_SI_\" = " << GetSecondaryInputVectors(secondaryInputs, simulation, 0u) << ";" << std::endl;
-		output << "        \"_SO_\" = " << GetSecondaryOutputVectors(secondaryOutputs, simulation, 0u) << ";" << std::endl;
-		output << "    }" << std::endl;
-		output << std::endl;
-	}
-	output << "}" << std::endl;
+		Simulation::SimulationResult simulation(pattern.GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
+		Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(mappedCircuit, pattern, {}, simulation, simConfig);
+
+		const auto append_line = [&](const char* prefix, const ScanList& nodes, const VectorSymbols& symbols, const char* suffix) {
+			buffer += prefix;
+			AppendVector(buffer, nodes, symbols, simulation, 0u);
+			buffer += suffix;
+		};
+
+		buffer += "    Ann {* Pattern ";
+		buffer += std::to_string(patternId);
+		buffer += " *}\n";
+		buffer += "    Ann {* Step 1: Apply primary inputs *}\n";
+		buffer += "    V {\n";
+		append_line("        \"_PI_\" = ", primaryInputNodes, INPUT_SYMBOLS, ";\n");
+		buffer += "        \"_PO_\" = " + noSpecPrimaryOutputs + ";\n";
+		buffer += "        \"_SI_\" = 000; \"_SO_\" = X;\n";
+		buffer += "    }\n";
+		buffer += "    Ann {* Step 2: Apply scan chain inputs *}\n";
+		buffer += "    Macro SCAN_LOAD_UNLOAD {\n";
+		append_line("        \"_SI_\" = ", secondaryInputs, SCAN_INPUT_SYMBOLS, ";\n");
+		buffer += "        \"_SO_\" = " + noSpecSecondaryOutputs + ";\n";
+		buffer += "    }\n";
+		buffer += "    Ann {* Step 3: Check primary outputs *}\n";
+		buffer += "    V {\n";
+		append_line("        \"_PI_\" = ", primaryInputNodes, INPUT_SYMBOLS, ";\n");
+		append_line("        \"_PO_\" = ", primaryOutputNodes, OUTPUT_SYMBOLS, ";\n");
+		buffer += "        \"_SI_\" = 000; \"_SO_\" = X;\n";
+		buffer += "    }\n";
+		buffer += "    Ann {* Step 4: Load scan chain with next state *}\n";
+		buffer += "    V {\n";
+		append_line("        \"_PI_\" = ", primaryInputNodes, INPUT_SYMBOLS, ";\n");
+		buffer += "        \"_PO_\" = " + noSpecPrimaryOutputs + ";\n";
+		buffer += "        \"_SI_\" = P00; \"_SO_\" = X;\n";
+		buffer += "    }\n";
+		buffer += "    Ann {* Step 5: Check scan chain outputs *}\n";
+		buffer += "    Macro SCAN_LOAD_UNLOAD {\n";
+		append_line("        \"_SI_\" = ", secondaryInputs, SCAN_INPUT_SYMBOLS, ";\n");
+		append_line("        \"_SO_\" = ", secondaryOutputs, SCAN_OUTPUT_SYMBOLS, ";\n");
+		buffer += "    }\n";
+		buffer += "\n";
+	});
+	output << "}" << '\n';
 }
 
 void ExportStilSequential(const Circuit::CircuitEnvironment& circuit, const Pattern::TestPatternList& patterns, std::ostream& output)
@@ -368,31 +367,36 @@ void ExportStilSequential(const Circuit::CircuitEnvironment& circuit, const Patt
 		noSpecPrimaryOutputs += std::string(port->GetSize().GetSize(), 'X');
 	}
 
-	output << "Pattern PATTERN {" << std::endl;
-	output << "    Ann {* Initialization Pattern, has to be fully defined *}" << std::endl;
-	output << "    V {" << std::endl;
-	output << "        \"_PI_\" = " << noSpecPrimaryInputs << ";" << std::endl;
-	output << "        \"_PO_\" = " << noSpecPrimaryOutputs << ";" << std::endl;
-	output << "    }" << std::endl;
-	output << std::endl;
-
-	output << "Pattern PATTERN {" << std::endl;
-	size_t patternId { 0u };
-	for (auto const& pattern : patterns)
-	{
+	output << "Pattern PATTERN {" << '\n';
+	output << "    Ann {* Initialization Pattern, has to be fully defined *}" << '\n';
+	output << "    V {" << '\n';
+	output << "        \"_PI_\" = " << noSpecPrimaryInputs << ";" << '\n';
+	output << "        \"_PO_\" = " << noSpecPrimaryOutputs << ";" << '\n';
+	output << "    }" << '\n';
+	output << '\n';
+
+	output << "Pattern PATTERN {" << '\n';
+	const auto primaryInputNodes { GetPortNodes(primaryInputs) };
+	const auto primaryOutputNodes { GetPortNodes(primaryOutputs) };
+	ExportPatternChunks(patterns, output, [&](std::string& buffer, size_t patternId, const Pattern::TestPattern& pattern) {
 		Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
-		Simulation::SimulationResult simulation(pattern->GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
-		Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(mappedCircuit, *pattern, {}, simulation, simConfig);
+		Simulation::SimulationResult simulation(pattern.GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
+		Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(mappedCircuit, pattern, {}, simulation, simConfig);
 
-		output << "    Ann {* Pattern " << patternId++ << " *}" << std::endl;
-		for (size_t timeframe { 0u }; timeframe < pattern->GetNumberOfTimeframes(); timeframe++)
+		buffer += "    Ann {* Pattern ";
+		buffer += std::to_string(patternId);
+		buffer += " *}\n";
+		for (size_t timeframe { 0u }; timeframe < pattern.GetNumberOfTimeframes(); timeframe++)
 		{
-			output << "    V { \"_PI_\" = " << GetPrimaryInputVectors(primaryInputs, simulation, timeframe) << "; \"_PO_\" = "
-				<< GetPrimaryOutputVectors(primaryOutputs, simulation, timeframe) << "}" << std::endl;
+			buffer += "    V { \"_PI_\" = ";
+			AppendVector(buffer, primaryInputNodes, INPUT_SYMBOLS, simulation, timeframe);
+			buffer += "; \"_PO_\" = ";
+			AppendVector(buffer, primaryOutputNodes, OUTPUT_SYMBOLS, simulation, timeframe);
+			buffer += "}\n";
 		}
-		output << std::endl;
-	}
-	output << "}" << std::endl;
+		buffer += "\n";
+	});
+	output << "}" << '\n';
 }
 
 void ExportStilPatterns(const Circuit::CircuitEnvironment& circuit, const Pattern::TestPatternList& patterns, StilPatternType type, std::ostream& output)
@@ -0,0 +1,312 @@
+#include "Io/TestPatternParser/TestPatternBinaryParser.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Fault/Models/FaultFreeModel.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
+
+using namespace FreiTest::Basic;
+
+namespace FreiTest
+{
+namespace Io
+{
+
+// ----------------------------------------------------------------------------
+// Binary pattern format
+// ----------------------------------------------------------------------------
+//
+// Header:   magic, version, byte order marker, input capture,
+//           number of primary and secondary inputs, circuit guard
+// Index:    number of patterns followed by the file offset of each pattern
+// Patterns: number of timeframes followed by the packed primary and
+//           secondary inputs of each timeframe (as selected by the capture)
+//
+// The values of one input vector are packed with four values per byte.
+// Increment the version when the encoding changes.
+
+static constexpr Binary::Magic PATTERN_MAGIC { '\x89', 'F', 'T', 'P', 'A', 'T', 'T', 'S' };
+static constexpr uint64_t PATTERN_VERSION { 1u };
+
+static constexpr Logic CODE_TO_LOGIC[4] {
+	Logic::LOGIC_ZERO, Logic::LOGIC_ONE, Logic::LOGIC_DONT_CARE, Logic::LOGIC_UNKNOWN
+};
+
+static std::optional<uint8_t> GetCodeForLogic(Logic value)
+{
+	switch (value)
+	{
+		case Logic::LOGIC_ZERO: return 0u;
+		case Logic::LOGIC_ONE: return 1u;
+		case Logic::LOGIC_DONT_CARE: return 2u;
+		case Logic::LOGIC_UNKNOWN: return 3u;
+		default: return std::nullopt;
+	}
+}
+
+static size_t GetPackedSize(size_t values)
+{
+	return (values + 3u) / 4u;
+}
+
+static bool CapturesPrimaryInputs(Pattern::InputCapture capture)
+{
+	return capture == Pattern::InputCapture::PrimaryInputsOnly
+		|| capture == Pattern::InputCapture::PrimaryAndSecondaryInputs
+		|| capture == Pattern::InputCapture::PrimaryAndInitialSecondaryInputs;
+}
+
+static bool CapturesSecondaryInputs(Pattern::InputCapture capture, size_t timeframe)
+{
+	return capture == Pattern::InputCapture::SecondaryInputsOnly
+		|| capture == Pattern::InputCapture::PrimaryAndSecondaryInputs
+		|| (capture == Pattern::InputCapture::PrimaryAndInitialSecondaryInputs && timeframe == 0u);
+}
+
+// Returns the size of a pattern including the number of timeframes or nothing if it does not fit into 64 bits.
+static std::optional<uint64_t> GetPatternSize(uint64_t timeframes, size_t primaryInputs, size_t secondaryInputs, Pattern::InputCapture capture)
+{
+	if (timeframes == 0u)
+	{
+		return sizeof(uint64_t);
+	}
+
+	// Only the first timeframe can differ (initial secondary inputs)
+	const uint64_t primarySize { CapturesPrimaryInputs(capture) ? GetPackedSize(primaryInputs) : 0u };
+	const uint64_t firstSize { sizeof(uint64_t) + primarySize + (CapturesSecondaryInputs(capture, 0u) ? GetPackedSize(secondaryInputs) : 0u) };
+	const uint64_t followingSize { primarySize + (CapturesSecondaryInputs(capture, 1u) ? GetPackedSize(secondaryInputs) : 0u) };
+	if (followingSize > 0u && timeframes - 1u > (std::numeric_limits<uint64_t>::max() - firstSize) / followingSize)
+	{
+		return std::nullopt;
+	}
+
+	return firstSize + (timeframes - 1u) * followingSize;
+}
+
+template<typename ValueGetter>
+static bool PackValues(std::vector<uint8_t>& buffer, size_t count, ValueGetter get_value)
+{
+	buffer.assign(GetPackedSize(count), 0u);
+	for (size_t index { 0u }; index < count; ++index)
+	{
+		const auto code { GetCodeForLogic(get_value(index)) };
+		if (!code.has_value())
+		{
+			LOG(ERROR) << "The logic value " << get_value(index) << " can not be stored in the binary format";
+			return false;
+		}
+
+		buffer[index / 4u] |= code.value() << (2u * (index % 4u));
+	}
+	return true;
+}
+
+static void UnpackValues(const std::vector<uint8_t>& buffer, size_t offset, std::vector<Logic>& values)
+{
+	for (size_t index { 0u }; index < values.size(); ++index)
+	{
+		values[index] = CODE_TO_LOGIC[(buffer[offset + index / 4u] >> (2u * (index % 4u))) & 0x3u];
+	}
+}
+
+bool ExportPatternsBinary(std::ostream& output, const TestPatternExchangeFormat& patterns)
+{
+	const auto& circuit { patterns.GetCircuit() };
+	const auto& mappedCircuit { circuit.GetMappedCircuit() };
+	const auto& testPatterns { patterns.GetTestPatterns() };
+	const auto capture { patterns.GetInputCapture() };
+	const size_t primaryInputs { mappedCircuit.GetNumberOfPrimaryInputs() };
+	const size_t secondaryInputs { mappedCircuit.GetNumberOfSecondaryInputs() };
+
+	Binary::BinaryExchangeWriter writer(output);
+	writer.WriteHeader(PATTERN_MAGIC, PATTERN_VERSION);
+	writer.Write(static_cast<uint64_t>(capture));
+	writer.Write(primaryInputs);
+	writer.Write(secondaryInputs);
+	writer.WriteCircuitGuard(circuit);
+
+	// The size of every pattern is known in advance.
+	// Therefore, the index can be written in front of the patterns.
+	writer.Write(testPatterns.size());
+	uint64_t patternOffset { writer.GetOffset() + testPatterns.size() * sizeof(uint64_t) };
+	for (const auto& pattern : testPatterns)
+	{
+		writer.Write(patternOffset);
+		patternOffset += GetPatternSize(pattern->GetNumberOfTimeframes(), primaryInputs, secondaryInputs, capture).value();
+	}
+
+	std::vector<uint8_t> buffer;
+	for (const auto& pattern : testPatterns)
+	{
+		// The JSON format stores the simulated secondary inputs for the following timeframes.
+		// The simulation is only required if these are captured.
+		std::optional<Simulation::SimulationResult> simulation;
+		if (pattern->GetNumberOfTimeframes() > 1u && CapturesSecondaryInputs(capture, 1u))
+		{
+			Simulation::SimulationConfig simConfig { Simulation::MakeSimulationConfig(Basic::MakeUnclockedSetResetFlipFlopModel()) };
+			simulation.emplace(pattern->GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
+			Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(mappedCircuit, *pattern, {}, *simulation, simConfig);
+		}
+
+		writer.Write(pattern->GetNumberOfTimeframes());
+		for (size_t timeframe { 0u }; timeframe < pattern->GetNumberOfTimeframes(); ++timeframe)
+		{
+			if (CapturesPrimaryInputs(capture))
+			{
+				const auto& values { pattern->GetPrimaryInputs(timeframe) };
+				if (!PackValues(buffer, primaryInputs, [&](size_t index) { return values[index]; }))
+				{
+					return false;
+				}
+				writer.WriteBytes(buffer.data(), buffer.size());
+			}
+
+			if (CapturesSecondaryInputs(capture, timeframe))
+			{
+				const auto& values { pattern->GetSecondaryInputs(timeframe) };
+				if (!PackValues(buffer, secondaryInputs, [&](size_t index) {
+						return (timeframe == 0u)
+							? values[index]
+							: (*simulation)[timeframe][mappedCircuit.GetSecondaryInput(index)->GetNodeId()];
+					}))
+				{
+					return false;
+				}
+				writer.WriteBytes(buffer.data(), buffer.size());
+			}
+		}
+	}
+
+	if (!writer.IsGood())
+	{
+		LOG(ERROR) << "Could not write binary pattern data";
+		return false;
+	}
+
+	return true;
+}
+
+std::optional<TestPatternExchangeFormat> ImportPatternRangeBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t begin, size_t end)
+{
+	const auto& mappedCircuit { circuit.GetMappedCircuit() };
+
+	Binary::BinaryExchangeReader reader(input);
+	if (!reader.ReadHeader(PATTERN_MAGIC, PATTERN_VERSION))
+	{
+		return std::nullopt;
+	}
+
+	uint64_t captureCode;
+	uint64_t primaryInputs;
+	uint64_t secondaryInputs;
+	if (!reader.Read(captureCode) || !reader.Read(primaryInputs) || !reader.Read(secondaryInputs))
+	{
+		LOG(ERROR) << "The binary pattern file is truncated";
+		return std::nullopt;
+	}
+	if (captureCode > static_cast<uint64_t>(Pattern::InputCapture::PrimaryAndInitialSecondaryInputs))
+	{
+		LOG(ERROR) << "The binary pattern file has an invalid input capture";
+		return std::nullopt;
+	}
+	if (primaryInputs != mappedCircuit.GetNumberOfPrimaryInputs()
+		|| secondaryInputs != mappedCircuit.GetNumberOfSecondaryInputs())
+	{
+		LOG(ERROR) << "The binary pattern file has " << primaryInputs << " primary and " << secondaryInputs
+			<< " secondary inputs while the circuit has " << mappedCircuit.GetNumberOfPrimaryInputs()
+			<< " and " << mappedCircuit.GetNumberOfSecondaryInputs();
+		return std::nullopt;
+	}
+	if (!reader.ValidateCircuitGuard(circuit))
+	{
+		return std::nullopt;
+	}
+
+	uint64_t numberOfPatterns;
+	if (!reader.Read(numberOfPatterns))
+	{
+		LOG(ERROR) << "The binary pattern file is truncated";
+		return std::nullopt;
+	}
+
+	end = std::min<size_t>(end, numberOfPatterns);
+	begin = std::min<size_t>(begin, end);
+
+	std::vector<uint64_t> index;
+	if (!reader.ReadBlock(index, numberOfPatterns))
+	{
+		LOG(ERROR) << "The binary pattern file is truncated";
+		return std::nullopt;
+	}
+
+	const auto capture { static_cast<Pattern::InputCapture>(captureCode) };
+	if (begin < end && !reader.Seek(index[begin]))
+	{
+		LOG(ERROR) << "Could not seek to pattern " << begin;
+		return std::nullopt;
+	}
+
+	Pattern::TestPatternList patterns;
+	std::vector<uint8_t> buffer;
+	for (size_t patternIndex { begin }; patternIndex < end; ++patternIndex)
+	{
+		uint64_t timeframes;
+		if (reader.GetOffset() != index[patternIndex] || !reader.Read(timeframes))
+		{
+			LOG(ERROR) << "The binary pattern file has an invalid index for pattern " << patternIndex;
+			return std::nullopt;
+		}
+
+		// The packed data of the pattern is read before the pattern is allocated.
+		// Therefore, a corrupt number of timeframes can not allocate more memory than the file provides.
+		const auto patternSize { GetPatternSize(timeframes, primaryInputs, secondaryInputs, capture) };
+		if (!patternSize.has_value()
+			|| (patternIndex + 1u < numberOfPatterns && index[patternIndex + 1u] - index[patternIndex] != patternSize.value()))
+		{
+			LOG(ERROR) << "The binary pattern file has an invalid number of timeframes for pattern " << patternIndex;
+			return std::nullopt;
+		}
+		if (!reader.ReadBlock(buffer, patternSize.value() - sizeof(uint64_t)))
+		{
+			LOG(ERROR) << "The binary pattern file is truncated";
+			return std::nullopt;
+		}
+
+		Pattern::TestPattern pattern(timeframes, primaryInputs, secondaryInputs, Logic::LOGIC_DONT_CARE);
+		size_t bufferOffset { 0u };
+		for (size_t timeframe { 0u }; timeframe < timeframes; ++timeframe)
+		{
+			if (CapturesPrimaryInputs(capture))
+			{
+				UnpackValues(buffer, bufferOffset, pattern.GetPrimaryInputs(timeframe));
+				bufferOffset += GetPackedSize(primaryInputs);
+			}
+
+			if (CapturesSecondaryInputs(capture, timeframe))
+			{
+				UnpackValues(buffer, bufferOffset, pattern.GetSecondaryInputs(timeframe));
+				bufferOffset += GetPackedSize(secondaryInputs);
+			}
+		}
+
+		patterns.emplace_back(pattern);
+	}
+
+	return std::make_optional<TestPatternExchangeFormat>(circuit, patterns, capture);
+}
+
+std::optional<TestPatternExchangeFormat> ImportPatternsBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit)
+{
+	return ImportPatternRangeBinary(input, circuit, 0u, std::numeric_limits<size_t>::max());
+}
+
+};
+};
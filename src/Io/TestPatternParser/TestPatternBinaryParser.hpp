@@ -0,0 +1,38 @@
+#pragma once
+
+#include <iostream>
+#include <optional>
+
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Io/TestPatternParser/TestPatternExchangeFormat.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+
+/**
+ * @brief Exports the patterns in the binary exchange format.
+ *
+ * The binary format contains the same input values as the JSON format
+ * (the values which the importer of the JSON format restores).
+ * Each value is packed into two bits and an index at the start of the
+ * file stores the offset of every pattern.
+ */
+bool ExportPatternsBinary(std::ostream& output, const TestPatternExchangeFormat& patterns);
+
+/**
+ * @brief Imports all patterns of a binary exchange file.
+ */
+std::optional<TestPatternExchangeFormat> ImportPatternsBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit);
+
+/**
+ * @brief Imports the patterns [begin, end) of a binary exchange file.
+ *
+ * The patterns before begin are skipped with the index without decoding them.
+ * The first imported pattern has the index 0 in the result.
+ */
+std::optional<TestPatternExchangeFormat> ImportPatternRangeBinary(std::istream& input, const Circuit::CircuitEnvironment& circuit, size_t begin, size_t end);
+
+};
+};
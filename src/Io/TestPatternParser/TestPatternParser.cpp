@@ -16,7 +16,11 @@
 #include "Basic/Fault/Models/FaultFreeModel.hpp"
 #include "Basic/Pattern/TestPatternList.hpp"
 #include "Simulation/CircuitSimulator.hpp"
+#include "Io/BinaryExchange/BinaryExchange.hpp"
 #include "Io/CircuitGuard/CircuitGuard.hpp"
+#include "Io/JsoncParser/JsonStreamReader.hpp"
+#include "Io/JsoncParser/JsonStreamWriter.hpp"
+#include "Io/TestPatternParser/TestPatternBinaryParser.hpp"
 
 using namespace FreiTest::Basic;
 
@@ -66,14 +70,28 @@ static Pattern::InputCapture ConvertStringToInputCapture(std::string capture)
 
 bool ExportPatterns(std::ostream& output, const TestPatternExchangeFormat& patterns)
 {
-	using ptree = boost::property_tree::ptree;
-
 	const auto& circuit { patterns.GetCircuit() };
 	const auto& mappedCircuit { circuit.GetMappedCircuit() };
 	const auto& testPatterns { patterns.GetTestPatterns() };
 	const auto capture { patterns.GetInputCapture() };
 
-	ptree exportPatternsList;
+	// The patterns are written one by one to keep the memory usage independent of the number of patterns
+	Json::JsonStreamWriter writer(output);
+	writer.BeginObject();
+	writer.WriteKey("patterns");
+	writer.BeginArray();
+
+	std::string values;
+	const auto write_values = [&](const std::string& key, const auto& nodes, const auto& simulation, size_t timeframe) {
+		values.clear();
+		for (auto const& node : nodes)
+		{
+			Logic value = simulation[timeframe][node->GetNodeId()];
+			values += static_cast<char>(value);
+		}
+		writer.WriteMember(key, values);
+	};
+
 	size_t testPatternIndex { 0u };
 	for (const auto pattern : testPatterns)
 	{
@@ -81,162 +99,152 @@ bool ExportPatterns(std::ostream& output, const TestPatternExchangeFormat& patte
 		Simulation::SimulationResult simulation(pattern->GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
 		Simulation::SimulateTestPatternEventDriven<Fault::FaultFreeModel>(mappedCircuit, *pattern, {}, simulation, simConfig);
 
-		ptree timeframesItem;
+		writer.BeginObject();
+		writer.WriteMember("index", testPatternIndex++);
+		writer.WriteKey("timeframes");
+		writer.BeginArray();
 		for (size_t timeframe = 0; timeframe < pattern->GetNumberOfTimeframes(); ++timeframe)
 		{
-			ptree timeframeItem;
-			timeframeItem.put("index", timeframe);
+			writer.BeginObject();
+			writer.WriteMember("index", timeframe);
 
 			if (capture == Pattern::InputCapture::PrimaryInputsOnly
 				|| capture == Pattern::InputCapture::PrimaryAndSecondaryInputs
 				|| capture == Pattern::InputCapture::PrimaryAndInitialSecondaryInputs)
 			{
-				std::string inputs;
-				for (auto const& input : mappedCircuit.GetPrimaryInputs())
-				{
-					Logic value = simulation[timeframe][input->GetNodeId()];
-					inputs += static_cast<char>(value);
-				}
-				timeframeItem.put("primary_inputs", inputs);
-
-				std::string outputs;
-				for (auto const& output : mappedCircuit.GetPrimaryOutputs())
-				{
-					Logic value = simulation[timeframe][output->GetNodeId()];
-					outputs += static_cast<char>(value);
-				}
-				timeframeItem.put("primary_outputs", outputs);
+				write_values("primary_inputs", mappedCircuit.GetPrimaryInputs(), simulation, timeframe);
+				write_values("primary_outputs", mappedCircuit.GetPrimaryOutputs(), simulation, timeframe);
 			}
 
 			if (capture == Pattern::InputCapture::SecondaryInputsOnly
 				|| capture == Pattern::InputCapture::PrimaryAndSecondaryInputs
 				|| (capture == Pattern::InputCapture::PrimaryAndInitialSecondaryInputs && timeframe == 0))
 			{
-				std::string inputs;
-				for (auto const& input : mappedCircuit.GetSecondaryInputs())
-				{
-					Logic value = simulation[timeframe][input->GetNodeId()];
-					inputs += static_cast<char>(value);
-				}
-				timeframeItem.put("secondary_inputs", inputs);
-
-				std::string outputs;
-				for (auto const& output : mappedCircuit.GetSecondaryOutputs())
-				{
-					Logic value = simulation[timeframe][output->GetNodeId()];
-					outputs += static_cast<char>(value);
-				}
-				timeframeItem.put("secondary_outputs", outputs);
+				write_values("secondary_inputs", mappedCircuit.GetSecondaryInputs(), simulation, timeframe);
+				write_values("secondary_outputs", mappedCircuit.GetSecondaryOutputs(), simulation, timeframe);
 			}
 
-			timeframesItem.push_back(std::make_pair("", timeframeItem));
+			writer.EndObject();
 		}
-
-		ptree testPatternItem;
-		testPatternItem.put("index", testPatternIndex++);
-		testPatternItem.put_child("timeframes", timeframesItem);
-
-		exportPatternsList.push_back(std::make_pair("", testPatternItem));
+		writer.EndArray();
+		writer.EndObject();
 	}
 
-	ptree root;
-	root.put_child("patterns", exportPatternsList);
-	root.put("pattern_capture", ConvertInputCaptureToString(capture));
-	root.put_child("circuit", CreateCircuitGuard(circuit));
+	writer.EndArray();
+	writer.WriteMember("pattern_capture", ConvertInputCaptureToString(capture));
+	writer.WriteKey("circuit");
+	writer.WriteTree(CreateCircuitGuard(circuit));
+	writer.EndObject();
+	writer.Finish();
 
-	try
+	if (!writer.IsGood())
 	{
-		boost::property_tree::write_json(output, root);
-	}
-	catch (boost::property_tree::json_parser_error& exception)
-	{
-		LOG(ERROR) << "Could not write json data: " << exception.what();
+		LOG(ERROR) << "Could not write json data";
 		return false;
 	}
 
 	return true;
 }
 
+bool ExportPatterns(std::ostream& output, const TestPatternExchangeFormat& patterns, Settings::ExchangeFormat format)
+{
+	switch (format)
+	{
+		case Settings::ExchangeFormat::Json:
+			return ExportPatterns(output, patterns);
+		case Settings::ExchangeFormat::Binary:
+			return ExportPatternsBinary(output, patterns);
+		default:
+			LOG(ERROR) << "Unknown exchange format";
+			return false;
+	}
+}
+
 std::optional<TestPatternExchangeFormat> ImportPatterns(std::istream& input, const Circuit::CircuitEnvironment& circuit)
 {
 	using ptree = boost::property_tree::ptree;
 
+	if (Binary::IsBinaryExchangeStream(input))
+	{
+		return ImportPatternsBinary(input, circuit);
+	}
+
 	const auto& mappedCircuit { circuit.GetMappedCircuit() };
 
-	try
-	{
-		ptree root;
-		boost::property_tree::read_json(input, root);
-		if (!ValidateCircuitGuard(root.get_child("circuit"), circuit))
+	Pattern::TestPatternList patterns;
+	const auto import_pattern = [&](ptree& patternItem, const ptree& document) -> bool {
+		if (patternItem.get_child("index").get_value<size_t>() != patterns.size())
 		{
-			return std::nullopt;
+			LOG(ERROR) << "Pattern has invalid index";
+			return false;
 		}
 
-		auto capture { ConvertStringToInputCapture(root.get_child("pattern_capture").get_value<std::string>()) };
+		ptree& timeframesList = patternItem.get_child("timeframes");
 
-		Pattern::TestPatternList patterns;
-		ptree& treePatterns = root.get_child("patterns");
-		for (auto patIt = treePatterns.ordered_begin(); patIt != treePatterns.not_found(); ++patIt)
+		size_t timeframeIndex = 0u;
+		Pattern::TestPattern pattern(timeframesList.size(), mappedCircuit.GetNumberOfPrimaryInputs(), mappedCircuit.GetNumberOfSecondaryInputs(), Logic::LOGIC_DONT_CARE);
+		for (auto tfIt = timeframesList.ordered_begin(); tfIt != timeframesList.not_found(); ++tfIt, ++timeframeIndex)
 		{
-			ptree& patternItem = patIt->second;
-
-			if (patternItem.get_child("index").get_value<size_t>() != patterns.size())
+			ptree& timeframeItem = tfIt->second;
+			if (timeframeIndex >= pattern.GetNumberOfTimeframes())
 			{
-				LOG(ERROR) << "Pattern has invalid index";
-				return std::nullopt;
+				LOG(ERROR) << "The timeframe " << timeframeIndex << " is longer than expected";
+				return false;
 			}
 
-			ptree& timeframesList = patternItem.get_child("timeframes");
-
-			size_t timeframeIndex = 0u;
-			Pattern::TestPattern pattern(timeframesList.size(), mappedCircuit.GetNumberOfPrimaryInputs(), mappedCircuit.GetNumberOfSecondaryInputs(), Logic::LOGIC_DONT_CARE);
-			for (auto tfIt = timeframesList.ordered_begin(); tfIt != timeframesList.not_found(); ++tfIt, ++timeframeIndex)
+			if (auto primaryInputs = timeframeItem.find("primary_inputs"); primaryInputs != timeframeItem.not_found())
 			{
-				ptree& timeframeItem = tfIt->second;
-				if (timeframeIndex >= pattern.GetNumberOfTimeframes())
+				std::string inputs = primaryInputs->second.get_value<std::string>();
+				if (inputs.size() != pattern.GetNumberOfPrimaryInputs())
 				{
-					LOG(ERROR) << "The timeframe " << timeframeIndex << " is longer than expected";
-					return std::nullopt;
+					LOG(ERROR) << "The timeframe " << timeframeIndex << " has " << inputs.size() << " inputs while the circuit has " << pattern.GetNumberOfPrimaryInputs();
+					return false;
 				}
 
-				if (auto primaryInputs = timeframeItem.find("primary_inputs"); primaryInputs != timeframeItem.not_found())
+				size_t inputIndex = 0u;
+				for (char input : inputs)
 				{
-					std::string inputs = primaryInputs->second.get_value<std::string>();
-					if (inputs.size() != pattern.GetNumberOfPrimaryInputs())
-					{
-						LOG(ERROR) << "The timeframe " << timeframeIndex << " has " << inputs.size() << " inputs while the circuit has " << pattern.GetNumberOfPrimaryInputs();
-						return std::nullopt;
-					}
-
-					size_t inputIndex = 0u;
-					for (char input : inputs)
-					{
-						pattern.SetPrimaryInput(timeframeIndex, inputIndex, static_cast<Logic>(input));
-						inputIndex++;
-					}
+					pattern.SetPrimaryInput(timeframeIndex, inputIndex, static_cast<Logic>(input));
+					inputIndex++;
 				}
+			}
 
-				if (auto secondaryInputs = timeframeItem.find("secondary_inputs"); secondaryInputs != timeframeItem.not_found())
+			if (auto secondaryInputs = timeframeItem.find("secondary_inputs"); secondaryInputs != timeframeItem.not_found())
+			{
+				std::string inputs = secondaryInputs->second.get_value<std::string>();
+				if (inputs.size() != pattern.GetNumberOfSecondaryInputs())
 				{
-					std::string inputs = secondaryInputs->second.get_value<std::string>();
-					if (inputs.size() != pattern.GetNumberOfSecondaryInputs())
-					{
-						LOG(ERROR) << "The timeframe " << timeframeIndex << " has " << inputs.size() << " inputs while the circuit has " << pattern.GetNumberOfSecondaryInputs();
-						return std::nullopt;
-					}
-
-					size_t inputIndex = 0u;
-					for (char input : inputs)
-					{
-						pattern.SetSecondaryInput(timeframeIndex, inputIndex, static_cast<Logic>(input));
-						inputIndex++;
-					}
+					LOG(ERROR) << "The timeframe " << timeframeIndex << " has " << inputs.size() << " inputs while the circuit has " << pattern.GetNumberOfSecondaryInputs();
+					return false;
+				}
+
+				size_t inputIndex = 0u;
+				for (char input : inputs)
+				{
+					pattern.SetSecondaryInput(timeframeIndex, inputIndex, static_cast<Logic>(input));
+					inputIndex++;
 				}
 			}
+		}
+
+		patterns.emplace_back(pattern);
+		return true;
+	};
 
-			patterns.emplace_back(pattern);
+	try
+	{
+		// The patterns are imported one by one to keep the memory usage independent of the number of patterns
+		auto root { Json::ReadJsonStreaming(input, "patterns", import_pattern) };
+		if (!root.has_value())
+		{
+			return std::nullopt;
+		}
+		if (!ValidateCircuitGuard(root->get_child("circuit"), circuit))
+		{
+			return std::nullopt;
 		}
 
+		auto capture { ConvertStringToInputCapture(root->get_child("pattern_capture").get_value<std::string>()) };
 		return std::make_optional<TestPatternExchangeFormat>(circuit, patterns, capture);
 	}
 	catch (boost::property_tree::json_parser_error& exception)
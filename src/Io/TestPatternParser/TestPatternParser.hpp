@@ -3,6 +3,7 @@
 #include <iostream>
 #include <optional>
 
+#include "Basic/Settings.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Io/TestPatternParser/TestPatternExchangeFormat.hpp"
 
@@ -12,6 +13,9 @@ namespace Io
 {
 
 bool ExportPatterns(std::ostream& output, const TestPatternExchangeFormat& patterns);
+bool ExportPatterns(std::ostream& output, const TestPatternExchangeFormat& patterns, Settings::ExchangeFormat format);
+
+// Imports JSON and binary exchange files (the format is detected automatically)
 std::optional<TestPatternExchangeFormat> ImportPatterns(std::istream& input, const Circuit::CircuitEnvironment& circuit);
 
 };
@@ -27,8 +27,6 @@ namespace Vcd
 std::string to_string(const VariableTypes& type);
 std::string to_string(const ModuleTypes& type);
 
-void WriteHeader(std::ostream& output, const VcdModel& model);
-void WriteVariable(std::ostream& output, const VcdModel& model);
 void WriteData(std::ostream& output, const VcdModel& model);
 void WriteVar(std::ostream& output, const Variable& var);
 void WriteScope(std::ostream& output, const std::shared_ptr<Scope>& scope);
@@ -36,39 +34,42 @@ void WriteScope(std::ostream& output, const std::shared_ptr<Scope>& scope);
 bool ExportVcd(const VcdModel& model, const std::string& fileName)
 {
 	FileHandle handle(fileName , false);
-	std::ofstream& output = handle.GetOutStream();
+	std::ostream& output = handle.GetOutStream();
 
-	if (!output.is_open())
+	if (!output.good())
 	{
 		return false;
 	}
 
-	WriteHeader(output, model);
-	WriteVariable(output, model);
-	WriteData(output, model);
+	WriteVcd(output, model);
 	return true;
 }
 
-void WriteHeader(std::ostream& outputStream, const VcdModel& model)
+void WriteVcd(std::ostream& output, const VcdModel& model)
 {
-	auto const& header = model.GetHeader();
+	WriteHeader(output, model.GetHeader());
+	WriteVariable(output, model.GetVariable());
+	WriteData(output, model);
+}
 
-	outputStream << "$version" << std::endl;
-	outputStream << "\t" << header.GetVersion() << std::endl;
-	outputStream << "$end" << std::endl;
+void WriteHeader(std::ostream& outputStream, const VcdHeader& header)
+{
+	outputStream << "$version" << '\n';
+	outputStream << "\t" << header.GetVersion() << '\n';
+	outputStream << "$end" << '\n';
 
-	outputStream << "$date" << std::endl;
+	outputStream << "$date" << '\n';
 	outputStream << "\t" << ctime(&(header.GetTimestamp()));
-	outputStream << "$end" << std::endl;
+	outputStream << "$end" << '\n';
 
-	outputStream << "$timescale "<< header.GetTimelapse() << "ns $end" << std::endl;
-	outputStream << std::endl;
+	outputStream << "$timescale "<< header.GetTimelapse() << "ns $end" << '\n';
+	outputStream << '\n';
 }
 
-void WriteVariable(std::ostream& outputStream, const VcdModel& model)
+void WriteVariable(std::ostream& outputStream, const VcdVariable& variable)
 {
-	WriteScope(outputStream, model.GetVariable().GetScope());
-	outputStream << "$enddefinitions $end" << std::endl;
+	WriteScope(outputStream, variable.GetScope());
+	outputStream << "$enddefinitions $end" << '\n';
 }
 
 void WriteData(std::ostream& outputStream, const VcdModel& model)
@@ -76,7 +77,7 @@ void WriteData(std::ostream& outputStream, const VcdModel& model)
 	const std::vector<Timeframe>& timeFrames = model.GetData().GetTimeFrames();
 
 	const auto write_values = [&](auto& values, const std::string& symbol) {
-		outputStream << std::endl;
+		outputStream << '\n';
 		if (values.size() > 1) outputStream << "b";
 		for (auto value : values) {
 			if (value == Basic::Logic::LOGIC_INVALID) value = Basic::Logic::LOGIC_DONT_CARE;
@@ -88,7 +89,7 @@ void WriteData(std::ostream& outputStream, const VcdModel& model)
 
 	size_t timeIndex = 0;
 	for (const Timeframe& timeframe : timeFrames) {
-		outputStream << std::endl << "#" << timeIndex;
+		outputStream << '\n' << "#" << timeIndex;
 		timeIndex += 5u;
 
 		for (auto [wireSymbol, wireValue] : timeframe.wireValues) {
@@ -98,7 +99,7 @@ void WriteData(std::ostream& outputStream, const VcdModel& model)
 			write_values(registerValue, registerSymbol);
 		}
 	}
-	outputStream << std::endl << "#" << timeIndex << std::endl;
+	outputStream << '\n' << "#" << timeIndex << '\n';
 }
 
 // -----------------------------------------------------------------------
@@ -108,13 +109,13 @@ void WriteVar(std::ostream& outputStream, const Variable& var)
 {
 	outputStream << "$var " << to_string(var.GetType()) << " ";
 	outputStream << var.GetSize() << " " << var.GetReference() << " ";
-	outputStream << var.GetName() << " $end" << std::endl;
+	outputStream << var.GetName() << " $end" << '\n';
 }
 
 void WriteScope(std::ostream& outputStream, const std::shared_ptr<Scope>& scope)
 {
-	outputStream << std::endl << "$scope " << to_string(scope->GetType()) << " ";
-	outputStream << scope->GetName() << " $end" << std::endl;
+	outputStream << '\n' << "$scope " << to_string(scope->GetType()) << " ";
+	outputStream << scope->GetName() << " $end" << '\n';
 
 	for (auto variable : scope->GetVariables())
 	{
@@ -126,7 +127,7 @@ void WriteScope(std::ostream& outputStream, const std::shared_ptr<Scope>& scope)
 		WriteScope(outputStream, childScope);
 	}
 
-	outputStream << "$upscope $end" << std::endl;
+	outputStream << "$upscope $end" << '\n';
 	return;
 }
 
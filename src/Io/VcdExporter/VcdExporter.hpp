@@ -13,6 +13,10 @@ namespace Vcd
 {
 
 bool ExportVcd(const VcdModel& model, const std::string& path);
+void WriteVcd(std::ostream& output, const VcdModel& model);
+
+void WriteHeader(std::ostream& output, const VcdHeader& header);
+void WriteVariable(std::ostream& output, const VcdVariable& variable);
 
 };
 };
@@ -194,6 +194,50 @@ VcdModel VcdModelBuilder::BuildVcdModel(const SimulationResult& simulationResult
 	return model;
 }
 
+std::vector<VcdSignal> VcdModelBuilder::BuildVcdSignals(const CircuitEnvironment& circuit) const
+{
+	std::vector<VcdSignal> signals;
+	std::map<std::string, size_t> signalIndex;
+	for (auto const& [reference, values] : defaultTimeframe.wireValues)
+	{
+		signalIndex.emplace(reference, signals.size());
+		signals.push_back({ reference, std::vector<const MappedNode*>(values.size(), nullptr) });
+	}
+
+	// Same selection of nodes as in BuildVcdData
+	for (const auto& mappedNode : circuit.GetMappedCircuit().GetNodes())
+	{
+		if (mappedNode->GetNumberOfSuccessors() == 0u)
+		{
+			continue;
+		}
+
+		const auto connectionId = mappedNode->GetOutputConnectionId();
+		if (connectionId == MappedCircuit::NO_CONNECTION)
+		{
+			continue;
+		}
+
+		if (auto it = references.find(connectionId); it != references.end())
+		{
+			signals[signalIndex.at(it->second)].nodes[0] = mappedNode;
+		}
+
+		if (auto it = connectionIdToBusRefAndIndex.find(connectionId); it != connectionIdToBusRefAndIndex.end())
+		{
+			const auto [busRef, index] = it->second;
+			signals[signalIndex.at(busRef)].nodes[index] = mappedNode;
+		}
+	}
+
+	return signals;
+}
+
+const VcdModel& VcdModelBuilder::GetModel(void) const
+{
+	return model;
+}
+
 void VcdModelBuilder::BuildVcdHeader(VcdModel& model, std::string version, int timelapse, time_t time) const
 {
 	model.header = VcdHeader(version, timelapse, time);
@@ -12,6 +12,7 @@
 #include <utility>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace FreiTest
 {
@@ -20,6 +21,18 @@ namespace Io
 namespace Vcd
 {
 
+/**
+ * @brief A variable of the VCD model with the mapped nodes that drive its bits.
+ *
+ * The bits of a bus are ordered as in the model.
+ * Bits without a driving node are a nullptr.
+ */
+struct VcdSignal
+{
+	std::string reference;
+	std::vector<const Circuit::MappedNode*> nodes;
+};
+
 class VcdModelBuilder
 {
 public:
@@ -30,6 +43,12 @@ public:
 	VcdModel BuildVcdModel(const Simulation::SimulationResult& simulationResult,
 		const Circuit::CircuitEnvironment& circuit, std::string version, int timelapse = 1, std::time_t time = 0) const;
 
+	/**
+	 * @brief Returns the variables of the initialized model in the order the model writes them.
+	 */
+	std::vector<VcdSignal> BuildVcdSignals(const Circuit::CircuitEnvironment& circuit) const;
+	const VcdModel& GetModel(void) const;
+
 private:
 	std::string CreateReference();
 	std::string GetOrCreateReference(std::size_t connectionId);
@@ -0,0 +1,124 @@
+#include "Io/VcdExporter/VcdStreamWriter.hpp"
+
+#include <sstream>
+
+#include "Basic/Logic.hpp"
+#include "Circuit/MappedCircuit.hpp"
+#include "Helper/FileHandle.hpp"
+#include "Io/VcdExporter/VcdExporter.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+using namespace FreiTest::Simulation;
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Vcd
+{
+
+// The buffer is written to the output when it exceeds this size
+static constexpr size_t BUFFER_SIZE { 1u << 20u };
+
+VcdStreamWriter::VcdStreamWriter(void):
+	definitions(),
+	signals()
+{
+}
+
+VcdStreamWriter::~VcdStreamWriter(void) = default;
+
+void VcdStreamWriter::Initialize(const CircuitEnvironment& circuit)
+{
+	VcdModelBuilder builder;
+	builder.Initialize(circuit);
+
+	std::ostringstream output;
+	WriteVariable(output, builder.GetModel().GetVariable());
+	definitions = output.str();
+	signals = builder.BuildVcdSignals(circuit);
+}
+
+bool VcdStreamWriter::ExportVcd(const SimulationResult& simulationResult, const std::string& fileName,
+	std::string version, int timelapse, time_t time) const
+{
+	FileHandle handle(fileName, false);
+	std::ostream& output = handle.GetOutStream();
+	if (!output.good())
+	{
+		return false;
+	}
+
+	WriteVcd(output, simulationResult, version, timelapse, time);
+	return output.good();
+}
+
+void VcdStreamWriter::WriteVcd(std::ostream& output, const SimulationResult& simulationResult,
+	std::string version, int timelapse, time_t time) const
+{
+	WriteHeader(output, VcdHeader(version, timelapse, time));
+	output << definitions;
+
+	// The values of all signals of the previous timeframe are stored consecutively
+	std::vector<size_t> offsets(signals.size() + 1u, 0u);
+	for (size_t signal { 0u }; signal < signals.size(); ++signal)
+	{
+		offsets[signal + 1u] = offsets[signal] + signals[signal].nodes.size();
+	}
+	std::string previous(offsets.back(), '\0');
+
+	std::string buffer;
+	buffer.reserve(BUFFER_SIZE + BUFFER_SIZE / 8u);
+
+	size_t timeIndex { 0u };
+	for (size_t timeframe { 0u }; timeframe < simulationResult.GetNumberOfTimeframes(); ++timeframe)
+	{
+		buffer += "\n#";
+		buffer += std::to_string(timeIndex);
+		timeIndex += 5u;
+
+		for (size_t signal { 0u }; signal < signals.size(); ++signal)
+		{
+			const auto& nodes { signals[signal].nodes };
+
+			bool changed { timeframe == 0u };
+			for (size_t bit { 0u }; bit < nodes.size(); ++bit)
+			{
+				Logic value { (nodes[bit] != nullptr)
+					? simulationResult.GetOutputLogic(nodes[bit], timeframe)
+					: Logic::LOGIC_DONT_CARE };
+				if (value == Logic::LOGIC_INVALID) value = Logic::LOGIC_DONT_CARE;
+
+				changed |= (previous[offsets[signal] + bit] != static_cast<char>(value));
+				previous[offsets[signal] + bit] = static_cast<char>(value);
+			}
+
+			if (!changed)
+			{
+				continue;
+			}
+
+			buffer += '\n';
+			if (nodes.size() > 1u) buffer += 'b';
+			buffer.append(previous, offsets[signal], nodes.size());
+			if (nodes.size() > 1u) buffer += ' ';
+			buffer += signals[signal].reference;
+		}
+
+		if (buffer.size() >= BUFFER_SIZE)
+		{
+			output.write(buffer.data(), buffer.size());
+			buffer.clear();
+		}
+	}
+
+	buffer += "\n#";
+	buffer += std::to_string(timeIndex);
+	buffer += '\n';
+	output.write(buffer.data(), buffer.size());
+}
+
+};
+};
+};
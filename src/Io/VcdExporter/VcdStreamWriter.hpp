@@ -0,0 +1,51 @@
+#pragma once
+
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Circuit/CircuitEnvironment.hpp"
+#include "Io/VcdExporter/VcdModelBuilder.hpp"
+#include "Simulation/CircuitSimulationResult.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Vcd
+{
+
+/**
+ * @brief Writes VCD files directly from simulation results.
+ *
+ * Contrary to the VcdModelBuilder no VcdModel is built for each file.
+ * The variable definitions and the nodes driving each variable are
+ * computed once in Initialize. Afterwards, the values are written
+ * timeframe by timeframe into a buffer and only the variables that
+ * changed since the previous timeframe are written (value change dump).
+ * The writer is read-only after the initialization and can be used
+ * by multiple threads in parallel.
+ */
+class VcdStreamWriter
+{
+public:
+	VcdStreamWriter(void);
+	virtual ~VcdStreamWriter(void);
+
+	void Initialize(const Circuit::CircuitEnvironment& circuit);
+
+	bool ExportVcd(const Simulation::SimulationResult& simulationResult, const std::string& fileName,
+		std::string version, int timelapse = 1, std::time_t time = 0) const;
+	void WriteVcd(std::ostream& output, const Simulation::SimulationResult& simulationResult,
+		std::string version, int timelapse = 1, std::time_t time = 0) const;
+
+private:
+	std::string definitions;
+	std::vector<VcdSignal> signals;
+
+};
+
+};
+};
+};
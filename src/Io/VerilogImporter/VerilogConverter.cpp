@@ -19,8 +19,10 @@
 #include "Circuit/UnmappedCircuit.hpp"
 #include "Helper/FileHandle.hpp"
 #include "Helper/StringHelper.hpp"
+#include "Io/CircuitSnapshot/CircuitSnapshot.hpp"
 #include "Io/VerilogInstantiator/BuiltinPrimitives.hpp"
 #include "Io/VerilogInstantiator/VerilogInstantiator.hpp"
+#include "Io/VerilogLibraryCache/VerilogLibraryCache.hpp"
 #include "Io/VerilogPreprocessor/VerilogPreprocessor.hpp"
 #include "Io/VerilogSpiritParser/VerilogParser.hpp"
 #include "Io/VerilogExporter/VerilogExporter.hpp"
@@ -42,35 +44,180 @@ VerilogConverter::~VerilogConverter(void) = default;
 
 std::unique_ptr<CircuitEnvironment> VerilogConverter::LoadCircuit(std::shared_ptr<Settings> settings) const
 {
+	// -----------------------------------------------------------------------
+	// Circuit Snapshot (Skips preprocessor, parser and instantiation)
+	// -----------------------------------------------------------------------
+
+	if (settings->CircuitSnapshotFilename != "")
+	{
+		const std::string snapshotFilename { settings->MapFileName(settings->CircuitSnapshotFilename, false) };
+		if (auto builder = ImportCircuitSnapshot(snapshotFilename, GetCircuitSnapshotSourceKey(settings)); builder)
+		{
+			Builder::BuildConfiguration buildConfiguration;
+			return builder->BuildCircuitEnvironment(buildConfiguration);
+		}
+	}
+
 	LOG(INFO) << "Loading verilog sources";
 
+	// The debug exports require the complete preprocessed and parsed sources
+	const bool useLibraryCache { settings->VerilogLibraryCacheDirectory != ""
+		&& !settings->VerilogLibraryFilenames.empty()
+		&& settings->VerilogExportPreprocessedFilename == ""
+		&& settings->VerilogExportProcessedFilename == "" };
+	std::vector<std::string> includedFiles;
+	auto verilogModules = useLibraryCache
+		? LoadModulesWithLibraryCache(settings, includedFiles)
+		: LoadModules(settings, includedFiles);
+	if (!verilogModules)
+	{
+		return std::unique_ptr<CircuitEnvironment>();
+	}
+
+	auto circuit = InstantiateModule(settings, *verilogModules, includedFiles);
+
+	LOG(INFO) << "Instantiated module";
+	return circuit;
+}
+
+std::unique_ptr<ModuleCollection> VerilogConverter::LoadModules(std::shared_ptr<Settings>& settings, std::vector<std::string>& includedFiles) const
+{
 	// -----------------------------------------------------------------------
 	// Macro Preprocessor (Handles #includes and #ifdefs)
 	// -----------------------------------------------------------------------
 
-	ostringstream preprocessorOutput;
-	if (!PreprocessFiles(settings, preprocessorOutput))
+	// The preprocessed sources are kept in one contiguous buffer
+	// that is handed to the parser without any further copy.
+	CpuClock preprocessorTimer;
+	preprocessorTimer.SetTimeReference();
+
+	string preprocessorOutput;
+	if (!PreprocessFiles(settings, preprocessorOutput, includedFiles))
 	{
 		LOG(ERROR) << "Could not preprocess verilog sources";
-		return std::unique_ptr<CircuitEnvironment>();
+		return std::unique_ptr<ModuleCollection>();
 	}
 
+	LOG(INFO) << "Preprocessed " << preprocessorOutput.size() << " bytes of verilog sources in "
+		<< preprocessorTimer.RunTimeSinceReference() << " s";
 	FreiTest::Statistic::PrintDetailedMemoryUsage();
 
 	// -----------------------------------------------------------------------
 	// Parser
 	// -----------------------------------------------------------------------
 
-	istringstream preprocessedStream(preprocessorOutput.str());
+	CpuClock parserTimer;
+	parserTimer.SetTimeReference();
 
-	auto verilogModules = ParseVerilog(settings, preprocessedStream);
-	auto circuit = InstantiateModule(settings, *verilogModules);
+	auto verilogModules = ParseVerilog(settings, preprocessorOutput);
+	if (!verilogModules)
+	{
+		return std::unique_ptr<ModuleCollection>();
+	}
 
-	LOG(INFO) << "Instantiated module";
-	return circuit;
+	LOG(INFO) << "Parsed " << verilogModules->size() << " verilog modules in "
+		<< parserTimer.RunTimeSinceReference() << " s";
+
+	return verilogModules;
+}
+
+std::unique_ptr<ModuleCollection> VerilogConverter::LoadModulesWithLibraryCache(std::shared_ptr<Settings>& settings, std::vector<std::string>& includedFiles) const
+{
+	auto map_files = [&](const vector<string>& files) {
+		vector<string> mappedFiles;
+		for (const auto& file : files)
+		{
+			mappedFiles.push_back(settings->MapFileName(file, true));
+		}
+		return mappedFiles;
+	};
+
+	const vector<string> libraryFiles { map_files(settings->VerilogLibraryFilenames) };
+	const vector<string> circuitFiles { map_files(settings->VerilogImportFilenames) };
+	const string cacheDirectory { settings->MapFileName(settings->VerilogLibraryCacheDirectory, false) };
+
+	// -----------------------------------------------------------------------
+	// Library (Loaded from the cache or preprocessed and parsed separately)
+	// -----------------------------------------------------------------------
+
+	Verilog::VerilogPreprocessor circuitPreprocessor;
+	const string cacheKey { GetVerilogLibraryCacheKey(libraryFiles, circuitPreprocessor.GetDefinedSymbols()) };
+	auto library = ImportVerilogLibraryCache(cacheKey, cacheDirectory);
+	if (!library)
+	{
+		Verilog::VerilogPreprocessor libraryPreprocessor;
+		string libraryOutput;
+		if (!libraryPreprocessor.Transform(libraryFiles, libraryOutput))
+		{
+			LOG(ERROR) << "Could not preprocess verilog library";
+			return std::unique_ptr<ModuleCollection>();
+		}
+
+		// A library that ends inside of a conditional block or comment
+		// influences the circuit files and can't be processed separately.
+		if (!libraryPreprocessor.IsNeutralState())
+		{
+			LOG(WARNING) << "The verilog library leaves the preprocessor in an open block and can not be cached";
+			return LoadModules(settings, includedFiles);
+		}
+
+		Verilog::VerilogParser parser;
+		if (!parser.Parse(libraryOutput))
+		{
+			LOG(ERROR) << "Could not parse verilog library";
+			return std::unique_ptr<ModuleCollection>();
+		}
+
+		library = VerilogLibraryCacheEntry { std::move(parser.GetModules()), libraryPreprocessor.GetDefinedSymbols(), libraryPreprocessor.GetIncludedFiles() };
+		ExportVerilogLibraryCache(*library, cacheKey, cacheDirectory);
+	}
+
+	// -----------------------------------------------------------------------
+	// Circuit (Preprocessed with the symbols defined by the library)
+	// -----------------------------------------------------------------------
+
+	for (const auto& [symbol, value] : library->definedSymbols)
+	{
+		circuitPreprocessor.DefineSymbol(symbol, value);
+	}
+
+	string circuitOutput;
+	if (!circuitPreprocessor.Transform(circuitFiles, circuitOutput))
+	{
+		LOG(ERROR) << "Could not preprocess verilog sources";
+		return std::unique_ptr<ModuleCollection>();
+	}
+
+	Verilog::VerilogParser parser;
+	if (!parser.Parse(circuitOutput))
+	{
+		LOG(ERROR) << "Could not parse verilog sources";
+		return std::unique_ptr<ModuleCollection>();
+	}
+
+	includedFiles = library->includedFiles;
+	includedFiles.insert(includedFiles.end(), circuitPreprocessor.GetIncludedFiles().begin(), circuitPreprocessor.GetIncludedFiles().end());
+
+	auto verilogModules = std::make_unique<ModuleCollection>(std::move(library->modules));
+	verilogModules->insert(verilogModules->end(), parser.GetModules().begin(), parser.GetModules().end());
+	LOG(INFO) << "Loaded " << verilogModules->size() << " verilog modules with library cache";
+	return verilogModules;
 }
 
 bool VerilogConverter::PreprocessFiles(std::shared_ptr<Settings>& settings, ostream& output) const
+{
+	string preprocessorOutput;
+	vector<string> includedFiles;
+	if (!PreprocessFiles(settings, preprocessorOutput, includedFiles))
+	{
+		return false;
+	}
+
+	output.write(preprocessorOutput.data(), preprocessorOutput.size());
+	return true;
+}
+
+bool VerilogConverter::PreprocessFiles(std::shared_ptr<Settings>& settings, string& output, vector<string>& includedFiles) const
 {
 	const vector<string>& libraryFiles = settings->VerilogLibraryFilenames;
 	const vector<string>& circuitFiles = settings->VerilogImportFilenames;
@@ -85,14 +232,14 @@ bool VerilogConverter::PreprocessFiles(std::shared_ptr<Settings>& settings, ostr
 		});
 
 	Verilog::VerilogPreprocessor preprocessor;
-	ostringstream preprocessorOutput;
-	if (!preprocessor.Transform(filesToParse, preprocessorOutput))
+	if (!preprocessor.Transform(filesToParse, output))
 	{
 		LOG(ERROR) << "Preprocessor failed to handle input files. Aborting.";
 		return false;
 	}
 
 	// Free unused resources
+	includedFiles = preprocessor.GetIncludedFiles();
 	preprocessor.Reset();
 	if (settings->VerilogExportPreprocessedFilename != "")
 	{
@@ -103,14 +250,19 @@ bool VerilogConverter::PreprocessFiles(std::shared_ptr<Settings>& settings, ostr
 		LOG(INFO) << "Exporting preprocessed verilog source to " << outFilename;
 		FileHandle handle(outFilename, false);
 		auto& outFile = handle.GetOutStream();
-		outFile << preprocessorOutput.str();
+		outFile.write(output.data(), output.size());
 	}
 
-	output << preprocessorOutput.str();
 	return true;
 }
 
 std::unique_ptr<ModuleCollection> VerilogConverter::ParseVerilog(std::shared_ptr<Settings>& settings, std::istream& input) const
+{
+	const string buffer { istreambuf_iterator<char>(input), istreambuf_iterator<char>() };
+	return ParseVerilog(settings, buffer);
+}
+
+std::unique_ptr<ModuleCollection> VerilogConverter::ParseVerilog(std::shared_ptr<Settings>& settings, const std::string& input) const
 {
 	Verilog::VerilogParser parser;
 	if (!parser.Parse(input))
@@ -139,7 +291,7 @@ std::unique_ptr<ModuleCollection> VerilogConverter::ParseVerilog(std::shared_ptr
 	return std::make_unique<ModuleCollection>(parser.GetModules());
 }
 
-std::unique_ptr<CircuitEnvironment> VerilogConverter::InstantiateModule(std::shared_ptr<Settings> settings, const ModuleCollection& verilogModules) const
+std::unique_ptr<CircuitEnvironment> VerilogConverter::InstantiateModule(std::shared_ptr<Settings> settings, const ModuleCollection& verilogModules, const std::vector<std::string>& includedFiles) const
 {
 	Verilog::Primitives::PrimitiveCollection primitives;
 	Verilog::Primitives::DefineConstantPrimitives(primitives);
@@ -161,7 +313,21 @@ std::unique_ptr<CircuitEnvironment> VerilogConverter::InstantiateModule(std::sha
 	}
 
 	Builder::BuildConfiguration buildConfiguration;
-	auto circuit = instantiator.CreateCircuit(modules, *instance, buildConfiguration);
+	auto builder = instantiator.CreateBuilder(modules, *instance, buildConfiguration);
+	if (!builder)
+	{
+		LOG(ERROR) << "Could not convert instantiated module to circuit representation";
+		return std::unique_ptr<CircuitEnvironment>();
+	}
+
+	if (settings->CircuitSnapshotFilename != "")
+	{
+		const std::string snapshotFilename { settings->MapFileName(settings->CircuitSnapshotFilename, false) };
+		ExportCircuitSnapshot(*builder, GetCircuitSnapshotSourceKey(settings), includedFiles, snapshotFilename);
+	}
+
+	LOG(INFO) << "Converting temporary unmapped and mapped circuit to final representation";
+	auto circuit = builder->BuildCircuitEnvironment(buildConfiguration);
 	if (!circuit)
 	{
 		LOG(ERROR) << "Could not convert instantiated module to circuit representation";
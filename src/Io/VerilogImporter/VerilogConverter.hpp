@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Basic/Settings.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
@@ -23,9 +24,17 @@ public:
 
 	std::unique_ptr<Circuit::CircuitEnvironment> LoadCircuit(std::shared_ptr<Settings> settings) const;
 
+	// Preprocesses and parses the library and circuit files together.
+	// The files that are included by the preprocessor are returned in includedFiles.
+	std::unique_ptr<ModuleCollection> LoadModules(std::shared_ptr<Settings>& settings, std::vector<std::string>& includedFiles) const;
+	// Loads the parsed library from the cache and only preprocesses and parses the circuit files
+	std::unique_ptr<ModuleCollection> LoadModulesWithLibraryCache(std::shared_ptr<Settings>& settings, std::vector<std::string>& includedFiles) const;
+
 	bool PreprocessFiles(std::shared_ptr<Settings>& settings, std::ostream& output) const;
+	bool PreprocessFiles(std::shared_ptr<Settings>& settings, std::string& output, std::vector<std::string>& includedFiles) const;
 	std::unique_ptr<ModuleCollection> ParseVerilog(std::shared_ptr<Settings>& settings, std::istream& input) const;
-	std::unique_ptr<Circuit::CircuitEnvironment> InstantiateModule(std::shared_ptr<Settings> settings, const ModuleCollection& verilogModules) const;
+	std::unique_ptr<ModuleCollection> ParseVerilog(std::shared_ptr<Settings>& settings, const std::string& input) const;
+	std::unique_ptr<Circuit::CircuitEnvironment> InstantiateModule(std::shared_ptr<Settings> settings, const ModuleCollection& verilogModules, const std::vector<std::string>& includedFiles) const;
 };
 
 };
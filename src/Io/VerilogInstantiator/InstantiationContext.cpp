@@ -22,6 +22,7 @@ InstantiationContext::InstantiationContext(const Modules& modules):
 	connections(),
 	gates(),
 	groups(),
+	groupPrefixes(),
 	constant0Id(CONNECTION_INVALID_ID),
 	constant1Id(CONNECTION_INVALID_ID),
 	constantXId(CONNECTION_INVALID_ID),
@@ -43,15 +44,7 @@ string InstantiationContext::PrefixName(const string& name) const
         return name;
     }
 
-	std::string path = name;
-	size_t group = currentHierarchy.back();
-	do
-	{
-		path = groups[group].name + "/" + path;
-		group = groups[group].parent;
-	} while(group != GROUP_INVALID_ID);
-
-	return path;
+	return groupPrefixes[currentHierarchy.back()] + "/" + name;
 }
 
 string InstantiationContext::GetPrefix(void) const
@@ -61,15 +54,7 @@ string InstantiationContext::GetPrefix(void) const
 		return "{root}";
 	}
 
-	std::string path;
-	size_t group = currentHierarchy.back();
-	do
-	{
-		path = groups[group].name + (path.empty() ? "" : ("/" + path));
-		group = groups[group].parent;
-	} while(group != GROUP_INVALID_ID);
-
-	return path;
+	return groupPrefixes[currentHierarchy.back()];
 }
 
 string InstantiationContext::GetName(void) const
@@ -79,15 +64,7 @@ string InstantiationContext::GetName(void) const
         return "{root}";
     }
 
-	std::string path;
-	size_t group = currentHierarchy.back();
-	do
-	{
-		path = groups[group].name + "/" + path;
-		group = groups[group].parent;
-	} while(group != GROUP_INVALID_ID);
-
-	return path;
+	return groupPrefixes[currentHierarchy.back()] + "/";
 }
 
 std::shared_ptr<Primitives::Primitive> InstantiationContext::FindPrimitive(string name, size_t port)
@@ -136,6 +113,11 @@ PrefixedScopeGuard::PrefixedScopeGuard(InstantiationContext& context, size_t par
 	if (const bool hasParent = (parent != GROUP_INVALID_ID); hasParent)
 	{
 		context.groups[parent].groups.push_back(groupIndex);
+		context.groupPrefixes.emplace_back(context.groupPrefixes[parent] + "/" + name);
+	}
+	else
+	{
+		context.groupPrefixes.emplace_back(name);
 	}
 }
 
@@ -36,6 +36,8 @@ struct InstantiationContext
     std::vector<Connection> connections;
     std::vector<Gate> gates;
 	std::vector<Group> groups;
+	// Full hierarchical name of each group ("top/sub/cell") to prefix names without walking the hierarchy
+	std::vector<std::string> groupPrefixes;
 
     size_t constant0Id;
     size_t constant1Id;
@@ -0,0 +1,657 @@
+#include "Io/VerilogLibraryCache/VerilogLibraryCache.hpp"
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string_view>
+#include <system_error>
+
+#include "Basic/Logging.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Verilog
+{
+
+// ----------------------------------------------------------------------------
+// Cache format
+// ----------------------------------------------------------------------------
+//
+// Header:  magic, version, byte order marker, key
+// Payload: the defined symbols, the included files and the modules
+//
+// The included files are stored with a hash of their content
+// and are checked when the cache is loaded.
+//
+// All numbers are stored as 64-bit words in the byte order of the host,
+// strings and lists are prefixed with their size and variants with their index.
+// Increment the version when the Verilog components change.
+
+static constexpr char CACHE_MAGIC[8] { 'F', 'T', 'V', 'L', 'I', 'B', 'C', 'A' };
+static constexpr uint64_t CACHE_VERSION { 2u };
+static constexpr uint64_t CACHE_BYTE_ORDER { 0x0102030405060708u };
+
+namespace
+{
+
+uint64_t HashContent(std::string_view content, uint64_t hash = 0xcbf29ce484222325u)
+{
+	// 64-bit FNV-1a
+	for (const char character : content)
+	{
+		hash ^= static_cast<uint8_t>(character);
+		hash *= 0x100000001b3u;
+	}
+	return hash;
+}
+
+enum class FileHash { Hashed, Missing, Unreadable };
+
+FileHash HashFile(const std::string& file, uint64_t& size, uint64_t& hash)
+{
+	std::error_code error;
+	size = std::filesystem::file_size(file, error);
+	if (error)
+	{
+		return FileHash::Missing;
+	}
+
+	hash = HashContent({});
+	if (size != 0u)
+	{
+		try
+		{
+			boost::iostreams::mapped_file_source content(file);
+			hash = HashContent(std::string_view(content.data(), content.size()));
+		}
+		catch (const std::exception& exception)
+		{
+			LOG(WARNING) << "Could not map " << file << " for the Verilog library cache: " << exception.what();
+			return FileHash::Unreadable;
+		}
+	}
+	return FileHash::Hashed;
+}
+
+class CacheWriter
+{
+public:
+	void Write(uint64_t value)
+	{
+		_data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void Write(const std::string& value)
+	{
+		Write(value.size());
+		_data.append(value);
+	}
+
+	void Write(const VectorSize& size)
+	{
+		Write(size.top);
+		Write(size.bottom);
+		Write(size.unknown);
+	}
+
+	void Write(const VectorInitializer& initializer)
+	{
+		Write(initializer.value.size());
+		for (const auto& bit : initializer.value)
+		{
+			_data.push_back(static_cast<char>(bit));
+		}
+	}
+
+	void Write(const AttributeValue& value)
+	{
+		Write(value.which());
+		switch (value.which())
+		{
+			case 0: Write(boost::get<std::string>(value)); break;
+			case 1: Write(static_cast<uint64_t>(boost::get<int64_t>(value))); break;
+			case 2: Write(boost::get<VectorInitializer>(value)); break;
+		}
+	}
+
+	void Write(const ParameterValue& value)
+	{
+		Write(value.which());
+		switch (value.which())
+		{
+			case 0: Write(static_cast<uint64_t>(boost::get<int64_t>(value))); break;
+			case 1: Write(boost::get<VectorInitializer>(value)); break;
+		}
+	}
+
+	void Write(const Attribute& attribute)
+	{
+		Write(attribute.name);
+		Write(attribute.value);
+	}
+
+	void Write(const Port& port)
+	{
+		Write(port.name);
+		Write(static_cast<uint64_t>(port.type));
+		Write(port.size);
+		WriteList(port.attributes);
+	}
+
+	void Write(const Parameter& parameter)
+	{
+		Write(parameter.name);
+		Write(parameter.value);
+	}
+
+	void Write(const Wire& wire)
+	{
+		Write(wire.name);
+		Write(wire.size);
+		WriteList(wire.attributes);
+	}
+
+	void Write(const WireReference& reference)
+	{
+		Write(reference.name);
+		Write(reference.size);
+	}
+
+	void Write(const Bus& bus)
+	{
+		Write(bus.sources.size());
+		for (const auto& source : bus.sources)
+		{
+			Write(source.which());
+			switch (source.which())
+			{
+				case 0: Write(boost::get<VectorInitializer>(source)); break;
+				case 1: Write(boost::get<WireReference>(source)); break;
+				case 2: break;
+			}
+		}
+	}
+
+	void Write(const Assignment& assignment)
+	{
+		Write(assignment.source);
+		Write(assignment.target);
+		WriteList(assignment.attributes);
+	}
+
+	void Write(const ParameterMapping& mapping)
+	{
+		Write(mapping.name);
+		Write(mapping.value);
+	}
+
+	void Write(const PortMapping& mapping)
+	{
+		Write(mapping.name);
+		Write(mapping.bus);
+	}
+
+	void Write(const Instantiation& instantiation)
+	{
+		Write(instantiation.name);
+		Write(instantiation.type);
+		WriteList(instantiation.parameter);
+		WriteList(instantiation.ports);
+		WriteList(instantiation.attributes);
+	}
+
+	void Write(const Module& module)
+	{
+		Write(module.name);
+		Write(module.libraryModule);
+		WriteList(module.ports);
+		WriteList(module.wires);
+		WriteList(module.parameter);
+		WriteList(module.assignments);
+		WriteList(module.instantiations);
+		WriteList(module.attributes);
+	}
+
+	template<typename Container>
+	void WriteList(const Container& values)
+	{
+		Write(values.size());
+		for (const auto& value : values)
+		{
+			Write(value);
+		}
+	}
+
+	const std::string& GetData(void) const
+	{
+		return _data;
+	}
+
+private:
+	std::string _data;
+};
+
+class CacheReader
+{
+public:
+	CacheReader(const char* data, size_t size):
+		_valid(true),
+		_data(data),
+		_size(size),
+		_position(0u)
+	{
+	}
+
+	bool IsValid(void) const
+	{
+		return _valid;
+	}
+
+	bool IsAtEnd(void) const
+	{
+		return _position == _size;
+	}
+
+	uint64_t ReadWord(void)
+	{
+		if (sizeof(uint64_t) > _size - _position)
+		{
+			_valid = false;
+			_position = _size;
+			return 0u;
+		}
+
+		uint64_t value;
+		std::memcpy(&value, _data + _position, sizeof(value));
+		_position += sizeof(value);
+		return value;
+	}
+
+	// Sizes are checked against the remaining data to never allocate
+	// huge amounts of memory for a corrupt cache file.
+	size_t ReadSize(void)
+	{
+		const uint64_t size { ReadWord() };
+		if (size > _size - _position)
+		{
+			_valid = false;
+			_position = _size;
+			return 0u;
+		}
+		return size;
+	}
+
+	std::string_view ReadStringView(void)
+	{
+		const size_t size { ReadSize() };
+		const std::string_view value(_data + _position, size);
+		_position += size;
+		return value;
+	}
+
+	void Read(uint64_t& value) { value = ReadWord(); }
+	void Read(int64_t& value) { value = static_cast<int64_t>(ReadWord()); }
+	void Read(bool& value) { value = (ReadWord() != 0u); }
+	void Read(std::string& value) { value = std::string(ReadStringView()); }
+
+	void Read(VectorSize& size)
+	{
+		Read(size.top);
+		Read(size.bottom);
+		Read(size.unknown);
+	}
+
+	void Read(VectorInitializer& initializer)
+	{
+		const std::string_view bits { ReadStringView() };
+		initializer.value.resize(bits.size());
+		for (size_t index { 0u }; index < bits.size(); ++index)
+		{
+			initializer.value[index] = static_cast<VectorBit>(bits[index]);
+		}
+	}
+
+	void Read(AttributeValue& value)
+	{
+		switch (ReadWord())
+		{
+			case 0: { std::string string; Read(string); value = string; break; }
+			case 1: { int64_t number; Read(number); value = number; break; }
+			case 2: { VectorInitializer initializer; Read(initializer); value = initializer; break; }
+			default: _valid = false; break;
+		}
+	}
+
+	void Read(ParameterValue& value)
+	{
+		switch (ReadWord())
+		{
+			case 0: { int64_t number; Read(number); value = number; break; }
+			case 1: { VectorInitializer initializer; Read(initializer); value = initializer; break; }
+			default: _valid = false; break;
+		}
+	}
+
+	void Read(Attribute& attribute)
+	{
+		Read(attribute.name);
+		Read(attribute.value);
+	}
+
+	void Read(Port& port)
+	{
+		Read(port.name);
+		port.type = static_cast<PortType>(ReadWord());
+		Read(port.size);
+		ReadList(port.attributes);
+	}
+
+	void Read(Parameter& parameter)
+	{
+		Read(parameter.name);
+		Read(parameter.value);
+	}
+
+	void Read(Wire& wire)
+	{
+		Read(wire.name);
+		Read(wire.size);
+		ReadList(wire.attributes);
+	}
+
+	void Read(WireReference& reference)
+	{
+		Read(reference.name);
+		Read(reference.size);
+	}
+
+	void Read(Bus& bus)
+	{
+		bus.sources.resize(ReadSize());
+		for (auto& source : bus.sources)
+		{
+			switch (ReadWord())
+			{
+				case 0: { VectorInitializer initializer; Read(initializer); source = initializer; break; }
+				case 1: { WireReference reference; Read(reference); source = reference; break; }
+				case 2: source = VectorPlaceholder(); break;
+				default: _valid = false; break;
+			}
+		}
+	}
+
+	void Read(Assignment& assignment)
+	{
+		Read(assignment.source);
+		Read(assignment.target);
+		ReadList(assignment.attributes);
+	}
+
+	void Read(ParameterMapping& mapping)
+	{
+		Read(mapping.name);
+		Read(mapping.value);
+	}
+
+	void Read(PortMapping& mapping)
+	{
+		Read(mapping.name);
+		Read(mapping.bus);
+	}
+
+	void Read(Instantiation& instantiation)
+	{
+		Read(instantiation.name);
+		Read(instantiation.type);
+		ReadList(instantiation.parameter);
+		ReadList(instantiation.ports);
+		ReadList(instantiation.attributes);
+	}
+
+	void Read(Module& module)
+	{
+		Read(module.name);
+		Read(module.libraryModule);
+		ReadList(module.ports);
+		ReadList(module.wires);
+		ReadList(module.parameter);
+		ReadList(module.assignments);
+		ReadList(module.instantiations);
+		ReadList(module.attributes);
+	}
+
+	template<typename Container>
+	void ReadList(Container& values)
+	{
+		const size_t size { ReadSize() };
+		for (size_t index { 0u }; index < size && _valid; ++index)
+		{
+			typename Container::value_type value;
+			Read(value);
+			values.push_back(std::move(value));
+		}
+	}
+
+private:
+	bool _valid;
+	const char* _data;
+	size_t _size;
+	size_t _position;
+};
+
+std::string GetCacheFilename(const std::string& key, const std::string& directory)
+{
+	std::ostringstream filename;
+	filename << "library-" << std::hex << std::setw(16) << std::setfill('0')
+		<< HashContent(key) << ".cache";
+	return (std::filesystem::path(directory) / filename.str()).string();
+}
+
+};
+
+std::string GetVerilogLibraryCacheKey(const std::vector<std::string>& libraryFiles, const std::map<std::string, std::string>& definedSymbols)
+{
+	std::ostringstream key;
+	key << "version=" << CACHE_VERSION;
+	for (const auto& [symbol, value] : definedSymbols)
+	{
+		key << ";define=" << symbol << "," << value;
+	}
+
+	for (const auto& file : libraryFiles)
+	{
+		uint64_t size;
+		uint64_t hash;
+		const auto result { HashFile(file, size, hash) };
+		if (result == FileHash::Unreadable)
+		{
+			return std::string();
+		}
+		if (result == FileHash::Missing)
+		{
+			// The preprocessor reports the missing file
+			key << ";library=missing," << file;
+			continue;
+		}
+
+		key << ";library=" << size << "," << std::hex << hash << std::dec;
+	}
+
+	return key.str();
+}
+
+bool ExportVerilogLibraryCache(const VerilogLibraryCacheEntry& entry, const std::string& key, const std::string& directory)
+{
+	if (key.empty())
+	{
+		return false;
+	}
+
+	CacheWriter writer;
+	writer.Write(entry.definedSymbols.size());
+	for (const auto& [symbol, value] : entry.definedSymbols)
+	{
+		writer.Write(symbol);
+		writer.Write(value);
+	}
+	writer.Write(entry.includedFiles.size());
+	for (const auto& file : entry.includedFiles)
+	{
+		uint64_t size { 0u };
+		uint64_t hash { 0u };
+		const auto result { HashFile(file, size, hash) };
+		if (result == FileHash::Unreadable)
+		{
+			return false;
+		}
+
+		const bool exists { result == FileHash::Hashed };
+		writer.Write(file);
+		writer.Write(exists);
+		writer.Write(size);
+		writer.Write(hash);
+	}
+	writer.WriteList(entry.modules);
+
+	std::error_code error;
+	std::filesystem::create_directories(directory, error);
+
+	const std::string filename { GetCacheFilename(key, directory) };
+	const std::string temporaryFilename { filename + ".tmp." + std::to_string(::getpid()) };
+	{
+		std::ofstream output(temporaryFilename, std::ios::binary);
+		const uint64_t header[3] { CACHE_VERSION, CACHE_BYTE_ORDER, key.size() };
+		output.write(CACHE_MAGIC, sizeof(CACHE_MAGIC));
+		output.write(reinterpret_cast<const char*>(header), sizeof(header));
+		output.write(key.data(), key.size());
+		output.write(writer.GetData().data(), writer.GetData().size());
+		if (!output.good())
+		{
+			LOG(ERROR) << "Could not write Verilog library cache " << filename;
+			std::filesystem::remove(temporaryFilename, error);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(temporaryFilename, filename, error);
+	if (error)
+	{
+		LOG(ERROR) << "Could not write Verilog library cache " << filename << ": " << error.message();
+		std::filesystem::remove(temporaryFilename, error);
+		return false;
+	}
+
+	LOG(INFO) << "Exported Verilog library cache to " << filename;
+	return true;
+}
+
+std::optional<VerilogLibraryCacheEntry> ImportVerilogLibraryCache(const std::string& key, const std::string& directory)
+{
+	if (key.empty())
+	{
+		return std::nullopt;
+	}
+
+	const std::string filename { GetCacheFilename(key, directory) };
+	std::error_code error;
+	if (!std::filesystem::exists(filename, error) || std::filesystem::file_size(filename, error) == 0u)
+	{
+		return std::nullopt;
+	}
+
+	boost::iostreams::mapped_file_source cache;
+	try
+	{
+		cache.open(filename);
+	}
+	catch (const std::exception& exception)
+	{
+		LOG(WARNING) << "Could not map Verilog library cache " << filename << ": " << exception.what();
+		return std::nullopt;
+	}
+
+	uint64_t header[3];
+	if (cache.size() < sizeof(CACHE_MAGIC) + sizeof(header)
+		|| std::memcmp(cache.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0)
+	{
+		LOG(WARNING) << "The Verilog library cache " << filename << " has an invalid header";
+		return std::nullopt;
+	}
+
+	std::memcpy(header, cache.data() + sizeof(CACHE_MAGIC), sizeof(header));
+	const auto [version, byteOrder, keySize] = header;
+	const size_t offset { sizeof(CACHE_MAGIC) + sizeof(header) };
+	if (version != CACHE_VERSION || byteOrder != CACHE_BYTE_ORDER
+		|| keySize > cache.size() - offset
+		|| std::string_view(cache.data() + offset, keySize) != key)
+	{
+		LOG(INFO) << "Ignoring Verilog library cache " << filename << " as it was created for different sources";
+		return std::nullopt;
+	}
+
+	VerilogLibraryCacheEntry entry;
+	CacheReader reader(cache.data() + offset + keySize, cache.size() - offset - keySize);
+	const size_t symbols { reader.ReadSize() };
+	for (size_t index { 0u }; index < symbols && reader.IsValid(); ++index)
+	{
+		std::string symbol;
+		std::string value;
+		reader.Read(symbol);
+		reader.Read(value);
+		entry.definedSymbols.emplace(symbol, value);
+	}
+
+	// The included files are not part of the key, as they are only known after the preprocessing
+	const size_t includedFiles { reader.ReadSize() };
+	std::optional<std::string> changedFile;
+	for (size_t index { 0u }; index < includedFiles && reader.IsValid(); ++index)
+	{
+		std::string file;
+		bool exists;
+		uint64_t size;
+		uint64_t hash;
+		reader.Read(file);
+		reader.Read(exists);
+		reader.Read(size);
+		reader.Read(hash);
+
+		uint64_t currentSize { 0u };
+		uint64_t currentHash { 0u };
+		const auto currentResult { HashFile(file, currentSize, currentHash) };
+		const bool currentExists { currentResult == FileHash::Hashed };
+		if (!changedFile && (currentResult == FileHash::Unreadable || currentExists != exists || currentSize != size || currentHash != hash))
+		{
+			changedFile = file;
+		}
+		entry.includedFiles.push_back(file);
+	}
+	if (reader.IsValid() && changedFile)
+	{
+		LOG(INFO) << "Ignoring Verilog library cache " << filename << " as the included file " << *changedFile << " has changed";
+		return std::nullopt;
+	}
+
+	reader.ReadList(entry.modules);
+
+	if (!reader.IsValid() || !reader.IsAtEnd())
+	{
+		LOG(WARNING) << "The Verilog library cache " << filename << " is corrupt";
+		return std::nullopt;
+	}
+
+	LOG(INFO) << "Imported Verilog library cache from " << filename;
+	return entry;
+}
+
+};
+};
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Io/VerilogSpiritParser/VerilogComponents.hpp"
+
+namespace FreiTest
+{
+namespace Io
+{
+namespace Verilog
+{
+
+/**
+ * @brief The parsed result of the Verilog library files.
+ *
+ * The defined symbols are the preprocessor symbols after the library files
+ * have been processed. They are required to preprocess the circuit files.
+ * The included files are the files opened by `include directives of the library.
+ */
+struct VerilogLibraryCacheEntry
+{
+	ModuleCollection modules;
+	std::map<std::string, std::string> definedSymbols;
+	std::vector<std::string> includedFiles;
+};
+
+/**
+ * @brief Returns a key that identifies the content of the library files and the preprocessor symbols.
+ *
+ * The key contains a hash of the content of each file. Therefore, the cache
+ * is reused if the same library is located at a different path.
+ * Files included by the Verilog preprocessor are not part of the key,
+ * they are stored in the cache file and checked by ImportVerilogLibraryCache.
+ * An empty key is returned if a library file can not be read, which disables the cache.
+ */
+std::string GetVerilogLibraryCacheKey(const std::vector<std::string>& libraryFiles, const std::map<std::string, std::string>& definedSymbols);
+
+/**
+ * @brief Writes the library to a cache file in the cache directory.
+ *
+ * The cache file is written to a temporary file first and then renamed.
+ * Therefore, parallel runs that create the same cache file never read a partially written file.
+ */
+bool ExportVerilogLibraryCache(const VerilogLibraryCacheEntry& entry, const std::string& key, const std::string& directory);
+
+/**
+ * @brief Loads the library for the given key from the cache directory.
+ *
+ * @return std::nullopt if there is no (valid) cache file for the key
+ *         or the content of an included file has changed or can not be read.
+ */
+std::optional<VerilogLibraryCacheEntry> ImportVerilogLibraryCache(const std::string& key, const std::string& directory);
+
+};
+};
+};
@@ -1,6 +1,7 @@
 #include "Io/VerilogPreprocessor/VerilogPreprocessor.hpp"
 
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <stddef.h>
 
 #include <algorithm>
@@ -8,11 +9,13 @@
 #include <filesystem>
 #include <iterator>
 #include <iostream>
+#include <memory>
 #include <string_view>
 #include <sstream>
 #include <utility>
 
 #include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
 #include "Basic/Settings.hpp"
 #include "Helper/FileHandle.hpp"
 #include "Helper/StringHelper.hpp"
@@ -37,23 +40,157 @@ VerilogPreprocessor::~VerilogPreprocessor()
 }
 
 bool VerilogPreprocessor::Transform(const vector<string> files, ostream& output)
+{
+	string buffer;
+	if (!Transform(files, buffer))
+	{
+		return false;
+	}
+
+	output.write(buffer.data(), buffer.size());
+	return true;
+}
+
+bool VerilogPreprocessor::Transform(const vector<string> files, string& output)
 {
 	// Copy defines from preconfigured set
 	_definedSymbols.insert(_defaultDefinedSymbols.cbegin(), _defaultDefinedSymbols.cend());
 
-	for (const string& file : files)
+	if (files.size() > 1u && Parallel::GetThreads(Parallel::Arena::General) > 1u && IsNeutralState())
 	{
-		if (!ProcessFile(file, output))
+		if (!TransformParallel(files, output))
 		{
 			return false;
 		}
 	}
+	else
+	{
+		for (const string& file : files)
+		{
+			if (!ProcessFile(file, output))
+			{
+				return false;
+			}
+		}
+	}
 
 	LOG(INFO) << "Successfully applied preprocessor to " << _numberOfParsedFiles << " source files";
 
 	return true;
 }
 
+bool VerilogPreprocessor::TransformParallel(const vector<string>& files, string& output)
+{
+	// Each file is preprocessed independently with the current symbols.
+	// The results are merged in order of the files and a file that depends
+	// on symbols modified by a previous file is preprocessed again.
+	vector<unique_ptr<VerilogPreprocessor>> filePreprocessors(files.size());
+	vector<string> fileOutputs(files.size());
+	vector<uint8_t> fileSuccess(files.size(), 0u);
+	Parallel::ExecuteParallel(0u, files.size(), Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t index) {
+		auto preprocessor = make_unique<VerilogPreprocessor>();
+		preprocessor->_defaultDefinedSymbols = _defaultDefinedSymbols;
+		preprocessor->_definedSymbols = _definedSymbols;
+		fileSuccess[index] = preprocessor->ProcessFile(files[index], fileOutputs[index]);
+		filePreprocessors[index] = move(preprocessor);
+	});
+
+	const auto initialDefaultSymbols { _defaultDefinedSymbols };
+	const auto initialSymbols { _definedSymbols };
+	size_t mergedFiles { 0u };
+	for (size_t index { 0u }; index < files.size(); ++index)
+	{
+		const VerilogPreprocessor& file { *filePreprocessors[index] };
+		if (fileSuccess[index] && CanMergeFile(file, initialDefaultSymbols, initialSymbols))
+		{
+			MergeFile(file);
+			output += fileOutputs[index];
+			mergedFiles++;
+		}
+		else if (!ProcessFile(files[index], output))
+		{
+			return false;
+		}
+
+		// Free the resources of the file early
+		string().swap(fileOutputs[index]);
+		filePreprocessors[index].reset();
+	}
+
+	LOG(DEBUG) << "Merged " << mergedFiles << " of " << files.size() << " independently preprocessed files";
+	return true;
+}
+
+const vector<string>& VerilogPreprocessor::GetIncludedFiles(void) const
+{
+	return _includedFiles;
+}
+
+bool VerilogPreprocessor::IsNeutralState(void) const
+{
+	return !_multilineComment && !_skipEverything && _firstTokenInLine
+		&& _currentBlock.empty() && _defineIdentifierResults.empty();
+}
+
+bool VerilogPreprocessor::CanMergeFile(const VerilogPreprocessor& file, const map<string, string>& initialDefaultSymbols, const map<string, string>& initialSymbols) const
+{
+	// The state at the start and end of the file has to be neutral,
+	// otherwise the file depends on the previous or influences the next file.
+	if (!IsNeutralState() || !file.IsNeutralState())
+	{
+		return false;
+	}
+
+	// The macro replacement has to see the same symbols
+	if (file._symbolAccesses.replacedMacros && _definedSymbols != initialSymbols)
+	{
+		return false;
+	}
+
+	// The `ifdef and `ifndef directives have to see the same symbols and values.
+	// The initial symbols contain the symbols defined before the transformation (e.g. of the cell library)
+	// that might have been modified or undefined by a previous file.
+	auto is_same_symbol = [](const map<string, string>& current, const map<string, string>& initial, const string& symbol) {
+		const auto currentIt { current.find(symbol) };
+		const auto initialIt { initial.find(symbol) };
+		return (currentIt == current.end() || initialIt == initial.end())
+			? (currentIt == current.end()) == (initialIt == initial.end())
+			: currentIt->second == initialIt->second;
+	};
+	for (const auto& symbol : file._symbolAccesses.checkedSymbols)
+	{
+		if (!is_same_symbol(_defaultDefinedSymbols, initialDefaultSymbols, symbol)
+			|| !is_same_symbol(_definedSymbols, initialSymbols, symbol))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void VerilogPreprocessor::MergeFile(const VerilogPreprocessor& file)
+{
+	for (const auto& [operation, key, value] : file._symbolAccesses.operations)
+	{
+		switch (operation)
+		{
+			case SymbolOperation::Define:
+				DefineSymbol(key, value);
+				break;
+			case SymbolOperation::Undefine:
+				UndefineSymbol(key);
+				break;
+			case SymbolOperation::ResetAll:
+				_definedSymbols.clear();
+				break;
+		}
+	}
+
+	_numberOfParsedFiles += file._numberOfParsedFiles;
+	_includedFiles.insert(_includedFiles.end(), file._includedFiles.begin(), file._includedFiles.end());
+}
+
 void VerilogPreprocessor::Reset(void)
 {
 	_numberOfParsedFiles = 0;
@@ -61,6 +198,8 @@ void VerilogPreprocessor::Reset(void)
 	_definedSymbols.clear();
 	_skipEverything = false;
 	_firstTokenInLine = true;
+	_symbolAccesses = SymbolAccesses();
+	_includedFiles.clear();
 
 	while (!_defineIdentifierResults.empty())
 	{
@@ -72,7 +211,7 @@ void VerilogPreprocessor::Reset(void)
 	}
 }
 
-bool VerilogPreprocessor::ProcessFile(const string& filename, ostream& output)
+bool VerilogPreprocessor::ProcessFile(const string& filename, string& output)
 {
 	FileHandle fileHandle(filename, true);
 	istream& inFile = fileHandle.GetStream();
@@ -84,25 +223,55 @@ bool VerilogPreprocessor::ProcessFile(const string& filename, ostream& output)
 	}
 
 	LOG(DEBUG) << "\tPreprocessing file " << fileHandle.GetFilename();
-	string line = "";
+	if (GetCompressionFormat(fileHandle.GetFilename()) != CompressionFormat::None)
+	{
+		// Compressed files have to be decompressed into memory first
+		const string content { istreambuf_iterator<char>(inFile), istreambuf_iterator<char>() };
+		if (!ProcessContent(content, filename, output))
+		{
+			return false;
+		}
+	}
+	else if (filesystem::file_size(fileHandle.GetFilename()) != 0u)
+	{
+		// Uncompressed files are mapped into memory and the lines are processed without a copy
+		iostreams::mapped_file_source mappedFile(fileHandle.GetFilename());
+		if (!ProcessContent(string_view(mappedFile.data(), mappedFile.size()), filename, output))
+		{
+			return false;
+		}
+	}
+
+	_numberOfParsedFiles++;
+	LOG(DEBUG) << "\tPreprocessed file " << fileHandle.GetFilename();
+	return true;
+}
+
+bool VerilogPreprocessor::ProcessContent(const string_view content, const string& filename, string& output)
+{
 	uint64_t lineNumber = 1;
-	while (getline(inFile, line))
+	for (size_t lineStart = 0u; lineStart < content.size(); )
 	{
-		if (!HandleLine(line, lineNumber, filename, output))
+		size_t lineEnd = content.find('\n', lineStart);
+		if (lineEnd == string_view::npos)
+		{
+			lineEnd = content.size();
+		}
+
+		if (!HandleLine(content.substr(lineStart, lineEnd - lineStart), lineNumber, filename, output))
 		{
 			return false;
 		}
 
 		lineNumber++;
 		EndLine(output);
+		lineStart = lineEnd + 1u;
 	}
 
-	_numberOfParsedFiles++;
-	LOG(DEBUG) << "\tPreprocessed file " << fileHandle.GetFilename();
 	return true;
 }
 
-bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber, const string& fileName, ostream& output)
+bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber, const string& fileName, string& output)
 {
 	if (_skipEverything)
 	{
@@ -126,6 +295,7 @@ bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber
 			tokenStream >> _defineIdentifier;
 
 			bool identifierDefined = IsDefinedSymbol(_defineIdentifier);
+			_symbolAccesses.checkedSymbols.insert(_defineIdentifier);
 			if (word == "`ifndef")
 			{
 				// Check for the inverse when evaluating the expressions in the block
@@ -182,6 +352,7 @@ bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber
 				_defineIdentifierResults.pop();
 			}
 			_definedSymbols.clear();
+			_symbolAccesses.operations.emplace_back(SymbolOperation::ResetAll, "", "");
 			break;
 		}
 
@@ -213,13 +384,14 @@ bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber
 				return false;
 			}
 
-			if (!macroValue.empty())
+			if (macroValue.empty())
 			{
-				DefineSymbol(macroName, macroValue);
-			} else {
-				DefineSymbol(macroName, "TRUE");
+				macroValue = "TRUE";
 			}
 
+			DefineSymbol(macroName, macroValue);
+			_symbolAccesses.operations.emplace_back(SymbolOperation::Define, macroName, macroValue);
+
 			break;
 		}
 
@@ -234,6 +406,7 @@ bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber
 			}
 
 			UndefineSymbol(macroName);
+			_symbolAccesses.operations.emplace_back(SymbolOperation::Undefine, macroName, "");
 			break;
 		}
 
@@ -268,6 +441,7 @@ bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber
 			}
 			LOG(INFO) << "\tFull include file name: " << includeFile;
 			EndLine(output);
+			_includedFiles.push_back(includeFile);
 			ProcessFile(includeFile, output);
 			break;
 		}
@@ -281,13 +455,19 @@ bool VerilogPreprocessor::HandleLine(const string_view line, uint64_t lineNumber
 			break;
 		}
 
-		// Use reverse iterator to replace correctly when a prefix exists
-		for (auto it = _definedSymbols.rbegin(); it != _definedSymbols.rend(); ++it)
+		// All macros start with a backtick and most tokens don't contain any macro
+		if (word.find('`') != string::npos)
 		{
-			string macro = "`" + it->first;
-			string value = it->second;
+			_symbolAccesses.replacedMacros = true;
 
-			boost::replace_all(word, macro, value);
+			// Use reverse iterator to replace correctly when a prefix exists
+			for (auto it = _definedSymbols.rbegin(); it != _definedSymbols.rend(); ++it)
+			{
+				string macro = "`" + it->first;
+				string value = it->second;
+
+				boost::replace_all(word, macro, value);
+			}
 		}
 
 		AppendToken(output, word);
@@ -384,18 +564,23 @@ string VerilogPreprocessor::GetDefinedSymbol(const string& key) const
 	return _defaultDefinedSymbols.find(key)->second;
 }
 
-void VerilogPreprocessor::AppendToken(ostream& output, string token)
+const map<string, string>& VerilogPreprocessor::GetDefinedSymbols(void) const
+{
+	return _defaultDefinedSymbols;
+}
+
+void VerilogPreprocessor::AppendToken(string& output, const string& token)
 {
 	if (!_firstTokenInLine)
 	{
-		output << ' ';
+		output += ' ';
 	}
 
 	_firstTokenInLine = false;
-	output << token;
+	output += token;
 }
 
-void VerilogPreprocessor::EndLine(ostream& output)
+void VerilogPreprocessor::EndLine(string& output)
 {
 	// Do not write empty lines
 	if (_firstTokenInLine)
@@ -404,7 +589,7 @@ void VerilogPreprocessor::EndLine(ostream& output)
 	}
 
 	_firstTokenInLine = true;
-	output << endl;
+	output += '\n';
 }
 
 };
@@ -9,6 +9,7 @@
 #include <stack>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -25,22 +26,51 @@ public:
 	virtual ~VerilogPreprocessor();
 
 	bool Transform(const std::vector<std::string> files, std::ostream& output);
+	// Appends the preprocessed sources to one contiguous buffer that can be parsed without copying.
+	bool Transform(const std::vector<std::string> files, std::string& output);
 	void Reset(void);
 
 	void DefineSymbol(const std::string& key, const std::string& value);
 	void UndefineSymbol(const std::string& key);
 	bool IsDefinedSymbol(const std::string& key) const;
 	std::string GetDefinedSymbol(const std::string& key) const;
+	const std::map<std::string, std::string>& GetDefinedSymbols(void) const;
+
+	// Returns true if no conditional block or multi-line comment is open after the last file
+	bool IsNeutralState(void) const;
+	// Returns the files that have been opened by `include directives in the order of the sources
+	const std::vector<std::string>& GetIncludedFiles(void) const;
 
 private:
 
-	bool ProcessFile(const std::string& filename, std::ostream& output);
-	bool HandleLine(const std::string_view line, const uint64_t lineNumber, const std::string &fileName, std::ostream& output);
+	enum class SymbolOperation
+	{
+		Define,
+		Undefine,
+		ResetAll
+	};
+
+	// The symbols that a file depends on and the modifications of the symbols by the file.
+	// This allows to preprocess files independently and to merge the results afterwards.
+	struct SymbolAccesses
+	{
+		std::unordered_set<std::string> checkedSymbols;
+		bool replacedMacros { false };
+		std::vector<std::tuple<SymbolOperation, std::string, std::string>> operations;
+	};
+
+	bool TransformParallel(const std::vector<std::string>& files, std::string& output);
+	bool CanMergeFile(const VerilogPreprocessor& file, const std::map<std::string, std::string>& initialDefaultSymbols, const std::map<std::string, std::string>& initialSymbols) const;
+	void MergeFile(const VerilogPreprocessor& file);
+
+	bool ProcessFile(const std::string& filename, std::string& output);
+	bool ProcessContent(const std::string_view content, const std::string& filename, std::string& output);
+	bool HandleLine(const std::string_view line, const uint64_t lineNumber, const std::string &fileName, std::string& output);
 	std::string RemoveComments(const std::string_view line);
 	std::string FixLineForTokenization(const std::string& line) const;
 
-	void AppendToken(std::ostream& output, std::string token);
-	void EndLine(std::ostream& output);
+	void AppendToken(std::string& output, const std::string& token);
+	void EndLine(std::string& output);
 
 	int _numberOfParsedFiles;
 	bool _multilineComment;
@@ -52,6 +82,8 @@ private:
 	bool _skipEverything;
 
 	bool _firstTokenInLine;
+	SymbolAccesses _symbolAccesses;
+	std::vector<std::string> _includedFiles;
 
 };
 
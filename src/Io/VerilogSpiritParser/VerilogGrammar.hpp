@@ -4,7 +4,6 @@
 #include <boost/fusion/include/std_tuple.hpp>
 #include <boost/fusion/include/deque.hpp>
 #include <boost/spirit/home/x3.hpp>
-#include <boost/spirit/include/support_multi_pass.hpp>
 #include <boost/variant.hpp>
 
 #include <cstdint>
@@ -27,8 +26,9 @@ namespace Grammar {
     using test_iterator_type = std::string::const_iterator;
     using test_context_type = x3::phrase_parse_context<x3::space_type>::type;
 
-    using base_iterator_type = std::istreambuf_iterator<char>;
-    using iterator_type = spirit::multi_pass<base_iterator_type>;
+    // The sources are parsed from one contiguous buffer which avoids
+    // the buffering and reference counting of multi_pass iterators.
+    using iterator_type = const char*;
     using context_type = x3::phrase_parse_context<x3::space_type>::type;
 
 	namespace Comment {
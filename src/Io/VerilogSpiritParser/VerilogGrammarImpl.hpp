@@ -94,6 +94,19 @@ namespace Grammar {
 		x3::_val(context) = x3::_attr(context);
 	};
 
+	// The x3::with directive stores its value inside the global rule definition
+	// which is shared by all parser invocations. The state is therefore kept in
+	// thread local storage to allow parsing multiple sources concurrently.
+	template<typename Tag, typename T>
+	struct thread_local_state
+	{
+		T& get(void) const
+		{
+			thread_local T value {};
+			return value;
+		}
+	};
+
     namespace Comment {
 
         const skipper_type skipper_impl = "Comment or Whitespace";
@@ -269,20 +282,20 @@ namespace Grammar {
 
 		auto assign_vector_bits = [](auto& ctx) {
 			x3::_pass(ctx) = (x3::_attr(ctx) >= 0);
-			x3::get<bits_tag>(ctx) = x3::_attr(ctx);
+			x3::get<bits_tag>(ctx).get() = x3::_attr(ctx);
 		};
 		auto assign_vector_value = [](auto& ctx) {
 			// Clip or expand bits
-			while (x3::_attr(ctx).size() > x3::get<bits_tag>(ctx))
+			while (x3::_attr(ctx).size() > x3::get<bits_tag>(ctx).get())
 				x3::_attr(ctx).pop_back();
-			while (x3::_attr(ctx).size() < x3::get<bits_tag>(ctx))
+			while (x3::_attr(ctx).size() < x3::get<bits_tag>(ctx).get())
 				x3::_attr(ctx).push_back(VectorBit::BIT_0);
 
 			x3::_val(ctx).value = x3::_attr(ctx);
 		};
 
 		const vector_initializer_type initializer_impl = "Vector Initializer";
-		const auto initializer_impl_def = x3::with<bits_tag>(0u)[
+		const auto initializer_impl_def = x3::with<bits_tag>(thread_local_state<bits_tag, size_t>())[
 			x3::uint64[ assign_vector_bits ]
 			>> ('\'' > (
 				('b' > binary_initializer_parser[ assign_vector_value ])
@@ -310,18 +323,18 @@ namespace Grammar {
 		} port_data;
 
 		auto reset_tag = [](auto& ctx) {
-			x3::get<port_data_tag>(ctx) = port_data();
+			x3::get<port_data_tag>(ctx).get() = port_data();
 		};
 		auto set_type = [](auto& ctx) {
-			x3::get<port_data_tag>(ctx).type = x3::_attr(ctx);
+			x3::get<port_data_tag>(ctx).get().type = x3::_attr(ctx);
 		};
 		auto set_size = [](auto& ctx) {
-			x3::get<port_data_tag>(ctx).size = x3::_attr(ctx);
+			x3::get<port_data_tag>(ctx).get().size = x3::_attr(ctx);
 		};
 
 		auto add_ports = [](auto& ctx) {
-			Verilog::PortType& type = x3::get<port_data_tag>(ctx).type;
-			Verilog::VectorSize& size = x3::get<port_data_tag>(ctx).size;
+			Verilog::PortType& type = x3::get<port_data_tag>(ctx).get().type;
+			Verilog::VectorSize& size = x3::get<port_data_tag>(ctx).get().size;
 
 			for (const std::string& portName : x3::_attr(ctx)) {
 				x3::_val(ctx).push_back(Verilog::Port(portName, type, size));
@@ -349,7 +362,7 @@ namespace Grammar {
 		BOOST_SPIRIT_DEFINE(name_impl);
 
 		const port_type port_impl = "Port";
-		const auto port_impl_def = x3::with<port_data_tag>(port_data())
+		const auto port_impl_def = x3::with<port_data_tag>(thread_local_state<port_data_tag, port_data>())
 			[
 				x3::eps [ reset_tag ]
 				>> type_impl[ set_type ]
@@ -407,13 +420,13 @@ namespace Grammar {
 		} wire_data;
 
 		auto reset_tag = [](auto& ctx) {
-			x3::get<wire_data_tag>(ctx) = wire_data();
+			x3::get<wire_data_tag>(ctx).get() = wire_data();
 		};
 		auto set_size = [](auto& ctx) {
-			x3::get<wire_data_tag>(ctx).size = x3::_attr(ctx);
+			x3::get<wire_data_tag>(ctx).get().size = x3::_attr(ctx);
 		};
 		auto add_wires = [](auto& ctx) {
-			Verilog::VectorSize& size = x3::get<wire_data_tag>(ctx).size;
+			Verilog::VectorSize& size = x3::get<wire_data_tag>(ctx).get().size;
 
 			for (const std::string& wireName : x3::_attr(ctx)) {
 				x3::_val(ctx).push_back(Verilog::Wire(wireName, size));
@@ -425,7 +438,7 @@ namespace Grammar {
 		BOOST_SPIRIT_DEFINE(name_impl);
 
 		const wire_type wire_impl = "Wire";
-		const auto wire_impl_def = x3::with<wire_data_tag>(wire_data())
+		const auto wire_impl_def = x3::with<wire_data_tag>(thread_local_state<wire_data_tag, wire_data>())
 			[
 				x3::eps [ reset_tag ]
 				>> (
@@ -635,13 +648,13 @@ namespace Grammar {
 		struct unused_attributes_tag {};
 
 		auto reset_tag = [](auto& ctx) {
-			x3::get<unused_attributes_tag>(ctx) = std::vector<Verilog::Attribute>();
+			x3::get<unused_attributes_tag>(ctx).get() = std::vector<Verilog::Attribute>();
 		};
 		auto store_attribute = [](auto& ctx) {
-			x3::get<unused_attributes_tag>(ctx).push_back(x3::_attr(ctx));
+			x3::get<unused_attributes_tag>(ctx).get().push_back(x3::_attr(ctx));
 		};
 		auto assign_attributes = [](auto& ctx, auto& target) {
-			auto& unusedAttributes = x3::get<unused_attributes_tag>(ctx);
+			auto& unusedAttributes = x3::get<unused_attributes_tag>(ctx).get();
 
 			if constexpr (is_specialization<decltype(target), std::vector>::value)
 			{
@@ -738,7 +751,7 @@ namespace Grammar {
 			// Use the unused_attributes_tag to collect attributes
 			// until the next valid statement is encountered
 			> x3::with<unused_attributes_tag>(
-				std::vector<Verilog::Attribute>()
+				thread_local_state<unused_attributes_tag, std::vector<Verilog::Attribute>>()
 			)[
 				x3::eps[ reset_tag ]
 				// Statements inside module
@@ -774,14 +787,14 @@ namespace Grammar {
 		} global_state;
 
 		auto reset_tag = [](auto& ctx) {
-			x3::get<global_state_tag>(ctx) = global_state();
+			x3::get<global_state_tag>(ctx).get() = global_state();
 		};
 		auto store_attribute = [](auto& ctx) {
-			global_state& state = x3::get<global_state_tag>(ctx);
+			global_state& state = x3::get<global_state_tag>(ctx).get();
 			state.unusedAttributes.push_back(x3::_attr(ctx));
 		};
 		auto assign_attributes = [](auto& ctx, auto& target) {
-			global_state& state = x3::get<global_state_tag>(ctx);
+			global_state& state = x3::get<global_state_tag>(ctx).get();
 
 			target.attributes.insert(target.attributes.end(),
 				state.unusedAttributes.begin(), state.unusedAttributes.end());
@@ -789,7 +802,7 @@ namespace Grammar {
 		};
 
 		auto add_module = [](auto& ctx) {
-			global_state& state = x3::get<global_state_tag>(ctx);
+			global_state& state = x3::get<global_state_tag>(ctx).get();
 			Verilog::Module& module = x3::_attr(ctx);
 
 			module.libraryModule = state.libraryModule;
@@ -800,11 +813,11 @@ namespace Grammar {
 		};
 
 		auto set_library_flag = [](auto& ctx) {
-			global_state& state = x3::get<global_state_tag>(ctx);
+			global_state& state = x3::get<global_state_tag>(ctx).get();
 			state.libraryModule = true;
 		};
 		auto unset_library_flag = [](auto& ctx) {
-			global_state& state = x3::get<global_state_tag>(ctx);
+			global_state& state = x3::get<global_state_tag>(ctx).get();
 			state.libraryModule = false;
 		};
 
@@ -819,7 +832,7 @@ namespace Grammar {
 		const source_type module_list_impl = "Module List";
 		const auto module_list_impl_def =
 			x3::with<global_state_tag>(
-				global_state()
+				thread_local_state<global_state_tag, global_state>()
 			)[
 				x3::eps[ reset_tag ]
 				> *(
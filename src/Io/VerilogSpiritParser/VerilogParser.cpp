@@ -1,16 +1,19 @@
 #include "Io/VerilogSpiritParser/VerilogParser.hpp"
 
 #include <boost/spirit/home/x3.hpp>
-#include <boost/spirit/include/support_istream_iterator.hpp>
-#include <boost/spirit/include/support_multi_pass.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <string_view>
 
 #include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
 #include "Io/VerilogSpiritParser/VerilogGrammar.hpp"
 #include "Io/X3Utils/X3ExceptionFormatter.hpp"
 
@@ -20,6 +23,9 @@ namespace FreiTest {
 namespace Io {
 namespace Verilog {
 
+// The minimum size of a source chunk that is parsed by one thread
+constexpr size_t VERILOG_PARSER_CHUNK_SIZE { 4u << 20u };
+
 // ---------------------------------------------------------------------------
 // Parser class
 // ---------------------------------------------------------------------------
@@ -34,37 +40,130 @@ VerilogParser::~VerilogParser(void)
 
 bool VerilogParser::Parse(istream& input)
 {
-	// Do not skip whitespace
-	input >> std::noskipws;
+	// Read the complete source into a contiguous buffer as the
+	// grammar backtracks and requires random access to the input.
+	const string buffer { istreambuf_iterator<char>(input), istreambuf_iterator<char>() };
+	return Parse(buffer);
+}
+
+bool VerilogParser::Parse(const string& input)
+{
+	return Parse(input.data(), input.data() + input.size());
+}
+
+bool VerilogParser::Parse(const char* begin, const char* end)
+{
+	const auto chunks { SplitIntoChunks(begin, end, VERILOG_PARSER_CHUNK_SIZE) };
+	if (chunks.size() <= 1u)
+	{
+		return ParseChunk({ begin, end, 1u }, _modules);
+	}
+
+	LOG(DEBUG) << "Parsing verilog source in " << chunks.size() << " chunks";
+
+	std::vector<ModuleCollection> chunkModules(chunks.size());
+	std::vector<uint8_t> chunkSuccess(chunks.size(), 0u);
+	Parallel::ExecuteParallel(0u, chunks.size(), Parallel::Arena::General, Parallel::Order::Parallel, [&](size_t index) {
+		chunkSuccess[index] = ParseChunk(chunks[index], chunkModules[index]);
+	});
+
+	if (std::find(chunkSuccess.begin(), chunkSuccess.end(), 0u) != chunkSuccess.end())
+	{
+		return false;
+	}
+
+	for (auto& modules : chunkModules)
+	{
+		_modules.insert(_modules.end(), modules.begin(), modules.end());
+		modules.clear();
+	}
+
+	return true;
+}
+
+std::vector<VerilogParser::SourceChunk> VerilogParser::SplitIntoChunks(const char* begin, const char* end, size_t minimumChunkSize)
+{
+	std::vector<SourceChunk> chunks;
+	if (Parallel::GetThreads(Parallel::Arena::General) <= 1u
+		|| static_cast<size_t>(end - begin) < 2u * minimumChunkSize)
+	{
+		chunks.push_back({ begin, end, 1u });
+		return chunks;
+	}
+
+	// The preprocessed source has one statement per line and the modules
+	// are independent of each other, except for the library flag that is set
+	// by `celldefine / `endcelldefine. Therefore, the source is split after
+	// lines starting with "endmodule" that are not inside of a celldefine block.
+	auto starts_with_token = [](std::string_view line, std::string_view token) {
+		return line.substr(0u, token.size()) == token
+			&& (line.size() == token.size() || std::isspace(static_cast<unsigned char>(line[token.size()])));
+	};
+
+	bool libraryModule { false };
+	const char* chunkBegin { begin };
+	size_t chunkFirstLine { 1u };
+	size_t lineNumber { 1u };
+	for (const char* lineBegin { begin }; lineBegin < end; ++lineNumber)
+	{
+		const char* lineEnd { std::find(lineBegin, end, '\n') };
+		const char* nextLine { (lineEnd == end) ? end : lineEnd + 1u };
+
+		std::string_view line(lineBegin, lineEnd - lineBegin);
+		line.remove_prefix(std::min(line.find_first_not_of(" \t\r"), line.size()));
+		if (starts_with_token(line, "`celldefine"))
+		{
+			libraryModule = true;
+		}
+		else if (starts_with_token(line, "`endcelldefine"))
+		{
+			libraryModule = false;
+		}
+		else if (starts_with_token(line, "endmodule") && !libraryModule
+			&& static_cast<size_t>(nextLine - chunkBegin) >= minimumChunkSize)
+		{
+			chunks.push_back({ chunkBegin, nextLine, chunkFirstLine });
+			chunkBegin = nextLine;
+			chunkFirstLine = lineNumber + 1u;
+		}
+
+		lineBegin = nextLine;
+	}
+
+	if (chunkBegin != end)
+	{
+		chunks.push_back({ chunkBegin, end, chunkFirstLine });
+	}
 
-	namespace spirit = boost::spirit;
+	return chunks;
+}
+
+bool VerilogParser::ParseChunk(const SourceChunk& chunk, ModuleCollection& modules)
+{
 	namespace x3 = boost::spirit::x3;
 
 	using Grammar::skipper;
 	using Grammar::verilog_source;
 
 	using Grammar::iterator_type;
-	using Grammar::base_iterator_type;
 	using Grammar::context_type;
 
-	iterator_type begin = spirit::make_default_multi_pass(base_iterator_type(input));
-	iterator_type end = spirit::make_default_multi_pass(base_iterator_type());
-	iterator_type curr = begin;
+	iterator_type curr = chunk.begin;
 
 	try
 	{
-		if (x3::phrase_parse(curr, end, verilog_source(), x3::standard::space, _modules))
+		if (x3::phrase_parse(curr, chunk.end, verilog_source(), x3::standard::space, modules))
 		{
 			return true;
 		}
 
 		LOG(ERROR) << "Parsing Verilog source failed here:" << std::endl
-			<< Io::X3::FormatX3Message(begin, end, curr, "Unexpected content");
+			<< Io::X3::FormatX3Message(chunk.begin, chunk.end, curr, "Unexpected content", 2u, 1u, chunk.firstLine);
 	}
 	catch(x3::expectation_failure<iterator_type>& exception)
 	{
 		LOG(ERROR) << "Parsing Verilog source failed with error:" << std::endl
-			<< Io::X3::FormatX3Exception(begin, end, exception);
+			<< Io::X3::FormatX3Exception(chunk.begin, chunk.end, exception, 2u, 1u, chunk.firstLine);
 	}
 
 	return false;
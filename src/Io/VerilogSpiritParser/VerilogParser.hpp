@@ -18,10 +18,30 @@ public:
 	virtual ~VerilogParser(void);
 
 	bool Parse(std::istream& input);
+	bool Parse(const std::string& input);
+	/**
+	 * @brief Parses the Verilog source in the given buffer.
+	 *
+	 * Large sources are split at module boundaries (outside of celldefine blocks)
+	 * and the chunks are parsed in parallel on the general arena.
+	 * The modules are appended in the order of the source.
+	 */
+	bool Parse(const char* begin, const char* end);
 	void Reset(void);
 	ModuleCollection& GetModules(void);
 
 private:
+	struct SourceChunk
+	{
+		const char* begin;
+		const char* end;
+		// The line number of the first line of the chunk in the whole source
+		size_t firstLine;
+	};
+
+	static bool ParseChunk(const SourceChunk& chunk, ModuleCollection& modules);
+	static std::vector<SourceChunk> SplitIntoChunks(const char* begin, const char* end, size_t minimumChunkSize);
+
 	ModuleCollection _modules;
 
 };
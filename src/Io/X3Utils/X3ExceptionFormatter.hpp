@@ -17,13 +17,19 @@ namespace Io
 namespace X3
 {
 
+/**
+ * @brief Formats a message with the source lines around the indicator.
+ *
+ * The line numbers start at firstLine, which allows to report the lines
+ * of a part of a source relative to the beginning of the whole source.
+ */
 template<typename Iterator>
-static std::string FormatX3Message(Iterator begin, Iterator end, Iterator indicator, std::string message, size_t preceding = 2, size_t following = 1)
+static std::string FormatX3Message(Iterator begin, Iterator end, Iterator indicator, std::string message, size_t preceding = 2, size_t following = 1, size_t firstLine = 1)
 {
 	Iterator curr = begin;
 
-	size_t firstLineNumber = 1u;
-	size_t indicatorLineNumber = 1u;
+	size_t firstLineNumber = firstLine;
+	size_t indicatorLineNumber = firstLine;
 	size_t indicatorOffset = 0u;
 	std::string indicatorLine;
 	std::string indicatorArrow;
@@ -35,7 +41,7 @@ static std::string FormatX3Message(Iterator begin, Iterator end, Iterator indica
 		return std::string(1u, value);
 	};
 
-	size_t lineNumber = 1u;
+	size_t lineNumber = firstLine;
 	std::string currentLine;
 	bool isPrecedingLine = true;
 	bool isFollowingLine = false;
@@ -104,9 +110,9 @@ static std::string FormatX3Message(Iterator begin, Iterator end, Iterator indica
 }
 
 template<typename Iterator>
-static std::string FormatX3Exception(Iterator begin, Iterator end, boost::spirit::x3::expectation_failure<Iterator> const& exception, size_t preceding = 2, size_t following = 1)
+static std::string FormatX3Exception(Iterator begin, Iterator end, boost::spirit::x3::expectation_failure<Iterator> const& exception, size_t preceding = 2, size_t following = 1, size_t firstLine = 1)
 {
-	return FormatX3Message(begin, end, exception.where(), "Expecting " + exception.which(), preceding, following);
+	return FormatX3Message(begin, end, exception.where(), "Expecting " + exception.which(), preceding, following, firstLine);
 }
 
 };
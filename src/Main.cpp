@@ -20,6 +20,7 @@
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Helper/FileHandle.hpp"
 #include "Helper/StringHelper.hpp"
+#include "Io/CircuitSnapshot/CircuitSnapshot.hpp"
 #include "Io/VerilogImporter/VerilogConverter.hpp"
 
 namespace FreiTest
@@ -393,6 +394,27 @@ bool Main::LoadCircuitFromSettings(void)
 		LOG(INFO) << "Loaded Verilog circuit";
 		this->circuit = std::move(circuit);
 	}
+	else if(settings->CircuitSourceType == Settings::CircuitSourceType::Snapshot)
+	{
+		// The snapshot is used independent of the sources it was created from
+		auto builder = Io::ImportCircuitSnapshot(settings->MapFileName(settings->CircuitSnapshotFilename, false), "");
+		if (!builder)
+		{
+			LOG(ERROR) << "Failed to load circuit snapshot " << settings->CircuitSnapshotFilename;
+			return false;
+		}
+
+		Circuit::Builder::BuildConfiguration buildConfiguration;
+		auto circuit = builder->BuildCircuitEnvironment(buildConfiguration);
+		if (!circuit)
+		{
+			LOG(ERROR) << "Failed to load circuits!";
+			return false;
+		}
+
+		LOG(INFO) << "Loaded circuit snapshot";
+		this->circuit = std::move(circuit);
+	}
 	else
 	{
 		LOG(ERROR) << "Invalid circuit source type";
@@ -0,0 +1,244 @@
+#include "Simulation/FaultSimulator.hpp"
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include <type_traits>
+#include <utility>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Logic.hpp"
+#include "Basic/Parallel.hpp"
+#include "Basic/Fault/Lists/CellAwareFaultList.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Lists/SingleTransitionDelayFaultList.hpp"
+#include "Basic/Fault/Models/FaultFreeModel.hpp"
+#include "Basic/Fault/Models/CellAwareFaultModel.hpp"
+#include "Basic/Fault/Models/MultiStuckAtFaultModel.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Basic/Fault/Models/MultiTransitionDelayFaultModel.hpp"
+#include "Basic/Fault/Models/SingleTransitionDelayFaultModel.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+using namespace FreiTest::Fault;
+using namespace FreiTest::Pattern;
+
+namespace FreiTest
+{
+namespace Simulation
+{
+
+// The number of faults that are simulated by one thread at once
+static constexpr size_t FAULT_BLOCK_SIZE { 256u };
+
+// The simulation result of the faulty circuit of each thread, which is kept between
+// the calls and is only reallocated if the size of the circuit or the pattern changes.
+static tbb::enumerable_thread_specific<SimulationResult> badResults { 0u, 0u };
+
+static SimulationResult& GetBadResult(size_t timeframes, size_t nodes)
+{
+	auto& badResult { badResults.local() };
+	if (badResult.GetNumberOfTimeframes() != timeframes
+		|| (timeframes > 0u && badResult[0u].GetNumberOfValues() != nodes))
+	{
+		badResult = SimulationResult { timeframes, nodes };
+	}
+	return badResult;
+}
+
+template<typename FaultModel>
+bool IsFaultSensitized(const MappedCircuit& circuit, const FaultModel& faultModel, const SimulationResult& goodResult)
+{
+	if constexpr (std::is_same_v<FaultModel, SingleStuckAtFaultModel>)
+	{
+		const auto& fault { faultModel.GetFault() };
+		const auto& stuckAt { fault->GetStuckAt() };
+		const size_t nodeId { circuit.GetDriverForPort(stuckAt)->GetNodeId() };
+		for (size_t timeframeId = 0u; timeframeId < goodResult.GetNumberOfTimeframes(); ++timeframeId)
+		{
+			const Logic& value = goodResult[timeframeId][nodeId];
+			if (__builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_1 && value == Logic::LOGIC_ZERO, false)
+				|| __builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_0 && value == Logic::LOGIC_ONE, false))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	else if constexpr (std::is_same_v<FaultModel, MultiStuckAtFaultModel>)
+	{
+		const auto& fault { faultModel.GetFault() };
+		for (const auto& stuckAt : fault.GetStuckAts())
+		{
+			const size_t nodeId = circuit.GetDriverForPort(stuckAt)->GetNodeId();
+			for (size_t timeframeId = 0u; timeframeId < goodResult.GetNumberOfTimeframes(); ++timeframeId)
+			{
+				const Logic& value = goodResult[timeframeId][nodeId];
+				if (__builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_1 && value == Logic::LOGIC_ZERO, false)
+					|| __builtin_expect(stuckAt.GetType() == StuckAtFaultType::STUCK_AT_0 && value == Logic::LOGIC_ONE, false))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+	else if constexpr (std::is_same_v<FaultModel, SingleTransitionDelayFaultModel>)
+	{
+		const auto& fault { faultModel.GetFault() };
+		const auto& transitionDelay { fault->GetTransitionDelay() };
+		const size_t nodeId { circuit.GetDriverForPort(transitionDelay)->GetNodeId() };
+		for (size_t timeframeId = 0u; timeframeId + 1u < goodResult.GetNumberOfTimeframes(); ++timeframeId)
+		{
+			const Logic& initialValue = goodResult[timeframeId][nodeId];
+			const Logic& finalValue = goodResult[timeframeId + 1u][nodeId];
+			if (__builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_RISE && initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE, false)
+				|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_FALL && initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO, false)
+				|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_TRANSITION
+					&& ((initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE)
+						|| (initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO)), false))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	else if constexpr (std::is_same_v<FaultModel, MultiTransitionDelayFaultModel>)
+	{
+		const auto& fault { faultModel.GetFault() };
+		for (const auto& transitionDelay : fault.GetTransitionDelays())
+		{
+			const size_t nodeId = circuit.GetDriverForPort(transitionDelay)->GetNodeId();
+			for (size_t timeframeId = 0u; timeframeId + 1u < goodResult.GetNumberOfTimeframes(); ++timeframeId)
+			{
+				const Logic& initialValue = goodResult[timeframeId][nodeId];
+				const Logic& finalValue = goodResult[timeframeId + 1u][nodeId];
+				if (__builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_RISE && initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE, false)
+					|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_FALL && initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO, false)
+					|| __builtin_expect(transitionDelay.GetType() == TransitionDelayFaultType::SLOW_TO_TRANSITION
+						&& ((initialValue == Logic::LOGIC_ZERO && finalValue == Logic::LOGIC_ONE)
+							|| (initialValue == Logic::LOGIC_ONE && finalValue == Logic::LOGIC_ZERO)), false))
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+	else if constexpr (std::is_same_v<FaultModel, CellAwareFaultModel>)
+	{
+		const auto& fault { faultModel.GetFault() };
+		for (const auto& alternative : fault->GetAlternatives())
+		{
+			for (size_t timeframeId { 0u }; timeframeId < goodResult.GetNumberOfTimeframes(); timeframeId++)
+			{
+				// Not enough timeframes left to be able to fulfill conditions
+				bool satisfied { (timeframeId + alternative.conditions[0].logicConstraints.size()) <= goodResult.GetNumberOfTimeframes() };
+				for (const auto& condition : alternative.conditions)
+				{
+					if (!satisfied) { break; }
+					for (size_t index { 0u }; index < alternative.conditions[0].logicConstraints.size(); index++)
+					{
+						if (!satisfied) { break; }
+						auto const targetNodeId { circuit.GetDriverForPort(condition.nodeAndPort)->GetNodeId() };
+						auto const goodValue { goodResult[timeframeId + index][targetNodeId] };
+						satisfied &= IsConstraintTrueForLogic(goodValue, condition.logicConstraints[index]);
+					}
+				}
+				if (satisfied) { return true; }
+			}
+		}
+		return false;
+	}
+	else
+	{
+		LOG(FATAL) << "Fault model not implemented";
+		__builtin_unreachable();
+	}
+}
+
+bool IsFaultDetected(const MappedCircuit& circuit, const SimulationResult& goodResult, const SimulationResult& badResult, OutputCapture capture)
+{
+	const auto [testPrimaryOutputs, testSecondaryOutputs] = GetCaptureOutputs(capture);
+	for (size_t timeframe = 0u; timeframe < goodResult.GetNumberOfTimeframes(); ++timeframe)
+	{
+		for (size_t index = 0u; testPrimaryOutputs && index < circuit.GetNumberOfPrimaryOutputs(); ++index)
+		{
+			const auto* primaryOutput = circuit.GetPrimaryOutput(index);
+			const auto good = goodResult.GetOutputLogic(primaryOutput, timeframe);
+			const auto bad = badResult.GetOutputLogic(primaryOutput, timeframe);
+			if (__builtin_expect(IsValidLogic01(good) && IsValidLogic01(bad) && (bad != good), false))
+			{
+				return true;
+			}
+		}
+
+		for (size_t index = 0u; testSecondaryOutputs && index < circuit.GetNumberOfSecondaryOutputs(); ++index)
+		{
+			const auto* secondaryOutput = circuit.GetSecondaryOutput(index);
+			const auto good = goodResult.GetOutputLogic(secondaryOutput, timeframe);
+			const auto bad = badResult.GetOutputLogic(secondaryOutput, timeframe);
+			if (__builtin_expect(IsValidLogic01(good) && IsValidLogic01(bad) && (bad != good), false))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+template<typename FaultModel, typename FaultList>
+std::vector<size_t> SimulateFaults(const MappedCircuit& circuit, const TestPattern& pattern, const FaultList& faultList,
+	OutputCapture capture, const SimulationConfig& config, const std::function<bool(size_t)>& filter)
+{
+	SimulationResult goodResult { pattern.GetNumberOfTimeframes(), circuit.GetNumberOfNodes() };
+	SimulateTestPatternEventDriven<FaultFreeModel>(circuit, pattern, { }, goodResult, config);
+
+	// Each block collects its detected faults separately which avoids
+	// synchronization between the threads and keeps the result sorted.
+	std::vector<std::vector<size_t>> blockDetections((faultList.size() + FAULT_BLOCK_SIZE - 1u) / FAULT_BLOCK_SIZE);
+	Parallel::ExecuteParallelInBlocks(0u, faultList.size(), FAULT_BLOCK_SIZE, Parallel::Arena::FaultSimulation, Parallel::Order::Parallel, [&](size_t begin, size_t end) {
+		auto& detections { blockDetections[begin / FAULT_BLOCK_SIZE] };
+		auto& badResult { GetBadResult(pattern.GetNumberOfTimeframes(), circuit.GetNumberOfNodes()) };
+
+		for (size_t faultIndex { begin }; faultIndex < end; ++faultIndex)
+		{
+			if (filter && !filter(faultIndex))
+			{
+				continue;
+			}
+
+			const auto [fault, metadata] = faultList[faultIndex];
+			if (!IsFaultSensitized(circuit, FaultModel(fault), goodResult))
+			{
+				continue;
+			}
+
+			badResult.ReplaceWith(goodResult);
+			SimulateTestPatternEventDrivenIncremental<FaultModel>(circuit, pattern, { fault }, std::as_const(goodResult), badResult, config);
+			if (IsFaultDetected(circuit, goodResult, badResult, capture))
+			{
+				detections.push_back(faultIndex);
+			}
+		}
+	});
+
+	std::vector<size_t> result;
+	for (auto& detections : blockDetections)
+	{
+		result.insert(result.end(), detections.begin(), detections.end());
+	}
+	return result;
+}
+
+template bool IsFaultSensitized<SingleStuckAtFaultModel>(const MappedCircuit& circuit, const SingleStuckAtFaultModel& faultModel, const SimulationResult& goodResult);
+template bool IsFaultSensitized<SingleTransitionDelayFaultModel>(const MappedCircuit& circuit, const SingleTransitionDelayFaultModel& faultModel, const SimulationResult& goodResult);
+template bool IsFaultSensitized<CellAwareFaultModel>(const MappedCircuit& circuit, const CellAwareFaultModel& faultModel, const SimulationResult& goodResult);
+
+template std::vector<size_t> SimulateFaults<SingleStuckAtFaultModel, SingleStuckAtFaultList>(const MappedCircuit& circuit, const TestPattern& pattern, const SingleStuckAtFaultList& faultList, OutputCapture capture, const SimulationConfig& config, const std::function<bool(size_t)>& filter);
+template std::vector<size_t> SimulateFaults<SingleTransitionDelayFaultModel, SingleTransitionDelayFaultList>(const MappedCircuit& circuit, const TestPattern& pattern, const SingleTransitionDelayFaultList& faultList, OutputCapture capture, const SimulationConfig& config, const std::function<bool(size_t)>& filter);
+template std::vector<size_t> SimulateFaults<CellAwareFaultModel, CellAwareFaultList>(const MappedCircuit& circuit, const TestPattern& pattern, const CellAwareFaultList& faultList, OutputCapture capture, const SimulationConfig& config, const std::function<bool(size_t)>& filter);
+
+};
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Basic/Pattern/Capture.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Circuit/MappedCircuit.hpp"
+#include "Simulation/CircuitSimulationResult.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+
+namespace FreiTest
+{
+namespace Simulation
+{
+
+/**
+ * @brief Checks if the fault is sensitized by the fault-free simulation in at least one timeframe.
+ *
+ * If this is not the case then no fault propagation is possible
+ * and the fault simulation can be skipped for the fault.
+ */
+template<typename FaultModel>
+bool IsFaultSensitized(const Circuit::MappedCircuit& circuit, const FaultModel& faultModel, const SimulationResult& goodResult);
+
+/**
+ * @brief Checks if the good and bad simulation differ in a valid 0 / 1 value at the captured outputs.
+ */
+bool IsFaultDetected(const Circuit::MappedCircuit& circuit, const SimulationResult& goodResult, const SimulationResult& badResult, Pattern::OutputCapture capture);
+
+/**
+ * @brief Simulates the faults of the fault list for one test pattern and returns the indices of the detected faults.
+ *
+ * The faults are simulated in blocks in the fault simulation arena with an incremental
+ * event-driven simulation. Faults that are not sensitized by the fault-free simulation
+ * are skipped. Faults for which the (optional) filter returns false are not simulated.
+ * The returned fault indices are sorted in ascending order.
+ */
+template<typename FaultModel, typename FaultList>
+std::vector<size_t> SimulateFaults(const Circuit::MappedCircuit& circuit, const Pattern::TestPattern& pattern, const FaultList& faultList,
+	Pattern::OutputCapture capture, const SimulationConfig& config, const std::function<bool(size_t)>& filter = { });
+
+};
+};
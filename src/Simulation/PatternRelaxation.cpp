@@ -0,0 +1,135 @@
+#include "Simulation/PatternRelaxation.hpp"
+
+#include <utility>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Logic.hpp"
+#include "Basic/Fault/Models/FaultFreeModel.hpp"
+#include "Basic/Fault/Models/CellAwareFaultModel.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Basic/Fault/Models/SingleTransitionDelayFaultModel.hpp"
+#include "Simulation/CircuitSimulationResult.hpp"
+#include "Simulation/FaultSimulator.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+using namespace FreiTest::Fault;
+using namespace FreiTest::Pattern;
+
+namespace FreiTest
+{
+namespace Simulation
+{
+
+template<typename FaultModel>
+class PatternRelaxation
+{
+public:
+	PatternRelaxation(const MappedCircuit& circuit, TestPattern& pattern, const FaultModel& faultModel, OutputCapture capture, const SimulationConfig& config, const FixedInputs& fixedInputs):
+		_circuit(circuit),
+		_pattern(pattern),
+		_faultModel(faultModel),
+		_capture(capture),
+		_config(config),
+		_fixedInputs(fixedInputs),
+		_goodResult(pattern.GetNumberOfTimeframes(), circuit.GetNumberOfNodes()),
+		_badResult(pattern.GetNumberOfTimeframes(), circuit.GetNumberOfNodes())
+	{
+	}
+
+	size_t Run(void)
+	{
+		if (!IsDetected())
+		{
+			return 0u;
+		}
+
+		std::vector<Logic*> careBits;
+		for (size_t timeframe { 0u }; timeframe < _pattern.GetNumberOfTimeframes(); ++timeframe)
+		{
+			auto& primaryInputs { _pattern.GetPrimaryInputs(timeframe) };
+			for (size_t input { 0u }; input < primaryInputs.size(); ++input)
+			{
+				if (IsValidLogic01(primaryInputs[input]) && !_fixedInputs.IsPrimaryInputFixed(input)) careBits.push_back(&primaryInputs[input]);
+			}
+			auto& secondaryInputs { _pattern.GetSecondaryInputs(timeframe) };
+			for (size_t input { 0u }; input < secondaryInputs.size(); ++input)
+			{
+				if (IsValidLogic01(secondaryInputs[input]) && !_fixedInputs.IsSecondaryInputFixed(input)) careBits.push_back(&secondaryInputs[input]);
+			}
+		}
+
+		return Relax(careBits, 0u, careBits.size());
+	}
+
+private:
+	bool IsDetected(void)
+	{
+		SimulateTestPatternEventDriven<FaultFreeModel>(_circuit, _pattern, { }, _goodResult, _config);
+		if (!IsFaultSensitized(_circuit, _faultModel, _goodResult))
+		{
+			return false;
+		}
+
+		_badResult.ReplaceWith(_goodResult);
+		SimulateTestPatternEventDrivenIncremental<FaultModel>(_circuit, _pattern, _faultModel, std::as_const(_goodResult), _badResult, _config);
+		return IsFaultDetected(_circuit, _goodResult, _badResult, _capture);
+	}
+
+	size_t Relax(const std::vector<Logic*>& careBits, size_t begin, size_t end)
+	{
+		if (begin == end)
+		{
+			return 0u;
+		}
+
+		std::vector<Logic> values;
+		values.reserve(end - begin);
+		for (size_t index { begin }; index < end; ++index)
+		{
+			values.push_back(*careBits[index]);
+			*careBits[index] = Logic::LOGIC_DONT_CARE;
+		}
+		if (IsDetected())
+		{
+			return end - begin;
+		}
+
+		for (size_t index { begin }; index < end; ++index)
+		{
+			*careBits[index] = values[index - begin];
+		}
+		if (end - begin == 1u)
+		{
+			return 0u;
+		}
+
+		const size_t middle { begin + (end - begin) / 2u };
+		return Relax(careBits, begin, middle) + Relax(careBits, middle, end);
+	}
+
+	const MappedCircuit& _circuit;
+	TestPattern& _pattern;
+	const FaultModel& _faultModel;
+	OutputCapture _capture;
+	const SimulationConfig& _config;
+	const FixedInputs& _fixedInputs;
+
+	SimulationResult _goodResult;
+	SimulationResult _badResult;
+
+};
+
+template<typename FaultModel>
+size_t RelaxTestPattern(const MappedCircuit& circuit, TestPattern& pattern, const FaultModel& faultModel, OutputCapture capture, const SimulationConfig& config, const FixedInputs& fixedInputs)
+{
+	return PatternRelaxation<FaultModel>(circuit, pattern, faultModel, capture, config, fixedInputs).Run();
+}
+
+template size_t RelaxTestPattern<SingleStuckAtFaultModel>(const MappedCircuit& circuit, TestPattern& pattern, const SingleStuckAtFaultModel& faultModel, OutputCapture capture, const SimulationConfig& config, const FixedInputs& fixedInputs);
+template size_t RelaxTestPattern<SingleTransitionDelayFaultModel>(const MappedCircuit& circuit, TestPattern& pattern, const SingleTransitionDelayFaultModel& faultModel, OutputCapture capture, const SimulationConfig& config, const FixedInputs& fixedInputs);
+template size_t RelaxTestPattern<CellAwareFaultModel>(const MappedCircuit& circuit, TestPattern& pattern, const CellAwareFaultModel& faultModel, OutputCapture capture, const SimulationConfig& config, const FixedInputs& fixedInputs);
+
+};
+};
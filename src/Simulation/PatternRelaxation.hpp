@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Basic/Pattern/Capture.hpp"
+#include "Basic/Pattern/PatternFill.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Circuit/MappedCircuit.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+
+namespace FreiTest
+{
+namespace Simulation
+{
+
+/**
+ * @brief Turns the inputs of the pattern that are not required to detect the fault into don't care (X) values.
+ *
+ * The pattern as returned by the SAT solver assigns many inputs that are irrelevant
+ * for the detection of the fault. The care bits are identified by a three-valued
+ * fault simulation: A group of specified inputs is set to X and the pattern is
+ * simulated. If the fault is still detected with valid 0 / 1 values at an output,
+ * the inputs of the group are not required. Otherwise the group is split in halves
+ * which are relaxed one after another. This requires a logarithmic number of
+ * simulations per care bit instead of one simulation per specified input.
+ *
+ * Patterns that do not detect the fault are not modified.
+ * The fixed inputs keep their values in all timeframes.
+ *
+ * @return The number of inputs that have been relaxed to X.
+ */
+template<typename FaultModel>
+size_t RelaxTestPattern(const Circuit::MappedCircuit& circuit, Pattern::TestPattern& pattern, const FaultModel& faultModel,
+	Pattern::OutputCapture capture, const SimulationConfig& config, const Pattern::FixedInputs& fixedInputs = { });
+
+};
+};
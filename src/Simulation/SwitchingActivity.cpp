@@ -0,0 +1,120 @@
+#include "Simulation/SwitchingActivity.hpp"
+
+#include <algorithm>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Fault/Models/FaultFreeModel.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+using namespace FreiTest::Fault;
+using namespace FreiTest::Pattern;
+
+namespace FreiTest
+{
+namespace Simulation
+{
+
+size_t SwitchingActivity::GetPeakShift(void) const
+{
+	return std::max(shiftIn, shiftOut);
+}
+
+// Calls the function with the position of each transition between specified values.
+// The don't care values in between are assumed to repeat the previous value,
+// which places the transition directly before the next specified value.
+template<typename Function>
+static void ForEachTransition(const std::vector<Logic>& values, Function function)
+{
+	const Logic* previous { nullptr };
+	for (size_t index { 0u }; index < values.size(); ++index)
+	{
+		if (!IsValidLogic01(values[index]))
+		{
+			continue;
+		}
+		if (previous != nullptr && *previous != values[index])
+		{
+			function(index);
+		}
+		previous = &values[index];
+	}
+}
+
+size_t GetWeightedShiftInTransitions(const std::vector<Logic>& stimulus)
+{
+	size_t transitions { 0u };
+	ForEachTransition(stimulus, [&](size_t index) { transitions += index; });
+	return transitions;
+}
+
+size_t GetWeightedShiftOutTransitions(const std::vector<Logic>& response)
+{
+	size_t transitions { 0u };
+	ForEachTransition(response, [&](size_t index) { transitions += response.size() - index; });
+	return transitions;
+}
+
+SwitchingActivity GetSwitchingActivity(const MappedCircuit& circuit, const SimulationResult& goodResult)
+{
+	SwitchingActivity activity { 0u, 0u, 0u };
+	const size_t timeframes { goodResult.GetNumberOfTimeframes() };
+	if (timeframes == 0u)
+	{
+		return activity;
+	}
+
+	const auto get_weight = [&](const MappedNode* node) -> size_t {
+		return 1u + node->GetNumberOfSuccessors();
+	};
+	const auto is_toggle = [](const Logic& before, const Logic& after) {
+		return IsValidLogic01(before) && IsValidLogic01(after) && before != after;
+	};
+
+	std::vector<Logic> stimulus(circuit.GetNumberOfSecondaryInputs(), Logic::LOGIC_DONT_CARE);
+	std::vector<Logic> response(circuit.GetNumberOfSecondaryInputs(), Logic::LOGIC_DONT_CARE);
+	for (auto [secondaryInput, node] : circuit.EnumerateSecondaryInputs())
+	{
+		const auto* secondaryOutput { circuit.GetSecondaryOutputForSecondaryInput(node) };
+		stimulus[secondaryInput] = goodResult.GetOutputLogic(node, 0u);
+		response[secondaryInput] = goodResult.GetOutputLogic(secondaryOutput, timeframes - 1u);
+
+		// The flip-flops that capture a different value than they hold
+		for (size_t timeframe { 0u }; timeframe < timeframes; ++timeframe)
+		{
+			if (is_toggle(goodResult.GetOutputLogic(node, timeframe), goodResult.GetOutputLogic(secondaryOutput, timeframe)))
+			{
+				activity.capture += get_weight(node);
+			}
+		}
+	}
+	activity.shiftIn = GetWeightedShiftInTransitions(stimulus);
+	activity.shiftOut = GetWeightedShiftOutTransitions(response);
+
+	// The nodes that toggle when the next timeframe is launched.
+	// A flip-flop starts the timeframe with the value it has captured in the previous one,
+	// which is already counted above. It only toggles again if the state is overwritten.
+	for (size_t timeframe { 1u }; timeframe < timeframes; ++timeframe)
+	{
+		for (auto [nodeId, node] : circuit.EnumerateNodes())
+		{
+			const auto* previous { circuit.IsSecondaryInput(node) ? circuit.GetSecondaryOutputForSecondaryInput(node) : node };
+			if (is_toggle(goodResult.GetOutputLogic(previous, timeframe - 1u), goodResult[timeframe][nodeId]))
+			{
+				activity.capture += get_weight(node);
+			}
+		}
+	}
+
+	return activity;
+}
+
+SwitchingActivity GetSwitchingActivity(const MappedCircuit& circuit, const TestPattern& pattern, const SimulationConfig& config)
+{
+	SimulationResult goodResult { pattern.GetNumberOfTimeframes(), circuit.GetNumberOfNodes() };
+	SimulateTestPatternEventDriven<FaultFreeModel>(circuit, pattern, { }, goodResult, config);
+	return GetSwitchingActivity(circuit, goodResult);
+}
+
+};
+};
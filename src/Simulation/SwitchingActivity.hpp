@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Circuit/MappedCircuit.hpp"
+#include "Simulation/CircuitSimulationResult.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+
+namespace FreiTest
+{
+namespace Simulation
+{
+
+/**
+ * @brief The estimated switching activity of one test pattern in weighted transitions.
+ *
+ * - shiftIn: Weighted transitions while the stimulus is shifted into the scan chain.
+ * - shiftOut: Weighted transitions while the response is shifted out of the scan chain.
+ * - capture: Weighted transitions of the capture (and launch) clock cycles.
+ */
+struct SwitchingActivity
+{
+	size_t shiftIn;
+	size_t shiftOut;
+	size_t capture;
+
+	size_t GetPeakShift(void) const;
+};
+
+/**
+ * @brief Returns the weighted transition metric of a vector that is shifted into a scan chain.
+ *
+ * The scan chain is assumed to be ordered by the secondary input index with
+ * index 0 at the scan input. A transition between the positions i and i + 1
+ * is shifted through i + 1 flip-flops. Don't care values don't cause a transition
+ * as they can be filled with the adjacent value.
+ */
+size_t GetWeightedShiftInTransitions(const std::vector<Basic::Logic>& stimulus);
+
+/**
+ * @brief Returns the weighted transition metric of a vector that is shifted out of a scan chain.
+ *
+ * A transition between the positions i and i + 1 is shifted through the
+ * remaining n - i - 1 flip-flops towards the scan output.
+ */
+size_t GetWeightedShiftOutTransitions(const std::vector<Basic::Logic>& response);
+
+/**
+ * @brief Estimates the switching activity of a test pattern from its fault-free simulation.
+ *
+ * The stimulus is the state of the secondary inputs in the first timeframe and
+ * the response is the captured state of the secondary outputs in the last timeframe.
+ * The capture activity counts the flip-flops that change their value at the capture
+ * clock of each timeframe and the nodes that toggle between consecutive timeframes.
+ * The flip-flops are counted once per capture and not again when the captured value
+ * is launched into the next timeframe.
+ * Each transition is weighted by the fanout of the node (1 + number of successors)
+ * as an estimate of the switched load capacitance.
+ */
+SwitchingActivity GetSwitchingActivity(const Circuit::MappedCircuit& circuit, const SimulationResult& goodResult);
+
+/**
+ * @brief Simulates the test pattern without faults and estimates its switching activity.
+ */
+SwitchingActivity GetSwitchingActivity(const Circuit::MappedCircuit& circuit, const Pattern::TestPattern& pattern, const SimulationConfig& config);
+
+};
+};
@@ -3,9 +3,6 @@
 #ifdef HAS_BMC_SOLVER_EXPORT_CIP
 
 #include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/bzip2.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filter/lzma.hpp>
 
 #include <chrono>
 #include <fstream>
@@ -74,22 +71,7 @@ BmcResult CipExportProxy::Solve(void)
 	LOG_IF(!outfstream.good(), FATAL) << "Could not open file " << filename << " for exporting BMC problem.";
 
 	boost::iostreams::filtering_ostreambuf outfilter;
-	switch(compression)
-	{
-		case Compression::Bzip2:
-			outfilter.push(boost::iostreams::bzip2_compressor());
-			break;
-		case Compression::Gzip:
-			outfilter.push(boost::iostreams::gzip_compressor(/*boost::iostreams::gzip_params { 3 }*/));
-			break;
-		case Compression::Lzma:
-			outfilter.push(boost::iostreams::lzma_compressor(/*boost::iostreams::lzma_params { 3 }*/));
-			break;
-		case Compression::None:
-			break;
-		default:
-			Logging::Panic();
-	}
+	PushCompressor(outfilter, (compression != Compression::None) ? compression : GetCompressionFormat(filename));
 	outfilter.push(outfstream);
 
 	std::ostream out { &outfilter };
@@ -4,6 +4,7 @@
 
 #include <string>
 
+#include "Helper/Compression.hpp"
 #include "SolverProxy/Bmc/BmcSolverProxy.hpp"
 
 namespace SolverProxy
@@ -14,7 +15,8 @@ namespace Bmc
 class CipExportProxy: public BmcSolverProxy
 {
 public:
-	enum class Compression { None, Gzip, Bzip2, Lzma };
+	// The compression is selected by the file extension if none is set
+	using Compression = CompressionFormat;
 
 	CipExportProxy(void);
 	virtual ~CipExportProxy(void);
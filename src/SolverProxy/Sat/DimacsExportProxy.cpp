@@ -3,9 +3,6 @@
 #ifdef HAS_SAT_SOLVER_DIMACS
 
 #include <boost/iostreams/filtering_streambuf.hpp>
-#include <boost/iostreams/filter/bzip2.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filter/lzma.hpp>
 
 #include <chrono>
 #include <iostream>
@@ -147,22 +144,7 @@ void DimacsExportProxy::Export(void) const
 	LOG_IF(!outfstream.good(), FATAL) << "Could not open file " << filename << " for exporting Max-SAT problem.";
 
 	boost::iostreams::filtering_ostreambuf outfilter;
-	switch(_compression)
-	{
-		case Compression::Bzip2:
-			outfilter.push(boost::iostreams::bzip2_compressor());
-			break;
-		case Compression::Gzip:
-			outfilter.push(boost::iostreams::gzip_compressor());
-			break;
-		case Compression::Lzma:
-			outfilter.push(boost::iostreams::lzma_compressor());
-			break;
-		case Compression::None:
-			break;
-		default:
-			Logging::Panic();
-	}
+	PushCompressor(outfilter, (_compression != Compression::None) ? _compression : GetCompressionFormat(filename));
 	outfilter.push(outfstream);
 	std::ostream out { &outfilter };
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "Helper/Compression.hpp"
 #include "SolverProxy/Sat/SatSolverProxy.hpp"
 #include "SolverProxy/MaxSat/MaxSatSolverProxy.hpp"
 #include "SolverProxy/CountSat/CountSatSolverProxy.hpp"
@@ -21,7 +22,8 @@ class DimacsExportProxy:
 	public virtual CountSatSolverProxy
 {
 public:
-	enum class Compression { None, Gzip, Bzip2, Lzma };
+	// The compression is selected by the file extension if none is set
+	using Compression = CompressionFormat;
 	enum class Format { Dimacs, WDimacsClassic, WDimacs2021 };
 
 	DimacsExportProxy(void);
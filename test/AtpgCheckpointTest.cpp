@@ -0,0 +1,179 @@
+#define BOOST_TEST_MODULE AtpgCheckpoint
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Io/AtpgCheckpoint/AtpgCheckpoint.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Fault;
+using namespace FreiTest::Io;
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( AtpgCheckpointTest )
+
+BOOST_AUTO_TEST_CASE( TestAtpgCheckpoint )
+{
+	auto circuit = BuildOr5CircuitEnvironment();
+	std::string filename { (std::filesystem::temp_directory_path() / "freitest-checkpoint-XXXXXX").string() };
+	const int descriptor { mkstemp(filename.data()) };
+	BOOST_REQUIRE_NE(descriptor, -1);
+	close(descriptor);
+
+	const auto faults { GenerateStuckAtFaultList(*circuit) };
+	const SingleStuckAtFaultList faultList(faults);
+	const SingleStuckAtFaultList reversedFaultList(std::vector<SingleStuckAtFault>(faults.rbegin(), faults.rend()));
+	const uint64_t faultListHash { GetCheckpointFaultListHash(faultList) };
+	BOOST_REQUIRE_GT(faultList.size(), 5u);
+	BOOST_CHECK_EQUAL(faultListHash, GetCheckpointFaultListHash(SingleStuckAtFaultList(faults)));
+	BOOST_CHECK_NE(faultListHash, GetCheckpointFaultListHash(reversedFaultList));
+
+	const CheckpointFault firstFault { 3u, FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE, 0u, 0u, 1u };
+	const CheckpointFault secondFault { 5u, FaultStatus::FAULT_STATUS_UNDETECTED, TargetedFaultStatus::FAULT_STATUS_UNTESTABLE, SIZE_MAX, 0u, 0u };
+	{
+		CheckpointWriter writer { *circuit, filename, faultList.size(), faultListHash };
+		BOOST_REQUIRE(writer.Create());
+		writer.WritePattern(createTestPatternFromString("01XU1/"));
+		writer.WriteFaults({ firstFault });
+		BOOST_REQUIRE(writer.Commit());
+
+		// An interrupted checkpoint without commit
+		writer.WritePattern(createTestPatternFromString("11111/"));
+		writer.WriteFaults({ secondFault });
+	}
+
+	std::optional<Checkpoint> checkpoint;
+	{
+		std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+		checkpoint = ImportCheckpoint(input, *circuit, faultList.size(), faultListHash);
+	}
+	BOOST_REQUIRE(checkpoint.has_value());
+	BOOST_REQUIRE_EQUAL(checkpoint->patterns.size(), 1u);
+	BOOST_CHECK_EQUAL(to_string(checkpoint->patterns[0u]), to_string(createTestPatternFromString("01XU1/")));
+	BOOST_REQUIRE_EQUAL(checkpoint->faults.size(), 1u);
+	BOOST_CHECK_EQUAL(checkpoint->faults[0u].faultIndex, 3u);
+	BOOST_CHECK(checkpoint->faults[0u].status == FaultStatus::FAULT_STATUS_DETECTED);
+	BOOST_CHECK_EQUAL(checkpoint->faults[0u].detectionCount, 1u);
+	BOOST_CHECK_LT(checkpoint->committedSize, std::filesystem::file_size(filename));
+
+	// The fault list has to match the checkpoint
+	{
+		std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+		BOOST_CHECK(!ImportCheckpoint(input, *circuit, faultList.size() + 1u, faultListHash).has_value());
+	}
+	{
+		std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+		BOOST_CHECK(!ImportCheckpoint(input, *circuit, reversedFaultList.size(), GetCheckpointFaultListHash(reversedFaultList)).has_value());
+	}
+
+	// The interrupted checkpoint is replaced when the file is continued
+	{
+		CheckpointWriter writer { *circuit, filename, faultList.size(), faultListHash };
+		BOOST_REQUIRE(writer.Continue(*checkpoint));
+		BOOST_CHECK_EQUAL(writer.GetNumberOfPatterns(), 1u);
+		writer.WritePattern(createTestPatternFromString("0000X/"));
+		writer.WriteFaults({ secondFault });
+		BOOST_REQUIRE(writer.Commit());
+	}
+	{
+		std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+		checkpoint = ImportCheckpoint(input, *circuit, faultList.size(), faultListHash);
+	}
+	BOOST_REQUIRE(checkpoint.has_value());
+	BOOST_REQUIRE_EQUAL(checkpoint->patterns.size(), 2u);
+	BOOST_CHECK_EQUAL(to_string(checkpoint->patterns[1u]), to_string(createTestPatternFromString("0000X/")));
+	BOOST_REQUIRE_EQUAL(checkpoint->faults.size(), 2u);
+	BOOST_CHECK_EQUAL(checkpoint->faults[1u].faultIndex, 5u);
+	BOOST_CHECK(checkpoint->faults[1u].targetedStatus == TargetedFaultStatus::FAULT_STATUS_UNTESTABLE);
+	BOOST_CHECK_EQUAL(checkpoint->committedSize, std::filesystem::file_size(filename));
+
+	std::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_CASE( TestAtpgCheckpointWithConcurrentPatterns )
+{
+	auto circuit = BuildOr5CircuitEnvironment();
+	std::string filename { (std::filesystem::temp_directory_path() / "freitest-checkpoint-XXXXXX").string() };
+	const int descriptor { mkstemp(filename.data()) };
+	BOOST_REQUIRE_NE(descriptor, -1);
+	close(descriptor);
+
+	const SingleStuckAtFaultList faultList(GenerateStuckAtFaultList(*circuit));
+	const uint64_t faultListHash { GetCheckpointFaultListHash(faultList) };
+	auto get_pattern_string = [](size_t index) {
+		std::string pattern { "00000/" };
+		for (size_t input { 0u }; input < 5u; ++input)
+		{
+			pattern[input] = ((index >> input) & 1u) ? '1' : '0';
+		}
+		return pattern;
+	};
+
+	// The checkpoints are written while the patterns are still being added
+	constexpr size_t numberOfPatterns { 2000u };
+	TestPatternList testPatterns;
+	std::thread generator([&]() {
+		for (size_t index { 0u }; index < numberOfPatterns; ++index)
+		{
+			testPatterns.emplace_back(createTestPatternFromString(get_pattern_string(index)));
+		}
+	});
+
+	CheckpointWriter writer { *circuit, filename, faultList.size(), faultListHash };
+	BOOST_REQUIRE(writer.Create());
+	while (writer.GetNumberOfPatterns() < numberOfPatterns)
+	{
+		for (const auto& pattern : testPatterns.copy_range(writer.GetNumberOfPatterns(), SIZE_MAX))
+		{
+			writer.WritePattern(*pattern);
+		}
+		BOOST_REQUIRE(writer.Commit());
+	}
+	generator.join();
+
+	std::optional<Checkpoint> checkpoint;
+	{
+		std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+		checkpoint = ImportCheckpoint(input, *circuit, faultList.size(), faultListHash);
+	}
+	BOOST_REQUIRE(checkpoint.has_value());
+	BOOST_REQUIRE_EQUAL(checkpoint->patterns.size(), numberOfPatterns);
+	for (size_t index { 0u }; index < numberOfPatterns; ++index)
+	{
+		BOOST_CHECK_EQUAL(to_string(checkpoint->patterns[index]), to_string(createTestPatternFromString(get_pattern_string(index))));
+	}
+	BOOST_CHECK(testPatterns.copy_range(numberOfPatterns, SIZE_MAX).empty());
+	BOOST_CHECK_EQUAL(testPatterns.copy_range(10u, 20u).size(), 10u);
+
+	std::filesystem::remove(filename);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
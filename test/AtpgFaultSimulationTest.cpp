@@ -0,0 +1,137 @@
+#define BOOST_TEST_MODULE AtpgFaultSimulation
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Applications/Scale4Edge/TestPatternGeneration/Base/AtpgBase.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Tpg/Vcm/VcmContext.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Application;
+using namespace FreiTest::Application::Mixin;
+using namespace FreiTest::Application::Scale4Edge;
+using namespace FreiTest::Fault;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+/**
+ * @brief Runs the fault simulation of the test pattern generation for the given test patterns.
+ */
+class FaultSimulationApplication:
+	public AtpgBase<SingleStuckAtFaultModel, SingleStuckAtFaultList>
+{
+public:
+	FaultSimulationApplication(size_t detectionLimit):
+		StatisticsMixin(SCALE4EDGE_ATPG_CONFIG),
+		FaultStatisticsMixin<SingleStuckAtFaultList>(SCALE4EDGE_ATPG_CONFIG),
+		SimulationStatisticsMixin(SCALE4EDGE_ATPG_CONFIG),
+		SolverStatisticsMixin(SCALE4EDGE_ATPG_CONFIG),
+		VcdExportMixin<SingleStuckAtFaultList>(SCALE4EDGE_ATPG_CONFIG),
+		VcmMixin(SCALE4EDGE_ATPG_CONFIG),
+		AtpgBase<SingleStuckAtFaultModel, SingleStuckAtFaultList>(SCALE4EDGE_ATPG_CONFIG)
+	{
+		SetCircuit(BuildOr5CircuitEnvironment());
+		BOOST_REQUIRE(SetSetting(SCALE4EDGE_ATPG_CONFIG + "/DetectionLimit", std::to_string(detectionLimit)));
+		Init();
+
+		// The complete fault list without the reductions of the fault list generation
+		faultList = SingleStuckAtFaultList(GenerateStuckAtFaultList(*circuit));
+		faultListBegin = 0u;
+		faultListEnd = faultList.size();
+		ResetStatistics();
+	}
+
+	void Simulate(const std::string& pattern)
+	{
+		const FreiTest::Tpg::Vcm::VcmContext context { "fault_simulation", "Fault Simulation" };
+		const FreiTest::Simulation::SimulationConfig config { FreiTest::Simulation::MakeSimulationConfig(FreiTest::Basic::MakeUnclockedSetResetFlipFlopModel()) };
+		const size_t patternIndex { testPatterns.emplace_back(createTestPatternFromString(pattern)) };
+		RunFaultSimulation(context, std::numeric_limits<size_t>::max(), patternIndex, FreiTest::Pattern::OutputCapture::PrimaryOutputsOnly, config);
+	}
+
+	const SingleStuckAtFaultList& GetFaultList(void) const { return faultList; }
+	const PatternGrade& GetPatternGrade(size_t patternIndex) const { return patternGrades[patternIndex]; }
+	size_t GetNumberOfPatternGrades(void) const { return patternGrades.size(); }
+
+};
+
+BOOST_AUTO_TEST_SUITE( AtpgFaultSimulationTest )
+
+BOOST_AUTO_TEST_CASE( TestDetectionLimit )
+{
+	FaultSimulationApplication application { 2u };
+	const auto& faultList { application.GetFaultList() };
+
+	// The same pattern detects the same faults each time,
+	// but the faults are dropped after the detection limit.
+	for (size_t repetition { 0u }; repetition < 3u; ++repetition)
+	{
+		application.Simulate("10000/");
+	}
+
+	size_t detectedFaults { 0u };
+	for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+	{
+		auto [fault, metaData] = faultList[faultIndex];
+		if (metaData->GetFaultStatus() == FaultStatus::FAULT_STATUS_DETECTED)
+		{
+			detectedFaults++;
+			BOOST_CHECK_EQUAL(metaData->detectionCount.load(), 2u);
+			BOOST_CHECK_EQUAL(metaData->detectingPatternId.load(), 0u);
+		}
+		else
+		{
+			BOOST_CHECK_EQUAL(metaData->detectionCount.load(), 0u);
+		}
+	}
+	BOOST_CHECK_GT(detectedFaults, 0u);
+	BOOST_CHECK_LT(detectedFaults, faultList.size());
+}
+
+BOOST_AUTO_TEST_CASE( TestPatternGrades )
+{
+	FaultSimulationApplication application { 2u };
+
+	application.Simulate("10000/");
+	application.Simulate("10000/");
+	application.Simulate("10000/");
+	application.Simulate("00000/");
+	BOOST_REQUIRE_EQUAL(application.GetNumberOfPatternGrades(), 4u);
+
+	// The first pattern detects the faults for the first time and the second pattern
+	// detects them again. The third pattern doesn't simulate the dropped faults anymore.
+	const auto first { application.GetPatternGrade(0u) };
+	const auto second { application.GetPatternGrade(1u) };
+	const auto third { application.GetPatternGrade(2u) };
+	const auto fourth { application.GetPatternGrade(3u) };
+	BOOST_CHECK_GT(first.newDetections, 0u);
+	BOOST_CHECK_EQUAL(first.detections, first.newDetections);
+	BOOST_CHECK_EQUAL(second.newDetections, 0u);
+	BOOST_CHECK_EQUAL(second.detections, first.detections);
+	BOOST_CHECK_EQUAL(third.newDetections, 0u);
+	BOOST_CHECK_EQUAL(third.detections, 0u);
+
+	// The all-zero pattern detects the stuck-at 1 faults, which are new
+	BOOST_CHECK_GT(fourth.newDetections, 0u);
+	BOOST_CHECK_EQUAL(fourth.detections, fourth.newDetections);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
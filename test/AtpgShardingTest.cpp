@@ -0,0 +1,185 @@
+#define BOOST_TEST_MODULE AtpgSharding
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Applications/Scale4Edge/TestPatternGeneration/Base/ShardingCoordinator.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Io/AtpgSharding/ShardingProtocol.hpp"
+#include "Helper/FaultStatusHelper.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Fault;
+using namespace FreiTest::Io;
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( AtpgShardingTest )
+
+BOOST_AUTO_TEST_CASE( TestShardingProtocol )
+{
+	using namespace FreiTest::Io::Sharding;
+
+	auto circuit = BuildOr5CircuitEnvironment();
+	int descriptors[2];
+	BOOST_REQUIRE_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors), 0);
+	Channel coordinator { descriptors[0] };
+	Channel worker { descriptors[1] };
+
+	BOOST_REQUIRE(worker.Send(MessageType::Hello, EncodeHello(*circuit, 10u)));
+	auto hello = coordinator.Receive();
+	BOOST_REQUIRE(hello.has_value());
+	BOOST_CHECK(hello->type == MessageType::Hello);
+	BOOST_CHECK(ValidateHello(hello->payload, *circuit, 10u));
+	BOOST_CHECK(!ValidateHello(hello->payload, *circuit, 11u));
+
+	BOOST_REQUIRE(coordinator.Send(MessageType::Chunk, EncodeChunk(4u, 8u)));
+	auto chunk = worker.Receive();
+	BOOST_REQUIRE(chunk.has_value());
+	BOOST_CHECK(chunk->type == MessageType::Chunk);
+	BOOST_CHECK(DecodeChunk(chunk->payload) == std::make_optional(std::make_pair<size_t, size_t>(4u, 8u)));
+
+	// Only the patterns after the previous result are sent
+	TestPatternList patterns;
+	patterns.emplace_back(createTestPatternFromString("01XU1/"));
+	patterns.emplace_back(createTestPatternFromString("11111/"));
+	patterns.emplace_back(createTestPatternFromString("0000X/"));
+	const CheckpointFault detected { 5u, FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE, 2u, 0u, 1u };
+	BOOST_REQUIRE(worker.Send(MessageType::Result, EncodeResult(patterns, 1u, 3u, { detected })));
+	auto message = coordinator.Receive();
+	BOOST_REQUIRE(message.has_value());
+	BOOST_CHECK(message->type == MessageType::Result);
+	auto result = DecodeResult(message->payload, circuit->GetMappedCircuit(), 10u);
+	BOOST_REQUIRE(result.has_value());
+	BOOST_REQUIRE_EQUAL(result->patterns.size(), 2u);
+	BOOST_CHECK_EQUAL(to_string(result->patterns[0u]), to_string(*patterns[1u]));
+	BOOST_CHECK_EQUAL(to_string(result->patterns[1u]), to_string(*patterns[2u]));
+	BOOST_REQUIRE_EQUAL(result->faults.size(), 1u);
+	BOOST_CHECK_EQUAL(result->faults[0u].faultIndex, 5u);
+	BOOST_CHECK_EQUAL(result->faults[0u].detectingPatternId, 2u);
+	BOOST_CHECK(!DecodeResult(message->payload, circuit->GetMappedCircuit(), 5u).has_value());
+
+	BOOST_REQUIRE(coordinator.Send(MessageType::Drop, EncodeFaults({ detected })));
+	auto drop = worker.Receive();
+	BOOST_REQUIRE(drop.has_value());
+	auto dropped = DecodeFaults(drop->payload, 10u);
+	BOOST_REQUIRE(dropped.has_value());
+	BOOST_REQUIRE_EQUAL(dropped->size(), 1u);
+	BOOST_CHECK(dropped->at(0u).status == FaultStatus::FAULT_STATUS_DETECTED);
+
+	// A message size above the limit is rejected before the payload is allocated
+	const uint64_t oversized[2] { static_cast<uint64_t>(MessageType::Result), UINT64_MAX };
+	BOOST_REQUIRE_EQUAL(send(descriptors[1], oversized, sizeof(oversized), 0), static_cast<ssize_t>(sizeof(oversized)));
+	BOOST_CHECK(!coordinator.Receive().has_value());
+
+	// The closed channel is reported as missing message
+	BOOST_REQUIRE(coordinator.Send(MessageType::Finish, ""));
+	shutdown(descriptors[0], SHUT_RDWR);
+	auto finish = worker.Receive();
+	BOOST_REQUIRE(finish.has_value());
+	BOOST_CHECK(finish->type == MessageType::Finish);
+	BOOST_CHECK(!worker.Receive().has_value());
+}
+
+BOOST_AUTO_TEST_CASE( TestShardingCoordinator )
+{
+	using namespace FreiTest::Io::Sharding;
+
+	auto circuit = BuildOr5CircuitEnvironment();
+	SingleStuckAtFaultList faultList(GenerateStuckAtFaultList(*circuit));
+	BOOST_REQUIRE(faultList.size() >= 6u);
+
+	FaultStatusApplication application;
+	application.ResetStatistics(faultList.size());
+	TestPatternList testPatterns;
+	testPatterns.emplace_back(createTestPatternFromString("00000/"));
+
+	// Three workers with a 2-detect fault list and three chunks
+	FreiTest::Application::Scale4Edge::ShardingCoordinator<SingleStuckAtFaultList> coordinator(application, faultList, testPatterns, 2u, 3u, 0u, 6u, 2u);
+	BOOST_CHECK_EQUAL(coordinator.GetNumberOfChunks(), 3u);
+	BOOST_CHECK(coordinator.AssignChunk(0u) == std::make_optional(std::make_pair<size_t, size_t>(0u, 2u)));
+	BOOST_CHECK(coordinator.AssignChunk(1u) == std::make_optional(std::make_pair<size_t, size_t>(2u, 4u)));
+	BOOST_CHECK(coordinator.AssignChunk(2u) == std::make_optional(std::make_pair<size_t, size_t>(4u, 6u)));
+	BOOST_CHECK(!coordinator.HasChunks());
+
+	// The chunk of the failed worker is handed out again
+	coordinator.FailWorker(1u);
+	BOOST_CHECK(coordinator.HasChunks());
+
+	Result first {
+		{ createTestPatternFromString("10000/"), createTestPatternFromString("01000/") },
+		{
+			{ 0u, FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE, 1u, 0u, 1u },
+			{ 1u, FaultStatus::FAULT_STATUS_UNDETECTED, TargetedFaultStatus::FAULT_STATUS_UNTESTABLE, SIZE_MAX, 0u, 0u }
+		}
+	};
+	auto dropped = coordinator.MergeResult(0u, first);
+	BOOST_REQUIRE_EQUAL(dropped.size(), 1u);
+	BOOST_CHECK_EQUAL(dropped[0u].faultIndex, 1u);
+	BOOST_CHECK(coordinator.AssignChunk(0u) == std::make_optional(std::make_pair<size_t, size_t>(2u, 4u)));
+	BOOST_CHECK(!coordinator.HasChunks());
+	BOOST_CHECK(!coordinator.AssignChunk(2u).has_value());
+
+	// The pattern indices of each worker start at zero
+	Result second {
+		{ createTestPatternFromString("00100/") },
+		{ { 4u, FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE, 0u, 0u, 1u } }
+	};
+	dropped = coordinator.MergeResult(2u, second);
+	BOOST_CHECK(dropped.empty());
+
+	// The second detection of fault 0 keeps the first detecting pattern and reaches the detection limit
+	Result third {
+		{ createTestPatternFromString("00010/") },
+		{
+			{ 0u, FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE, 2u, 0u, 1u },
+			{ 3u, FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE, 2u, 0u, 1u }
+		}
+	};
+	dropped = coordinator.MergeResult(0u, third);
+	BOOST_REQUIRE_EQUAL(dropped.size(), 1u);
+	BOOST_CHECK_EQUAL(dropped[0u].faultIndex, 0u);
+	BOOST_CHECK_EQUAL(dropped[0u].detectionCount, 2u);
+
+	BOOST_REQUIRE_EQUAL(testPatterns.size(), 5u);
+	BOOST_CHECK_EQUAL(to_string(*testPatterns[3u]), to_string(createTestPatternFromString("00100/")));
+	BOOST_CHECK_EQUAL(to_string(*testPatterns[4u]), to_string(createTestPatternFromString("00010/")));
+
+	auto get_meta_data = [&](size_t faultIndex) { return std::get<1>(faultList[faultIndex]); };
+	BOOST_CHECK_EQUAL(get_meta_data(0u)->detectingPatternId.load(), 2u);
+	BOOST_CHECK_EQUAL(get_meta_data(0u)->detectionCount.load(), 2u);
+	BOOST_CHECK(get_meta_data(1u)->GetFaultStatus() == FaultStatus::FAULT_STATUS_UNDETECTED);
+	BOOST_CHECK_EQUAL(get_meta_data(3u)->detectingPatternId.load(), 4u);
+	BOOST_CHECK_EQUAL(get_meta_data(4u)->detectingPatternId.load(), 3u);
+	BOOST_CHECK_EQUAL(get_meta_data(4u)->detectionCount.load(), 1u);
+
+	// A restarted worker skips the classified faults
+	const auto classified { coordinator.GetClassifiedFaults() };
+	BOOST_REQUIRE_EQUAL(classified.size(), 2u);
+	BOOST_CHECK_EQUAL(classified[0u].faultIndex, 0u);
+	BOOST_CHECK_EQUAL(classified[1u].faultIndex, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
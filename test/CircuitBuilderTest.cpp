@@ -4,10 +4,16 @@
 
 #include <boost/test/included/unit_test.hpp>
 
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
 #include <string>
 #include <iostream>
+#include <sstream>
 #include <tuple>
 
+#include "Basic/Container/StringPool.hpp"
 #include "Basic/Logging.hpp"
 #include "Basic/Settings.hpp"
 #include "Circuit/CellLibrary.hpp"
@@ -15,6 +21,7 @@
 #include "Circuit/CircuitBuilder.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Circuit/UnmappedCircuit.hpp"
+#include "Io/CircuitSnapshot/CircuitSnapshot.hpp"
 
 using namespace FreiTest::Circuit;
 
@@ -249,4 +256,134 @@ BOOST_AUTO_TEST_CASE( TestWithComplexCircuit )
 	BOOST_CHECK_EQUAL(mappedCircuit.GetNode(7u)->GetInput(0u), mappedCircuit.GetNode(6u));
 }
 
+BOOST_AUTO_TEST_CASE( TestSnapshotRoundTrip )
+{
+	Builder::CircuitBuilder builder;
+	builder.SetName("snapshot");
+
+	auto inputNodeId = builder.EmplaceMappedNode("input", CellCategory::MAIN_IN, CellType::P_IN, 0);
+	auto inverterNodeId = builder.EmplaceMappedNode("inverter", CellCategory::MAIN_INV, CellType::INV, 1);
+	auto outputNodeId = builder.EmplaceMappedNode("output", CellCategory::MAIN_OUT, CellType::P_OUT, 1);
+	builder.GetMappedNode(inputNodeId).AddSuccessorNode(inverterNodeId);
+	builder.GetMappedNode(inverterNodeId).SetInputNode(0u, inputNodeId);
+	builder.GetMappedNode(inverterNodeId).AddSuccessorNode(outputNodeId);
+	builder.GetMappedNode(outputNodeId).SetInputNode(0u, inverterNodeId);
+	builder.AddMappedPrimaryInput(inputNodeId);
+	builder.AddMappedPrimaryOutput(outputNodeId);
+	builder.EmplaceConnection();
+	builder.EmplaceConnection();
+
+	SourceInformation sourceInfo { "file.v", "1:1", "top", "module" };
+	sourceInfo.AddProperty<std::string>("module-name", "top");
+	sourceInfo.AddProperty<bool>("module-is-cell", false);
+	sourceInfo.AddProperty<size_t>("port-size", 4u);
+	builder.AddSourceInfo(sourceInfo);
+
+	std::ostringstream output;
+	BOOST_REQUIRE(builder.ExportSnapshot(output, "key"));
+	const std::string snapshot { output.str() };
+
+	// A snapshot of different sources or a truncated snapshot is rejected
+	Builder::CircuitBuilder otherSources;
+	BOOST_CHECK(!otherSources.ImportSnapshot(snapshot.data(), snapshot.size(), "other-key"));
+	Builder::CircuitBuilder truncated;
+	BOOST_CHECK(!truncated.ImportSnapshot(snapshot.data(), snapshot.size() - 8u, "key"));
+
+	Builder::CircuitBuilder restored;
+	BOOST_REQUIRE(restored.ImportSnapshot(snapshot.data(), snapshot.size(), "key"));
+	BOOST_CHECK_EQUAL(restored.GetName(), "snapshot");
+	BOOST_CHECK_EQUAL(restored.GetSourceInfo(0u).sourceFile, "file.v");
+	BOOST_CHECK_EQUAL(restored.GetSourceInfo(0u).GetProperty<std::string>("module-name").value_or(""), "top");
+	BOOST_CHECK_EQUAL(restored.GetSourceInfo(0u).GetProperty<bool>("module-is-cell").value_or(true), false);
+	BOOST_CHECK_EQUAL(restored.GetSourceInfo(0u).GetProperty<size_t>("port-size").value_or(0u), 4u);
+
+	Builder::BuildConfiguration config;
+	auto circuitEnvironment = std::shared_ptr<CircuitEnvironment>(restored.BuildCircuitEnvironment(config));
+	auto& mappedCircuit = circuitEnvironment->GetMappedCircuit();
+
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNumberOfNodes(), 3u);
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNumberOfInputs(), 1u);
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNumberOfOutputs(), 1u);
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNode(1u)->GetName(), "inverter");
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNode(1u)->GetCellType(), CellType::INV);
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNode(1u)->GetInput(0u), mappedCircuit.GetNode(0u));
+	BOOST_CHECK_EQUAL(mappedCircuit.GetNode(1u)->GetSuccessor(0u), mappedCircuit.GetNode(2u));
+}
+
+BOOST_AUTO_TEST_CASE( TestSnapshotWithInvalidNodeId )
+{
+	Builder::CircuitBuilder builder;
+	auto inputNodeId = builder.EmplaceMappedNode("input", CellCategory::MAIN_IN, CellType::P_IN, 0);
+	auto outputNodeId = builder.EmplaceMappedNode("output", CellCategory::MAIN_OUT, CellType::P_OUT, 1);
+	builder.GetMappedNode(inputNodeId).AddSuccessorNode(outputNodeId);
+	builder.GetMappedNode(outputNodeId).SetInputNode(0u, inputNodeId);
+
+	// The successor references a node that does not exist
+	builder.GetMappedNode(outputNodeId).AddSuccessorNode(5u);
+
+	std::ostringstream output;
+	BOOST_REQUIRE(builder.ExportSnapshot(output, "key"));
+	const std::string snapshot { output.str() };
+
+	Builder::CircuitBuilder restored;
+	BOOST_CHECK(!restored.ImportSnapshot(snapshot.data(), snapshot.size(), "key"));
+}
+
+BOOST_AUTO_TEST_CASE( TestSnapshotWithChangedIncludedFile )
+{
+	const auto directory { std::filesystem::temp_directory_path() / ("CircuitBuilderTest." + std::to_string(::getpid())) };
+	std::filesystem::create_directories(directory);
+	const std::string includeFilename { (directory / "include.v").string() };
+	const std::string snapshotFilename { (directory / "circuit.snapshot").string() };
+	std::ofstream(includeFilename) << "`define INCLUDED\n";
+
+	Builder::CircuitBuilder builder;
+	builder.SetName("snapshot");
+	builder.EmplaceMappedNode("input", CellCategory::MAIN_IN, CellType::P_IN, 0);
+	BOOST_REQUIRE(FreiTest::Io::ExportCircuitSnapshot(builder, "key", { includeFilename }, snapshotFilename));
+	BOOST_CHECK(FreiTest::Io::ImportCircuitSnapshot(snapshotFilename, "key"));
+	BOOST_CHECK(!FreiTest::Io::ImportCircuitSnapshot(snapshotFilename, "other-key"));
+
+	// The snapshot is rejected after the included file has changed
+	std::ofstream(includeFilename, std::ios::app) << "`define CHANGED\n";
+	BOOST_CHECK(!FreiTest::Io::ImportCircuitSnapshot(snapshotFilename, "key"));
+	BOOST_CHECK(FreiTest::Io::ImportCircuitSnapshot(snapshotFilename, ""));
+
+	std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE( TestStringPoolIdentity )
+{
+	FreiTest::Basic::Container::StringPool pool;
+
+	// Equal strings are stored once and return a reference to the same string
+	const std::string longName { "top/core/alu/adder_0/full_adder_17/carry" };
+	const auto first { pool.Intern(std::string_view(longName)) };
+	const auto second { pool.Intern(std::string(longName)) };
+	const auto third { pool.Intern(longName.c_str()) };
+	BOOST_CHECK_EQUAL(&first.Get(), &second.Get());
+	BOOST_CHECK_EQUAL(&first.Get(), &third.Get());
+	BOOST_CHECK_EQUAL(first.Get(), longName);
+
+	const auto shortName { pool.Intern("A") };
+	BOOST_CHECK_NE(&shortName.Get(), &first.Get());
+	BOOST_CHECK(shortName != first);
+	BOOST_CHECK(shortName == "A");
+
+	// The references stay valid while more strings are added
+	const std::string* address { &first.Get() };
+	for (size_t index { 0u }; index < 10000u; ++index)
+	{
+		pool.Intern("net_" + std::to_string(index));
+	}
+	BOOST_CHECK_EQUAL(&pool.Intern(std::string_view(longName)).Get(), address);
+	BOOST_CHECK_EQUAL(*address, longName);
+
+	BOOST_CHECK_EQUAL(pool.GetNumberOfStrings(), 10002u);
+
+	// A default interned string is empty
+	const FreiTest::Basic::Container::InternedString empty;
+	BOOST_CHECK(empty == "");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
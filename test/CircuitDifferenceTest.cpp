@@ -0,0 +1,209 @@
+#define BOOST_TEST_MODULE CircuitDifference
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Circuit/CircuitBuilder.hpp"
+#include "Circuit/CircuitDifference.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+// out0 = GATE(in0, in1), out1 = BUF(in1)
+static std::unique_ptr<CircuitEnvironment> BuildTwoGateCircuit(CellCategory category, CellType type)
+{
+	Builder::CircuitBuilder builder;
+	builder.SetName("difference");
+
+	auto in0 = builder.EmplaceMappedNode("in0", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto in1 = builder.EmplaceMappedNode("in1", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto gate = builder.EmplaceMappedNode("gate", category, type, 2u);
+	auto buffer = builder.EmplaceMappedNode("buf", CellCategory::MAIN_BUF, CellType::BUF, 1u);
+	auto out0 = builder.EmplaceMappedNode("out0", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	auto out1 = builder.EmplaceMappedNode("out1", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	builder.AddMappedPrimaryInput(in0);
+	builder.AddMappedPrimaryInput(in1);
+	builder.AddMappedPrimaryOutput(out0);
+	builder.AddMappedPrimaryOutput(out1);
+
+	ConnectMappedNodes(builder, in0, gate, 0u, "in0");
+	ConnectMappedNodes(builder, in1, gate, 1u, "in1");
+	ConnectMappedNodes(builder, gate, out0, 0u, "out0");
+	ConnectMappedNodes(builder, in1, buffer, 0u, "in1");
+	ConnectMappedNodes(builder, buffer, out1, 0u, "out1");
+
+	Builder::BuildConfiguration config;
+	return builder.BuildCircuitEnvironment(config);
+}
+
+// ff0 = DFF(in0), out0 = GATE(ff0, in1), ff1 = DFF(out0), out1 = BUF(ff1)
+static std::unique_ptr<CircuitEnvironment> BuildSequentialGateCircuit(CellCategory category, CellType type)
+{
+	Builder::CircuitBuilder builder;
+	builder.SetName("sequential-difference");
+
+	auto in0 = builder.EmplaceMappedNode("in0", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto in1 = builder.EmplaceMappedNode("in1", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto gate = builder.EmplaceMappedNode("gate", category, type, 2u);
+	auto buffer = builder.EmplaceMappedNode("buf", CellCategory::MAIN_BUF, CellType::BUF, 1u);
+	auto out0 = builder.EmplaceMappedNode("out0", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	auto out1 = builder.EmplaceMappedNode("out1", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	builder.AddMappedPrimaryInput(in0);
+	builder.AddMappedPrimaryInput(in1);
+	builder.AddMappedPrimaryOutput(out0);
+	builder.AddMappedPrimaryOutput(out1);
+
+	// The set, reset and clock inputs of the flip-flops are tied to a constant
+	auto add_flip_flop = [&](const std::string& name) {
+		auto secondaryInput = builder.EmplaceMappedNode(name + "/q", CellCategory::MAIN_IN, CellType::S_IN, 0u);
+		auto secondaryOutput = builder.EmplaceMappedNode(name + "/d", CellCategory::MAIN_OUT, CellType::S_OUT, 4u);
+		auto zero = builder.EmplaceMappedNode(name + "/zero", CellCategory::MAIN_CONSTANT, CellType::PRESET_0, 0u);
+		builder.AddSecondaryInput(secondaryInput);
+		builder.AddSecondaryOutput(secondaryOutput);
+		builder.LinkSecondaryPorts(secondaryInput, secondaryOutput);
+
+		auto connectionId = builder.EmplaceConnection();
+		auto& zeroNode = builder.GetMappedNode(zero);
+		zeroNode.SetOutputConnectionId(connectionId);
+		zeroNode.SetOutputConnectionName(name + "/zero");
+		zeroNode.SetOutputPortName("out");
+		zeroNode.AddSuccessorNode(secondaryOutput);
+		auto& secondaryOutputNode = builder.GetMappedNode(secondaryOutput);
+		for (size_t input { 1u }; input < 4u; ++input)
+		{
+			secondaryOutputNode.SetInputConnectionId(input, connectionId);
+			secondaryOutputNode.SetInputConnectionName(input, name + "/zero");
+			secondaryOutputNode.SetInputPortName(input, "in" + std::to_string(input));
+			secondaryOutputNode.SetInputNode(input, zero);
+		}
+		return std::make_pair(secondaryInput, secondaryOutput);
+	};
+	auto [ff0In, ff0Out] = add_flip_flop("ff0");
+	auto [ff1In, ff1Out] = add_flip_flop("ff1");
+
+	ConnectMappedNodes(builder, in0, ff0Out, 0u, "in0");
+	ConnectMappedNodes(builder, ff0In, gate, 0u, "ff0");
+	ConnectMappedNodes(builder, in1, gate, 1u, "in1");
+	ConnectMappedNodes(builder, gate, out0, 0u, "out0");
+	ConnectMappedNodes(builder, gate, ff1Out, 0u, "out0");
+	ConnectMappedNodes(builder, ff1In, buffer, 0u, "ff1");
+	ConnectMappedNodes(builder, buffer, out1, 0u, "out1");
+
+	Builder::BuildConfiguration config;
+	return builder.BuildCircuitEnvironment(config);
+}
+
+// out0 = GATE(in1, loop), out1 = loop = AND(gate, in0)
+static std::unique_ptr<CircuitEnvironment> BuildLoopGateCircuit(CellCategory category, CellType type)
+{
+	Builder::CircuitBuilder builder;
+	builder.SetName("loop-difference");
+
+	auto in0 = builder.EmplaceMappedNode("in0", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto in1 = builder.EmplaceMappedNode("in1", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto gate = builder.EmplaceMappedNode("gate", category, type, 2u);
+	auto loop = builder.EmplaceMappedNode("loop", CellCategory::MAIN_AND, CellType::AND, 2u);
+	auto out0 = builder.EmplaceMappedNode("out0", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	auto out1 = builder.EmplaceMappedNode("out1", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	builder.AddMappedPrimaryInput(in0);
+	builder.AddMappedPrimaryInput(in1);
+	builder.AddMappedPrimaryOutput(out0);
+	builder.AddMappedPrimaryOutput(out1);
+
+	ConnectMappedNodes(builder, in1, gate, 0u, "in1");
+	ConnectMappedNodes(builder, loop, gate, 1u, "loop");
+	ConnectMappedNodes(builder, gate, loop, 0u, "gate");
+	ConnectMappedNodes(builder, in0, loop, 1u, "in0");
+	ConnectMappedNodes(builder, gate, out0, 0u, "gate");
+	ConnectMappedNodes(builder, loop, out1, 0u, "loop");
+
+	Builder::BuildConfiguration config;
+	return builder.BuildCircuitEnvironment(config);
+}
+
+BOOST_AUTO_TEST_SUITE( CircuitDifferenceTest )
+
+BOOST_AUTO_TEST_CASE( TestCircuitDifference )
+{
+	auto previous = BuildTwoGateCircuit(CellCategory::MAIN_AND, CellType::AND);
+	auto current = BuildTwoGateCircuit(CellCategory::MAIN_OR, CellType::OR);
+	const auto& mappedCircuit { current->GetMappedCircuit() };
+
+	const CircuitDifference unchanged { previous->GetMappedCircuit(), previous->GetMappedCircuit() };
+	BOOST_CHECK_EQUAL(unchanged.GetNumberOfChangedNodes(), 0u);
+	BOOST_CHECK_EQUAL(unchanged.GetNumberOfAffectedNodes(), 0u);
+
+	// The gate is replaced, which changes the value at out0 only.
+	// The faults at the inputs of the gate are affected, the buffer path is not.
+	const CircuitDifference difference { previous->GetMappedCircuit(), mappedCircuit };
+	BOOST_CHECK_EQUAL(difference.GetNumberOfChangedNodes(), 1u);
+	BOOST_CHECK_EQUAL(difference.GetNumberOfRemovedNodes(), 0u);
+	for (auto [nodeId, node] : mappedCircuit.EnumerateNodes())
+	{
+		const bool inGateCone { node->GetName() == "gate" || node->GetName() == "out0"
+			|| node->GetName() == "in0" || node->GetName() == "in1" };
+		BOOST_CHECK_MESSAGE(difference.IsChanged(node) == (node->GetName() == "gate"), "Node " << node->GetName());
+		BOOST_CHECK_MESSAGE(difference.IsAffected(node) == inGateCone, "Node " << node->GetName());
+	}
+}
+
+BOOST_AUTO_TEST_CASE( TestCircuitDifferenceOverTimeframes )
+{
+	auto previous = BuildSequentialGateCircuit(CellCategory::MAIN_AND, CellType::AND);
+	auto current = BuildSequentialGateCircuit(CellCategory::MAIN_OR, CellType::OR);
+	const auto& mappedCircuit { current->GetMappedCircuit() };
+
+	// With a single timeframe the flip-flops cut the cones of the gate
+	const CircuitDifference singleTimeframe { previous->GetMappedCircuit(), mappedCircuit, 1u };
+	BOOST_CHECK_EQUAL(singleTimeframe.GetNumberOfChangedNodes(), 1u);
+	for (auto [nodeId, node] : mappedCircuit.EnumerateNodes())
+	{
+		const bool inGateCone { node->GetName() == "gate" || node->GetName() == "out0" || node->GetName() == "in1"
+			|| node->GetName() == "ff0/q" || node->GetName() == "ff1/d" || node->GetName() == "ff1/zero" };
+		BOOST_CHECK_MESSAGE(singleTimeframe.IsAffected(node) == inGateCone, "Node " << node->GetName());
+	}
+
+	// With two timeframes the different value captured by ff1 reaches out1 and
+	// the fault effects captured by ff0 reach the gate in the next timeframe
+	const CircuitDifference multipleTimeframes { previous->GetMappedCircuit(), mappedCircuit, 2u };
+	BOOST_CHECK_EQUAL(multipleTimeframes.GetNumberOfChangedNodes(), 1u);
+	BOOST_CHECK_EQUAL(multipleTimeframes.GetNumberOfAffectedNodes(), mappedCircuit.GetNumberOfNodes());
+}
+
+BOOST_AUTO_TEST_CASE( TestCircuitDifferenceWithLoop )
+{
+	auto previous = BuildLoopGateCircuit(CellCategory::MAIN_AND, CellType::AND);
+	auto current = BuildLoopGateCircuit(CellCategory::MAIN_OR, CellType::OR);
+	const auto& mappedCircuit { current->GetMappedCircuit() };
+
+	// The gate has a larger node id than its successor in the loop.
+	// The different value still has to reach out1 through the loop and all nodes are affected.
+	const CircuitDifference difference { previous->GetMappedCircuit(), mappedCircuit };
+	BOOST_CHECK_EQUAL(difference.GetNumberOfChangedNodes(), 1u);
+	for (auto [nodeId, node] : mappedCircuit.EnumerateNodes())
+	{
+		// The unconnected constant of the cycle breaking is the only unaffected node
+		const bool isConstant { node->GetCellCategory() == CellCategory::MAIN_CONSTANT };
+		BOOST_CHECK_MESSAGE(difference.IsChanged(node) == (node->GetName() == "gate"), "Node " << node->GetName());
+		BOOST_CHECK_MESSAGE(difference.IsAffected(node) != isConstant, "Node " << node->GetName());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
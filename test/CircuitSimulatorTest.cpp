@@ -8,6 +8,7 @@
 #include <string>
 #include <iostream>
 #include <tuple>
+#include <vector>
 
 #include "Basic/Logging.hpp"
 #include "Basic/Logic.hpp"
@@ -16,6 +17,7 @@
 #include "Basic/Fault/Models/FaultFreeModel.hpp"
 #include "Circuit/CircuitBuilder.hpp"
 #include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/SwitchingActivity.hpp"
 
 using namespace FreiTest::Basic;
 using namespace FreiTest::Circuit;
@@ -287,4 +289,98 @@ BOOST_AUTO_TEST_CASE( TestSequentialGates )
 	}
 }
 
+BOOST_AUTO_TEST_CASE( TestWeightedShiftTransitions )
+{
+	// Position 0 is at the scan input, the transition between the positions 2 and 3
+	// passes 3 flip-flops while shifting in and 2 flip-flops while shifting out.
+	const auto values { GetLogicValuesForString("00011") };
+	BOOST_CHECK_EQUAL(GetWeightedShiftInTransitions(values), 3u);
+	BOOST_CHECK_EQUAL(GetWeightedShiftOutTransitions(values), 2u);
+
+	const auto alternating { GetLogicValuesForString("0101") };
+	BOOST_CHECK_EQUAL(GetWeightedShiftInTransitions(alternating), 1u + 2u + 3u);
+	BOOST_CHECK_EQUAL(GetWeightedShiftOutTransitions(alternating), 3u + 2u + 1u);
+
+	// Don't care values repeat the previous value
+	const auto dontCare { GetLogicValuesForString("XX0XX1X") };
+	BOOST_CHECK_EQUAL(GetWeightedShiftInTransitions(dontCare), 5u);
+	BOOST_CHECK_EQUAL(GetWeightedShiftOutTransitions(dontCare), 2u);
+	BOOST_CHECK_EQUAL(GetWeightedShiftInTransitions(GetLogicValuesForString("XXXX")), 0u);
+}
+
+
+BOOST_AUTO_TEST_CASE( TestSwitchingActivityOverTimeframes )
+{
+	// A shift register with one flip-flop: input -> flip-flop -> buffer -> output
+	Builder::CircuitBuilder builder;
+	builder.SetName("shift");
+
+	auto inputId = builder.EmplaceMappedNode("input", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto constantId = builder.EmplaceMappedNode("zero", CellCategory::MAIN_CONSTANT, CellType::PRESET_0, 0u);
+	auto secondaryInputId = builder.EmplaceMappedNode("secondary-input", CellCategory::MAIN_IN, CellType::S_IN, 0u);
+	auto secondaryOutputId = builder.EmplaceMappedNode("secondary-output", CellCategory::MAIN_OUT, CellType::S_OUT, 4u);
+	auto bufferId = builder.EmplaceMappedNode("buffer", CellCategory::MAIN_BUF, CellType::BUF, 1u);
+	auto outputId = builder.EmplaceMappedNode("output", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+
+	const auto connect = [&](Builder::MappedNodeId sourceId, Builder::MappedNodeId targetId, std::vector<size_t> ports, std::string name) {
+		auto connectionId = builder.EmplaceConnection();
+		auto& source = builder.GetMappedNode(sourceId);
+		source.SetOutputConnectionId(connectionId);
+		source.SetOutputConnectionName(name);
+		source.SetOutputPortName("out");
+		source.AddSuccessorNode(targetId);
+		auto& target = builder.GetMappedNode(targetId);
+		for (auto port : ports)
+		{
+			target.SetInputConnectionId(port, connectionId);
+			target.SetInputConnectionName(port, name);
+			target.SetInputPortName(port, "in" + std::to_string(port));
+			target.SetInputNode(port, sourceId);
+		}
+	};
+	connect(inputId, secondaryOutputId, { 0u }, "input");
+	connect(constantId, secondaryOutputId, { 1u, 2u, 3u }, "zero");
+	connect(secondaryInputId, bufferId, { 0u }, "state");
+	connect(bufferId, outputId, { 0u }, "output");
+
+	builder.AddMappedPrimaryInput(inputId);
+	builder.AddMappedPrimaryOutput(outputId);
+	builder.AddSecondaryInput(secondaryInputId);
+	builder.AddSecondaryOutput(secondaryOutputId);
+	builder.LinkSecondaryPorts(secondaryInputId, secondaryOutputId);
+
+	Builder::BuildConfiguration buildConfig;
+	auto env = builder.BuildCircuitEnvironment(buildConfig);
+	const auto& mappedCircuit { env->GetMappedCircuit() };
+
+	// The flip-flop captures 0 -> 1 in timeframe 0 and 1 -> 0 in timeframe 1
+	TestPattern pattern(3u, 1u, 1u);
+	pattern.SetPrimaryInput(0u, 0u, Logic::LOGIC_ONE);
+	pattern.SetPrimaryInput(1u, 0u, Logic::LOGIC_ZERO);
+	pattern.SetPrimaryInput(2u, 0u, Logic::LOGIC_ZERO);
+	pattern.SetSecondaryInput(0u, 0u, Logic::LOGIC_ZERO);
+
+	// The flip-flop toggles are counted once (weight 2 each) and not again when the
+	// captured value is launched into the next timeframe. The other toggles between the timeframes:
+	// input 1 -> 0 (weight 2), D-input 1 -> 0 (weight 1), buffer 0 -> 1 -> 0 (weight 2) and output 0 -> 1 -> 0 (weight 1).
+	const size_t expectedCapture { 2u * 2u + 2u + 1u + 2u * 2u + 2u * 1u };
+
+	SimulationConfig config { MakeSimulationConfig(MakeUnclockedSetResetFlipFlopModel()) };
+	const auto functional { GetSwitchingActivity(mappedCircuit, pattern, config) };
+	BOOST_CHECK_EQUAL(functional.capture, expectedCapture);
+	BOOST_CHECK_EQUAL(functional.shiftIn, 0u);
+	BOOST_CHECK_EQUAL(functional.shiftOut, 0u);
+
+	// A full-scan pattern with the same state sequence has the same activity
+	pattern.SetSecondaryInput(1u, 0u, Logic::LOGIC_ONE);
+	pattern.SetSecondaryInput(2u, 0u, Logic::LOGIC_ZERO);
+	config.sequentialMode = SequentialMode::FullScan;
+	BOOST_CHECK_EQUAL(GetSwitchingActivity(mappedCircuit, pattern, config).capture, expectedCapture);
+
+	// Overwriting the captured state with 1 in timeframe 2 toggles the flip-flop at the launch
+	// and at the capture (weight 2 each) while the buffer and the output keep their value
+	pattern.SetSecondaryInput(2u, 0u, Logic::LOGIC_ONE);
+	BOOST_CHECK_EQUAL(GetSwitchingActivity(mappedCircuit, pattern, config).capture, expectedCapture + 2u * 2u - 2u - 1u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
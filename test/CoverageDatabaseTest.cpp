@@ -0,0 +1,61 @@
+#define BOOST_TEST_MODULE CoverageDatabase
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <memory>
+#include <sstream>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Io/FaultCoverage/CoverageDatabase.hpp"
+
+using namespace FreiTest::Fault;
+using namespace FreiTest::Io::FaultCoverage;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( CoverageDatabaseTest )
+
+BOOST_AUTO_TEST_CASE( TestCoverageDatabaseRoundTrip )
+{
+	CoverageDatabase database { 12u };
+	database.AddFault({ "top/u1/A", "StuckAt0" }, { FaultStatus::FAULT_STATUS_DETECTED, 3u, 2u });
+	database.AddFault({ "top/u1/A", "StuckAt1" }, { FaultStatus::FAULT_STATUS_UNDETECTED, 0u, 0u });
+	database.AddFault({ "top/u2/Z", "StuckAt0" }, { FaultStatus::FAULT_STATUS_DETECTED, 7u, 1u });
+	// Faults that can't be told apart are removed
+	database.AddFault({ "top/u3/Z", "StuckAt1" }, { FaultStatus::FAULT_STATUS_DETECTED, 1u, 1u });
+	database.AddFault({ "top/u3/Z", "StuckAt1" }, { FaultStatus::FAULT_STATUS_DETECTED, 2u, 1u });
+	database.AddFault({ "top/u3/Z", "StuckAt1" }, { FaultStatus::FAULT_STATUS_DETECTED, 4u, 1u });
+	BOOST_CHECK_EQUAL(database.GetNumberOfFaults(), 3u);
+	BOOST_CHECK(!database.GetFault({ "top/u3/Z", "StuckAt1" }).has_value());
+
+	std::stringstream stream;
+	BOOST_REQUIRE(ExportCoverageDatabase(stream, database));
+	const auto imported { ImportCoverageDatabase(stream) };
+	BOOST_REQUIRE(imported.has_value());
+	BOOST_CHECK_EQUAL(imported->GetNumberOfPatterns(), 12u);
+	BOOST_CHECK_EQUAL(imported->GetNumberOfFaults(), 3u);
+
+	const auto record { imported->GetFault({ "top/u2/Z", "StuckAt0" }) };
+	BOOST_REQUIRE(record.has_value());
+	BOOST_CHECK(record->status == FaultStatus::FAULT_STATUS_DETECTED);
+	BOOST_CHECK_EQUAL(record->detectingPatternId, 7u);
+	BOOST_CHECK_EQUAL(record->detectionCount, 1u);
+	BOOST_CHECK(imported->GetFault({ "top/u1/A", "StuckAt1" })->status == FaultStatus::FAULT_STATUS_UNDETECTED);
+	BOOST_CHECK(!imported->GetFault({ "top/u9/A", "StuckAt1" }).has_value());
+
+	// A truncated database is rejected
+	std::stringstream truncated { stream.str().substr(0u, stream.str().size() - 4u) };
+	BOOST_CHECK(!ImportCoverageDatabase(truncated).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
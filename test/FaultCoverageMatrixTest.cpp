@@ -0,0 +1,190 @@
+#define BOOST_TEST_MODULE FaultCoverageMatrix
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/FaultCoverageMatrix.hpp"
+
+using namespace FreiTest;
+using namespace FreiTest::Fault;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+using Detections = std::vector<std::vector<FaultCoverageMatrix::index_type>>;
+
+// Returns the size of the smallest pattern set that covers all detected faults.
+static size_t GetMinimumCoverSize(const FaultCoverageMatrix& matrix)
+{
+	size_t minimum { matrix.GetNumberOfPatterns() };
+	for (size_t selection { 0u }; selection < (1u << matrix.GetNumberOfPatterns()); ++selection)
+	{
+		std::vector<bool> covered(matrix.GetNumberOfFaults(), false);
+		for (size_t pattern { 0u }; pattern < matrix.GetNumberOfPatterns(); ++pattern)
+		{
+			if ((selection >> pattern) & 1u)
+			{
+				for (const auto fault : matrix.GetDetectedFaults(pattern)) covered[fault] = true;
+			}
+		}
+
+		bool complete { true };
+		for (size_t fault { 0u }; fault < matrix.GetNumberOfFaults(); ++fault)
+		{
+			complete &= covered[fault] || matrix.GetDetectingPatterns(fault).empty();
+		}
+		if (complete)
+		{
+			minimum = std::min<size_t>(minimum, __builtin_popcount(selection));
+		}
+	}
+	return minimum;
+}
+
+BOOST_AUTO_TEST_SUITE( FaultCoverageMatrixTest )
+
+BOOST_AUTO_TEST_CASE( TransposedCoverage )
+{
+	FaultCoverageMatrix matrix { 5u, Detections { { 0u, 2u }, { }, { 1u, 2u, 4u } } };
+
+	BOOST_CHECK_EQUAL(matrix.GetNumberOfPatterns(), 3u);
+	BOOST_CHECK_EQUAL(matrix.GetNumberOfFaults(), 5u);
+	BOOST_CHECK_EQUAL(matrix.GetNumberOfDetections(), 5u);
+
+	const auto patterns { matrix.GetDetectingPatterns(2u) };
+	const std::vector<FaultCoverageMatrix::index_type> expected { 0u, 2u };
+	BOOST_CHECK_EQUAL_COLLECTIONS(patterns.begin(), patterns.end(), expected.begin(), expected.end());
+	BOOST_CHECK(matrix.GetDetectingPatterns(3u).empty());
+	BOOST_CHECK(matrix.GetDetectedFaults(1u).empty());
+	BOOST_CHECK(matrix.IsDetected(2u, 4u));
+	BOOST_CHECK(!matrix.IsDetected(0u, 4u));
+}
+
+BOOST_AUTO_TEST_CASE( EssentialAndDominatedPatterns )
+{
+	// Fault 0 is only detected by pattern 0 (essential) which covers fault 1 too.
+	// Pattern 3 detects a subset of the faults of pattern 2 and is dominated.
+	FaultCoverageMatrix matrix { 4u, Detections { { 0u, 1u }, { 1u, 2u }, { 2u, 3u }, { 3u } } };
+	auto reduction { ReduceSetCover(matrix) };
+
+	BOOST_CHECK(reduction.essentialPatterns == std::vector<size_t>({ 0u, 2u }));
+	BOOST_CHECK(reduction.corePatterns.empty());
+	BOOST_CHECK(reduction.coreFaults.empty());
+}
+
+BOOST_AUTO_TEST_CASE( ReductionKeepsMinimumCover )
+{
+	std::mt19937 random { 42u };
+	for (size_t iteration { 0u }; iteration < 200u; ++iteration)
+	{
+		const size_t patterns { 1u + random() % 10u };
+		const size_t faults { 1u + random() % 16u };
+		Detections detections(patterns);
+		for (auto& pattern : detections)
+		{
+			for (size_t fault { 0u }; fault < faults; ++fault)
+			{
+				if (random() % 4u == 0u) pattern.push_back(fault);
+			}
+		}
+
+		FaultCoverageMatrix matrix { faults, std::move(detections) };
+		auto reduction { ReduceSetCover(matrix) };
+
+		// The core problem is solved by brute force and combined with the essential patterns
+		std::vector<std::vector<FaultCoverageMatrix::index_type>> core(reduction.corePatterns.size());
+		for (size_t index { 0u }; index < reduction.corePatterns.size(); ++index)
+		{
+			for (const auto fault : reduction.coreFaults)
+			{
+				if (matrix.IsDetected(reduction.corePatterns[index], fault)) core[index].push_back(fault);
+			}
+		}
+		FaultCoverageMatrix coreMatrix { faults, std::move(core) };
+		for (const auto fault : reduction.coreFaults)
+		{
+			BOOST_CHECK(!coreMatrix.GetDetectingPatterns(fault).empty());
+		}
+
+		BOOST_CHECK_EQUAL(reduction.essentialPatterns.size() + GetMinimumCoverSize(coreMatrix), GetMinimumCoverSize(matrix));
+	}
+}
+
+BOOST_AUTO_TEST_CASE( MarginalCoverageOrder )
+{
+	// Pattern 2 detects the most faults, afterwards pattern 0 adds fault 0 and pattern 1 nothing.
+	FaultCoverageMatrix matrix { 5u, Detections { { 0u, 1u }, { 2u }, { 1u, 2u, 3u } } };
+	BOOST_CHECK(OrderByMarginalCoverage(matrix, { }) == std::vector<size_t>({ 2u, 0u, 1u }));
+
+	// A high weight of fault 0 selects pattern 0 first.
+	BOOST_CHECK(OrderByMarginalCoverage(matrix, { 10.0, 1.0, 1.0, 1.0, 1.0 }) == std::vector<size_t>({ 0u, 2u, 1u }));
+}
+
+BOOST_AUTO_TEST_CASE( MarginalCoverageMatchesEagerGreedy )
+{
+	std::mt19937 random { 42u };
+	for (size_t iteration { 0u }; iteration < 200u; ++iteration)
+	{
+		const size_t patterns { 1u + random() % 12u };
+		const size_t faults { 1u + random() % 24u };
+		Detections detections(patterns);
+		for (auto& pattern : detections)
+		{
+			for (size_t fault { 0u }; fault < faults; ++fault)
+			{
+				if (random() % 3u == 0u) pattern.push_back(fault);
+			}
+		}
+		std::vector<double> weights(faults);
+		for (auto& weight : weights) weight = static_cast<double>(1u + random() % 4u);
+
+		FaultCoverageMatrix matrix { faults, std::move(detections) };
+		const auto order { OrderByMarginalCoverage(matrix, weights) };
+
+		// The eager greedy recomputes all gains in each step
+		std::vector<size_t> expected;
+		std::vector<bool> selected(patterns, false);
+		std::vector<bool> detected(faults, false);
+		for (size_t step { 0u }; step < patterns; ++step)
+		{
+			size_t best { patterns };
+			double bestGain { -1.0 };
+			for (size_t pattern { 0u }; pattern < patterns; ++pattern)
+			{
+				if (selected[pattern]) continue;
+				double gain { 0.0 };
+				for (const auto fault : matrix.GetDetectedFaults(pattern))
+				{
+					if (!detected[fault]) gain += weights[fault];
+				}
+				if (gain > bestGain)
+				{
+					best = pattern;
+					bestGain = gain;
+				}
+			}
+
+			selected[best] = true;
+			expected.push_back(best);
+			for (const auto fault : matrix.GetDetectedFaults(best)) detected[fault] = true;
+		}
+
+		BOOST_CHECK(order == expected);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
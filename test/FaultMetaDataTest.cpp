@@ -0,0 +1,92 @@
+#define BOOST_TEST_MODULE FaultMetaData
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/FaultMetaData.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Helper/FaultStatusHelper.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+
+using namespace FreiTest::Fault;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( FaultMetaDataTest )
+
+BOOST_AUTO_TEST_CASE( TestConcurrentFaultStatusTransition )
+{
+	auto circuit = BuildOr5CircuitEnvironment();
+	SingleStuckAtFaultList faultList(GenerateStuckAtFaultList(*circuit));
+	BOOST_REQUIRE(faultList.size() > 0u);
+
+	FaultStatusApplication application;
+	for (size_t round { 0u }; round < 200u; ++round)
+	{
+		for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+		{
+			application.SetFaultStatus(faultList, faultIndex, FaultStatus::FAULT_STATUS_UNCLASSIFIED, TargetedFaultStatus::FAULT_STATUS_UNCLASSIFIED);
+		}
+		application.ResetStatistics(faultList.size());
+
+		// One thread aborts the faults while the other thread detects them.
+		// The abort keeps the fault status and has to fail after the detection.
+		std::thread abort([&]() {
+			for (size_t repetition { 0u }; repetition < 4u; ++repetition)
+			{
+				for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+				{
+					application.TrySetFaultStatus(faultList, faultIndex, FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+						FaultStatus::FAULT_STATUS_UNCLASSIFIED, TargetedFaultStatus::FAULT_STATUS_ABORTED_TIMEOUT);
+				}
+			}
+		});
+		// The results are checked on the main thread as the Boost test macros are not thread-safe
+		std::vector<bool> detected(faultList.size(), false);
+		std::thread detect([&]() {
+			for (size_t faultIndex { 0u }; faultIndex < faultList.size(); ++faultIndex)
+			{
+				detected[faultIndex] = application.TrySetFaultStatus(faultList, faultIndex, FaultStatus::FAULT_STATUS_UNCLASSIFIED,
+					FaultStatus::FAULT_STATUS_DETECTED, TargetedFaultStatus::FAULT_STATUS_TESTABLE);
+			}
+		});
+		abort.join();
+		detect.join();
+
+		BOOST_CHECK(std::all_of(detected.begin(), detected.end(), [](bool value) { return value; }));
+		for (auto [fault, metaData] : faultList)
+		{
+			const auto status { metaData->GetStatus() };
+			BOOST_CHECK(status.status == FaultStatus::FAULT_STATUS_DETECTED);
+			BOOST_CHECK(status.targetedStatus == TargetedFaultStatus::FAULT_STATUS_TESTABLE);
+		}
+	}
+
+	application.ExportStatistics(faultList);
+	std::stringstream json;
+	application.GetStatistics().PrintJsonToStream(json);
+	boost::property_tree::ptree statistics;
+	boost::property_tree::read_json(json, statistics);
+	BOOST_CHECK_EQUAL(statistics.get<size_t>("Atpg.Faults.Detected.Value"), faultList.size());
+	BOOST_CHECK_EQUAL(statistics.get<size_t>("Atpg.Faults.Timeout.Value"), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+#define BOOST_TEST_MODULE FileHandle
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
+#include "Basic/Settings.hpp"
+#include "Helper/FileHandle.hpp"
+
+using namespace FreiTest::Parallel;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+// Creates a content that spans several compression blocks of 1 MiB
+static std::string CreateContent(size_t size)
+{
+	std::string content;
+	content.reserve(size);
+	for (size_t index { 0u }; content.size() < size; ++index)
+	{
+		content += "pattern " + std::to_string(index) + ": " + std::to_string(index * 2654435761u) + "\n";
+	}
+	content.resize(size);
+	return content;
+}
+
+static void WriteContent(const std::string& filename, const std::string& content)
+{
+	FileHandle handle { filename, false };
+	handle.GetOutStream().write(content.data(), content.size());
+	BOOST_CHECK(handle.GetOutStream().good());
+}
+
+// Returns false if the stream fails before the end of the file is reached
+static bool ReadContent(const std::string& filename, std::string& content)
+{
+	content.clear();
+	try
+	{
+		FileHandle handle { filename, true };
+		auto& stream { handle.GetStream() };
+		std::vector<char> buffer(1u << 16u);
+		while (stream.read(buffer.data(), buffer.size()) || stream.gcount() > 0)
+		{
+			content.append(buffer.data(), stream.gcount());
+		}
+		return stream.eof() && !stream.bad();
+	}
+	catch (const std::exception& exception)
+	{
+		return false;
+	}
+}
+
+static std::filesystem::path GetTestDirectory(void)
+{
+	const auto directory { std::filesystem::temp_directory_path() / ("freitest-file-handle-test-" + std::to_string(::getpid())) };
+	std::filesystem::create_directories(directory);
+	return directory;
+}
+
+BOOST_AUTO_TEST_SUITE( FileHandleTest )
+
+BOOST_AUTO_TEST_CASE( TestRoundTrip )
+{
+	const auto directory { GetTestDirectory() };
+	const std::string content { CreateContent((5u << 20u) + 12345u) };
+
+	// A single thread writes one block per batch,
+	// several threads compress the blocks of a batch in parallel.
+	for (const size_t threads : { 1u, 4u })
+	{
+		SetThreads(Arena::General, threads);
+		for (const std::string extension : { ".txt", ".gz", ".zst" })
+		{
+			BOOST_TEST_CONTEXT("Threads " << threads << ", extension " << extension)
+			{
+				const std::string filename { (directory / ("content" + extension)).string() };
+				WriteContent(filename, content);
+
+				std::string result;
+				BOOST_CHECK(ReadContent(filename, result));
+				BOOST_CHECK_EQUAL(result.size(), content.size());
+				BOOST_CHECK(result == content);
+			}
+		}
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE( TestRoundTripEmptyFile )
+{
+	const auto directory { GetTestDirectory() };
+	for (const std::string extension : { ".gz", ".zst" })
+	{
+		BOOST_TEST_CONTEXT("Extension " << extension)
+		{
+			const std::string filename { (directory / ("empty" + extension)).string() };
+			WriteContent(filename, "");
+			BOOST_CHECK_GT(std::filesystem::file_size(filename), 0u);
+
+			std::string result { "not empty" };
+			BOOST_CHECK(ReadContent(filename, result));
+			BOOST_CHECK(result.empty());
+		}
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE( TestTruncatedStream )
+{
+	const auto directory { GetTestDirectory() };
+	const std::string content { CreateContent(3u << 20u) };
+
+	SetThreads(Arena::General, 4u);
+	for (const std::string extension : { ".gz", ".zst" })
+	{
+		BOOST_TEST_CONTEXT("Extension " << extension)
+		{
+			const std::string filename { (directory / ("truncated" + extension)).string() };
+			WriteContent(filename, content);
+			std::filesystem::resize_file(filename, std::filesystem::file_size(filename) / 2u);
+
+			// The truncated stream yields only the first part of the content.
+			// The boost zstd decompressor accepts the end of the file inside of a frame
+			// and therefore only the gzip decompressor reports the truncation.
+			std::string result;
+			const bool success { ReadContent(filename, result) };
+			BOOST_CHECK(extension != ".gz" || !success);
+			BOOST_CHECK_LT(result.size(), content.size());
+			BOOST_CHECK(content.compare(0u, result.size(), result) == 0);
+		}
+	}
+
+	std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,217 @@
+#define BOOST_TEST_MODULE GreedyStaticFaultCompaction
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Applications/Scale4Edge/FaultCompaction/GreedyStaticFaultCompaction.hpp"
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Simulation/FaultSimulator.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Application::Scale4Edge;
+using namespace FreiTest::Fault;
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+/**
+ * @brief Runs the merging and the simulation of the greedy compaction for the OR5 circuit.
+ */
+class CompactionApplication:
+	public GreedyStaticFaultCompaction<SingleStuckAtFaultModel, SingleStuckAtFaultList>
+{
+public:
+	CompactionApplication(size_t detectionLimit):
+		GreedyStaticFaultCompaction<SingleStuckAtFaultModel, SingleStuckAtFaultList>(),
+		faultList()
+	{
+		SetCircuit(BuildOr5CircuitEnvironment());
+		BOOST_REQUIRE(SetSetting("Scale4Edge/FaultCompaction/DetectionLimit", std::to_string(detectionLimit)));
+		faultList = SingleStuckAtFaultList(GenerateStuckAtFaultList(*circuit));
+	}
+
+	std::vector<size_t> GetDetectedFaults(const TestPattern& pattern) const
+	{
+		const FreiTest::Simulation::SimulationConfig config { FreiTest::Simulation::MakeSimulationConfig(FreiTest::Basic::MakeUnclockedSetResetFlipFlopModel()) };
+		return FreiTest::Simulation::SimulateFaults<SingleStuckAtFaultModel>(circuit->GetMappedCircuit(), pattern, faultList, OutputCapture::PrimaryOutputsOnly, config);
+	}
+
+	void Merge(std::vector<std::shared_ptr<TestPattern>>& patternList) { MergePatternList(patternList, faultList); }
+	void Simulate(std::vector<std::shared_ptr<TestPattern>>& patternList) { SimulatePatternList(patternList, faultList, InputCapture::PrimaryInputsOnly); }
+
+	SingleStuckAtFaultList faultList;
+
+};
+
+static std::vector<std::shared_ptr<TestPattern>> CreatePatternList(const std::vector<std::string>& patterns)
+{
+	std::vector<std::shared_ptr<TestPattern>> patternList;
+	for (auto const& pattern : patterns)
+	{
+		patternList.push_back(std::make_shared<TestPattern>(createTestPatternFromString(pattern)));
+	}
+	return patternList;
+}
+
+// Merges the patterns with a plain first-fit search over all merged patterns
+static std::vector<std::string> MergeReference(const std::vector<std::string>& patterns)
+{
+	std::vector<std::string> merged;
+	for (auto const& pattern : patterns)
+	{
+		bool found { false };
+		for (auto& other : merged)
+		{
+			bool compatible { true };
+			for (size_t index { 0u }; index < pattern.size(); ++index)
+			{
+				compatible &= (pattern[index] == 'X' || other[index] == 'X' || pattern[index] == other[index]);
+			}
+			if (!compatible)
+			{
+				continue;
+			}
+
+			for (size_t index { 0u }; index < pattern.size(); ++index)
+			{
+				other[index] = (other[index] == 'X') ? pattern[index] : other[index];
+			}
+			found = true;
+			break;
+		}
+		if (!found)
+		{
+			merged.push_back(pattern);
+		}
+	}
+	return merged;
+}
+
+BOOST_AUTO_TEST_SUITE( GreedyStaticFaultCompactionTest )
+
+BOOST_AUTO_TEST_CASE( TestMergeIntoFirstCompatiblePattern )
+{
+	CompactionApplication application { 1u };
+	auto patternList { CreatePatternList({ "1XXXX/", "0XXXX/", "X0XXX/", "0X1XX/", "XXX1X/" }) };
+	for (size_t faultIndex { 0u }; faultIndex < application.faultList.size(); ++faultIndex)
+	{
+		auto [fault, metaData] = application.faultList[faultIndex];
+		metaData->detectingPatternId = faultIndex % patternList.size();
+	}
+
+	// The third and the last pattern are compatible with both merged patterns
+	// and are merged into the first one. The fourth pattern conflicts with the first one.
+	application.Merge(patternList);
+	BOOST_REQUIRE_EQUAL(patternList.size(), 2u);
+	BOOST_CHECK_EQUAL(to_string(*patternList[0u]), to_string(createTestPatternFromString("10X1X/")));
+	BOOST_CHECK_EQUAL(to_string(*patternList[1u]), to_string(createTestPatternFromString("0X1XX/")));
+
+	const std::vector<size_t> mapping { 0u, 1u, 0u, 1u, 0u };
+	for (size_t faultIndex { 0u }; faultIndex < application.faultList.size(); ++faultIndex)
+	{
+		auto [fault, metaData] = application.faultList[faultIndex];
+		BOOST_CHECK_EQUAL(metaData->detectingPatternId.load(), mapping[faultIndex % mapping.size()]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( TestMergeMatchesFirstFit )
+{
+	std::mt19937 generator { 42u };
+	std::uniform_int_distribution<int> distribution { 0, 5 };
+
+	// Most positions are unspecified to get a large number of merges
+	std::vector<std::string> patterns;
+	for (size_t pattern { 0u }; pattern < 500u; ++pattern)
+	{
+		std::string value;
+		for (size_t input { 0u }; input < 5u; ++input)
+		{
+			const int random { distribution(generator) };
+			value += (random == 0) ? '0' : ((random == 1) ? '1' : 'X');
+		}
+		patterns.push_back(value + "/");
+	}
+
+	CompactionApplication application { 1u };
+	auto patternList { CreatePatternList(patterns) };
+	application.Merge(patternList);
+
+	const auto expected { MergeReference(patterns) };
+	BOOST_REQUIRE_EQUAL(patternList.size(), expected.size());
+	for (size_t index { 0u }; index < expected.size(); ++index)
+	{
+		BOOST_CHECK_EQUAL(to_string(*patternList[index]), to_string(createTestPatternFromString(expected[index])));
+	}
+}
+
+BOOST_AUTO_TEST_CASE( TestSimulationDropsFaultsInReverseOrder )
+{
+	CompactionApplication application { 1u };
+	auto patternList { CreatePatternList({ "10000/", "01000/", "10000/" }) };
+	const auto firstDetections { application.GetDetectedFaults(*patternList[1u]) };
+	const auto lastDetections { application.GetDetectedFaults(*patternList[2u]) };
+	for (auto [fault, metaData] : application.faultList)
+	{
+		metaData->SetFaultStatus(FaultStatus::FAULT_STATUS_DETECTED);
+	}
+
+	// The last pattern detects all faults of the first pattern
+	// which is therefore removed as it is simulated last.
+	const std::vector<std::shared_ptr<TestPattern>> original { patternList };
+	application.Simulate(patternList);
+	BOOST_REQUIRE_EQUAL(patternList.size(), 2u);
+	BOOST_CHECK(patternList[0u] == original[1u]);
+	BOOST_CHECK(patternList[1u] == original[2u]);
+
+	for (size_t faultIndex { 0u }; faultIndex < application.faultList.size(); ++faultIndex)
+	{
+		auto [fault, metaData] = application.faultList[faultIndex];
+		if (std::find(lastDetections.begin(), lastDetections.end(), faultIndex) != lastDetections.end())
+		{
+			BOOST_CHECK_EQUAL(metaData->detectingPatternId.load(), 1u);
+		}
+		else if (std::find(firstDetections.begin(), firstDetections.end(), faultIndex) != firstDetections.end())
+		{
+			BOOST_CHECK_EQUAL(metaData->detectingPatternId.load(), 0u);
+		}
+		else
+		{
+			BOOST_CHECK_EQUAL(metaData->detectingPatternId.load(), std::numeric_limits<size_t>::max());
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE( TestSimulationKeepsPatternsForDetectionLimit )
+{
+	CompactionApplication application { 2u };
+	auto patternList { CreatePatternList({ "10000/", "01000/", "10000/" }) };
+	for (auto [fault, metaData] : application.faultList)
+	{
+		metaData->SetFaultStatus(FaultStatus::FAULT_STATUS_DETECTED);
+	}
+
+	// The first pattern is required for the second detection of the faults of the last pattern
+	application.Simulate(patternList);
+	BOOST_CHECK_EQUAL(patternList.size(), 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Applications/Mixins/Statistics/FaultStatisticsMixin.hpp"
+#include "Basic/Fault/Lists/SingleStuckAtFaultList.hpp"
+
+/**
+ * @brief Provides the fault status transitions and statistics of an application for tests.
+ */
+class FaultStatusApplication:
+	public FreiTest::Application::Mixin::FaultStatisticsMixin<FreiTest::Fault::SingleStuckAtFaultList>
+{
+public:
+	FaultStatusApplication(void):
+		StatisticsMixin("Test"),
+		FaultStatisticsMixin("Test")
+	{
+	}
+};
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Circuit/CellLibrary.hpp"
+#include "Circuit/CircuitBuilder.hpp"
+#include "Circuit/CircuitEnvironment.hpp"
+
+// Connects the output of the source node to an input of the sink node with a new connection.
+inline void ConnectMappedNodes(FreiTest::Circuit::Builder::CircuitBuilder& builder, FreiTest::Circuit::Builder::MappedNodeId source,
+	FreiTest::Circuit::Builder::MappedNodeId sink, size_t input, const std::string& name)
+{
+	auto connectionId = builder.EmplaceConnection();
+
+	auto& sourceNode = builder.GetMappedNode(source);
+	sourceNode.SetOutputConnectionId(connectionId);
+	sourceNode.SetOutputConnectionName(name);
+	sourceNode.SetOutputPortName("out");
+	sourceNode.AddSuccessorNode(sink);
+
+	auto& sinkNode = builder.GetMappedNode(sink);
+	sinkNode.SetInputConnectionId(input, connectionId);
+	sinkNode.SetInputConnectionName(input, name);
+	sinkNode.SetInputPortName(input, "in" + std::to_string(input));
+	sinkNode.SetInputNode(input, source);
+}
+
+// Builds a circuit with one OR gate with five primary inputs and one primary output.
+// The circuit guard requires the node names from the top-level ports.
+// Therefore, all nodes are placed in a group below the top-level group.
+inline std::shared_ptr<FreiTest::Circuit::CircuitEnvironment> BuildOr5CircuitEnvironment(void)
+{
+	using namespace FreiTest::Circuit;
+
+	Builder::CircuitBuilder builder;
+	builder.SetName("or5");
+	auto topGroupId = builder.EmplaceGroup("or5");
+	auto gateGroupId = builder.EmplaceGroup("gate");
+	builder.GetGroup(topGroupId).AddGroup(gateGroupId);
+	builder.GetGroup(gateGroupId).SetParent(topGroupId);
+
+	const auto add_node = [&](std::string name, CellCategory category, CellType type, size_t inputs) {
+		auto nodeId = builder.EmplaceMappedNode(name, category, type, inputs);
+		builder.GetMappedNode(nodeId).SetGroup(gateGroupId);
+		builder.GetGroup(gateGroupId).AddMappedNode(nodeId);
+		return nodeId;
+	};
+	const auto add_port = [&](std::string name, Builder::PortType type, Builder::ConnectionId connectionId) {
+		auto& topGroup = builder.GetGroup(topGroupId);
+		auto& port = topGroup.GetPort(topGroup.EmplacePort(name, type));
+		port.SetSize({ 0u, 0u });
+		port.SetConnections({ connectionId });
+	};
+
+	auto orNodeId = add_node("or", CellCategory::MAIN_OR, CellType::OR, 5u);
+	for (size_t index = 0u; index < 5u; ++index)
+	{
+		auto inputId = add_node("input" + std::to_string(index), CellCategory::MAIN_IN, CellType::P_IN, 0u);
+		auto connectionId = builder.EmplaceConnection();
+		add_port("input" + std::to_string(index), Builder::PortType::Input, connectionId);
+
+		auto& mappedInput = builder.GetMappedNode(inputId);
+		mappedInput.SetOutputConnectionId(connectionId);
+		mappedInput.SetOutputConnectionName("input" + std::to_string(index));
+		mappedInput.SetOutputPortName("out");
+		mappedInput.AddSuccessorNode(orNodeId);
+		builder.AddMappedPrimaryInput(inputId);
+
+		auto& mappedGate = builder.GetMappedNode(orNodeId);
+		mappedGate.SetInputConnectionId(index, connectionId);
+		mappedGate.SetInputConnectionName(index, "input" + std::to_string(index));
+		mappedGate.SetInputPortName(index, "in" + std::to_string(index));
+		mappedGate.SetInputNode(index, inputId);
+	}
+
+	auto outputId = add_node("output", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	auto connectionId = builder.EmplaceConnection();
+	add_port("output", Builder::PortType::Output, connectionId);
+
+	auto& mappedOutput = builder.GetMappedNode(outputId);
+	mappedOutput.SetInputConnectionId(0u, connectionId);
+	mappedOutput.SetInputConnectionName(0u, "output");
+	mappedOutput.SetInputPortName(0u, "in");
+	mappedOutput.SetInputNode(0u, orNodeId);
+	builder.AddMappedPrimaryOutput(outputId);
+
+	auto& mappedGate = builder.GetMappedNode(orNodeId);
+	mappedGate.SetOutputConnectionId(connectionId);
+	mappedGate.SetOutputConnectionName("output");
+	mappedGate.SetOutputPortName("out");
+	mappedGate.AddSuccessorNode(outputId);
+
+	Builder::BuildConfiguration config;
+	return std::shared_ptr<CircuitEnvironment>(builder.BuildCircuitEnvironment(config));
+}
+
+// Builds a circuit with a two-bit input bus, one flip-flop and one primary output.
+// The flip-flop stores in[0] ^ q and the output is in[1] & q.
+// The ports carry their port type, which is required by the STIL export.
+inline std::shared_ptr<FreiTest::Circuit::CircuitEnvironment> BuildSequentialCircuitEnvironment(void)
+{
+	using namespace FreiTest::Circuit;
+
+	Builder::CircuitBuilder builder;
+	builder.SetName("seq");
+	auto topGroupId = builder.EmplaceGroup("seq");
+	auto logicGroupId = builder.EmplaceGroup("logic");
+	builder.GetGroup(topGroupId).AddGroup(logicGroupId);
+	builder.GetGroup(logicGroupId).SetParent(topGroupId);
+
+	const auto add_node = [&](std::string name, CellCategory category, CellType type, size_t inputs) {
+		auto nodeId = builder.EmplaceMappedNode(name, category, type, inputs);
+		builder.GetMappedNode(nodeId).SetGroup(logicGroupId);
+		builder.GetGroup(logicGroupId).AddMappedNode(nodeId);
+		return nodeId;
+	};
+	const auto add_port = [&](std::string name, Builder::PortType type, std::string portType, std::vector<Builder::ConnectionId> connections) {
+		auto sourceInfoId = builder.AddSourceInfo({});
+		builder.GetSourceInfo(sourceInfoId).AddProperty<std::string>("port-type", portType);
+		auto& topGroup = builder.GetGroup(topGroupId);
+		auto& port = topGroup.GetPort(topGroup.EmplacePort(name, type));
+		port.SetSize({ connections.size() - 1u, 0u });
+		port.SetConnections(connections);
+		port.SetSourceInfo(sourceInfoId);
+	};
+	const auto connect = [&](Builder::MappedNodeId source, Builder::MappedNodeId target, size_t input) {
+		auto& sourceNode = builder.GetMappedNode(source);
+		auto& targetNode = builder.GetMappedNode(target);
+		targetNode.SetInputNode(input, source);
+		targetNode.SetInputConnectionId(input, sourceNode.GetOutputConnectionId());
+		targetNode.SetInputConnectionName(input, sourceNode.GetOutputConnectionName());
+		targetNode.SetInputPortName(input, "in" + std::to_string(input));
+		sourceNode.AddSuccessorNode(target);
+	};
+	const auto set_output = [&](Builder::MappedNodeId nodeId, std::string name) {
+		auto connectionId = builder.EmplaceConnection();
+		auto& node = builder.GetMappedNode(nodeId);
+		node.SetOutputConnectionId(connectionId);
+		node.SetOutputConnectionName(name);
+		node.SetOutputPortName("out");
+		return connectionId;
+	};
+
+	auto input0Id = add_node("input0", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto input1Id = add_node("input1", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto stateInId = add_node("state_in", CellCategory::MAIN_IN, CellType::S_IN, 0u);
+	auto zeroId = add_node("zero", CellCategory::MAIN_CONSTANT, CellType::PRESET_0, 0u);
+	auto xorId = add_node("xor", CellCategory::MAIN_XOR, CellType::XOR, 2u);
+	auto andId = add_node("and", CellCategory::MAIN_AND, CellType::AND, 2u);
+	auto stateOutId = add_node("state_out", CellCategory::MAIN_OUT, CellType::S_OUT, 4u);
+	auto outputId = add_node("output", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+
+	auto input0Connection = set_output(input0Id, "input0");
+	auto input1Connection = set_output(input1Id, "input1");
+	auto stateConnection = set_output(stateInId, "state");
+	set_output(zeroId, "zero");
+	set_output(xorId, "next_state");
+	auto outputConnection = set_output(andId, "output");
+	set_output(stateOutId, "state_out");
+
+	connect(input0Id, xorId, 0u);
+	connect(stateInId, xorId, 1u);
+	connect(input1Id, andId, 0u);
+	connect(stateInId, andId, 1u);
+	connect(xorId, stateOutId, 0u);
+	connect(zeroId, stateOutId, 1u);
+	connect(zeroId, stateOutId, 2u);
+	connect(zeroId, stateOutId, 3u);
+	connect(andId, outputId, 0u);
+
+	builder.AddMappedPrimaryInput(input0Id);
+	builder.AddMappedPrimaryInput(input1Id);
+	builder.AddMappedPrimaryOutput(outputId);
+	builder.AddSecondaryInput(stateInId);
+	builder.AddSecondaryOutput(stateOutId);
+	builder.LinkSecondaryPorts(stateInId, stateOutId);
+
+	add_port("in", Builder::PortType::Input, "input", { input0Connection, input1Connection });
+	add_port("out", Builder::PortType::Output, "output", { outputConnection });
+	auto& logicGroup = builder.GetGroup(logicGroupId);
+	logicGroup.GetWire(logicGroup.EmplaceWire("state")).SetConnections({ stateConnection });
+
+	Builder::BuildConfiguration config;
+	return std::shared_ptr<CircuitEnvironment>(builder.BuildCircuitEnvironment(config));
+}
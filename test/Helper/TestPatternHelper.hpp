@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Basic/Logic.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+
+/**
+ * @brief Creates a test pattern with one string per timeframe.
+ *
+ * Each string contains the primary inputs and the secondary inputs separated by a slash, e.g. "01X/1U".
+ */
+template<typename... InputT>
+inline FreiTest::Pattern::TestPattern createTestPatternFromString(InputT... values)
+{
+	const std::vector<std::string> inputPatterns = { values... };
+
+	const size_t timeframes = inputPatterns.size();
+	const size_t noOfPIs = inputPatterns[0].find('/');
+	const size_t noOfSIs = inputPatterns[0].size() - noOfPIs - 1;
+
+	FreiTest::Pattern::TestPattern newPattern(timeframes, noOfPIs, noOfSIs, FreiTest::Basic::Logic::LOGIC_DONT_CARE);
+	for (size_t timeframe = 0u; timeframe < timeframes; ++timeframe)
+	{
+		for (size_t i = 0; i < noOfPIs; i++)
+		{
+			newPattern.SetPrimaryInput(timeframe, i, FreiTest::Basic::GetLogicForCharacter(inputPatterns[timeframe][i]));
+		}
+
+		for (size_t i = noOfPIs+1; i < noOfPIs+noOfSIs+1; i++)
+		{
+			newPattern.SetSecondaryInput(timeframe, i-noOfPIs-1, FreiTest::Basic::GetLogicForCharacter(inputPatterns[timeframe][i]));
+		}
+	}
+
+	return newPattern;
+}
+
+/**
+ * @brief Reads a (reference) file of the test data into a string.
+ */
+inline std::string ReadFile(const std::string& fileName)
+{
+	std::ifstream input(fileName, std::ios_base::in | std::ios_base::binary);
+	BOOST_REQUIRE(input.good());
+	std::ostringstream content;
+	content << input.rdbuf();
+	return content.str();
+}
@@ -0,0 +1,111 @@
+#define BOOST_TEST_MODULE JsoncParser
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Io/JsoncParser/JsonStreamReader.hpp"
+#include "Io/JsoncParser/JsonStreamWriter.hpp"
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( JsoncParserTest )
+
+BOOST_AUTO_TEST_CASE( TestPatternJsonStreaming )
+{
+	using ptree = boost::property_tree::ptree;
+
+	const std::vector<std::string> inputs { "X110/XX11", "0/1", "" };
+
+	// The pattern list format as written by property_tree
+	ptree patternList;
+	for (size_t index = 0u; index < inputs.size(); ++index)
+	{
+		ptree timeframe;
+		timeframe.put("index", 0u);
+		timeframe.put("primary_inputs", inputs[index]);
+		ptree timeframes;
+		timeframes.push_back(std::make_pair("", timeframe));
+
+		ptree pattern;
+		pattern.put("index", index);
+		pattern.put_child("timeframes", (index == 2u) ? ptree() : timeframes);
+		patternList.push_back(std::make_pair("", pattern));
+	}
+	ptree root;
+	root.put_child("patterns", patternList);
+	root.put("pattern_capture", "primary-inputs-only");
+	root.put("circuit.name", "top/circuit");
+
+	std::ostringstream expected;
+	boost::property_tree::write_json(expected, root);
+
+	std::ostringstream output;
+	FreiTest::Io::Json::JsonStreamWriter writer(output);
+	writer.BeginObject();
+	writer.WriteKey("patterns");
+	writer.BeginArray();
+	for (size_t index = 0u; index < inputs.size(); ++index)
+	{
+		writer.BeginObject();
+		writer.WriteMember("index", index);
+		writer.WriteKey("timeframes");
+		writer.BeginArray();
+		if (index != 2u)
+		{
+			writer.BeginObject();
+			writer.WriteMember("index", 0u);
+			writer.WriteMember("primary_inputs", inputs[index]);
+			writer.EndObject();
+		}
+		writer.EndArray();
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.WriteMember("pattern_capture", std::string("primary-inputs-only"));
+	writer.WriteKey("circuit");
+	writer.WriteTree(root.get_child("circuit"));
+	writer.EndObject();
+	writer.Finish();
+
+	BOOST_CHECK_EQUAL(output.str(), expected.str());
+
+	std::vector<std::string> imported;
+	std::istringstream input(output.str());
+	auto document = FreiTest::Io::Json::ReadJsonStreaming(input, "patterns", [&](ptree& pattern, const ptree& document) {
+		BOOST_CHECK_EQUAL(pattern.get<size_t>("index"), imported.size());
+		BOOST_CHECK(document.get_child_optional("pattern_capture") == boost::none);
+		const auto& timeframes { pattern.get_child("timeframes") };
+		imported.push_back(timeframes.empty() ? "" : timeframes.front().second.get<std::string>("primary_inputs"));
+		return true;
+	});
+
+	BOOST_REQUIRE(document.has_value());
+	BOOST_CHECK(imported == std::vector<std::string>({ "X110/XX11", "0/1", "" }));
+	BOOST_CHECK_EQUAL(document->get_child("patterns").size(), 0u);
+	BOOST_CHECK_EQUAL(document->get<std::string>("pattern_capture"), "primary-inputs-only");
+	BOOST_CHECK_EQUAL(document->get<std::string>("circuit.name"), "top/circuit");
+
+	// The handler can stop the import
+	std::istringstream stoppedInput(output.str());
+	BOOST_CHECK(!FreiTest::Io::Json::ReadJsonStreaming(stoppedInput, "patterns", [](ptree&, const ptree&) { return false; }).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
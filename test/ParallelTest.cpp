@@ -0,0 +1,81 @@
+#define BOOST_TEST_MODULE Parallel
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
+#include "Basic/Settings.hpp"
+
+using namespace FreiTest::Parallel;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+
+	// Several threads are used independent of the cores to run the parallel code paths
+	SetThreads(Arena::General, 4u);
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( ParallelTest )
+
+BOOST_AUTO_TEST_CASE( TestExecuteParallelVisitsEachIndexOnce )
+{
+	for (const auto order : { Order::Sequential, Order::Parallel })
+	{
+		std::vector<std::atomic<size_t>> visits(1000u);
+		ExecuteParallel(10u, visits.size(), Arena::General, order, [&](size_t index) {
+			visits[index]++;
+		});
+
+		// The results are checked on the main thread as the Boost test macros are not thread-safe
+		for (size_t index { 0u }; index < visits.size(); ++index)
+		{
+			BOOST_CHECK_EQUAL(visits[index].load(), (index < 10u) ? 0u : 1u);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE( TestExecuteParallelInBlocksVisitsEachIndexOnce )
+{
+	for (const auto order : { Order::Sequential, Order::Parallel })
+	{
+		std::vector<std::atomic<size_t>> visits(1000u);
+		ExecuteParallelInBlocks(0u, visits.size(), 64u, Arena::General, order, [&](size_t begin, size_t end) {
+			for (size_t index { begin }; index < end; ++index)
+			{
+				visits[index]++;
+			}
+		});
+
+		for (size_t index { 0u }; index < visits.size(); ++index)
+		{
+			BOOST_CHECK_EQUAL(visits[index].load(), 1u);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE( TestExecuteParallelRethrowsException )
+{
+	std::atomic<size_t> finished { 0u };
+	BOOST_CHECK_THROW(ExecuteParallel(0u, 1000u, Arena::General, Order::Parallel, [&](size_t index) {
+		if (index == 500u)
+		{
+			throw std::runtime_error("Failed work item");
+		}
+		finished++;
+	}), std::runtime_error);
+	BOOST_CHECK_LT(finished.load(), 1000u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
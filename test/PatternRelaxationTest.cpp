@@ -0,0 +1,118 @@
+#define BOOST_TEST_MODULE PatternRelaxation
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Logic.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Pattern/PatternFill.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Basic/Fault/Models/SingleStuckAtFaultModel.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Simulation/PatternRelaxation.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+using namespace FreiTest::Fault;
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( PatternRelaxationTest )
+
+BOOST_AUTO_TEST_CASE( TestDontCareFill )
+{
+	auto is_equal = [](const TestPattern& pattern, const TestPattern& expected) {
+		for (size_t timeframe = 0u; timeframe < expected.GetNumberOfTimeframes(); ++timeframe)
+		{
+			if (pattern.GetPrimaryInputs(timeframe) != expected.GetPrimaryInputs(timeframe)
+				|| pattern.GetSecondaryInputs(timeframe) != expected.GetSecondaryInputs(timeframe))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	TestPattern zeroFill = createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1");
+	BOOST_CHECK_EQUAL(GetNumberOfCareBits(zeroFill), 5u);
+	BOOST_CHECK_EQUAL(FillDontCareValues(zeroFill, FillMode::Zero), 11u);
+	BOOST_CHECK(is_equal(zeroFill, createTestPatternFromString("0100/0010", "0000/0001")));
+
+	TestPattern oneFill = createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1");
+	BOOST_CHECK_EQUAL(FillDontCareValues(oneFill, FillMode::One), 11u);
+	BOOST_CHECK(is_equal(oneFill, createTestPatternFromString("1110/1111", "1111/0111")));
+
+	// Leading don't cares take the first specified value, inputs without any care bit are filled with 0
+	TestPattern adjacentFill = createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1");
+	BOOST_CHECK_EQUAL(FillDontCareValues(adjacentFill, FillMode::Adjacent), 11u);
+	BOOST_CHECK(is_equal(adjacentFill, createTestPatternFromString("1110/1111", "0000/0001")));
+
+	TestPattern noneFill = createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1");
+	BOOST_CHECK_EQUAL(FillDontCareValues(noneFill, FillMode::None), 0u);
+	BOOST_CHECK(is_equal(noneFill, createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1")));
+
+	// The random fill keeps the care bits and is reproducible for the same seed
+	TestPattern randomFill1 = createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1");
+	TestPattern randomFill2 = createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1");
+	BOOST_CHECK_EQUAL(FillDontCareValues(randomFill1, FillMode::Random, 42u), 11u);
+	BOOST_CHECK_EQUAL(FillDontCareValues(randomFill2, FillMode::Random, 42u), 11u);
+	BOOST_CHECK(is_equal(randomFill1, randomFill2));
+	BOOST_CHECK_EQUAL(GetNumberOfCareBits(randomFill1), 16u);
+	BOOST_CHECK(randomFill1.IsCompatible(createTestPatternFromString("X1X0/XX1X", "XXXX/0XX1")));
+}
+
+BOOST_AUTO_TEST_CASE( TestPatternRelaxation )
+{
+	using namespace FreiTest::Simulation;
+
+	auto circuit = BuildOr5CircuitEnvironment();
+	const auto& mappedCircuit = circuit->GetMappedCircuit();
+	const SingleStuckAtFaultModel faultModel { std::make_shared<SingleStuckAtFault>(
+		MappedCircuit::NodeAndPort { mappedCircuit.GetPrimaryOutput(0u)->GetInput(0u), { FreiTest::Circuit::PortType::Output, 0u } },
+		StuckAtFaultType::STUCK_AT_0) };
+	const SimulationConfig simConfig { MakeSimulationConfig(MakeUnclockedSetResetFlipFlopModel()) };
+
+	// A single input with value 1 is enough to detect the stuck-at-0 fault at the output of the OR gate
+	TestPattern pattern = createTestPatternFromString("11111/");
+	BOOST_CHECK_EQUAL(RelaxTestPattern(mappedCircuit, pattern, faultModel, OutputCapture::PrimaryOutputsOnly, simConfig), 4u);
+	BOOST_CHECK_EQUAL(GetNumberOfCareBits(pattern), 1u);
+	BOOST_CHECK_EQUAL(to_string(pattern), to_string(createTestPatternFromString("XXXX1/")));
+
+	// Fixed inputs keep their values and the relaxation uses the remaining inputs
+	const FixedInputs fixedInputs { { false, false, false, false, true }, { } };
+	TestPattern fixedPattern = createTestPatternFromString("10101/");
+	BOOST_CHECK_EQUAL(RelaxTestPattern(mappedCircuit, fixedPattern, faultModel, OutputCapture::PrimaryOutputsOnly, simConfig, fixedInputs), 4u);
+	BOOST_CHECK_EQUAL(to_string(fixedPattern), to_string(createTestPatternFromString("XXXX1/")));
+
+	TestPattern constrainedPattern = createTestPatternFromString("10000/");
+	BOOST_CHECK_EQUAL(RelaxTestPattern(mappedCircuit, constrainedPattern, faultModel, OutputCapture::PrimaryOutputsOnly, simConfig, fixedInputs), 3u);
+	BOOST_CHECK_EQUAL(to_string(constrainedPattern), to_string(createTestPatternFromString("1XXX0/")));
+
+	// The fill skips the fixed inputs
+	TestPattern filledPattern = createTestPatternFromString("1XXXX/");
+	BOOST_CHECK_EQUAL(FillDontCareValues(filledPattern, FillMode::Zero, 0u, fixedInputs), 3u);
+	BOOST_CHECK_EQUAL(to_string(filledPattern), to_string(createTestPatternFromString("1000X/")));
+
+	// Patterns which do not detect the fault are not modified
+	TestPattern undetectingPattern = createTestPatternFromString("00000/");
+	BOOST_CHECK_EQUAL(RelaxTestPattern(mappedCircuit, undetectingPattern, faultModel, OutputCapture::PrimaryOutputsOnly, simConfig), 0u);
+	BOOST_CHECK_EQUAL(to_string(undetectingPattern), to_string(createTestPatternFromString("00000/")));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,60 @@
+#define BOOST_TEST_MODULE StilExporter
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Io/StilExporter/StilExporter.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Io;
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( StilExporterTest )
+
+BOOST_AUTO_TEST_CASE( TestStilExport )
+{
+	auto circuit = BuildSequentialCircuitEnvironment();
+
+	// More patterns than are formatted in one chunk.
+	// The reference files have been written by the exporter that formatted the patterns sequentially.
+	TestPatternList fullScanPatterns;
+	TestPatternList sequentialPatterns;
+	for (size_t index = 0u; index < 70u; ++index)
+	{
+		const auto value = [&](size_t digit) {
+			size_t code = index;
+			for (size_t step = 0u; step < digit; ++step) code /= 3u;
+			return std::string(1u, "01X"[code % 3u]);
+		};
+		fullScanPatterns.emplace_back(createTestPatternFromString(value(0u) + value(1u) + "/" + value(2u)));
+		sequentialPatterns.emplace_back(createTestPatternFromString(
+			value(0u) + value(1u) + "/0", value(2u) + value(3u) + "/X", value(1u) + value(2u) + "/X"));
+	}
+
+	std::ostringstream fullScan;
+	std::ostringstream sequential;
+	ExportStilPatterns(*circuit, fullScanPatterns, StilPatternType::FullScan, fullScan);
+	ExportStilPatterns(*circuit, sequentialPatterns, StilPatternType::Sequential, sequential);
+	BOOST_CHECK(fullScan.str() == ReadFile("test/data/stil/full_scan.stil"));
+	BOOST_CHECK(sequential.str() == ReadFile("test/data/stil/sequential.stil"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
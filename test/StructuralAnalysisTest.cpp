@@ -0,0 +1,144 @@
+#define BOOST_TEST_MODULE StructuralAnalysis
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Logic.hpp"
+#include "Basic/Settings.hpp"
+#include "Circuit/CircuitBuilder.hpp"
+#include "Circuit/StructuralAnalysis.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Circuit;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( StructuralAnalysisTest )
+
+BOOST_AUTO_TEST_CASE( TestConstantAndBlockedPaths )
+{
+	// out0 = AND(in0, CONST0), out1 = BUF(in1)
+	Builder::CircuitBuilder builder;
+	builder.SetName("structural");
+
+	auto in0 = builder.EmplaceMappedNode("in0", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto in1 = builder.EmplaceMappedNode("in1", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto tie = builder.EmplaceMappedNode("tie", CellCategory::MAIN_CONSTANT, CellType::PRESET_0, 0u);
+	auto gate = builder.EmplaceMappedNode("and", CellCategory::MAIN_AND, CellType::AND, 2u);
+	auto buffer = builder.EmplaceMappedNode("buf", CellCategory::MAIN_BUF, CellType::BUF, 1u);
+	auto out0 = builder.EmplaceMappedNode("out0", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	auto out1 = builder.EmplaceMappedNode("out1", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	builder.AddMappedPrimaryInput(in0);
+	builder.AddMappedPrimaryInput(in1);
+	builder.AddMappedPrimaryOutput(out0);
+	builder.AddMappedPrimaryOutput(out1);
+
+	ConnectMappedNodes(builder, in0, gate, 0u, "in0");
+	ConnectMappedNodes(builder, tie, gate, 1u, "tie");
+	ConnectMappedNodes(builder, gate, out0, 0u, "out0");
+	ConnectMappedNodes(builder, in1, buffer, 0u, "in1");
+	ConnectMappedNodes(builder, buffer, out1, 0u, "out1");
+
+	Builder::BuildConfiguration config;
+	auto env = builder.BuildCircuitEnvironment(config);
+	const auto& mappedCircuit { env->GetMappedCircuit() };
+
+	const MappedNode* andNode { nullptr };
+	const MappedNode* bufNode { nullptr };
+	const MappedNode* in0Node { nullptr };
+	for (auto [nodeId, node] : mappedCircuit.EnumerateNodes())
+	{
+		if (node->GetCellType() == CellType::AND)
+		{
+			andNode = node;
+		}
+		if (node->GetCellType() == CellType::BUF)
+		{
+			bufNode = node;
+		}
+		if (node->GetName() == "in0")
+		{
+			in0Node = node;
+		}
+	}
+	BOOST_REQUIRE(andNode != nullptr && bufNode != nullptr && in0Node != nullptr);
+
+	const StructuralAnalysis analysis { mappedCircuit };
+	const MappedCircuit::NodeAndPort andOutput { andNode, { PortType::Output, 0u } };
+	const MappedCircuit::NodeAndPort andInput { andNode, { PortType::Input, 0u } };
+	const MappedCircuit::NodeAndPort bufOutput { bufNode, { PortType::Output, 0u } };
+
+	BOOST_CHECK_EQUAL(analysis.GetConstantValue(andNode), Logic::LOGIC_ZERO);
+	BOOST_CHECK_EQUAL(analysis.GetConstantValue(bufNode), Logic::LOGIC_DONT_CARE);
+
+	// The AND output can't be excited to 1 but is still observable
+	BOOST_CHECK(analysis.IsObservable(andOutput));
+	BOOST_CHECK(analysis.IsStuckAtUntestable(andOutput, Logic::LOGIC_ZERO));
+	BOOST_CHECK(!analysis.IsStuckAtUntestable(andOutput, Logic::LOGIC_ONE));
+
+	// The first AND input is blocked by the constant controlling value
+	BOOST_CHECK(!analysis.IsObservable(andInput));
+	BOOST_CHECK(!analysis.IsObservable({ in0Node, { PortType::Output, 0u } }));
+	BOOST_CHECK(analysis.IsStuckAtUntestable(andInput, Logic::LOGIC_ZERO));
+	BOOST_CHECK(analysis.IsStuckAtUntestable(andInput, Logic::LOGIC_ONE));
+	BOOST_CHECK(analysis.IsTransitionUntestable(andInput));
+
+	// The buffer path is fully testable
+	BOOST_CHECK(!analysis.IsStuckAtUntestable(bufOutput, Logic::LOGIC_ZERO));
+	BOOST_CHECK(!analysis.IsStuckAtUntestable(bufOutput, Logic::LOGIC_ONE));
+	BOOST_CHECK(!analysis.IsTransitionUntestable(bufOutput));
+}
+
+BOOST_AUTO_TEST_CASE( TestObservabilityWithLoopAndInout )
+{
+	// pad = INOUT(buf0), buf0 = BUF(in0), out0 = BUF(or), or = OR(in1, loop), loop = BUF(or)
+	// The loop buffer has a larger node id than its successor or and the
+	// inout pad is the only output of the first buffer.
+	Builder::CircuitBuilder builder;
+	builder.SetName("observability");
+
+	auto in0 = builder.EmplaceMappedNode("in0", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto in1 = builder.EmplaceMappedNode("in1", CellCategory::MAIN_IN, CellType::P_IN, 0u);
+	auto buffer = builder.EmplaceMappedNode("buf0", CellCategory::MAIN_BUF, CellType::BUF, 1u);
+	auto pad = builder.EmplaceMappedNode("pad", CellCategory::MAIN_INOUT, CellType::P_INOUT, 1u);
+	auto gate = builder.EmplaceMappedNode("or", CellCategory::MAIN_OR, CellType::OR, 2u);
+	auto loop = builder.EmplaceMappedNode("loop", CellCategory::MAIN_BUF, CellType::BUF, 1u);
+	auto out0 = builder.EmplaceMappedNode("out0", CellCategory::MAIN_OUT, CellType::P_OUT, 1u);
+	builder.AddMappedPrimaryInput(in0);
+	builder.AddMappedPrimaryInput(in1);
+	builder.AddMappedPrimaryOutput(out0);
+
+	ConnectMappedNodes(builder, in0, buffer, 0u, "in0");
+	ConnectMappedNodes(builder, buffer, pad, 0u, "buf0");
+	ConnectMappedNodes(builder, in1, gate, 0u, "in1");
+	ConnectMappedNodes(builder, loop, gate, 1u, "loop");
+	ConnectMappedNodes(builder, gate, loop, 0u, "or");
+	ConnectMappedNodes(builder, gate, out0, 0u, "or");
+
+	Builder::BuildConfiguration config;
+	auto env = builder.BuildCircuitEnvironment(config);
+	const auto& mappedCircuit { env->GetMappedCircuit() };
+	const StructuralAnalysis analysis { mappedCircuit };
+
+	for (auto [nodeId, node] : mappedCircuit.EnumerateNodes())
+	{
+		// The unconnected constant of the cycle breaking is the only unobservable node
+		const bool isConstant { node->GetCellCategory() == CellCategory::MAIN_CONSTANT };
+		BOOST_CHECK_MESSAGE(analysis.IsObservable({ node, { PortType::Output, 0u } }) != isConstant, "Node " << node->GetName());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+#define BOOST_TEST_MODULE TestPatternParser
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Basic/Pattern/TestPatternList.hpp"
+#include "Io/TestPatternParser/TestPatternBinaryParser.hpp"
+#include "Io/TestPatternParser/TestPatternParser.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+BOOST_AUTO_TEST_SUITE( TestPatternParserTest )
+
+BOOST_AUTO_TEST_CASE( TestPatternBinaryExchange )
+{
+	auto circuit = BuildOr5CircuitEnvironment();
+
+	TestPatternList patterns;
+	patterns.emplace_back(createTestPatternFromString("01XU1/"));
+	patterns.emplace_back(createTestPatternFromString("11111/", "0000X/"));
+	patterns.emplace_back(createTestPatternFromString("UXUX0/", "X1X1X/", "10101/"));
+
+	std::ostringstream json;
+	std::ostringstream binary;
+	BOOST_REQUIRE(FreiTest::Io::ExportPatterns(json, { *circuit, patterns, InputCapture::PrimaryInputsOnly }, Settings::ExchangeFormat::Json));
+	BOOST_REQUIRE(FreiTest::Io::ExportPatterns(binary, { *circuit, patterns, InputCapture::PrimaryInputsOnly }, Settings::ExchangeFormat::Binary));
+	BOOST_CHECK_LT(binary.str().size(), json.str().size());
+
+	// The importer detects the format and restores the same patterns from both
+	std::istringstream jsonInput(json.str());
+	std::istringstream binaryInput(binary.str());
+	auto jsonResult = FreiTest::Io::ImportPatterns(jsonInput, *circuit);
+	auto binaryResult = FreiTest::Io::ImportPatterns(binaryInput, *circuit);
+	BOOST_REQUIRE(jsonResult.has_value());
+	BOOST_REQUIRE(binaryResult.has_value());
+	BOOST_CHECK(binaryResult->GetInputCapture() == InputCapture::PrimaryInputsOnly);
+	BOOST_REQUIRE_EQUAL(binaryResult->GetNumberOfPatterns(), patterns.size());
+	for (size_t index = 0u; index < patterns.size(); ++index)
+	{
+		BOOST_CHECK_EQUAL(to_string(*binaryResult->GetPattern(index)), to_string(*patterns[index]));
+		BOOST_CHECK_EQUAL(to_string(*binaryResult->GetPattern(index)), to_string(*jsonResult->GetPattern(index)));
+	}
+
+	// Random access to a range of patterns
+	std::istringstream rangeInput(binary.str());
+	auto rangeResult = FreiTest::Io::ImportPatternRangeBinary(rangeInput, *circuit, 1u, 3u);
+	BOOST_REQUIRE(rangeResult.has_value());
+	BOOST_REQUIRE_EQUAL(rangeResult->GetNumberOfPatterns(), 2u);
+	BOOST_CHECK_EQUAL(to_string(*rangeResult->GetPattern(0u)), to_string(*patterns[1u]));
+	BOOST_CHECK_EQUAL(to_string(*rangeResult->GetPattern(1u)), to_string(*patterns[2u]));
+
+	// Corrupt sizes are rejected before memory is allocated for them
+	const auto import_corrupted = [&](size_t offset, uint64_t value) {
+		std::string data { binary.str() };
+		std::memcpy(data.data() + offset, &value, sizeof(value));
+		std::istringstream input(data);
+		return FreiTest::Io::ImportPatterns(input, *circuit);
+	};
+	const auto read_word = [&](size_t offset) {
+		uint64_t value;
+		std::memcpy(&value, binary.str().data() + offset, sizeof(value));
+		return value;
+	};
+	const size_t guardOffset { 6u * sizeof(uint64_t) };
+	const size_t indexOffset { guardOffset + sizeof(uint64_t) + read_word(guardOffset) };
+	const size_t lastPatternOffset { read_word(indexOffset + 3u * sizeof(uint64_t)) };
+	BOOST_CHECK(!import_corrupted(guardOffset, uint64_t { 1u } << 60u).has_value());
+	BOOST_CHECK(!import_corrupted(indexOffset, uint64_t { 1u } << 60u).has_value());
+	BOOST_CHECK(!import_corrupted(lastPatternOffset, uint64_t { 1u } << 60u).has_value());
+	BOOST_CHECK(import_corrupted(lastPatternOffset, 3u).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -16,36 +16,11 @@
 #include "Circuit/CircuitBuilder.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
 #include "Circuit/UnmappedCircuit.hpp"
+#include "Helper/TestPatternHelper.hpp"
 
 using namespace FreiTest::Basic;
 using namespace FreiTest::Pattern;
 
-template<typename... InputT>
-static TestPattern createTestPatternFromString(InputT... values)
-{
-	const std::vector<std::string> inputPatterns = { values... };
-
-	const size_t timeframes = inputPatterns.size();
-	const size_t noOfPIs = inputPatterns[0].find('/');
-	const size_t noOfSIs = inputPatterns[0].size() - noOfPIs - 1;
-
-	TestPattern newPattern(timeframes, noOfPIs, noOfSIs, Logic::LOGIC_DONT_CARE);
-	for (size_t timeframe = 0u; timeframe < timeframes; ++timeframe)
-	{
-		for (size_t i = 0; i < noOfPIs; i++)
-		{
-			newPattern.SetPrimaryInput(timeframe, i, GetLogicForCharacter(inputPatterns[timeframe][i]));
-		}
-
-		for (size_t i = noOfPIs+1; i < noOfPIs+noOfSIs+1; i++)
-		{
-			newPattern.SetSecondaryInput(timeframe, i-noOfPIs-1, GetLogicForCharacter(inputPatterns[timeframe][i]));
-		}
-	}
-
-	return newPattern;
-}
-
 template<typename... InputT>
 static std::vector<TestPattern*> createPatternList(InputT... values)
 {
@@ -53,7 +28,6 @@ static std::vector<TestPattern*> createPatternList(InputT... values)
 	return inputPatterns;
 }
 
-
 int main(int argc, char* argv[], char* envp[])
 {
 	auto settings = std::make_shared<Settings>();
@@ -0,0 +1,125 @@
+#define BOOST_TEST_MODULE VcdExporter
+#define BOOST_TEST_NO_MAIN
+#define BOOST_TEST_ALTERNATIVE_INIT_API
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ctime>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Basic/Logging.hpp"
+#include "Basic/Settings.hpp"
+#include "Basic/Pattern/TestPattern.hpp"
+#include "Basic/Fault/Models/FaultFreeModel.hpp"
+#include "Io/VcdExporter/VcdExporter.hpp"
+#include "Io/VcdExporter/VcdModelBuilder.hpp"
+#include "Io/VcdExporter/VcdStreamWriter.hpp"
+#include "Simulation/CircuitSimulator.hpp"
+#include "Helper/TestCircuitHelper.hpp"
+#include "Helper/TestPatternHelper.hpp"
+
+using namespace FreiTest::Basic;
+using namespace FreiTest::Fault;
+using namespace FreiTest::Io;
+using namespace FreiTest::Pattern;
+
+int main(int argc, char* argv[], char* envp[])
+{
+	auto settings = std::make_shared<Settings>();
+	Settings::SetInstance(settings);
+
+	Logging::Initialize({ "--log-level=trace" });
+	return boost::unit_test::unit_test_main(::init_unit_test, argc, argv);
+}
+
+// Returns the values of all variables at each time step of a VCD file.
+// A dump of the changed variables has the same states as a dump of all variables.
+static std::vector<std::map<std::string, std::string>> GetVcdStates(const std::string& vcd)
+{
+	std::vector<std::map<std::string, std::string>> states;
+	std::istringstream input(vcd.substr(vcd.find("$enddefinitions $end")));
+	std::string line;
+	std::getline(input, line);
+	while (std::getline(input, line))
+	{
+		if (line.empty())
+		{
+			continue;
+		}
+
+		if (line[0] == '#')
+		{
+			states.push_back(states.empty() ? std::map<std::string, std::string> { } : states.back());
+		}
+		else if (line[0] == 'b')
+		{
+			const size_t separator = line.find(' ');
+			states.back()[line.substr(separator + 1u)] = line.substr(1u, separator - 1u);
+		}
+		else
+		{
+			states.back()[line.substr(1u)] = line.substr(0u, 1u);
+		}
+	}
+	return states;
+}
+
+BOOST_AUTO_TEST_SUITE( VcdExporterTest )
+
+BOOST_AUTO_TEST_CASE( TestVcdStreamWriter )
+{
+	auto circuit = BuildSequentialCircuitEnvironment();
+	const auto& mappedCircuit = circuit->GetMappedCircuit();
+
+	const auto simulate = [&](const TestPattern& pattern) {
+		FreiTest::Simulation::SimulationConfig simConfig { FreiTest::Simulation::MakeSimulationConfig(MakeUnclockedSetResetFlipFlopModel()) };
+		FreiTest::Simulation::SimulationResult simulation(pattern.GetNumberOfTimeframes(), mappedCircuit.GetNumberOfNodes());
+		FreiTest::Simulation::SimulateTestPatternEventDriven<FaultFreeModel>(mappedCircuit, pattern, {}, simulation, simConfig);
+		return simulation;
+	};
+
+	Vcd::VcdModelBuilder modelBuilder;
+	Vcd::VcdStreamWriter streamWriter;
+	modelBuilder.Initialize(*circuit);
+	streamWriter.Initialize(*circuit);
+
+	const std::time_t time { 1700000000 };
+	const auto write_model = [&](const FreiTest::Simulation::SimulationResult& simulation) {
+		std::ostringstream output;
+		Vcd::WriteVcd(output, modelBuilder.BuildVcdModel(simulation, *circuit, "FreiTest", 1, time));
+		return output.str();
+	};
+	const auto write_stream = [&](const FreiTest::Simulation::SimulationResult& simulation) {
+		std::ostringstream output;
+		streamWriter.WriteVcd(output, simulation, "FreiTest", 1, time);
+		return output.str();
+	};
+
+	// Both writers dump all variables in the first timeframe
+	const auto singleSimulation { simulate(createTestPatternFromString("1X/0")) };
+	BOOST_CHECK_EQUAL(write_stream(singleSimulation), write_model(singleSimulation));
+
+	// The stream writer only dumps the variables that changed in the following timeframes
+	const auto sequenceSimulation { simulate(createTestPatternFromString("10/0", "00/X", "00/X", "11/X")) };
+	const auto modelVcd { write_model(sequenceSimulation) };
+	const auto streamVcd { write_stream(sequenceSimulation) };
+	const auto definitionsEnd { modelVcd.find("$enddefinitions $end") };
+	BOOST_REQUIRE_NE(definitionsEnd, std::string::npos);
+	BOOST_CHECK_EQUAL(streamVcd.substr(0u, definitionsEnd), modelVcd.substr(0u, definitionsEnd));
+	BOOST_CHECK_LT(streamVcd.size(), modelVcd.size());
+
+	const auto modelStates { GetVcdStates(modelVcd) };
+	const auto streamStates { GetVcdStates(streamVcd) };
+	BOOST_REQUIRE_EQUAL(modelStates.size(), 5u);
+	BOOST_REQUIRE_EQUAL(streamStates.size(), modelStates.size());
+	for (size_t timeframe = 0u; timeframe < modelStates.size(); ++timeframe)
+	{
+		BOOST_CHECK(streamStates[timeframe] == modelStates[timeframe]);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
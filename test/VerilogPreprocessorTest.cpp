@@ -11,6 +11,7 @@
 #include <iostream>
 
 #include "Basic/Logging.hpp"
+#include "Basic/Parallel.hpp"
 #include "Basic/Settings.hpp"
 #include "Io/VerilogPreprocessor/VerilogPreprocessor.hpp"
 
@@ -69,4 +70,60 @@ BOOST_AUTO_TEST_CASE( TestIncludePreprocessing )
     BOOST_CHECK_EQUAL(outputStream.str(), expected_str);
 }
 
+BOOST_AUTO_TEST_CASE( TestParallelDefinePreprocessing )
+{
+    auto settings = std::make_shared<Settings>();
+    Settings::SetInstance(settings);
+
+    std::vector<std::string> fileList = {
+        "test/data/verilog/define_library.v",
+        "test/data/verilog/define_circuit.v",
+        "test/data/verilog/comments.v"
+    };
+
+    // The defines of the library have to be visible in the circuit
+    // when the files are preprocessed independently of each other.
+    std::string sequentialOutput;
+    FreiTest::Parallel::SetThreads(FreiTest::Parallel::Arena::General, 1u);
+    BOOST_TEST(VerilogPreprocessor().Transform(fileList, sequentialOutput));
+
+    std::string parallelOutput;
+    FreiTest::Parallel::SetThreads(FreiTest::Parallel::Arena::General, 4u);
+    BOOST_TEST(VerilogPreprocessor().Transform(fileList, parallelOutput));
+
+    BOOST_CHECK_EQUAL(sequentialOutput, parallelOutput);
+    BOOST_CHECK(parallelOutput.find("define_circuit_with_library") != std::string::npos);
+    BOOST_CHECK(parallelOutput.find("define_circuit_without_library") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE( TestParallelUndefPreprocessing )
+{
+    auto settings = std::make_shared<Settings>();
+    Settings::SetInstance(settings);
+
+    std::vector<std::string> fileList = {
+        "test/data/verilog/undef_library.v",
+        "test/data/verilog/define_circuit.v",
+        "test/data/verilog/comments.v"
+    };
+
+    // The symbol of the library is defined before the transformation
+    // and removed by the first file before the circuit checks it.
+    std::string sequentialOutput;
+    FreiTest::Parallel::SetThreads(FreiTest::Parallel::Arena::General, 1u);
+    VerilogPreprocessor sequentialPreprocessor;
+    sequentialPreprocessor.DefineSymbol("DEFINE_LIBRARY", "TRUE");
+    BOOST_TEST(sequentialPreprocessor.Transform(fileList, sequentialOutput));
+
+    std::string parallelOutput;
+    FreiTest::Parallel::SetThreads(FreiTest::Parallel::Arena::General, 4u);
+    VerilogPreprocessor parallelPreprocessor;
+    parallelPreprocessor.DefineSymbol("DEFINE_LIBRARY", "TRUE");
+    BOOST_TEST(parallelPreprocessor.Transform(fileList, parallelOutput));
+
+    BOOST_CHECK_EQUAL(sequentialOutput, parallelOutput);
+    BOOST_CHECK(parallelOutput.find("define_circuit_without_library") != std::string::npos);
+    BOOST_CHECK(parallelOutput.find("define_circuit_with_library") == std::string::npos);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
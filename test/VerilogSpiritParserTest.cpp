@@ -5,14 +5,18 @@
 #include <boost/config/warning_disable.hpp>
 #include <boost/test/included/unit_test.hpp>
 
+#include <filesystem>
 #include <memory>
 #include <streambuf>
 #include <string>
 #include <fstream>
 #include <iostream>
 
+#include <unistd.h>
+
 #include "Basic/Settings.hpp"
 #include "Circuit/CircuitEnvironment.hpp"
+#include "Io/VerilogLibraryCache/VerilogLibraryCache.hpp"
 #include "Io/VerilogSpiritParser/VerilogParser.hpp"
 #include "Io/VerilogPreprocessor/VerilogPreprocessor.hpp"
 
@@ -164,4 +168,77 @@ BOOST_AUTO_TEST_CASE( TestWithFlipFlop )
     );
 }
 
+BOOST_AUTO_TEST_CASE( TestLibraryCacheRoundTrip )
+{
+    auto settings = std::make_shared<Settings>();
+    Settings::SetInstance(settings);
+
+    vector<string> testFiles {
+      "test/data/verilog/basic.v",
+      "test/data/verilog/flipflop.v"
+    };
+
+    Verilog::VerilogPreprocessor preprocessor;
+    string preprocessorOutput;
+    BOOST_TEST(preprocessor.Transform(testFiles, preprocessorOutput));
+
+    Verilog::VerilogParser parser;
+    BOOST_CHECK_EQUAL(parser.Parse(preprocessorOutput), true);
+
+    const string directory { (std::filesystem::temp_directory_path() / "freitest-library-cache-test").string() };
+    const string key { Verilog::GetVerilogLibraryCacheKey(testFiles, { { "CACHE_TEST", "TRUE" } }) };
+    BOOST_CHECK(key != Verilog::GetVerilogLibraryCacheKey(testFiles, { }));
+
+    Verilog::VerilogLibraryCacheEntry entry { parser.GetModules(), { { "CACHE_TEST", "TRUE" } }, { } };
+    BOOST_REQUIRE(Verilog::ExportVerilogLibraryCache(entry, key, directory));
+
+    auto cached = Verilog::ImportVerilogLibraryCache(key, directory);
+    BOOST_REQUIRE(cached.has_value());
+    BOOST_CHECK(cached->definedSymbols == entry.definedSymbols);
+    BOOST_REQUIRE_EQUAL(cached->modules.size(), entry.modules.size());
+    for (size_t index = 0; index < entry.modules.size(); ++index)
+    {
+      BOOST_CHECK_EQUAL(cached->modules[index], entry.modules[index]);
+      BOOST_CHECK_EQUAL(cached->modules[index].libraryModule, entry.modules[index].libraryModule);
+    }
+
+    BOOST_CHECK(!Verilog::ImportVerilogLibraryCache(Verilog::GetVerilogLibraryCacheKey(testFiles, { }), directory).has_value());
+    std::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE( TestLibraryCacheIncludedFileChange )
+{
+    auto settings = std::make_shared<Settings>();
+    Settings::SetInstance(settings);
+
+    const auto directory { std::filesystem::temp_directory_path() / ("freitest-library-include-test-" + std::to_string(::getpid())) };
+    std::filesystem::create_directories(directory);
+    const string libraryFile { (directory / "library.v").string() };
+    const string includedFile { (directory / "included.v").string() };
+    const string cacheDirectory { (directory / "cache").string() };
+    std::ofstream(libraryFile) << "`include \"" << includedFile << "\"\n";
+    std::ofstream(includedFile) << "module cell(A, Z);\ninput A;\noutput Z;\nbuf g(Z, A);\nendmodule\n";
+
+    Verilog::VerilogPreprocessor preprocessor;
+    string preprocessorOutput;
+    BOOST_REQUIRE(preprocessor.Transform({ libraryFile }, preprocessorOutput));
+    BOOST_REQUIRE_EQUAL(preprocessor.GetIncludedFiles().size(), 1u);
+    BOOST_CHECK_EQUAL(preprocessor.GetIncludedFiles()[0], includedFile);
+
+    Verilog::VerilogParser parser;
+    BOOST_REQUIRE(parser.Parse(preprocessorOutput));
+
+    const string key { Verilog::GetVerilogLibraryCacheKey({ libraryFile }, { }) };
+    Verilog::VerilogLibraryCacheEntry entry { parser.GetModules(), { }, preprocessor.GetIncludedFiles() };
+    BOOST_REQUIRE(Verilog::ExportVerilogLibraryCache(entry, key, cacheDirectory));
+    BOOST_CHECK(Verilog::ImportVerilogLibraryCache(key, cacheDirectory).has_value());
+
+    // The key of the library file is unchanged, but the cache is stale
+    std::ofstream(includedFile) << "module cell(A, Z);\ninput A;\noutput Z;\nnot g(Z, A);\nendmodule\n";
+    BOOST_CHECK_EQUAL(Verilog::GetVerilogLibraryCacheKey({ libraryFile }, { }), key);
+    BOOST_CHECK(!Verilog::ImportVerilogLibraryCache(key, cacheDirectory).has_value());
+
+    std::filesystem::remove_all(directory);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,7 @@
+`ifdef DEFINE_LIBRARY
+module define_circuit_with_library();
+endmodule
+`else
+module define_circuit_without_library();
+endmodule
+`endif
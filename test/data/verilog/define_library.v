@@ -0,0 +1,5 @@
+`ifndef DEFINE_LIBRARY
+`define DEFINE_LIBRARY
+module define_library();
+endmodule
+`endif
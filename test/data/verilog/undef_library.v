@@ -0,0 +1,3 @@
+`undef DEFINE_LIBRARY
+module undef_library();
+endmodule